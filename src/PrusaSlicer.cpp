@@ -21,11 +21,16 @@
     #endif /* SLIC3R_GUI */
 #endif /* WIN32 */
 
+#include <atomic>
 #include <cstdio>
 #include <string>
 #include <cstring>
 #include <iostream>
 #include <math.h>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <tbb/task_arena.h>
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/nowide/args.hpp>
@@ -49,6 +54,7 @@
 #include "libslic3r/Model.hpp"
 #include "libslic3r/CutUtils.hpp"
 #include "libslic3r/ModelArrange.hpp"
+#include "libslic3r/Execution/GrainCalibration.hpp"
 #include "libslic3r/Platform.hpp"
 #include "libslic3r/Print.hpp"
 #include "libslic3r/SLAPrint.hpp"
@@ -115,6 +121,13 @@ int CLI::run(int argc, char **argv)
 	if (! this->setup(argc, argv))
 		return 1;
 
+    // Batch server mode: further jobs are read from the standard input and
+    // executed within this warmed up process, see run_batch_jobs().
+    if (auto it = std::find(m_actions.begin(), m_actions.end(), "batch"); it != m_actions.end()) {
+        m_actions.erase(it);
+        return this->run_batch_jobs(argv[0]);
+    }
+
     m_extra_config.apply(m_config, true);
     m_extra_config.normalize_fdm();
     
@@ -582,6 +595,8 @@ int CLI::run(int argc, char **argv)
             this->print_help(true, ptFFF);
         } else if (opt_key == "help_sla") {
             this->print_help(true, ptSLA);
+        } else if (opt_key == "calibrate_parallelism") {
+            boost::nowide::cout << execution::run_grain_calibration();
         } else if (opt_key == "save") {
             //FIXME check for mixing the FFF / SLA parameters.
             // or better save fff_print_config vs. sla_print_config
@@ -616,14 +631,11 @@ int CLI::run(int argc, char **argv)
                 boost::nowide::cerr << "error: cannot export SLA slices for a SLA configuration" << std::endl;
                 return 1;
             }
-            // Make a copy of the model if the current action is not the last action, as the model may be
-            // modified by the centering and such.
-            Model model_copy;
-            bool  make_copy = &opt_key != &m_actions.back();
-            for (Model &model_in : m_models) {
-                if (make_copy)
-                    model_copy = model_in;
-                Model &model = make_copy ? model_copy : model_in;
+            // Slices a single model in its own Print instance. Diagnostics go to the supplied streams,
+            // so that concurrent jobs may buffer their output instead of interleaving it.
+            // Returns a process exit status.
+            auto slice_model = [this, printer_technology, &bed, &arrange_cfg, user_center_specified]
+                    (Model &model, std::ostream &out, std::ostream &errout, bool verbose_progress) -> int {
                 // If all objects have defined instances, their relative positions will be
                 // honored when printing (they will be only centered, unless --dont-arrange
                 // is supplied); if any object has no instances, it will get a default one
@@ -631,12 +643,13 @@ int CLI::run(int argc, char **argv)
                 std::string outfile = m_config.opt_string("output");
                 Print       fff_print;
                 SLAPrint    sla_print;
-                sla_print.set_status_callback(
-                            [](const PrintBase::SlicingStatus& s)
-                {
-                    if(s.percent >= 0) // FIXME: is this sufficient?
-                        printf("%3d%s %s\n", s.percent, "% =>", s.text.c_str());
-                });
+                if (verbose_progress)
+                    sla_print.set_status_callback(
+                                [](const PrintBase::SlicingStatus& s)
+                    {
+                        if(s.percent >= 0) // FIXME: is this sufficient?
+                            printf("%3d%s %s\n", s.percent, "% =>", s.text.c_str());
+                    });
 
                 PrintBase  *print = (printer_technology == ptFFF) ? static_cast<PrintBase*>(&fff_print) : static_cast<PrintBase*>(&sla_print);
                 if (! m_config.opt_bool("dont_arrange")) {
@@ -653,11 +666,11 @@ int CLI::run(int argc, char **argv)
                 print->apply(model, m_print_config);
                 std::string err = print->validate();
                 if (! err.empty()) {
-                    boost::nowide::cerr << err << std::endl;
+                    errout << err << std::endl;
                     return 1;
                 }
                 if (print->empty())
-                    boost::nowide::cout << "Nothing to print for " << outfile << " . Either the print is empty or no object is fully inside the print volume." << std::endl;
+                    out << "Nothing to print for " << outfile << " . Either the print is empty or no object is fully inside the print volume." << std::endl;
                 else
                     try {
                         std::string outfile_final;
@@ -674,18 +687,78 @@ int CLI::run(int argc, char **argv)
                         }
                         if (outfile != outfile_final) {
                             if (Slic3r::rename_file(outfile, outfile_final)) {
-                                boost::nowide::cerr << "Renaming file " << outfile << " to " << outfile_final << " failed" << std::endl;
+                                errout << "Renaming file " << outfile << " to " << outfile_final << " failed" << std::endl;
                                 return 1;
                             }
                             outfile = outfile_final;
                         }
                         // Run the post-processing scripts if defined.
                         run_post_process_scripts(outfile, fff_print.full_print_config());
-                        boost::nowide::cout << "Slicing result exported to " << outfile << std::endl;
+                        out << "Slicing result exported to " << outfile << std::endl;
                     } catch (const std::exception &ex) {
-                        boost::nowide::cerr << ex.what() << std::endl;
+                        errout << ex.what() << std::endl;
                         return 1;
                     }
+                return 0;
+            };
+            // Make a copy of the model if the current action is not the last action, as the model may be
+            // modified by the centering and such.
+            bool make_copy = &opt_key != &m_actions.back();
+            int  jobs      = 1;
+            if (const ConfigOptionInt *opt_jobs = m_config.opt<ConfigOptionInt>("jobs"); opt_jobs != nullptr)
+                jobs = std::max(1, opt_jobs->value);
+            jobs = std::min(jobs, int(m_models.size()));
+            if (jobs <= 1) {
+                Model model_copy;
+                for (Model &model_in : m_models) {
+                    if (make_copy)
+                        model_copy = model_in;
+                    Model &model = make_copy ? model_copy : model_in;
+                    if (int status = slice_model(model, boost::nowide::cout, boost::nowide::cerr, true); status != 0)
+                        return status;
+                }
+            } else {
+                // Slice independent input files concurrently. Each worker executes its jobs inside
+                // a private TBB arena sized to a proportional share of the hardware threads,
+                // buffers the diagnostic output of a job and flushes it in one piece once the job
+                // finished. Unlike the sequential mode, all jobs are run even if some of them fail;
+                // the process exit status then reflects the first failure.
+                const int           arena_threads = std::max(1, tbb::this_task_arena::max_concurrency() / jobs);
+                std::atomic<size_t> next_model { 0 };
+                std::atomic<int>    batch_status { 0 };
+                std::mutex          io_mutex;
+                std::vector<std::thread> workers;
+                workers.reserve(jobs);
+                for (int worker_id = 0; worker_id < jobs; ++ worker_id)
+                    workers.emplace_back([&, worker_id]() {
+                        set_current_thread_name("slic3r_job_" + std::to_string(worker_id));
+                        tbb::task_arena arena(arena_threads);
+                        for (size_t idx; (idx = next_model.fetch_add(1)) < m_models.size(); ) {
+                            Model &model_in = m_models[idx];
+                            Model  model_copy;
+                            if (make_copy)
+                                model_copy = model_in;
+                            Model &model = make_copy ? model_copy : model_in;
+                            std::ostringstream out;
+                            std::ostringstream errout;
+                            int status = 1;
+                            try {
+                                arena.execute([&]() { status = slice_model(model, out, errout, false); });
+                            } catch (const std::exception &ex) {
+                                errout << ex.what() << std::endl;
+                            }
+                            if (status != 0)
+                                batch_status.store(status);
+                            std::lock_guard<std::mutex> lock(io_mutex);
+                            boost::nowide::cout << out.str();
+                            boost::nowide::cerr << errout.str();
+                        }
+                    });
+                for (std::thread &worker : workers)
+                    worker.join();
+                if (int status = batch_status.load(); status != 0)
+                    return status;
+            }
 /*
                 print.center = ! m_config.has("center")
                     && ! m_config.has("align_xy")
@@ -716,7 +789,6 @@ int CLI::run(int argc, char **argv)
                     << "Filament required: " << print.total_used_filament() << "mm"
                     << " (" << print.total_extruded_volume()/1000 << "cm3)" << std::endl;
 */
-            }
         } else {
             boost::nowide::cerr << "error: option not supported yet: " << opt_key << std::endl;
             return 1;
@@ -864,6 +936,18 @@ bool CLI::setup(int argc, char **argv)
             thread_count = opt_threads->value;
     }
 
+    {
+        const ConfigOptionInt *opt_numa_node = m_config.opt<ConfigOptionInt>("numa_node");
+        if (opt_numa_node != nullptr)
+            numa_node = opt_numa_node->value;
+    }
+
+    {
+        const ConfigOptionInt *opt_memory_budget = m_config.opt<ConfigOptionInt>("memory_budget");
+        if (opt_memory_budget != nullptr)
+            memory_budget = opt_memory_budget->value;
+    }
+
     //FIXME Validating at this stage most likely does not make sense, as the config is not fully initialized yet.
     std::string validity = m_config.validate();
 
@@ -1101,6 +1185,82 @@ bool CLI::check_and_load_input_profiles(PrinterTechnology& printer_technology)
     return true;
 }
 
+// Batch server mode ("--batch" or "--daemon"): instead of paying the full
+// process startup (binary load, config definition construction, worker thread
+// pool spin up, warmed caches such as the mesh import cache) for every job of
+// a farm batch, one process reads further command lines from the standard
+// input and executes each with a fresh CLI instance. One job per line,
+// arguments separated by whitespace, double quotes group arguments containing
+// spaces. Empty lines and lines starting with '#' are skipped. After each job
+// a status line "job <number> exit <status>" is written to the standard
+// output as an acknowledgement, the exit status of the server process is that
+// of the first failed job, if any. A local socket front end (socat, systemd
+// socket activation) can feed the standard input to get a daemon.
+int CLI::run_batch_jobs(const char *argv0)
+{
+    int         ret    = 0;
+    size_t      job_id = 0;
+    std::string line;
+
+    while (std::getline(boost::nowide::cin, line)) {
+        if (size_t start = line.find_first_not_of(" \t\r");
+            start == std::string::npos || line[start] == '#')
+            continue;
+
+        // Split the line into arguments.
+        std::vector<std::string> args;
+        args.emplace_back(argv0);
+        {
+            std::string token;
+            bool        in_quotes = false;
+            bool        has_token = false;
+            for (char c : line) {
+                if (c == '"') {
+                    in_quotes = ! in_quotes;
+                    has_token = true;
+                } else if (! in_quotes && (c == ' ' || c == '\t' || c == '\r')) {
+                    if (has_token) {
+                        args.emplace_back(std::move(token));
+                        token.clear();
+                        has_token = false;
+                    }
+                } else {
+                    token += c;
+                    has_token = true;
+                }
+            }
+            if (has_token)
+                args.emplace_back(std::move(token));
+        }
+
+        ++ job_id;
+
+        int status = 1;
+        if (std::find_if(args.begin() + 1, args.end(), [](const std::string &arg) {
+                return arg == "--batch" || arg == "--daemon";
+            }) != args.end()) {
+            // The standard input carries the job stream, a nested server would starve it.
+            boost::nowide::cerr << "Batch jobs must not request the batch server mode themselves." << std::endl;
+        } else {
+            std::vector<char *> argv_ptrs;
+            argv_ptrs.reserve(args.size());
+            for (std::string &arg : args)
+                argv_ptrs.emplace_back(arg.data());
+            try {
+                status = CLI().run(int(argv_ptrs.size()), argv_ptrs.data());
+            } catch (const std::exception &ex) {
+                boost::nowide::cerr << ex.what() << std::endl;
+            }
+        }
+
+        boost::nowide::cout << "job " << job_id << " exit " << status << std::endl;
+        if (status != 0 && ret == 0)
+            ret = status;
+    }
+
+    return ret;
+}
+
 // __has_feature() is used later for Clang, this is for compatibility with other compilers (such as GCC and MSVC)
 #ifndef __has_feature
 #   define __has_feature(x) 0
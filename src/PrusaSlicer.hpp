@@ -32,7 +32,10 @@ private:
     std::vector<Model>          m_models;
 
     bool setup(int argc, char **argv);
-    
+
+    /// Batch server mode: executes jobs read from the standard input.
+    int run_batch_jobs(const char *argv0);
+
     /// Prints usage of the CLI.
     void print_help(bool include_print_options = false, PrinterTechnology printer_technology = ptAny) const;
     
@@ -263,23 +263,31 @@ inline void its_translate(indexed_triangle_set &its, const V v)
     v_dst += v;
 }
 
+// Map the contiguous vertex buffer as a single 3xN matrix, so the transforms
+// below run through Eigen's batched kernels instead of per-vertex scalar code.
+inline auto its_mapped_vertices(indexed_triangle_set &its)
+{
+	return Eigen::Map<Eigen::Matrix<float, 3, Eigen::Dynamic>>(
+		its.vertices.front().data(), 3, its.vertices.size());
+}
+
 template<typename T>
 inline void its_transform(indexed_triangle_set &its, T *trafo3x4)
 {
-	for (stl_vertex &v_dst : its.vertices) {
-		stl_vertex  v_src = v_dst;
-		v_dst(0) = T(trafo3x4[0] * v_src(0) + trafo3x4[1] * v_src(1) + trafo3x4[2]  * v_src(2) + trafo3x4[3]);
-		v_dst(1) = T(trafo3x4[4] * v_src(0) + trafo3x4[5] * v_src(1) + trafo3x4[6]  * v_src(2) + trafo3x4[7]);
-		v_dst(2) = T(trafo3x4[8] * v_src(0) + trafo3x4[9] * v_src(1) + trafo3x4[10] * v_src(2) + trafo3x4[11]);
-	}
+	if (its.vertices.empty())
+		return;
+	Eigen::Map<const Eigen::Matrix<T, 3, 4, Eigen::RowMajor>> m(trafo3x4);
+	auto map = its_mapped_vertices(its);
+	map = ((m.template leftCols<3>() * map.template cast<T>()).colwise() + m.col(3)).template cast<float>();
 }
 
 template<typename T>
 inline void its_transform(indexed_triangle_set &its, const Eigen::Transform<T, 3, Eigen::Affine, Eigen::DontAlign>& t, bool fix_left_handed = false)
 {
-	//const Eigen::Matrix<double, 3, 3, Eigen::DontAlign> r = t.matrix().template block<3, 3>(0, 0);
-	for (stl_vertex &v : its.vertices)
-		v = (t * v.template cast<T>()).template cast<float>().eval();
+	if (! its.vertices.empty()) {
+		auto map = its_mapped_vertices(its);
+		map = ((t.linear() * map.template cast<T>()).colwise() + t.translation()).template cast<float>();
+	}
   if (fix_left_handed && t.matrix().block(0, 0, 3, 3).determinant() < 0.)
     for (stl_triangle_vertex_indices &i : its.indices)
       std::swap(i[0], i[1]);
@@ -288,8 +296,10 @@ inline void its_transform(indexed_triangle_set &its, const Eigen::Transform<T, 3
 template<typename T>
 inline void its_transform(indexed_triangle_set &its, const Eigen::Matrix<T, 3, 3, Eigen::DontAlign>& m, bool fix_left_handed = false)
 {
-  for (stl_vertex &v : its.vertices)
-		v = (m * v.template cast<T>()).template cast<float>().eval();
+	if (! its.vertices.empty()) {
+		auto map = its_mapped_vertices(its);
+		map = (m * map.template cast<T>()).template cast<float>();
+	}
   if (fix_left_handed && m.determinant() < 0.)
     for (stl_triangle_vertex_indices &i : its.indices)
       std::swap(i[0], i[1]);
@@ -26,6 +26,8 @@
 #include <math.h>
 #include <assert.h>
 
+#include <vector>
+
 #include <boost/log/trivial.hpp>
 #include <boost/nowide/cstdio.hpp>
 #include <boost/predef/other/endian.h>
@@ -147,24 +149,42 @@ static FILE* stl_open_count_facets(stl_file *stl, const char *file)
    time running this for the stl and therefore we should reset our max and min stats. */
 static bool stl_read(stl_file *stl, FILE *fp, int first_facet, bool first)
 {
-	if (stl->stats.type == binary)
+	if (stl->stats.type == binary) {
     	fseek(fp, HEADER_SIZE, SEEK_SET);
-  	else
-    	rewind(fp);
+
+		// Read the whole facet payload with a single call instead of one
+		// fread() per 50 byte facet, the per-call overhead dominates the
+		// import of large binary files otherwise. The in-memory stl_facet
+		// is padded, thus the facets are unpacked with a memcpy each.
+		std::vector<char> buffer(size_t(stl->stats.number_of_facets - first_facet) * SIZEOF_STL_FACET);
+		if (fread(buffer.data(), 1, buffer.size(), fp) != buffer.size())
+			return false;
+
+		const char *ptr = buffer.data();
+		for (uint32_t i = first_facet; i < stl->stats.number_of_facets; ++ i, ptr += SIZEOF_STL_FACET) {
+			stl_facet facet;
+			memcpy(&facet, ptr, SIZEOF_STL_FACET);
+#if BOOST_ENDIAN_BIG_BYTE
+			// Convert the loaded little endian data to big endian.
+			stl_internal_reverse_quads((char*)&facet, 48);
+#endif /* BOOST_ENDIAN_BIG_BYTE */
+			// Write the facet into memory.
+			stl->facet_start[i] = facet;
+			stl_facet_stats(stl, facet, first);
+		}
+
+		stl->stats.size = stl->stats.max - stl->stats.min;
+		stl->stats.bounding_diameter = stl->stats.size.norm();
+		return true;
+	}
+
+    rewind(fp);
 
   	char normal_buf[3][32];
   	for (uint32_t i = first_facet; i < stl->stats.number_of_facets; ++ i) {
   	  	stl_facet facet;
 
-    	if (stl->stats.type == binary) {
-      		// Read a single facet from a binary .STL file. We assume little-endian architecture!
-      		if (fread(&facet, 1, SIZEOF_STL_FACET, fp) != SIZEOF_STL_FACET)
-      			return false;
-#if BOOST_ENDIAN_BIG_BYTE
-      		// Convert the loaded little endian data to big endian.
-      		stl_internal_reverse_quads((char*)&facet, 48);
-#endif /* BOOST_ENDIAN_BIG_BYTE */
-    	} else {
+    	{
 			// Read a single facet from an ASCII .STL file
 			// skip solid/endsolid
 			// (in this order, otherwise it won't work when they are paired in the middle of a file)
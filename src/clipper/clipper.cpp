@@ -64,6 +64,8 @@ static double const pi = 3.141592653589793238;
 static double const two_pi = pi *2;
 static double const def_arc_tolerance = 0.25;
 
+void (*progress_callback)() = nullptr;
+
 enum Direction { dRightToLeft, dLeftToRight };
 
 static int const Unassigned = -1;  //edge not currently 'owning' a solution
@@ -1108,7 +1110,11 @@ bool Clipper::ExecuteInternal()
     if (m_MinimaList.empty()) return true;
     cInt botY = m_Scanbeam.top();
     do { m_Scanbeam.pop(); } while (! m_Scanbeam.empty() && botY == m_Scanbeam.top());
+    size_t num_scanbeams = 0;
     do {
+      //periodic cooperative cancellation checkpoint, cheap enough to not show up in profiles
+      if (progress_callback != nullptr && (++ num_scanbeams & 0x3F) == 0)
+        progress_callback();
       InsertLocalMinimaIntoAEL(botY);
       ProcessHorizontals();
 	    m_GhostJoins.clear();
@@ -1121,10 +1127,19 @@ bool Clipper::ExecuteInternal()
       botY = topY;
     } while (!m_Scanbeam.empty() || !m_MinimaList.empty());
   }
-  catch(...) 
+  catch(const clipperException&)
   {
     succeeded = false;
   }
+  catch(...)
+  {
+    //raised from progress_callback (cancellation) or the allocator; clean up what the
+    //callers of ExecuteInternal() would have disposed of and let the exception propagate
+    m_Joins.clear();
+    m_GhostJoins.clear();
+    DisposeAllOutRecs();
+    throw;
+  }
 
   if (succeeded)
   {
@@ -314,6 +314,14 @@ enum EdgeSide { esLeft = 1, esRight = 2};
 
 //------------------------------------------------------------------------------
 
+//Optional cooperative cancellation hook. When set, it is called periodically from the
+//scanbeam loop of Clipper::Execute(). The callback may throw to abort a long clipping
+//operation; the exception propagates out of Execute() after the internal state has been
+//disposed of. nullptr (the default) disables the hook.
+extern void (*progress_callback)();
+
+//------------------------------------------------------------------------------
+
 //ClipperBase is the ancestor to the Clipper class. It should not be
 //instantiated directly. This class simply abstracts the conversion of sets of
 //polygon coordinates into edge objects that are stored in a LocalMinima list.
@@ -80,7 +80,7 @@ AABBMesh::AABBMesh(const indexed_triangle_set &tmesh, bool calculate_epsilon)
     : m_tm(&tmesh)
     , m_aabb(new AABBImpl())
     , m_vfidx{tmesh}
-    , m_fnidx{its_face_neighbors(tmesh)}
+    , m_fnidx{std::make_shared<const std::vector<Vec3i>>(its_face_neighbors(tmesh))}
 {
     init(tmesh, calculate_epsilon);
 }
@@ -89,7 +89,7 @@ AABBMesh::AABBMesh(const TriangleMesh &mesh, bool calculate_epsilon)
     : m_tm(&mesh.its)
     , m_aabb(new AABBImpl())
     , m_vfidx{mesh.its}
-    , m_fnidx{its_face_neighbors(mesh.its)}
+    , m_fnidx{mesh.face_neighbors()}
 {
     init(mesh, calculate_epsilon);
 }
@@ -35,7 +35,8 @@ class AABBMesh {
 
     std::unique_ptr<AABBImpl> m_aabb;
     VertexFaceIndex m_vfidx;    // vertex-face index
-    std::vector<Vec3i> m_fnidx; // face-neighbor index
+    // face-neighbor index, shared with the TriangleMesh the AABBMesh was built from
+    std::shared_ptr<const std::vector<Vec3i>> m_fnidx;
 
 #ifdef SLIC3R_HOLE_RAYCASTER
     // This holds a copy of holes in the mesh. Initialized externally
@@ -137,7 +138,7 @@ public:
     const indexed_triangle_set * get_triangle_mesh() const { return m_tm; }
 
     const VertexFaceIndex &vertex_face_index() const { return m_vfidx; }
-    const std::vector<Vec3i> &face_neighbor_index() const { return m_fnidx; }
+    const std::vector<Vec3i> &face_neighbor_index() const { return *m_fnidx; }
 };
 
 
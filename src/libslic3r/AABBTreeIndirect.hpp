@@ -309,6 +309,48 @@ namespace detail {
         return tmin < t1 && tmax > t0;
 	}
 
+	// Variant of the slab test above, additionally reporting the entry distance of the ray into the box.
+	// The entry distance orders the child nodes during the first hit traversal.
+	template <typename Derivedsource, typename Deriveddir, typename Scalar>
+	inline bool ray_box_intersect_invdir(
+  		const Eigen::MatrixBase<Derivedsource> 	&origin,
+  		const Eigen::MatrixBase<Deriveddir> 	&inv_dir,
+  		Eigen::AlignedBox<Scalar,3> 			 box,
+  		const Scalar 							&t0,
+  		const Scalar 							&t1,
+  		Scalar 									&t_entry) {
+		if (inv_dir.x() < 0)
+			std::swap(box.min().x(), box.max().x());
+		if (inv_dir.y() < 0)
+			std::swap(box.min().y(), box.max().y());
+        Scalar tmin = (box.min().x() - origin.x()) * inv_dir.x();
+		Scalar tymax = (box.max().y() - origin.y()) * inv_dir.y();
+		if (tmin > tymax)
+			return false;
+        Scalar tmax = (box.max().x() - origin.x()) * inv_dir.x();
+		Scalar tymin = (box.min().y()  - origin.y()) * inv_dir.y();
+		if (tymin > tmax)
+			return false;
+		if (tymin > tmin)
+			tmin = tymin;
+		if (tymax < tmax)
+			tmax = tymax;
+		if (inv_dir.z() < 0)
+			std::swap(box.min().z(), box.max().z());
+		Scalar tzmin = (box.min().z()  - origin.z()) * inv_dir.z();
+		if (tzmin > tmax)
+			return false;
+		Scalar tzmax = (box.max().z() - origin.z()) * inv_dir.z();
+		if (tmin > tzmax)
+			return false;
+		if (tzmin > tmin)
+			tmin = tzmin;
+		if (tzmax < tmax)
+			tmax = tzmax;
+		t_entry = tmin;
+        return tmin < t1 && tmax > t0;
+	}
+
 	// The following intersect_triangle() is derived from raytri.c routine intersect_triangle1()
 	// Ray-Triangle Intersection Test Routines
 	// Different optimizations of my and Ben Trumbore's
@@ -396,51 +438,82 @@ namespace detail {
 		return eps;
 	}
 
+    // Iterative first hit traversal with an explicit stack, visiting the children ordered by the entry
+    // distance of the ray into their bounding boxes. Visiting the nearer child first shrinks min_t early,
+    // which then culls most of the farther subtrees that the naive depth first traversal would descend into.
     template<typename RayIntersectorType, typename Scalar>
-	static inline bool intersect_ray_recursive_first_hit(
+	static inline bool intersect_ray_first_hit_ordered(
         RayIntersectorType 	   &ray_intersector,
-        size_t 				    node_idx,
         Scalar                  min_t,
         igl::Hit 			   &hit)
 	{
-        const auto &node = ray_intersector.tree.node(node_idx);
-        assert(node.is_valid());
-		
-        if (! ray_box_intersect_invdir(ray_intersector.origin, ray_intersector.invdir, node.bbox.template cast<Scalar>(), Scalar(0), min_t))
-			return false;
+        struct StackEntry {
+            size_t node_idx;
+            // Entry distance of the ray into the bounding box of the node.
+            Scalar t_entry;
+        };
+        // The tree is stored as an implicit balanced binary tree, thus its depth is bounded
+        // by the number of bits of the node index and the stack cannot grow by more than one
+        // entry per level descended.
+        StackEntry stack[128];
+        size_t     stack_size = 0;
+        bool       found      = false;
+
+        {
+            Scalar t_entry;
+            if (! ray_box_intersect_invdir(ray_intersector.origin, ray_intersector.invdir,
+                    ray_intersector.tree.node(0).bbox.template cast<Scalar>(), Scalar(0), min_t, t_entry))
+                return false;
+            stack[stack_size ++] = { 0, t_entry };
+        }
 
-	  	if (node.is_leaf()) {
-		    // shoot ray, record hit
-            auto   face = ray_intersector.faces[node.idx];
-		    double t, u, v;
-		    if (intersect_triangle(
-		    		ray_intersector.origin, ray_intersector.dir, 
-		    		ray_intersector.vertices[face(0)], ray_intersector.vertices[face(1)], ray_intersector.vertices[face(2)], 
-                    t, u, v, ray_intersector.eps)
-		    	&& t > 0.) {
-                hit = igl::Hit { int(node.idx), -1, float(u), float(v), float(t) };
-				return true;
-		    } else
-		    	return false;
-	  	} else {
-			// Left / right child node index.
-			size_t left  = node_idx * 2 + 1;
-			size_t right = left + 1;
-			igl::Hit left_hit;
-			igl::Hit right_hit;
-	        bool left_ret = intersect_ray_recursive_first_hit(ray_intersector, left,  min_t, left_hit);
-			if (left_ret && left_hit.t < min_t) {
-	    		min_t = left_hit.t;
-	    		hit   = left_hit;
-	  		} else
-			    left_ret = false;
-	        bool right_ret = intersect_ray_recursive_first_hit(ray_intersector, right, min_t, right_hit);
-			if (right_ret && right_hit.t < min_t)
-				hit = right_hit;
-			else
-				right_ret = false;
-			return left_ret || right_ret;
-		}
+        while (stack_size > 0) {
+            StackEntry entry = stack[-- stack_size];
+            if (entry.t_entry >= min_t)
+                // A closer hit was found since this node was pushed onto the stack.
+                continue;
+            const auto &node = ray_intersector.tree.node(entry.node_idx);
+            assert(node.is_valid());
+            if (node.is_leaf()) {
+                // shoot ray, record hit
+                auto   face = ray_intersector.faces[node.idx];
+                double t, u, v;
+                if (intersect_triangle(
+                        ray_intersector.origin, ray_intersector.dir,
+                        ray_intersector.vertices[face(0)], ray_intersector.vertices[face(1)], ray_intersector.vertices[face(2)],
+                        t, u, v, ray_intersector.eps)
+                    && t > 0. && Scalar(t) < min_t) {
+                    min_t = Scalar(t);
+                    hit   = igl::Hit { int(node.idx), -1, float(u), float(v), float(t) };
+                    found = true;
+                }
+            } else {
+                // Left / right child node index.
+                size_t left    = entry.node_idx * 2 + 1;
+                size_t right   = left + 1;
+                Scalar t_left  = 0;
+                Scalar t_right = 0;
+                bool   hit_left  = ray_box_intersect_invdir(ray_intersector.origin, ray_intersector.invdir,
+                    ray_intersector.tree.node(left).bbox.template cast<Scalar>(), Scalar(0), min_t, t_left);
+                bool   hit_right = ray_box_intersect_invdir(ray_intersector.origin, ray_intersector.invdir,
+                    ray_intersector.tree.node(right).bbox.template cast<Scalar>(), Scalar(0), min_t, t_right);
+                // Push the farther child first, so that the nearer child is processed next.
+                if (hit_left && hit_right) {
+                    if (t_left < t_right) {
+                        stack[stack_size ++] = { right, t_right };
+                        stack[stack_size ++] = { left,  t_left };
+                    } else {
+                        stack[stack_size ++] = { left,  t_left };
+                        stack[stack_size ++] = { right, t_right };
+                    }
+                } else if (hit_left)
+                    stack[stack_size ++] = { left,  t_left };
+                else if (hit_right)
+                    stack[stack_size ++] = { right, t_right };
+                assert(stack_size <= sizeof(stack) / sizeof(stack[0]));
+            }
+        }
+        return found;
 	}
 
     template<typename RayIntersectorType>
@@ -746,8 +819,8 @@ inline bool intersect_ray_first_hit(
         origin, dir, VectorType(dir.cwiseInverse()),
         eps
 	};
-	return ! tree.empty() && detail::intersect_ray_recursive_first_hit(
-        ray_intersector, size_t(0), std::numeric_limits<Scalar>::infinity(), hit);
+	return ! tree.empty() && detail::intersect_ray_first_hit_ordered(
+        ray_intersector, std::numeric_limits<Scalar>::infinity(), hit);
 }
 
 // Find all intersections of a ray with indexed triangle set.
@@ -505,6 +505,16 @@ void AppConfig::save()
     // To cope with that, we already made a backup of the config on Windows.
     rename_file(path_pid, path);
     m_dirty = false;
+    m_last_save_time = std::chrono::steady_clock::now();
+}
+
+void AppConfig::save_if_dirty_debounced()
+{
+    // Window moves and recent-file updates dirty the config many times a second;
+    // one save per interval is plenty for state that is only read back on startup.
+    constexpr auto debounce_interval = std::chrono::seconds(1);
+    if (m_dirty && std::chrono::steady_clock::now() - m_last_save_time >= debounce_interval)
+        this->save();
 }
 
 bool AppConfig::erase(const std::string &section, const std::string &key)
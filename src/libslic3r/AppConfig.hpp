@@ -5,6 +5,7 @@
 #ifndef slic3r_AppConfig_hpp_
 #define slic3r_AppConfig_hpp_
 
+#include <chrono>
 #include <set>
 #include <map>
 #include <string>
@@ -43,6 +44,11 @@ public:
 	std::string         load(const std::string &path);
 	// Store the slic3r.ini into a user profile directory (or a datadir, if configured).
 	void 			   	save();
+	// Save the config if it is dirty and the last save is older than the debounce
+	// interval. Meant for periodic flushing (e.g. from an idle handler), where
+	// frequent small changes like window moves would otherwise rewrite the ini
+	// on every call. Use save() directly when the config has to hit the disk now.
+	void 			   	save_if_dirty_debounced();
 
 	// Does this config need to be saved?
 	bool 				dirty() const { return m_dirty; }
@@ -199,6 +205,8 @@ private:
 	VendorMap                                                   m_vendors;
 	// Has any value been modified since the config.ini has been last saved or loaded?
 	bool														m_dirty;
+	// When the config was last written to disk, used by save_if_dirty_debounced().
+	std::chrono::steady_clock::time_point						m_last_save_time;
 	// Original version found in the ini file before it was overwritten
 	Semver                                                      m_orig_version;
 	// Whether the existing version is before system profiles & configuration updating
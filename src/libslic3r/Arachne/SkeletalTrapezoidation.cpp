@@ -11,6 +11,7 @@
 
 #include "utils/linearAlg2D.hpp"
 #include "Utils.hpp"
+#include "../PrintBase.hpp"
 #include "SVG.hpp"
 #include "Geometry/VoronoiVisualUtils.hpp"
 #include "Geometry/VoronoiUtilsCgal.hpp"
@@ -367,6 +368,8 @@ void SkeletalTrapezoidation::constructFromPolygons(const Polygons& polys)
     }
 #endif
 
+    PrintBase::cancellation_checkpoint();
+
     VD voronoi_diagram;
     voronoi_diagram.construct_voronoi(segments.cbegin(), segments.cend());
 
@@ -378,7 +381,10 @@ void SkeletalTrapezoidation::constructFromPolygons(const Polygons& polys)
 #endif
 
     assert(this->graph.edges.empty() && this->graph.nodes.empty() && this->vd_edge_to_he_edge.empty() && this->vd_node_to_he_node.empty());
+    size_t num_cells_processed = 0;
     for (const VD::cell_type &cell : voronoi_diagram.cells()) {
+        if ((++ num_cells_processed & 0x3FF) == 0)
+            PrintBase::cancellation_checkpoint();
         if (!cell.incident_edge())
             continue; // There is no spoon
 
@@ -521,6 +527,8 @@ void SkeletalTrapezoidation::generateToolpaths(std::vector<VariableWidthLines> &
     export_graph_to_svg(debug_out_path("ST-filterNoncentralRegions-final-%d.svg", iRun), this->graph, this->outline);
 #endif
 
+    PrintBase::cancellation_checkpoint();
+
     generateTransitioningRibs();
 
 #ifdef ARACHNE_DEBUG
@@ -533,6 +541,8 @@ void SkeletalTrapezoidation::generateToolpaths(std::vector<VariableWidthLines> &
     export_graph_to_svg(debug_out_path("ST-generateExtraRibs-final-%d.svg", iRun), this->graph, this->outline);
 #endif
 
+    PrintBase::cancellation_checkpoint();
+
     generateSegments();
 
 #ifdef ARACHNE_DEBUG
@@ -2,6 +2,9 @@
 // CuraEngine is released under the terms of the AGPLv3 or higher.
 
 #include <algorithm> //For std::partition_copy and std::min_element.
+#include <mutex>
+
+#include <boost/functional/hash.hpp>
 
 #include "WallToolPaths.hpp"
 
@@ -12,6 +15,7 @@
 #include "Geometry.hpp"
 #include "utils/PolylineStitcher.hpp"
 #include "SVG.hpp"
+#include "Tracing.hpp"
 #include "Utils.hpp"
 #include "ClipperUtils.hpp"
 
@@ -22,6 +26,124 @@
 namespace Slic3r::Arachne
 {
 
+// Consecutive layers of prismatic parts have identical or just translated outlines, yet the expensive
+// SkeletalTrapezoidation was rebuilt from scratch for every one of them. Recently generated toolpaths
+// are therefore cached, keyed by the outline points normalized to the outline bounding box corner
+// (so translated copies hit as well) together with all parameters influencing the generation.
+// Perimeters of different layers are generated concurrently, thus the cache is guarded by a mutex.
+namespace {
+
+struct ToolPathsCacheKey
+{
+    Points              points; // outline points, shifted by -reference
+    std::vector<size_t> sizes;  // point count of each outline polygon
+    coord_t             bead_width_0;
+    coord_t             bead_width_x;
+    size_t              inset_count;
+    coord_t             wall_0_inset;
+    coordf_t            layer_height;
+    coord_t             min_feature_size;
+    coord_t             min_bead_width;
+    coord_t             wall_transition_filter_deviation;
+    coord_t             wall_transition_length;
+    double              wall_transition_angle;
+    int                 wall_distribution_count;
+
+    bool operator==(const ToolPathsCacheKey &rhs) const
+    {
+        return points == rhs.points && sizes == rhs.sizes &&
+               bead_width_0 == rhs.bead_width_0 && bead_width_x == rhs.bead_width_x &&
+               inset_count == rhs.inset_count && wall_0_inset == rhs.wall_0_inset &&
+               layer_height == rhs.layer_height && min_feature_size == rhs.min_feature_size &&
+               min_bead_width == rhs.min_bead_width &&
+               wall_transition_filter_deviation == rhs.wall_transition_filter_deviation &&
+               wall_transition_length == rhs.wall_transition_length &&
+               wall_transition_angle == rhs.wall_transition_angle &&
+               wall_distribution_count == rhs.wall_distribution_count;
+    }
+
+    size_t hash() const
+    {
+        size_t seed = 0;
+        for (const Point &pt : points) {
+            boost::hash_combine(seed, pt.x());
+            boost::hash_combine(seed, pt.y());
+        }
+        boost::hash_range(seed, sizes.begin(), sizes.end());
+        boost::hash_combine(seed, bead_width_0);
+        boost::hash_combine(seed, bead_width_x);
+        boost::hash_combine(seed, inset_count);
+        boost::hash_combine(seed, wall_0_inset);
+        boost::hash_combine(seed, layer_height);
+        boost::hash_combine(seed, min_feature_size);
+        boost::hash_combine(seed, min_bead_width);
+        boost::hash_combine(seed, wall_transition_filter_deviation);
+        boost::hash_combine(seed, wall_transition_length);
+        boost::hash_combine(seed, wall_transition_angle);
+        boost::hash_combine(seed, wall_distribution_count);
+        return seed;
+    }
+};
+
+struct ToolPathsCacheEntry
+{
+    std::vector<VariableWidthLines> toolpaths;
+    Polygons                        inner_contour;
+};
+
+class ToolPathsCache
+{
+public:
+    bool lookup(size_t hash, const ToolPathsCacheKey &key, ToolPathsCacheEntry &out)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (Slot &slot : m_slots)
+            if (slot.hash == hash && slot.key == key) {
+                slot.age = ++ m_age;
+                out = slot.entry;
+                return true;
+            }
+        return false;
+    }
+
+    void insert(size_t hash, ToolPathsCacheKey &&key, ToolPathsCacheEntry &&entry)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const Slot &slot : m_slots)
+            if (slot.hash == hash && slot.key == key)
+                return; // already generated concurrently by another layer
+        Slot *slot;
+        if (m_slots.size() < capacity) {
+            m_slots.emplace_back();
+            slot = &m_slots.back();
+        } else // evict the least recently used entry
+            slot = &*std::min_element(m_slots.begin(), m_slots.end(),
+                [](const Slot &l, const Slot &r) { return l.age < r.age; });
+        slot->hash  = hash;
+        slot->key   = std::move(key);
+        slot->entry = std::move(entry);
+        slot->age   = ++ m_age;
+    }
+
+private:
+    struct Slot
+    {
+        size_t              hash = 0;
+        ToolPathsCacheKey   key;
+        ToolPathsCacheEntry entry;
+        size_t              age = 0;
+    };
+    static constexpr size_t capacity = 64;
+
+    std::mutex        m_mutex;
+    std::vector<Slot> m_slots;
+    size_t            m_age = 0;
+};
+
+ToolPathsCache toolpaths_cache;
+
+} // namespace
+
 WallToolPaths::WallToolPaths(const Polygons& outline, const coord_t bead_width_0, const coord_t bead_width_x,
                              const size_t inset_count, const coord_t wall_0_inset, const coordf_t layer_height,
                              const PrintObjectConfig &print_object_config, const PrintConfig &print_config)
@@ -452,6 +574,54 @@ const std::vector<VariableWidthLines> &WallToolPaths::generate()
     if (this->inset_count < 1)
         return toolpaths;
 
+    Tracing::Span span("Arachne::WallToolPaths::generate");
+
+    // Normalize the outline to its bounding box corner, so an identical outline of
+    // a neighboring layer hits the cache even when the object is just translated.
+    Point reference(0, 0);
+    bool  first_point = true;
+    for (const Polygon &poly : this->outline)
+        for (const Point &pt : poly.points) {
+            if (first_point) {
+                reference   = pt;
+                first_point = false;
+            } else
+                reference = reference.cwiseMin(pt);
+        }
+    ToolPathsCacheKey cache_key;
+    cache_key.sizes.reserve(this->outline.size());
+    for (const Polygon &poly : this->outline) {
+        cache_key.sizes.emplace_back(poly.size());
+        for (const Point &pt : poly.points)
+            cache_key.points.emplace_back(pt - reference);
+    }
+    cache_key.bead_width_0                     = this->bead_width_0;
+    cache_key.bead_width_x                     = this->bead_width_x;
+    cache_key.inset_count                      = this->inset_count;
+    cache_key.wall_0_inset                     = this->wall_0_inset;
+    cache_key.layer_height                     = this->layer_height;
+    cache_key.min_feature_size                 = this->min_feature_size;
+    cache_key.min_bead_width                   = this->min_bead_width;
+    cache_key.wall_transition_filter_deviation = this->wall_transition_filter_deviation;
+    cache_key.wall_transition_length           = this->wall_transition_length;
+    cache_key.wall_transition_angle            = this->print_object_config.wall_transition_angle.value;
+    cache_key.wall_distribution_count          = this->print_object_config.wall_distribution_count.value;
+    const size_t cache_hash = cache_key.hash();
+
+    if (ToolPathsCacheEntry cache_entry; toolpaths_cache.lookup(cache_hash, cache_key, cache_entry)) {
+        toolpaths     = std::move(cache_entry.toolpaths);
+        inner_contour = std::move(cache_entry.inner_contour);
+        // shift the normalized result back to this layer's position
+        for (VariableWidthLines &lines : toolpaths)
+            for (ExtrusionLine &line : lines)
+                for (ExtrusionJunction &junction : line.junctions)
+                    junction.p += reference;
+        for (Polygon &poly : inner_contour)
+            poly.translate(reference);
+        toolpaths_generated = true;
+        return toolpaths;
+    }
+
     const coord_t smallest_segment = Slic3r::Arachne::meshfix_maximum_resolution;
     const coord_t allowed_distance = Slic3r::Arachne::meshfix_maximum_deviation;
     const coord_t epsilon_offset = (allowed_distance / 2) - 1;
@@ -460,7 +630,7 @@ const std::vector<VariableWidthLines> &WallToolPaths::generate()
 
     // Simplify outline for boost::voronoi consumption. Absolutely no self intersections or near-self intersections allowed:
     // TODO: Open question: Does this indeed fix all (or all-but-one-in-a-million) cases for manifold but otherwise possibly complex polygons?
-    Polygons prepared_outline = offset(offset(offset(outline, -epsilon_offset), epsilon_offset * 2), -epsilon_offset);
+    Polygons prepared_outline = offset_chain(outline, { float(- epsilon_offset), float(epsilon_offset * 2), float(- epsilon_offset) });
     simplify(prepared_outline, smallest_segment, allowed_distance);
     fixSelfIntersections(epsilon_offset, prepared_outline);
     removeDegenerateVerts(prepared_outline);
@@ -533,6 +703,17 @@ const std::vector<VariableWidthLines> &WallToolPaths::generate()
                               return l.front().inset_idx < r.front().inset_idx;
                           }) && "WallToolPaths should be sorted from the outer 0th to inner_walls");
     toolpaths_generated = true;
+
+    { // store a normalized copy of the result for the following layers
+        ToolPathsCacheEntry cache_entry { toolpaths, inner_contour };
+        for (VariableWidthLines &lines : cache_entry.toolpaths)
+            for (ExtrusionLine &line : lines)
+                for (ExtrusionJunction &junction : line.junctions)
+                    junction.p -= reference;
+        for (Polygon &poly : cache_entry.inner_contour)
+            poly.translate(- reference.x(), - reference.y());
+        toolpaths_cache.insert(cache_hash, std::move(cache_key), std::move(cache_entry));
+    }
     return toolpaths;
 }
 
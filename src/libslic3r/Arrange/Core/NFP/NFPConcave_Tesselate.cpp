@@ -4,6 +4,10 @@
 ///|/
 #include "NFPConcave_Tesselate.hpp"
 
+#include <array>
+#include <map>
+#include <numeric>
+
 #include <libslic3r/ClipperUtils.hpp>
 #include <libslic3r/Tesselate.hpp>
 
@@ -26,6 +30,124 @@ Polygons convex_decomposition_tess(const ExPolygon &expoly)
             Polygon{scaled(tr[i]), scaled(tr[i + 1]), scaled(tr[i + 2])});
     }
 
+    return convex_merge(std::move(ret));
+}
+
+namespace {
+
+// Key of an undirected edge between two decomposition parts. The parts come
+// from a common tesselation, so the endpoints of a shared edge match exactly.
+struct UndirectedEdgeKey
+{
+    std::array<coord_t, 4> coords;
+
+    UndirectedEdgeKey(const Point &a, const Point &b)
+    {
+        if (a.x() < b.x() || (a.x() == b.x() && a.y() < b.y()))
+            coords = {a.x(), a.y(), b.x(), b.y()};
+        else
+            coords = {b.x(), b.y(), a.x(), a.y()};
+    }
+
+    bool operator<(const UndirectedEdgeKey &other) const
+    {
+        return coords < other.coords;
+    }
+};
+
+// The index of the directed edge (u, v) within the loop, or size_t(-1).
+size_t find_directed_edge(const Points &loop, const Point &u, const Point &v)
+{
+    for (size_t i = 0; i < loop.size(); ++i)
+        if (loop[i] == u && loop[(i + 1) % loop.size()] == v)
+            return i;
+
+    return size_t(-1);
+}
+
+} // namespace
+
+Polygons convex_merge(Polygons parts)
+{
+    constexpr size_t Unset = size_t(-1);
+
+    // Collect the (at most two) parts sharing each undirected edge.
+    std::map<UndirectedEdgeKey, std::pair<size_t, size_t>> shared_edges;
+    for (size_t part_idx = 0; part_idx < parts.size(); ++part_idx) {
+        const Points &pts = parts[part_idx].points;
+        for (size_t i = 0; i < pts.size(); ++i) {
+            const Point &a = pts[i];
+            const Point &b = pts[(i + 1) % pts.size()];
+            if (a == b)
+                continue;
+
+            auto &e = shared_edges.try_emplace(UndirectedEdgeKey{a, b},
+                                               Unset, Unset).first->second;
+            if (e.first == Unset)
+                e.first = part_idx;
+            else
+                e.second = part_idx;
+        }
+    }
+
+    // Merged parts are redirected to the part absorbing them.
+    std::vector<size_t> owner(parts.size());
+    std::iota(owner.begin(), owner.end(), size_t(0));
+    auto find_owner = [&owner](size_t i) {
+        while (owner[i] != i) {
+            owner[i] = owner[owner[i]];
+            i = owner[i];
+        }
+        return i;
+    };
+
+    Points merged;
+    for (const auto &[key, e] : shared_edges) {
+        if (e.first == Unset || e.second == Unset)
+            continue;
+
+        size_t a = find_owner(e.first);
+        size_t b = find_owner(e.second);
+        if (a == b)
+            continue;
+
+        const Point u{key.coords[0], key.coords[1]};
+        const Point v{key.coords[2], key.coords[3]};
+
+        // Orient the pair so that part a contains the directed edge (u, v)
+        // and part b the opposite one.
+        size_t ia = find_directed_edge(parts[a].points, u, v);
+        if (ia == Unset) {
+            std::swap(a, b);
+            ia = find_directed_edge(parts[a].points, u, v);
+        }
+        size_t jb = ia != Unset ?
+            find_directed_edge(parts[b].points, v, u) : Unset;
+        if (ia == Unset || jb == Unset)
+            continue;
+
+        // Walk part a from v all the way around to u, then close the loop
+        // with the chain of part b between u and v, dropping the shared edge.
+        const Points &pa = parts[a].points;
+        const Points &pb = parts[b].points;
+        merged.clear();
+        merged.reserve(pa.size() + pb.size() - 2);
+        for (size_t k = 0; k < pa.size(); ++k)
+            merged.emplace_back(pa[(ia + 1 + k) % pa.size()]);
+        for (size_t k = 2; k < pb.size(); ++k)
+            merged.emplace_back(pb[(jb + k) % pb.size()]);
+
+        if (polygon_is_convex(merged)) {
+            parts[a].points = merged;
+            owner[b] = a;
+        }
+    }
+
+    auto ret = reserve_polygons(parts.size());
+    for (size_t i = 0; i < parts.size(); ++i)
+        if (find_owner(i) == i)
+            ret.emplace_back(std::move(parts[i]));
+
     return ret;
 }
 
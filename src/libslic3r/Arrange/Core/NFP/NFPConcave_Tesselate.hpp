@@ -12,6 +12,12 @@ namespace Slic3r {
 Polygons convex_decomposition_tess(const Polygon &expoly);
 Polygons convex_decomposition_tess(const ExPolygon &expoly);
 Polygons convex_decomposition_tess(const ExPolygons &expolys);
+
+// Greedily merge neighboring convex parts of a decomposition as long as their
+// union stays convex (in the spirit of Hertel-Mehlhorn). The pairwise convex
+// NFP is quadratic in the number of parts, so a triangulation is much cheaper
+// to process after this pass.
+Polygons convex_merge(Polygons parts);
 ExPolygons nfp_concave_concave_tess(const ExPolygon &fixed, const ExPolygon &movable);
 
 } // namespace Slic3r
@@ -21,19 +21,21 @@ const Polygons &DecomposedShape::transformed_outline() const
 
     if (!m_transformed_outline_valid) {
         m_transformed_outline = contours();
+        double      area_acc = 0.;
+        BoundingBox bbox;
         for (Polygon &poly : m_transformed_outline) {
             poly.rotate(rotation());
             poly.translate(translation());
+            // Gather area and bounding box in the same pass over the freshly transformed points.
+            PolygonStatistics stats = polygon_statistics(poly.points);
+            area_acc += stats.area / sc;
+            bbox.merge(stats.bbox);
         }
 
-        m_area = std::accumulate(m_transformed_outline.begin(),
-                                 m_transformed_outline.end(), 0.,
-                                 [sc](double s, const auto &p) {
-                                     return s + p.area() / sc;
-                                 });
-
+        m_area = area_acc;
         m_convex_hull = Geometry::convex_hull(m_transformed_outline);
-        m_bounding_box = get_extents(m_convex_hull);
+        // Bounding box of the outline equals the bounding box of its convex hull.
+        m_bounding_box = bbox;
 
         m_transformed_outline_valid = true;
     }
@@ -101,9 +103,9 @@ Vec2crd DecomposedShape::centroid() const
         double total_area = 0.0;
         Vec2d cntr = Vec2d::Zero();
 
-        for (const Polygon& poly : transformed_outline()) {
-            double parea = poly.area() / area_sc;
-            Vec2d pcntr = unscaled(poly.centroid());
+        for (const PolygonStatistics &stats : polygons_statistics(transformed_outline())) {
+            double parea = stats.area / area_sc;
+            Vec2d pcntr = unscaled(Point(stats.centroid));
             total_area += parea;
             cntr += pcntr * parea;
         }
@@ -116,8 +118,20 @@ Vec2crd DecomposedShape::centroid() const
     return m_centroid;
 }
 
+// Maximum relative area loss tolerated when replacing a near-convex shape
+// with its convex hull. A single convex piece makes the NFP calculation
+// linear instead of quadratic in the vertex counts.
+constexpr double NearConvexHullAreaEps = 0.01;
+
 DecomposedShape decompose(const ExPolygons &shape)
 {
+    Polygon hull = Geometry::convex_hull(to_polygons(shape));
+
+    double hull_area = hull.area();
+    if (hull_area > 0. &&
+        hull_area - area(shape) < NearConvexHullAreaEps * hull_area)
+        return DecomposedShape{std::move(hull)};
+
     return DecomposedShape{convex_decomposition_tess(shape)};
 }
 
@@ -129,7 +143,14 @@ DecomposedShape decompose(const Polygon &shape)
     if (is_convex) {
         convex_shapes.emplace_back(shape);
     } else {
-        convex_shapes = convex_decomposition_tess(shape);
+        Polygon hull = Geometry::convex_hull(shape.points);
+
+        double hull_area = hull.area();
+        if (hull_area > 0. &&
+            hull_area - shape.area() < NearConvexHullAreaEps * hull_area)
+            convex_shapes.emplace_back(std::move(hull));
+        else
+            convex_shapes = convex_decomposition_tess(shape);
     }
 
     return DecomposedShape{std::move(convex_shapes)};
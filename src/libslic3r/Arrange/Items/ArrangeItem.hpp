@@ -26,6 +26,7 @@
 #include "libslic3r/Arrange/Items/ArbitraryDataStore.hpp"
 
 #include <libslic3r/ClipperUtils.hpp>
+#include <libslic3r/Execution/ExecutionTBB.hpp>
 
 namespace Slic3r { namespace arr2 {
 
@@ -286,57 +287,74 @@ static Polygons calculate_nfp_unnormalized(const ArrangeItem    &item,
                                            const Range<FixedIt> &fixed_items,
                                            StopCond &&stop_cond = {})
 {
-    size_t cap = 0;
-
-    for (const ArrangeItem &fixitem : fixed_items) {
-        const Polygons &outlines = fixitem.shape().transformed_outline();
-        cap += outlines.size();
-    }
+    auto fixed_ptrs = reserve_vector<const ArrangeItem *>(fixed_items.size());
+    for (const ArrangeItem &fixitem : fixed_items)
+        fixed_ptrs.emplace_back(&fixitem);
 
+    // Fill the lazy caches of the movable item up front, so the parallel
+    // workers below only read them. The per-fixed-item caches are safe to
+    // fill from the workers, as each fixed item is handled by a single task.
     const Polygons &item_outlines = item.envelope().transformed_outline();
+    Vec2crd ref_whole = item.envelope().reference_vertex();
 
-    auto nfps = reserve_polygons(cap * item_outlines.size());
+    // No-fit polygons of the movable item with each of the fixed items,
+    // calculated independently in parallel and unified in a single pass
+    // afterwards.
+    std::vector<Polygons> fixed_nfps(fixed_ptrs.size());
 
-    Vec2crd ref_whole = item.envelope().reference_vertex();
-    Polygon subnfp;
-
-    for (const ArrangeItem &fixed : fixed_items) {
-        // fixed_polys should already be a set of strictly convex polygons,
-        // as ArrangeItem stores convex-decomposed polygons
-        const Polygons & fixed_polys = fixed.shape().transformed_outline();
-
-        for (const Polygon &fixed_poly : fixed_polys) {
-            Point max_fixed = Slic3r::reference_vertex(fixed_poly);
-            for (size_t mi = 0; mi < item_outlines.size(); ++mi) {
-                const Polygon &movable = item_outlines[mi];
-                const Vec2crd &mref = item.envelope().reference_vertex(mi);
-                subnfp = nfp_convex_convex_legacy(fixed_poly, movable);
-
-                Vec2crd min_movable = item.envelope().min_vertex(mi);
-
-                Vec2crd dtouch = max_fixed - min_movable;
-                Vec2crd top_other = mref + dtouch;
-                Vec2crd max_nfp = Slic3r::reference_vertex(subnfp);
-                auto dnfp = top_other - max_nfp;
-
-                auto d = ref_whole - mref + dnfp;
-                subnfp.translate(d);
-                nfps.emplace_back(subnfp);
+    execution::for_each(
+        ex_tbb, size_t(0), fixed_ptrs.size(),
+        [&](size_t fixed_idx) {
+            if (stop_cond())
+                return;
+
+            // fixed_polys should already be a set of strictly convex polygons,
+            // as ArrangeItem stores convex-decomposed polygons
+            const Polygons &fixed_polys =
+                fixed_ptrs[fixed_idx]->shape().transformed_outline();
+
+            auto &nfps = fixed_nfps[fixed_idx];
+            nfps = reserve_polygons(fixed_polys.size() * item_outlines.size());
+
+            Polygon subnfp;
+
+            for (const Polygon &fixed_poly : fixed_polys) {
+                Point max_fixed = Slic3r::reference_vertex(fixed_poly);
+                for (size_t mi = 0; mi < item_outlines.size(); ++mi) {
+                    const Polygon &movable = item_outlines[mi];
+                    const Vec2crd &mref = item.envelope().reference_vertex(mi);
+                    subnfp = nfp_convex_convex_legacy(fixed_poly, movable);
+
+                    Vec2crd min_movable = item.envelope().min_vertex(mi);
+
+                    Vec2crd dtouch = max_fixed - min_movable;
+                    Vec2crd top_other = mref + dtouch;
+                    Vec2crd max_nfp = Slic3r::reference_vertex(subnfp);
+                    auto dnfp = top_other - max_nfp;
+
+                    auto d = ref_whole - mref + dnfp;
+                    subnfp.translate(d);
+                    nfps.emplace_back(subnfp);
+                }
+
+                if (stop_cond())
+                    break;
             }
+        });
 
-            if (stop_cond())
-                break;
+    if (stop_cond())
+        return {};
 
-            nfps = union_(nfps);
-        }
+    size_t cap = std::accumulate(fixed_nfps.begin(), fixed_nfps.end(),
+                                 size_t(0), [](size_t s, const Polygons &pp) {
+                                     return s + pp.size();
+                                 });
 
-        if (stop_cond()) {
-            nfps.clear();
-            break;
-        }
-    }
+    auto nfps = reserve_polygons(cap);
+    for (Polygons &pp : fixed_nfps)
+        std::move(pp.begin(), pp.end(), std::back_inserter(nfps));
 
-    return nfps;
+    return union_(nfps);
 }
 
 template<> struct NFPArrangeItemTraits_<ArrangeItem> {
@@ -7,6 +7,9 @@
 
 #include "SceneBuilder.hpp"
 
+#include <map>
+#include <mutex>
+
 #include "libslic3r/Model.hpp"
 #include "libslic3r/Print.hpp"
 #include "libslic3r/SLAPrint.hpp"
@@ -100,6 +103,84 @@ bool check_coord_bounds(const BoundingBoxf &bb)
            std::abs(bb.max.y()) < UnscaledCoordLimit;
 }
 
+namespace {
+
+// Caches the projected 2D silhouettes of volume meshes, persisting across
+// arrange invocations. Projecting every volume mesh on each arrange click is
+// expensive, while the geometry rarely changes in between. Projection onto
+// the XY plane commutes with translation, therefore the entries are keyed by
+// the linear part of the volume transform only and the cached silhouette is
+// shifted into place on a hit, so moving an instance around the bed does not
+// invalidate its entry.
+class ProjectedSilhouetteCache
+{
+    struct Entry
+    {
+        // Pins the mesh, so the map key cannot alias a new mesh allocated
+        // at the same address and silhouettes of dropped meshes can be told
+        // apart by their use count.
+        std::shared_ptr<const TriangleMesh> mesh;
+        Transform3d                         linear_trafo;
+        Polygons                            silhouette;
+    };
+
+    std::mutex m_mutex;
+    std::map<const TriangleMesh *, std::vector<Entry>> m_entries;
+
+    // How many distinct orientations to keep cached for a single mesh.
+    static constexpr size_t MaxEntriesPerMesh = 8;
+
+public:
+    static Polygons get(const ModelVolume &v, const Transform3d &tr)
+    {
+        static ProjectedSilhouetteCache cache;
+
+        // Split the transform into its linear part and the projection of its
+        // translation. Applying the translation to the cached silhouette may
+        // differ from projecting the translated mesh by one scaled unit due
+        // to rounding, which is well below the accuracy of arrange.
+        Transform3d linear{tr};
+        linear.translation() = Vec3d::Zero();
+        const Point shift = scaled(to_2d(tr.translation()));
+
+        std::shared_ptr<const TriangleMesh> mesh = v.get_mesh_shared_ptr();
+
+        std::unique_lock lk{cache.m_mutex};
+
+        // Drop silhouettes of meshes only referenced by the cache itself.
+        for (auto it = cache.m_entries.begin(); it != cache.m_entries.end();) {
+            assert(!it->second.empty());
+            if (it->second.front().mesh.use_count() == long(it->second.size()))
+                it = cache.m_entries.erase(it);
+            else
+                ++it;
+        }
+
+        std::vector<Entry> &entries = cache.m_entries[mesh.get()];
+        auto entry_it = std::find_if(entries.begin(), entries.end(),
+                                     [&linear](const Entry &e) {
+            return (e.linear_trafo.matrix().array() == linear.matrix().array()).all();
+        });
+
+        if (entry_it == entries.end()) {
+            if (entries.size() >= MaxEntriesPerMesh)
+                entries.erase(entries.begin());
+
+            entries.emplace_back(Entry{mesh, linear,
+                                       project_mesh(mesh->its, linear, [] {})});
+            entry_it = std::prev(entries.end());
+        }
+
+        Polygons ret = entry_it->silhouette;
+        for (Polygon &p : ret)
+            p.translate(shift);
+
+        return ret;
+    }
+};
+
+} // namespace
+
 ExPolygons extract_full_outline(const ModelInstance &inst, const Transform3d &tr)
 {
     ExPolygons outline;
@@ -108,9 +189,8 @@ ExPolygons extract_full_outline(const ModelInstance &inst, const Transform3d &tr
         for (const ModelVolume *v : inst.get_object()->volumes) {
             Polygons vol_outline;
 
-            vol_outline = project_mesh(v->mesh().its,
-                                       tr * inst.get_matrix() * v->get_matrix(),
-                                       [] {});
+            vol_outline = ProjectedSilhouetteCache::get(
+                *v, tr * inst.get_matrix() * v->get_matrix());
             switch (v->type()) {
             case ModelVolumeType::MODEL_PART:
                 outline = union_ex(outline, vol_outline);
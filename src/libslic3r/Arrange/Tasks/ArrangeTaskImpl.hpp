@@ -5,12 +5,15 @@
 #ifndef ARRANGETASK_IMPL_HPP
 #define ARRANGETASK_IMPL_HPP
 
+#include <optional>
 #include <random>
 
 #include <boost/log/trivial.hpp>
 
 #include "ArrangeTask.hpp"
 
+#include "libslic3r/Execution/ExecutionTBB.hpp"
+
 namespace Slic3r { namespace arr2 {
 
 // Prepare the selected and unselected items separately. If nothing is
@@ -20,28 +23,60 @@ void extract_selected(ArrangeTask<ArrItem> &task,
                       const ArrangeableModel &mdl,
                       const ArrangeableToItemConverter<ArrItem> &itm_conv)
 {
-    // Go through the objects and check if inside the selection
-    mdl.for_each_arrangeable(
-        [&task, &itm_conv](const Arrangeable &arrbl) {
-            bool selected = arrbl.is_selected();
-            bool printable = arrbl.is_printable();
-
+    // Converting an arrangeable derives its outline (silhouette projection or
+    // convex hull of the transformed meshes), which dominates the scene build
+    // on plates with many instances. Collect the ids first, then convert in
+    // parallel, revisiting each arrangeable by id.
+    struct Record {
+        ObjectID id;
+        bool selected  = false;
+        bool printable = false;
+        bool converted = false;
+        std::optional<ArrItem> itm;
+    };
+    std::vector<Record> records;
+    mdl.for_each_arrangeable([&records](const Arrangeable &arrbl) {
+        records.emplace_back(Record{arrbl.id(), arrbl.is_selected(), arrbl.is_printable()});
+    });
+
+    auto convert_fn = [&itm_conv](Record &rec) {
+        return [&itm_conv, &rec](const Arrangeable &arrbl) {
+            rec.converted = true;
             try {
-                auto itm = itm_conv.convert(arrbl, selected ? 0 : -SCALED_EPSILON);
-
-                auto &container_parent = printable ? task.printable :
-                                                 task.unprintable;
-
-                auto &container = selected ?
-                                       container_parent.selected :
-                                       container_parent.unselected;
-
-                container.emplace_back(std::move(itm));
+                rec.itm = itm_conv.convert(arrbl, rec.selected ? 0 : -SCALED_EPSILON);
             } catch (const EmptyItemOutlineError &ex) {
                 BOOST_LOG_TRIVIAL(error)
                     << "ObjectID " << std::to_string(arrbl.id().id) << ": " << ex.what();
             }
-        });
+        };
+    };
+
+    execution::for_each(ex_tbb, size_t(0), records.size(),
+                        [&mdl, &records, &convert_fn](size_t i) {
+        mdl.visit_arrangeable(records[i].id, convert_fn(records[i]));
+    }, execution::max_concurrency(ex_tbb));
+
+    // Some arrangeables are reachable by for_each_arrangeable() but not by a
+    // visit by id (e.g. the wipe tower of an SLA model). Convert the leftovers
+    // serially.
+    mdl.for_each_arrangeable([&records, &convert_fn](const Arrangeable &arrbl) {
+        auto rec_it = std::find_if(records.begin(), records.end(),
+                                   [id = arrbl.id()](const Record &rec) {
+                                       return !rec.converted && rec.id == id;
+                                   });
+        if (rec_it != records.end())
+            convert_fn(*rec_it)(arrbl);
+    });
+
+    for (Record &rec : records) {
+        if (!rec.itm)
+            continue;
+
+        auto &container_parent = rec.printable ? task.printable : task.unprintable;
+        auto &container = rec.selected ? container_parent.selected :
+                                         container_parent.unselected;
+        container.emplace_back(std::move(*rec.itm));
+    }
 
     // If the selection was empty arrange everything
     if (task.printable.selected.empty() && task.unprintable.selected.empty()) {
@@ -225,6 +225,45 @@ BoundingBox3Base<PointType>::max_size() const
 template coordf_t BoundingBox3Base<Vec3f>::max_size() const;
 template coordf_t BoundingBox3Base<Vec3d>::max_size() const;
 
+PolygonStatistics polygon_statistics(const Points &points)
+{
+    PolygonStatistics out;
+    if (points.empty())
+        return out;
+    Point  pt_min = points.front();
+    Point  pt_max = points.front();
+    double a      = 0.;
+    Vec2d  c      = Vec2d::Zero();
+    Vec2d  p1     = points.back().cast<double>();
+    for (const Point &p : points) {
+        pt_min = pt_min.cwiseMin(p);
+        pt_max = pt_max.cwiseMax(p);
+        Vec2d  p2    = p.cast<double>();
+        double cross = cross2(p1, p2);
+        a += cross;
+        c += (p1 + p2) * cross;
+        p1 = p2;
+    }
+    if (points.size() >= 3) {
+        out.area = 0.5 * a;
+        if (a != 0.)
+            out.centroid = c / (3. * a);
+    }
+    out.bbox.min     = pt_min;
+    out.bbox.max     = pt_max;
+    out.bbox.defined = true;
+    return out;
+}
+
+std::vector<PolygonStatistics> polygons_statistics(const Polygons &polygons)
+{
+    std::vector<PolygonStatistics> out;
+    out.reserve(polygons.size());
+    for (const Polygon &polygon : polygons)
+        out.emplace_back(polygon_statistics(polygon.points));
+    return out;
+}
+
 void BoundingBox::align_to_grid(const coord_t cell_size)
 {
     if (this->defined) {
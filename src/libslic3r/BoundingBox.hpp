@@ -219,6 +219,24 @@ public:
 
 using BoundingBoxes = std::vector<BoundingBox>;
 
+// Signed area, centroid and bounding box of a polygon, computed in a single pass over the points.
+// Hot paths (arrangement scoring, fill, statistics) query these per polygon; fusing the passes
+// avoids streaming the point data once per statistic.
+struct PolygonStatistics
+{
+    // Signed area of the polygon, positive for a counter-clockwise orientation.
+    // Same value as Polygon::area().
+    double      area { 0. };
+    // Centroid of the polygon, same value as Polygon::centroid() before rounding.
+    // Only valid for a non-zero area.
+    Vec2d       centroid { Vec2d::Zero() };
+    BoundingBox bbox;
+};
+
+PolygonStatistics              polygon_statistics(const Points &points);
+inline PolygonStatistics       polygon_statistics(const Polygon &polygon) { return polygon_statistics(polygon.points); }
+std::vector<PolygonStatistics> polygons_statistics(const Polygons &polygons);
+
 class BoundingBox3  : public BoundingBox3Base<Vec3crd> 
 {
 public:
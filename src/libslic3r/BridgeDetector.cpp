@@ -9,6 +9,8 @@
 #include "Geometry.hpp"
 #include <algorithm>
 
+#include <tbb/parallel_for.h>
+
 namespace Slic3r {
 
 BridgeDetector::BridgeDetector(
@@ -101,10 +103,53 @@ bool BridgeDetector::detect_angle(double bridge_direction_override)
     /*  we'll now try several directions using a rudimentary visibility check:
         bridge in several directions and then sum the length of lines having both
         endpoints within anchors */
-        
-    bool have_coverage = false;
-    for (size_t i_angle = 0; i_angle < candidates.size(); ++ i_angle)
-    {
+    this->evaluate_candidates(candidates, clip_area);
+
+    // if no direction produced coverage, then there's no bridge direction
+    if (std::none_of(candidates.begin(), candidates.end(), [](const BridgeDirection &c) { return c.coverage > 0.; }))
+        return false;
+
+    size_t i_best = this->select_best_candidate(candidates);
+
+    // The winner was picked from a sweep with a rather coarse angle stepping (see initialize()).
+    // Refine it by searching its neighborhood with a 1 degree step, which is the same resolution
+    // bridge_direction_candidates() uses to merge nearly parallel directions.
+    const double fine_resolution = PI / 180.;
+    if (bridge_direction_override == 0. && this->resolution > fine_resolution + EPSILON) {
+        std::vector<BridgeDirection> refined;
+        refined.emplace_back(candidates[i_best]);
+        for (double da = fine_resolution; da < this->resolution - 0.5 * fine_resolution; da += fine_resolution)
+            for (double a : { candidates[i_best].angle - da, candidates[i_best].angle + da }) {
+                if (a < 0.)
+                    a += PI;
+                else if (a >= PI)
+                    a -= PI;
+                refined.emplace_back(BridgeDirection(a));
+            }
+        // The coarse winner was evaluated already, skip it.
+        std::vector<BridgeDirection> fresh(refined.begin() + 1, refined.end());
+        this->evaluate_candidates(fresh, clip_area);
+        std::copy(fresh.begin(), fresh.end(), refined.begin() + 1);
+        candidates = std::move(refined);
+        i_best = this->select_best_candidate(candidates);
+    }
+
+    this->angle = candidates[i_best].angle;
+    if (this->angle >= PI)
+        this->angle -= PI;
+    
+    #ifdef SLIC3R_DEBUG
+    printf("  Optimal infill angle is %d degrees\n", (int)Slic3r::Geometry::rad2deg(this->angle));
+    #endif
+    
+    return true;
+}
+
+void BridgeDetector::evaluate_candidates(std::vector<BridgeDirection> &candidates, const Polygons &clip_area) const
+{
+    // The candidates are independent, each iteration only clips against the shared read-only
+    // clip_area and anchor regions and writes to its own slot.
+    tbb::parallel_for(size_t(0), candidates.size(), [this, &candidates, &clip_area](size_t i_angle) {
         const double angle = candidates[i_angle].angle;
 
         Lines lines;
@@ -115,7 +160,7 @@ bool BridgeDetector::detect_angle(double bridge_direction_override)
             lines.reserve((bbox.max(1) - bbox.min(1) + this->spacing) / this->spacing);
             double s = sin(angle);
             double c = cos(angle);
-            //FIXME Vojtech: The lines shall be spaced half the line width from the edge, but then 
+            //FIXME Vojtech: The lines shall be spaced half the line width from the edge, but then
             // some of the test cases fail. Need to adjust the test cases then?
 //            for (coord_t y = bbox.min(1) + this->spacing / 2; y <= bbox.max(1); y += this->spacing)
             for (coord_t y = bbox.min(1); y <= bbox.max(1); y += this->spacing)
@@ -136,12 +181,11 @@ bool BridgeDetector::detect_angle(double bridge_direction_override)
                     total_length += len;
                     max_length = std::max(max_length, len);
                 }
-            }        
+            }
         }
         if (total_length == 0.)
-            continue;
+            return;
 
-        have_coverage = true;
         // Sum length of bridged lines.
         candidates[i_angle].coverage = total_length;
         /*  The following produces more correct results in some cases and more broken in others.
@@ -149,31 +193,21 @@ bool BridgeDetector::detect_angle(double bridge_direction_override)
         // $directions_coverage{$angle} = sum(map $_->area, @{$self->coverage($angle)}) // 0;
         // max length of bridged lines
         candidates[i_angle].max_length = max_length;
-    }
+    });
+}
 
-    // if no direction produced coverage, then there's no bridge direction
-    if (! have_coverage)
-        return false;
-    
+size_t BridgeDetector::select_best_candidate(std::vector<BridgeDirection> &candidates) const
+{
     // sort directions by coverage - most coverage first
     std::sort(candidates.begin(), candidates.end());
-    
+
     // if any other direction is within extrusion width of coverage, prefer it if shorter
     // TODO: There are two options here - within width of the angle with most coverage, or within width of the currently perferred?
     size_t i_best = 0;
     for (size_t i = 1; i < candidates.size() && candidates[i_best].coverage - candidates[i].coverage < this->spacing; ++ i)
         if (candidates[i].max_length < candidates[i_best].max_length)
             i_best = i;
-
-    this->angle = candidates[i_best].angle;
-    if (this->angle >= PI)
-        this->angle -= PI;
-    
-    #ifdef SLIC3R_DEBUG
-    printf("  Optimal infill angle is %d degrees\n", (int)Slic3r::Geometry::rad2deg(this->angle));
-    #endif
-    
-    return true;
+    return i_best;
 }
 
 std::vector<double> BridgeDetector::bridge_direction_candidates() const
@@ -72,6 +72,13 @@ private:
     // Get possible briging direction candidates.
     std::vector<double> bridge_direction_candidates() const;
 
+    // Fill in coverage and max_length of the candidates by stranging test lines over the anchor regions.
+    // The candidates are independent of each other, thus they are evaluated in parallel.
+    void evaluate_candidates(std::vector<BridgeDirection> &candidates, const Polygons &clip_area) const;
+    // Sort the evaluated candidates by coverage and return the index of the winner,
+    // preferring shorter bridges among the directions with similar coverage.
+    size_t select_best_candidate(std::vector<BridgeDirection> &candidates) const;
+
     // Open lines representing the supporting edges.
     Polylines _edges;
     // Closed polygons representing the supporting areas.
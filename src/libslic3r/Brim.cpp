@@ -13,6 +13,8 @@
 #include "libslic3r.h"
 
 #include <algorithm>
+#include <functional>
+#include <map>
 #include <numeric>
 #include <unordered_set>
 #include <mutex>
@@ -65,10 +67,12 @@ static ExPolygons get_print_object_bottom_layer_expolygons(const PrintObject &pr
 // Returns ExPolygons of bottom layer for every print object in Print after elephant foot compensation.
 static std::vector<ExPolygons> get_print_bottom_layers_expolygons(const Print &print)
 {
-    std::vector<ExPolygons> bottom_layers_expolygons;
-    bottom_layers_expolygons.reserve(print.objects().size());
-    for (const PrintObject *object : print.objects())
-        bottom_layers_expolygons.emplace_back(get_print_object_bottom_layer_expolygons(*object));
+    std::vector<ExPolygons> bottom_layers_expolygons(print.objects().size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, print.objects().size()),
+        [&print, &bottom_layers_expolygons](const tbb::blocked_range<size_t> &range) {
+            for (size_t print_object_idx = range.begin(); print_object_idx < range.end(); ++ print_object_idx)
+                bottom_layers_expolygons[print_object_idx] = get_print_object_bottom_layer_expolygons(*print.objects()[print_object_idx]);
+        });
 
     return bottom_layers_expolygons;
 }
@@ -146,8 +150,7 @@ static Polygons top_level_outer_brim_islands(const ConstPrintObjectPtrs &top_lev
         Polygons islands_object;
         for (const ExPolygon &ex_poly : get_print_object_bottom_layer_expolygons(*object)) {
             Polygons contour_offset = offset(ex_poly.contour, brim_separation, ClipperLib::jtSquare);
-            for (Polygon &poly : contour_offset)
-                poly.douglas_peucker(scaled_resolution);
+            polygons_douglas_peucker(contour_offset, scaled_resolution);
 
             polygons_append(islands_object, std::move(contour_offset));
         }
@@ -515,12 +518,54 @@ ExtrusionEntityCollection make_brim(const Print &print, PrintTryCancel try_cance
 
     Polygons        loops;
     size_t          num_loops = size_t(floor(max_brim_width(print.objects()) / flow.spacing()));
-    for (size_t i = 0; i < num_loops; ++i) {
-        try_cancel();
-        islands = expand(islands, float(flow.scaled_spacing()), ClipperLib::jtSquare);
-        for (Polygon &poly : islands) 
-            poly.douglas_peucker(scaled_resolution);
-        polygons_append(loops, shrink(islands, 0.5f * float(flow.scaled_spacing())));
+    if (! islands.empty() && num_loops > 0) {
+        // Cluster islands so close to each other that their expanded brim loops may interact,
+        // thus they have to be expanded together. Distinct clusters are processed in parallel,
+        // producing the same geometry as a single serial expansion of all the islands.
+        const float max_expansion = float(num_loops) * float(flow.scaled_spacing());
+        std::vector<BoundingBox> bboxes;
+        bboxes.reserve(islands.size());
+        for (const Polygon &island : islands)
+            bboxes.emplace_back(get_extents(island).inflated(coordf_t(max_expansion)));
+        std::vector<size_t> parent(islands.size());
+        std::iota(parent.begin(), parent.end(), size_t(0));
+        std::function<size_t(size_t)> find_root = [&parent, &find_root](size_t i) -> size_t {
+            return parent[i] == i ? i : (parent[i] = find_root(parent[i]));
+        };
+        for (size_t i = 0; i < bboxes.size(); ++ i)
+            for (size_t j = i + 1; j < bboxes.size(); ++ j)
+                if (bboxes[i].overlap(bboxes[j]))
+                    parent[find_root(j)] = find_root(i);
+        // Keep the clusters ordered by the index of their first island to produce
+        // a stable output ordering.
+        std::map<size_t, size_t>    root_to_cluster;
+        std::vector<Polygons>       clusters;
+        for (size_t i = 0; i < islands.size(); ++ i) {
+            size_t root = find_root(i);
+            auto [it, inserted] = root_to_cluster.emplace(root, clusters.size());
+            if (inserted)
+                clusters.emplace_back();
+            clusters[it->second].emplace_back(std::move(islands[i]));
+        }
+        std::vector<Polygons> loops_by_clusters(clusters.size());
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, clusters.size()),
+            [&clusters, &loops_by_clusters, &flow, scaled_resolution, num_loops, &try_cancel](const tbb::blocked_range<size_t> &range) {
+                for (size_t cluster_idx = range.begin(); cluster_idx < range.end(); ++ cluster_idx) {
+                    Polygons &cluster_islands = clusters[cluster_idx];
+                    Polygons &cluster_loops   = loops_by_clusters[cluster_idx];
+                    for (size_t i = 0; i < num_loops; ++ i) {
+                        try_cancel();
+                        cluster_islands = expand(cluster_islands, float(flow.scaled_spacing()), ClipperLib::jtSquare);
+                        polygons_douglas_peucker(cluster_islands, scaled_resolution);
+                        polygons_append(cluster_loops, shrink(cluster_islands, 0.5f * float(flow.scaled_spacing())));
+                    }
+                }
+            });
+        islands.clear();
+        for (size_t cluster_idx = 0; cluster_idx < clusters.size(); ++ cluster_idx) {
+            polygons_append(islands, std::move(clusters[cluster_idx]));
+            polygons_append(loops, std::move(loops_by_clusters[cluster_idx]));
+        }
     }
     loops = union_pt_chained_outside_in(loops);
 
@@ -8,7 +8,9 @@
 #include "GCode/GCodeProcessor.hpp"
 #include "Point.hpp"
 
+#include <atomic>
 #include <boost/log/trivial.hpp>
+#include <tbb/parallel_for.h>
 
 namespace Slic3r {
 
@@ -321,6 +323,25 @@ BuildVolume::ObjectState BuildVolume::volume_state_bbox(const BoundingBoxf3& vol
            build_volume.intersects(volume_bbox) ? ObjectState::Colliding : ObjectState::Outside;
 }
 
+// Test the predicate on all moves in parallel, stopping the remaining chunks early
+// once any move fails the predicate.
+template<typename Pred>
+static bool all_moves_inside(const GCodeProcessorResult &paths, Pred &&inside)
+{
+    std::atomic<bool> all_inside{ true };
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, paths.moves.size(), 1 << 14),
+        [&paths, &inside, &all_inside](const tbb::blocked_range<size_t> &range) {
+            if (! all_inside.load(std::memory_order_relaxed))
+                return;
+            for (size_t i = range.begin(); i < range.end(); ++ i)
+                if (! inside(paths.moves[i])) {
+                    all_inside.store(false, std::memory_order_relaxed);
+                    return;
+                }
+        });
+    return all_inside.load(std::memory_order_relaxed);
+}
+
 bool BuildVolume::all_paths_inside(const GCodeProcessorResult& paths, const BoundingBoxf3& paths_bbox, bool ignore_bottom) const
 {
     auto move_valid = [](const GCodeProcessorResult::MoveVertex &move) {
@@ -343,20 +364,38 @@ bool BuildVolume::all_paths_inside(const GCodeProcessorResult& paths, const Boun
         const Vec2f c = unscaled<float>(m_circle.center);
         const float r = unscaled<double>(m_circle.radius) + epsilon;
         const float r2 = sqr(r);
-        return m_max_print_height == 0.0 ?
-            std::all_of(paths.moves.begin(), paths.moves.end(), [move_valid, c, r2](const GCodeProcessorResult::MoveVertex &move)
-                { return ! move_valid(move) || (to_2d(move.position) - c).squaredNorm() <= r2; }) :
-            std::all_of(paths.moves.begin(), paths.moves.end(), [move_valid, c, r2, z = m_max_print_height + epsilon](const GCodeProcessorResult::MoveVertex& move)
-                { return ! move_valid(move) || ((to_2d(move.position) - c).squaredNorm() <= r2 && move.position.z() <= z); });
+        const float z = m_max_print_height == 0.0 ? std::numeric_limits<float>::max() : float(m_max_print_height + epsilon);
+        // Fast path: if the whole path bounding box fits, no move has to be tested.
+        {
+            const Vec2f bbox_min = to_2d(paths_bbox.min).cast<float>();
+            const Vec2f bbox_max = to_2d(paths_bbox.max).cast<float>();
+            const Vec2f farthest { std::max(std::abs(bbox_min.x() - c.x()), std::abs(bbox_max.x() - c.x())),
+                                   std::max(std::abs(bbox_min.y() - c.y()), std::abs(bbox_max.y() - c.y())) };
+            if (farthest.squaredNorm() <= r2 && float(paths_bbox.max.z()) <= z)
+                return true;
+        }
+        return all_moves_inside(paths, [move_valid, c, r2, z](const GCodeProcessorResult::MoveVertex &move)
+            { return ! move_valid(move) || ((to_2d(move.position) - c).squaredNorm() <= r2 && move.position.z() <= z); });
     }
     case Type::Convex:
     //FIXME doing test on convex hull until we learn to do test on non-convex polygons efficiently.
     case Type::Custom:
-        return m_max_print_height == 0.0 ?
-            std::all_of(paths.moves.begin(), paths.moves.end(), [move_valid, this](const GCodeProcessorResult::MoveVertex &move) 
-                { return ! move_valid(move) || Geometry::inside_convex_polygon(m_top_bottom_convex_hull_decomposition_bed, to_2d(move.position).cast<double>()); }) :
-            std::all_of(paths.moves.begin(), paths.moves.end(), [move_valid, this, z = m_max_print_height + epsilon](const GCodeProcessorResult::MoveVertex &move)
-                { return ! move_valid(move) || (Geometry::inside_convex_polygon(m_top_bottom_convex_hull_decomposition_bed, to_2d(move.position).cast<double>()) && move.position.z() <= z); });
+    {
+        const double z = m_max_print_height == 0.0 ? std::numeric_limits<double>::max() : m_max_print_height + epsilon;
+        // Fast path: the bed region is convex, thus the whole path bounding box fits
+        // if all its four corners fit.
+        {
+            const Vec2d bbox_min = to_2d(paths_bbox.min);
+            const Vec2d bbox_max = to_2d(paths_bbox.max);
+            const Vec2d corners[4] { bbox_min, { bbox_max.x(), bbox_min.y() }, bbox_max, { bbox_min.x(), bbox_max.y() } };
+            if (std::all_of(std::begin(corners), std::end(corners), [this](const Vec2d &pt)
+                    { return Geometry::inside_convex_polygon(m_top_bottom_convex_hull_decomposition_bed, pt); }) &&
+                paths_bbox.max.z() <= z)
+                return true;
+        }
+        return all_moves_inside(paths, [move_valid, this, z](const GCodeProcessorResult::MoveVertex &move)
+            { return ! move_valid(move) || (Geometry::inside_convex_polygon(m_top_bottom_convex_hull_decomposition_bed, to_2d(move.position).cast<double>()) && move.position.z() <= z); });
+    }
     default:
         return true;
     }
@@ -9,7 +9,14 @@
 ///|/
 ///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
 ///|/
+#include <numeric>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include "BoundingBox.hpp"
 #include "ClipperUtils.hpp"
+#include "Execution/GrainCalibration.hpp"
 #include "Geometry.hpp"
 #include "ShortestPath.hpp"
 #include "Utils.hpp"
@@ -187,9 +194,11 @@ namespace ClipperUtils {
     {
         Polygons out;
         out.reserve(number_polygons(src));
+        // Clip the contours directly into the output, without an intermediate Polygons buffer per ExPolygon.
         for (const ExPolygon &p : src) {
-            Polygons temp = clip_clipper_polygons_with_subject_bbox(p, bbox);
-            out.insert(out.end(), temp.begin(), temp.end());
+            out.emplace_back(clip_clipper_polygon_with_subject_bbox(p.contour, bbox));
+            for (const Polygon &hole : p.holes)
+                out.emplace_back(clip_clipper_polygon_with_subject_bbox(hole, bbox));
         }
 
         out.erase(std::remove_if(out.begin(), out.end(), [](const Polygon &polygon) {return polygon.empty(); }), out.end());
@@ -482,17 +491,20 @@ static int offset_expolygon_inner(const Slic3r::ExPolygon &expoly, const float d
         append(out, std::move(contours));
     } else {
         // 2) Offset the holes one by one, collect the offsetted holes.
+        // The offsetter and its output buffer are reused for all the holes to keep the heap churn
+        // of this hot loop down.
         ClipperLib::Paths holes;
         {
+            ClipperLib::ClipperOffset co;
+            if (joinType == jtRound)
+                co.ArcTolerance = miterLimit;
+            else
+                co.MiterLimit = miterLimit;
+            co.ShortestEdgeLength = std::abs(delta * ClipperOffsetShortestEdgeFactor);
+            ClipperLib::Paths out2;
             for (const Polygon &hole : expoly.holes) {
-                ClipperLib::ClipperOffset co;
-                if (joinType == jtRound)
-                    co.ArcTolerance = miterLimit;
-                else
-                    co.MiterLimit = miterLimit;
-                co.ShortestEdgeLength = std::abs(delta * ClipperOffsetShortestEdgeFactor);
+                co.Clear();
                 co.AddPath(hole.points, joinType, ClipperLib::etClosedPolygon);
-                ClipperLib::Paths out2;
                 // Execute reorients the contours so that the outer most contour has a positive area. Thus the output
                 // contours will be CCW oriented even though the input paths are CW oriented.
                 // Offset is applied after contour reorientation, thus the signum of the offset value is reversed.
@@ -613,6 +625,45 @@ ExPolygons offset2_ex(const Surfaces &surfaces, const float delta1, const float
     return PolyTreeToExPolygons(offset_paths<ClipperLib::PolyTree>(expolygons_offset(surfaces, delta1, joinType, miterLimit), delta2, joinType, miterLimit));
 }
 
+// Apply the remaining steps of an offset chain to paths already converted to the Clipper representation.
+// The intermediate results stay in the Clipper representation, only the last step produces TResult.
+template<class TResult>
+static TResult offset_chain_paths(ClipperLib::Paths &&paths, const float *it, const float *last, ClipperLib::JoinType joinType, double miterLimit)
+{
+    for (; it != last; ++ it)
+        paths = offset_paths<ClipperLib::Paths>(std::move(paths), *it, joinType, miterLimit);
+    return offset_paths<TResult>(std::move(paths), *last, joinType, miterLimit);
+}
+
+Polygons offset_chain(const Polygons &polygons, std::initializer_list<float> deltas, ClipperLib::JoinType joinType, double miterLimit)
+{
+    assert(deltas.size() >= 2);
+    return to_polygons(offset_chain_paths<ClipperLib::Paths>(
+        offset_paths<ClipperLib::Paths>(ClipperUtils::PolygonsProvider(polygons), *deltas.begin(), joinType, miterLimit),
+        deltas.begin() + 1, deltas.end() - 1, joinType, miterLimit));
+}
+Polygons offset_chain(const ExPolygons &expolygons, std::initializer_list<float> deltas, ClipperLib::JoinType joinType, double miterLimit)
+{
+    assert(deltas.size() >= 2);
+    return to_polygons(offset_chain_paths<ClipperLib::Paths>(
+        expolygons_offset(expolygons, *deltas.begin(), joinType, miterLimit),
+        deltas.begin() + 1, deltas.end() - 1, joinType, miterLimit));
+}
+ExPolygons offset_chain_ex(const Polygons &polygons, std::initializer_list<float> deltas, ClipperLib::JoinType joinType, double miterLimit)
+{
+    assert(deltas.size() >= 2);
+    return PolyTreeToExPolygons(offset_chain_paths<ClipperLib::PolyTree>(
+        offset_paths<ClipperLib::Paths>(ClipperUtils::PolygonsProvider(polygons), *deltas.begin(), joinType, miterLimit),
+        deltas.begin() + 1, deltas.end() - 1, joinType, miterLimit));
+}
+ExPolygons offset_chain_ex(const ExPolygons &expolygons, std::initializer_list<float> deltas, ClipperLib::JoinType joinType, double miterLimit)
+{
+    assert(deltas.size() >= 2);
+    return PolyTreeToExPolygons(offset_chain_paths<ClipperLib::PolyTree>(
+        expolygons_offset(expolygons, *deltas.begin(), joinType, miterLimit),
+        deltas.begin() + 1, deltas.end() - 1, joinType, miterLimit));
+}
+
 // Offset outside, then inside produces morphological closing. All deltas should be positive.
 Slic3r::Polygons closing(const Slic3r::Polygons &polygons, const float delta1, const float delta2, ClipperLib::JoinType joinType, double miterLimit)
 {
@@ -816,6 +867,81 @@ Slic3r::ExPolygons union_ex(const Slic3r::ExPolygons &subject, const Slic3r::Pol
 Slic3r::ExPolygons union_ex(const Slic3r::Surfaces &subject)
     { return PolyTreeToExPolygons(clipper_do_polytree(ClipperLib::ctUnion, ClipperUtils::SurfacesProvider(subject), ClipperUtils::EmptyPathsProvider(), ClipperLib::pftNonZero)); }
 
+// Order the polygons by their bounding box center so that each chunk of the hierarchical union
+// unites mostly local geometry. The order only depends on the input, ties are broken by the input index,
+// thus the partitioning is deterministic and independent of the number of worker threads.
+static std::vector<size_t> hierarchical_union_order(const Polygons &polygons)
+{
+    Points centers(polygons.size());
+    for (size_t i = 0; i < polygons.size(); ++ i)
+        centers[i] = get_extents(polygons[i]).center();
+    std::vector<size_t> order(polygons.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&centers](size_t l, size_t r) {
+        return centers[l].x() < centers[r].x() ||
+              (centers[l].x() == centers[r].x() && (centers[l].y() < centers[r].y() ||
+              (centers[l].y() == centers[r].y() && l < r)));
+    });
+    return order;
+}
+
+// Union the input polygons by a hierarchical reduction: chunks of spatially close polygons are united
+// in parallel, the partial results are then merged pairwise until a single set of paths remains.
+// The chunking and the merge tree only depend on the input, thus the output is reproducible
+// across thread counts. chunk_union_fn unites one chunk of input polygons into ClipperLib::Paths.
+template<typename ChunkUnionFn>
+static ClipperLib::Paths hierarchical_union_paths(const Polygons &polygons, const size_t chunk_size, ChunkUnionFn chunk_union_fn)
+{
+    const std::vector<size_t>      order      = hierarchical_union_order(polygons);
+    const size_t                   num_chunks = (polygons.size() + chunk_size - 1) / chunk_size;
+    std::vector<ClipperLib::Paths> partial(num_chunks);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_chunks),
+        [&polygons, &order, chunk_size, &chunk_union_fn, &partial](const tbb::blocked_range<size_t> &range) {
+            for (size_t chunk_idx = range.begin(); chunk_idx < range.end(); ++ chunk_idx) {
+                size_t   begin = chunk_idx * chunk_size;
+                size_t   end   = std::min(begin + chunk_size, order.size());
+                Polygons chunk;
+                chunk.reserve(end - begin);
+                for (size_t i = begin; i < end; ++ i)
+                    chunk.emplace_back(polygons[order[i]]);
+                partial[chunk_idx] = chunk_union_fn(chunk);
+            }
+        });
+    while (partial.size() > 1) {
+        std::vector<ClipperLib::Paths> merged((partial.size() + 1) / 2);
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, partial.size() / 2),
+            [&partial, &merged](const tbb::blocked_range<size_t> &range) {
+                for (size_t i = range.begin(); i < range.end(); ++ i) {
+                    append(partial[2 * i], std::move(partial[2 * i + 1]));
+                    merged[i] = clipper_union<ClipperLib::Paths>(partial[2 * i]);
+                }
+            });
+        if ((partial.size() & 1) != 0)
+            merged.back() = std::move(partial.back());
+        partial = std::move(merged);
+    }
+    return std::move(partial.front());
+}
+
+Slic3r::ExPolygons union_ex_parallel(const Slic3r::Polygons &subject)
+{
+    // Fixed per host, thus the chunking and with it the output ordering stay reproducible from run to run.
+    const size_t chunk_size = execution::calibrated_granularity(execution::CalibratedKernel::Clipper, 256);
+    if (subject.size() <= chunk_size)
+        return union_ex(subject);
+    return PolyTreeToExPolygons(clipper_union<ClipperLib::PolyTree>(hierarchical_union_paths(subject, chunk_size,
+        [](const Polygons &chunk) { return clipper_union<ClipperLib::Paths>(ClipperUtils::PolygonsProvider(chunk)); })));
+}
+
+Slic3r::ExPolygons union_safety_offset_ex_parallel(const Slic3r::Polygons &subject)
+{
+    const size_t chunk_size = execution::calibrated_granularity(execution::CalibratedKernel::Clipper, 256);
+    if (subject.size() <= chunk_size)
+        return union_safety_offset_ex(subject);
+    return PolyTreeToExPolygons(clipper_union<ClipperLib::PolyTree>(hierarchical_union_paths(subject, chunk_size,
+        [](const Polygons &chunk) { return expand_paths<ClipperLib::Paths>(ClipperUtils::PolygonsProvider(chunk), ClipperSafetyOffset, DefaultJoinType, DefaultMiterLimit); })));
+}
+
 template<typename PathsProvider1, typename PathsProvider2>
 Polylines _clipper_pl_open(ClipperLib::ClipType clipType, PathsProvider1 &&subject, PathsProvider2 &&clip)
 {
@@ -8,6 +8,8 @@
 
 //#define SLIC3R_USE_CLIPPER2
 
+#include <initializer_list>
+
 #include "libslic3r.h"
 #include "ExPolygon.hpp"
 #include "Polygon.hpp"
@@ -372,6 +374,15 @@ Slic3r::Polygons   union_safety_offset(const Slic3r::ExPolygons &expolygons);
 Slic3r::ExPolygons union_safety_offset_ex(const Slic3r::Polygons &polygons);
 Slic3r::ExPolygons union_safety_offset_ex(const Slic3r::ExPolygons &expolygons);
 
+// Union a large polygon set by a hierarchical reduction: chunks of spatially close polygons are united
+// in parallel, the partial results are merged pairwise. Intended for inputs large enough for the
+// superlinear runtime of a single Clipper union to dominate, small inputs fall back to the serial variants.
+// The chunking and the merge tree only depend on the input geometry, thus the output is deterministic
+// and independent of the number of worker threads. The output may however be ordered differently
+// from the output of the respective serial variant.
+Slic3r::ExPolygons union_ex_parallel(const Slic3r::Polygons &subject);
+Slic3r::ExPolygons union_safety_offset_ex_parallel(const Slic3r::Polygons &subject);
+
 // Aliases for the various offset(...) functions, conveying the purpose of the offset.
 inline Slic3r::Polygons   expand(const Slic3r::Polygon &polygon, const float delta, ClipperLib::JoinType joinType = DefaultJoinType, double miterLimit = DefaultMiterLimit) 
     { assert(delta > 0); return offset(polygon, delta, joinType, miterLimit); }
@@ -395,6 +406,14 @@ Slic3r::Polygons   offset2(const Slic3r::ExPolygons &expolygons, const float del
 Slic3r::ExPolygons offset2_ex(const Slic3r::ExPolygons &expolygons, const float delta1, const float delta2, ClipperLib::JoinType joinType = DefaultJoinType, double miterLimit = DefaultMiterLimit);
 Slic3r::ExPolygons offset2_ex(const Slic3r::Surfaces &surfaces, const float delta1, const float delta2, ClipperLib::JoinType joinType = DefaultJoinType, double miterLimit = DefaultMiterLimit);
 
+// Chain of offsets, a generalization of offset2() to any number of steps. Each step is equivalent to one offset() call,
+// however the intermediate results are kept in Clipper's native path representation, the conversion between the Slic3r
+// and the Clipper representation is only performed on the input and on the final result. At least two deltas are expected.
+Slic3r::Polygons   offset_chain(const Slic3r::Polygons &polygons, std::initializer_list<float> deltas, ClipperLib::JoinType joinType = DefaultJoinType, double miterLimit = DefaultMiterLimit);
+Slic3r::Polygons   offset_chain(const Slic3r::ExPolygons &expolygons, std::initializer_list<float> deltas, ClipperLib::JoinType joinType = DefaultJoinType, double miterLimit = DefaultMiterLimit);
+Slic3r::ExPolygons offset_chain_ex(const Slic3r::Polygons &polygons, std::initializer_list<float> deltas, ClipperLib::JoinType joinType = DefaultJoinType, double miterLimit = DefaultMiterLimit);
+Slic3r::ExPolygons offset_chain_ex(const Slic3r::ExPolygons &expolygons, std::initializer_list<float> deltas, ClipperLib::JoinType joinType = DefaultJoinType, double miterLimit = DefaultMiterLimit);
+
 // Offset outside, then inside produces morphological closing. All deltas should be positive.
 Slic3r::Polygons          closing(const Slic3r::Polygons &polygons, const float delta1, const float delta2, ClipperLib::JoinType joinType = DefaultJoinType, double miterLimit = DefaultMiterLimit);
 inline Slic3r::Polygons   closing(const Slic3r::Polygons &polygons, const float delta, ClipperLib::JoinType joinType = DefaultJoinType, double miterLimit = DefaultMiterLimit) 
@@ -515,7 +515,22 @@ void ConfigBase::apply_only(const ConfigBase &other, const t_config_option_keys
 
 // Are the two configs equal? Ignoring options not present in both configs.
 bool ConfigBase::equals(const ConfigBase &other) const
-{ 
+{
+    if (const DynamicConfig *other_dyn = dynamic_cast<const DynamicConfig*>(&other); other_dyn != nullptr) {
+        if (const DynamicConfig *this_dyn = dynamic_cast<const DynamicConfig*>(this); this_dyn != nullptr)
+            // Both configs are dynamic, the coordinated walk over the two sorted option maps applies.
+            return this_dyn->equals(*other_dyn);
+        // Walk the sorted option map of the dynamic config directly. Compared to iterating this->keys(),
+        // it saves the allocation of the keys vector and one map lookup per option. This is the hot path
+        // of Print::apply() / SLAPrint::apply(), which diff static print configs against a full dynamic config
+        // on every background sync.
+        for (auto it = other_dyn->cbegin(); it != other_dyn->cend(); ++ it) {
+            const ConfigOption *this_opt = this->option(it->first);
+            if (this_opt != nullptr && *this_opt != *it->second)
+                return false;
+        }
+        return true;
+    }
     for (const t_config_option_key &opt_key : this->keys()) {
         const ConfigOption *this_opt  = this->option(opt_key);
         const ConfigOption *other_opt = other.option(opt_key);
@@ -528,6 +543,19 @@ bool ConfigBase::equals(const ConfigBase &other) const
 // Returns options differing in the two configs, ignoring options not present in both configs.
 t_config_option_keys ConfigBase::diff(const ConfigBase &other) const
 {
+    if (const DynamicConfig *other_dyn = dynamic_cast<const DynamicConfig*>(&other); other_dyn != nullptr) {
+        if (const DynamicConfig *this_dyn = dynamic_cast<const DynamicConfig*>(this); this_dyn != nullptr)
+            return this_dyn->diff(*other_dyn);
+        // See ConfigBase::equals() for the rationale of walking the sorted option map of the dynamic config.
+        // Both the option map and this->keys() are sorted, thus the output order is preserved.
+        t_config_option_keys diff;
+        for (auto it = other_dyn->cbegin(); it != other_dyn->cend(); ++ it) {
+            const ConfigOption *this_opt = this->option(it->first);
+            if (this_opt != nullptr && *this_opt != *it->second)
+                diff.emplace_back(it->first);
+        }
+        return diff;
+    }
     t_config_option_keys diff;
     for (const t_config_option_key &opt_key : this->keys()) {
         const ConfigOption *this_opt  = this->option(opt_key);
@@ -541,6 +569,18 @@ t_config_option_keys ConfigBase::diff(const ConfigBase &other) const
 // Returns options being equal in the two configs, ignoring options not present in both configs.
 t_config_option_keys ConfigBase::equal(const ConfigBase &other) const
 {
+    if (const DynamicConfig *other_dyn = dynamic_cast<const DynamicConfig*>(&other); other_dyn != nullptr) {
+        if (const DynamicConfig *this_dyn = dynamic_cast<const DynamicConfig*>(this); this_dyn != nullptr)
+            return this_dyn->equal(*other_dyn);
+        // See ConfigBase::equals() for the rationale of walking the sorted option map of the dynamic config.
+        t_config_option_keys equal;
+        for (auto it = other_dyn->cbegin(); it != other_dyn->cend(); ++ it) {
+            const ConfigOption *this_opt = this->option(it->first);
+            if (this_opt != nullptr && *this_opt == *it->second)
+                equal.emplace_back(it->first);
+        }
+        return equal;
+    }
     t_config_option_keys equal;
     for (const t_config_option_key &opt_key : this->keys()) {
         const ConfigOption *this_opt  = this->option(opt_key);
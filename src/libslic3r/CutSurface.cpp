@@ -34,6 +34,7 @@ using namespace Slic3r;
 #include <CGAL/Surface_mesh.h>
 #include <CGAL/Cartesian_converter.h>
 #include <tbb/parallel_for.h>
+#include <tbb/parallel_invoke.h>
 
 // libslic3r
 #include "TriangleMesh.hpp" // its_merge
@@ -549,21 +550,31 @@ SurfaceCut Slic3r::cut_surface(const ExPolygons &shapes,
 
     // for filttrate opposite triangles and a little more
     const float max_angle = 89.9f;
-    priv::CutMeshes cgal_models; // source for patch
-    priv::CutMeshes cgal_neg_models; // model used for differenciate patches
-    cgal_models.reserve(models.size());
-    for (const indexed_triangle_set &its : models) {
-        std::vector<bool> skip_indicies(its.indices.size(), {false});
-        priv::set_skip_for_out_of_aoi(skip_indicies, its, projection, shapes_bb);
-
-        // create model for differenciate cutted patches
-        bool flip = true;
-        cgal_neg_models.push_back(priv::to_cgal(its, skip_indicies, flip));
-        
-        // cut out more than only opposit triangles 
-        priv::set_skip_by_angle(skip_indicies, its, projection, max_angle);
-        cgal_models.push_back(priv::to_cgal(its, skip_indicies));
-    }
+    priv::CutMeshes cgal_models(models.size()); // source for patch
+    priv::CutMeshes cgal_neg_models(models.size()); // model used for differenciate patches
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, models.size()),
+    [&models, &projection, &shapes_bb, &cgal_models, &cgal_neg_models, max_angle]
+    (const tbb::blocked_range<size_t> &range) {
+        for (size_t model_index = range.begin(); model_index < range.end(); ++model_index) {
+            const indexed_triangle_set &its = models[model_index];
+            std::vector<bool> skip_indicies(its.indices.size(), {false});
+            priv::set_skip_for_out_of_aoi(skip_indicies, its, projection, shapes_bb);
+
+            // Both CGAL meshes are built from an independent snapshot of the skip flags,
+            // so the two conversions may run concurrently.
+            tbb::parallel_invoke(
+                [&its, skip_indicies, &cgal_neg_models, model_index]() {
+                    // create model for differenciate cutted patches
+                    bool flip = true;
+                    cgal_neg_models[model_index] = priv::to_cgal(its, skip_indicies, flip);
+                },
+                [&its, &skip_indicies, &projection, max_angle, &cgal_models, model_index]() {
+                    // cut out more than only opposit triangles
+                    priv::set_skip_by_angle(skip_indicies, its, projection, max_angle);
+                    cgal_models[model_index] = priv::to_cgal(its, skip_indicies);
+                });
+        }
+    }); // END parallel for
 #ifdef DEBUG_OUTPUT_DIR
     priv::store(cgal_models, DEBUG_OUTPUT_DIR + "model/");// model[0-N].off
     priv::store(cgal_neg_models, DEBUG_OUTPUT_DIR + "model_neg/"); // model[0-N].off
@@ -17,6 +17,9 @@
 #include <cmath>
 #include <cassert>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 // #define CONTOUR_DISTANCE_DEBUG_SVG
 
 namespace Slic3r {
@@ -574,31 +577,36 @@ ExPolygon elephant_foot_compensation(const ExPolygon &input_expoly, double min_c
 		bbox.offset(SCALED_EPSILON);
 		grid.set_bbox(bbox);
 		grid.create(simplified, coord_t(0.7 * search_radius));
-		std::vector<std::vector<float>> deltas;
-		deltas.reserve(simplified.holes.size() + 1);
+		std::vector<std::vector<float>> deltas(simplified.holes.size() + 1);
 		ExPolygon resampled(simplified);
 		double resample_interval = scale_(0.5);
-		for (size_t idx_contour = 0; idx_contour <= simplified.holes.size(); ++ idx_contour) {
-			Polygon &poly = (idx_contour == 0) ? resampled.contour : resampled.holes[idx_contour - 1];
-			std::vector<ResampledPoint> resampled_point_parameters;
-			poly.points = resample_polygon(poly.points, resample_interval, resampled_point_parameters);
-			assert(poly.is_counter_clockwise() == (idx_contour == 0));
-			std::vector<float> dists = contour_distance2(grid, idx_contour, poly.points, resampled_point_parameters, scaled_compensation, search_radius);
-			for (float &d : dists) {
-	//			printf("Point %d, Distance: %lf\n", int(&d - dists.data()), unscale<double>(d));
-				// Convert contour width to available compensation distance.
-				if (d < min_contour_width)
-					d = 0.f;
-				else if (d > min_contour_width_compensated)
-					d = - float(scaled_compensation);
-				else
-					d = - (d - float(min_contour_width)) / 2.f;
-				assert(d >= - float(scaled_compensation) && d <= 0.f);
+		// The contours only read the shared grid and each of them resamples a different polygon of the ExPolygon,
+		// thus they are processed in parallel.
+		tbb::parallel_for(tbb::blocked_range<size_t>(0, simplified.holes.size() + 1),
+			[&grid, &resampled, &deltas, resample_interval, scaled_compensation, search_radius, min_contour_width, min_contour_width_compensated]
+			(const tbb::blocked_range<size_t> &range) {
+			for (size_t idx_contour = range.begin(); idx_contour < range.end(); ++ idx_contour) {
+				Polygon &poly = (idx_contour == 0) ? resampled.contour : resampled.holes[idx_contour - 1];
+				std::vector<ResampledPoint> resampled_point_parameters;
+				poly.points = resample_polygon(poly.points, resample_interval, resampled_point_parameters);
+				assert(poly.is_counter_clockwise() == (idx_contour == 0));
+				std::vector<float> dists = contour_distance2(grid, idx_contour, poly.points, resampled_point_parameters, scaled_compensation, search_radius);
+				for (float &d : dists) {
+		//			printf("Point %d, Distance: %lf\n", int(&d - dists.data()), unscale<double>(d));
+					// Convert contour width to available compensation distance.
+					if (d < min_contour_width)
+						d = 0.f;
+					else if (d > min_contour_width_compensated)
+						d = - float(scaled_compensation);
+					else
+						d = - (d - float(min_contour_width)) / 2.f;
+					assert(d >= - float(scaled_compensation) && d <= 0.f);
+				}
+		//		smooth_compensation(dists, 0.4f, 10);
+				smooth_compensation_banded(poly.points, float(0.8 * resample_interval), dists, 0.3f, 3);
+				deltas[idx_contour] = std::move(dists);
 			}
-	//		smooth_compensation(dists, 0.4f, 10);
-			smooth_compensation_banded(poly.points, float(0.8 * resample_interval), dists, 0.3f, 3);
-			deltas.emplace_back(dists);
-		}
+		});
 
 		ExPolygons out_vec = variable_offset_inner_ex(resampled, deltas, 2.);
 		if (out_vec.size() == 1 && out_vec.front().holes.size() == resampled.holes.size())
@@ -633,19 +641,20 @@ ExPolygon  elephant_foot_compensation(const ExPolygon  &input, const Flow &exter
 
 ExPolygons elephant_foot_compensation(const ExPolygons &input, const Flow &external_perimeter_flow, const double compensation)
 {
-	ExPolygons out;
-	out.reserve(input.size());
-	for (const ExPolygon &expoly : input)
-		out.emplace_back(elephant_foot_compensation(expoly, external_perimeter_flow, compensation));
-	return out;
+    // The contour shall be wide enough to apply the external perimeter plus compensation on both sides.
+    double min_contour_width = double(external_perimeter_flow.width() + external_perimeter_flow.spacing());
+    return elephant_foot_compensation(input, min_contour_width, compensation);
 }
 
 ExPolygons elephant_foot_compensation(const ExPolygons &input, double min_contour_width, const double compensation)
 {
-	ExPolygons out;
-	out.reserve(input.size());
-	for (const ExPolygon &expoly : input)
-		out.emplace_back(elephant_foot_compensation(expoly, min_contour_width, compensation));
+	// The ExPolygons are compensated independently of each other, each building its own EdgeGrid.
+	ExPolygons out(input.size());
+	tbb::parallel_for(tbb::blocked_range<size_t>(0, input.size()),
+		[&input, &out, min_contour_width, compensation](const tbb::blocked_range<size_t> &range) {
+		for (size_t i = range.begin(); i < range.end(); ++ i)
+			out[i] = elephant_foot_compensation(input[i], min_contour_width, compensation);
+	});
 	return out;
 }
 
@@ -9,6 +9,7 @@
 #include <cstdlib>
 #include <boost/nowide/convert.hpp>
 #include <boost/log/trivial.hpp>
+#include <tbb/parallel_for.h>
 #include <ClipperUtils.hpp> // union_ex + for boldness(polygon extend(offset))
 #include "IntersectionPoints.hpp"
 
@@ -85,8 +86,12 @@ bool is_valid(const FontFile &font, unsigned int index);
 fontinfo_opt load_font_info(const unsigned char *data, unsigned int index = 0);
 std::optional<Glyph> get_glyph(const stbtt_fontinfo &font_info, int unicode_letter, float flatness);
 
+// digitize a glyph without touching the cache - used for parallel cache prefill
+std::optional<Glyph> create_glyph(int unicode, const FontFile &font, const FontProp &font_prop,
+        fontinfo_opt &font_info_opt);
+
 // take glyph from cache
-const Glyph* get_glyph(int unicode, const FontFile &font, const FontProp &font_prop, 
+const Glyph* get_glyph(int unicode, const FontFile &font, const FontProp &font_prop,
         Glyphs &cache, fontinfo_opt &font_info_opt);
 
 // scale and convert float to int coordinate
@@ -315,9 +320,10 @@ bool Emboss::divide_segments_for_close_point(ExPolygons &expolygons, double dist
     remove_same_neighbor(expolygons);
 
     // IMPROVE: use int(insted of double) lines and tree
-    const ExPolygonsIndices ids(expolygons);
-    const std::vector<Linef> lines = Slic3r::to_linesf(expolygons, ids.get_count());
-    AABBTreeIndirect::Tree<2, double> tree = AABBTreeLines::build_aabb_tree_over_indexed_lines(lines);
+    ExPolygonsLineIndex line_index(expolygons);
+    const ExPolygonsIndices &ids = line_index.indices();
+    const std::vector<Linef> &lines = line_index.lines();
+    const AABBTreeIndirect::Tree2d &tree = line_index.tree();
     using Div = std::pair<Point, size_t>;
     std::vector<Div> divs;
     size_t point_index = 0;
@@ -760,25 +766,22 @@ std::optional<Glyph> get_glyph(const stbtt_fontinfo &font_info, int unicode_lett
     return glyph;
 }
 
-const Glyph* get_glyph(
+std::optional<Glyph> create_glyph(
     int              unicode,
     const FontFile & font,
     const FontProp & font_prop,
-    Glyphs &         cache,
     fontinfo_opt &font_info_opt)
 {
     // TODO: Use resolution by printer configuration, or add it into FontProp
     const float RESOLUTION = 0.0125f; // [in mm]
-    auto glyph_item = cache.find(unicode);
-    if (glyph_item != cache.end()) return &glyph_item->second;
 
     unsigned int font_index = font_prop.collection_number.value_or(0);
-    if (!is_valid(font, font_index)) return nullptr;
+    if (!is_valid(font, font_index)) return {};
 
-    if (!font_info_opt.has_value()) {        
+    if (!font_info_opt.has_value()) {
         font_info_opt = load_font_info(font.data->data(), font_index);
         // can load font info?
-        if (!font_info_opt.has_value()) return nullptr;
+        if (!font_info_opt.has_value()) return {};
     }
 
     float flatness = font.infos[font_index].unit_per_em / font_prop.size_in_mm * RESOLUTION;
@@ -790,10 +793,10 @@ const Glyph* get_glyph(
 
     // IMPROVE: multiple loadig glyph without data
     // has definition inside of font?
-    if (!glyph_opt.has_value()) return nullptr;
+    if (!glyph_opt.has_value()) return {};
 
     Glyph &glyph = *glyph_opt;
-    if (font_prop.char_gap.has_value()) 
+    if (font_prop.char_gap.has_value())
         glyph.advance_width += *font_prop.char_gap;
 
     // scale glyph size
@@ -817,7 +820,23 @@ const Glyph* get_glyph(
             }
         }
     }
-    auto [it, success] = cache.try_emplace(unicode, std::move(glyph));
+    return glyph_opt;
+}
+
+const Glyph* get_glyph(
+    int              unicode,
+    const FontFile & font,
+    const FontProp & font_prop,
+    Glyphs &         cache,
+    fontinfo_opt &font_info_opt)
+{
+    auto glyph_item = cache.find(unicode);
+    if (glyph_item != cache.end()) return &glyph_item->second;
+
+    std::optional<Glyph> glyph_opt = create_glyph(unicode, font, font_prop, font_info_opt);
+    if (!glyph_opt.has_value()) return nullptr;
+
+    auto [it, success] = cache.try_emplace(unicode, std::move(*glyph_opt));
     assert(success);
     return &it->second;
 }
@@ -1330,7 +1349,38 @@ ExPolygonsWithIds Emboss::text2vshapes(FontFileWithCache &font_with_cache, const
     unsigned counter = CANCEL_CHECK-1; // it is needed to validate using of cache
     Point cursor(0, 0);
 
-    fontinfo_opt font_info_cache;  
+    // Digitize the glyphs missing in the cache in parallel before the sequential
+    // layout pass below. Glyph extraction and tesselation are independent per
+    // letter, only the cursor advancement has to stay sequential.
+    {
+        std::vector<int> missing;
+        missing.reserve(text.size());
+        for (wchar_t letter : text) {
+            if (letter == '\n' || letter == '\r')
+                continue;
+            int unicode = (letter == '\t') ? int(' ') : static_cast<int>(letter);
+            if (cache->find(unicode) == cache->end())
+                missing.emplace_back(unicode);
+        }
+        std::sort(missing.begin(), missing.end());
+        missing.erase(std::unique(missing.begin(), missing.end()), missing.end());
+        if (missing.size() > 1) {
+            std::vector<std::optional<Glyph>> glyphs(missing.size());
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, missing.size()),
+                [&font, &font_prop, &missing, &glyphs](const tbb::blocked_range<size_t> &range) {
+                    fontinfo_opt font_info_local;
+                    for (size_t i = range.begin(); i < range.end(); ++ i)
+                        glyphs[i] = create_glyph(missing[i], font, font_prop, font_info_local);
+                });
+            for (size_t i = 0; i < missing.size(); ++ i)
+                if (glyphs[i].has_value())
+                    cache->try_emplace(missing[i], std::move(*glyphs[i]));
+            if (was_canceled())
+                return {};
+        }
+    }
+
+    fontinfo_opt font_info_cache;
     ExPolygonsWithIds result;
     result.reserve(text.size());
     for (wchar_t letter : text) {
@@ -20,6 +20,7 @@
 #include "SVG.hpp"
 #include <algorithm>
 #include <cassert>
+#include <tbb/parallel_for.h>
 #include <list>
 
 #include <ankerl/unordered_dense.h>
@@ -85,6 +86,15 @@ void ExPolygon::douglas_peucker(double tolerance)
         poly.douglas_peucker(tolerance);
 }
 
+void expolygons_douglas_peucker(ExPolygons &expolys, double tolerance)
+{
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, expolys.size()),
+        [&expolys, tolerance](const tbb::blocked_range<size_t> &range) {
+            for (size_t i = range.begin(); i < range.end(); ++ i)
+                expolys[i].douglas_peucker(tolerance);
+        });
+}
+
 bool ExPolygon::contains(const Line &line) const
 {
     return this->contains(Polyline(line.a, line.b));
@@ -463,6 +463,10 @@ inline ExPolygons expolygons_simplify(const ExPolygons &expolys, double toleranc
 	return out;
 }
 
+// Apply Douglas-Peucker simplification to the contours and holes of each
+// expolygon in place, parallelized over the expolygons.
+void expolygons_douglas_peucker(ExPolygons &expolys, double tolerance);
+
 // Do expolygons match? If they match, they must have the same topology,
 // however their contours may be rotated.
 bool expolygons_match(const ExPolygon &l, const ExPolygon &r);
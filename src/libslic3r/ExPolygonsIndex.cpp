@@ -1,4 +1,8 @@
 #include "ExPolygonsIndex.hpp"
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 using namespace Slic3r;
 
 // IMPROVE: use one dimensional vector for polygons offset with searching by std::lower_bound
@@ -79,4 +83,111 @@ bool ExPolygonsIndices::is_last_point(const ExPolygonsIndex &id) const {
     return next_point_index == shape_offset[next_poly_index];
 }
 
-uint32_t ExPolygonsIndices::get_count() const { return m_count; }		
+uint32_t ExPolygonsIndices::get_count() const { return m_count; }
+
+uint32_t ExPolygonsIndices::get_expolygons_count() const { return m_offsets.size(); }
+
+uint32_t ExPolygonsIndices::get_polygons_count(uint32_t expolygons_index) const
+{
+    assert(expolygons_index < m_offsets.size());
+    return m_offsets[expolygons_index].size();
+}
+
+ExPolygonsLineIndex::ExPolygonsLineIndex(const ExPolygons &shapes)
+    : m_shapes(&shapes), m_indices(shapes)
+{}
+
+void ExPolygonsLineIndex::invalidate(uint32_t expolygons_index)
+{
+    m_dirty.push_back(expolygons_index);
+    m_valid = false;
+}
+
+void ExPolygonsLineIndex::invalidate()
+{
+    m_dirty.clear();
+    m_lines.clear();
+    m_valid = false;
+}
+
+void ExPolygonsLineIndex::ensure_valid()
+{
+    if (m_valid)
+        return;
+
+    // Write lines of one polygon into m_lines starting at slot offset,
+    // same ordering as Slic3r::to_linesf
+    auto extract_lines = [this](const Points &pts, uint32_t offset) {
+        for (size_t i = 1; i < pts.size(); ++ i)
+            m_lines[offset + i - 1] = Linef(pts[i - 1].cast<double>(), pts[i].cast<double>());
+        m_lines[offset + pts.size() - 1] = Linef(pts.back().cast<double>(), pts.front().cast<double>());
+    };
+
+    bool rebuild = m_lines.empty();
+    if (!rebuild) {
+        // Check that the changed expolygons kept their point counts,
+        // otherwise the offsets are no more valid and the index is rebuilt.
+        for (uint32_t expolygons_index : m_dirty) {
+            if (expolygons_index >= m_shapes->size() ||
+                expolygons_index >= m_indices.get_expolygons_count()) {
+                rebuild = true;
+                break;
+            }
+            const ExPolygon &shape = (*m_shapes)[expolygons_index];
+            uint32_t polygons_count = m_indices.get_polygons_count(expolygons_index);
+            if (polygons_count != shape.holes.size() + 1) {
+                rebuild = true;
+                break;
+            }
+            for (uint32_t polygon_index = 0; polygon_index < polygons_count && !rebuild; ++ polygon_index) {
+                const Points &pts = polygon_index == 0 ? shape.contour.points : shape.holes[polygon_index - 1].points;
+                uint32_t offset = m_indices.cvt(ExPolygonsIndex{expolygons_index, polygon_index, 0});
+                uint32_t next_offset =
+                    (polygon_index + 1 < polygons_count) ? m_indices.cvt(ExPolygonsIndex{expolygons_index, polygon_index + 1, 0}) :
+                    (expolygons_index + 1 < m_indices.get_expolygons_count()) ? m_indices.cvt(ExPolygonsIndex{expolygons_index + 1, 0, 0}) :
+                    m_indices.get_count();
+                if (next_offset - offset != pts.size())
+                    rebuild = true;
+            }
+            if (rebuild)
+                break;
+        }
+    }
+
+    if (rebuild) {
+        m_indices = ExPolygonsIndices(*m_shapes);
+        m_lines   = to_linesf(*m_shapes, m_indices.get_count());
+    } else {
+        // Re-extract lines of the changed expolygons only
+        for (uint32_t expolygons_index : m_dirty) {
+            const ExPolygon &shape = (*m_shapes)[expolygons_index];
+            extract_lines(shape.contour.points, m_indices.cvt(ExPolygonsIndex{expolygons_index, 0, 0}));
+            for (uint32_t hole_index = 0; hole_index < shape.holes.size(); ++ hole_index)
+                extract_lines(shape.holes[hole_index].points,
+                              m_indices.cvt(ExPolygonsIndex{expolygons_index, hole_index + 1, 0}));
+        }
+    }
+    m_tree = AABBTreeLines::build_aabb_tree_over_indexed_lines(m_lines);
+    m_dirty.clear();
+    m_valid = true;
+}
+
+std::vector<ExPolygonsLineIndex::NearestLine> ExPolygonsLineIndex::nearest_lines(const std::vector<Vec2d> &points)
+{
+    ensure_valid();
+    std::vector<NearestLine> result(points.size(), NearestLine{size_t(-1), Vec2d(), -1.});
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, points.size()), [this, &points, &result](const tbb::blocked_range<size_t> &range) {
+        for (size_t i = range.begin(); i < range.end(); ++ i) {
+            NearestLine &nearest = result[i];
+            nearest.distance_sqr = AABBTreeLines::squared_distance_to_indexed_lines(
+                m_lines, m_tree, points[i], nearest.line_index, nearest.hit_point);
+        }
+    });
+    return result;
+}
+
+std::vector<size_t> ExPolygonsLineIndex::lines_in_radius(const Vec2d &point, double radius)
+{
+    ensure_valid();
+    return AABBTreeLines::all_lines_in_radius(m_lines, m_tree, point, radius * radius);
+}
@@ -2,6 +2,7 @@
 #define slic3r_ExPolygonsIndex_hpp_
 
 #include "ExPolygon.hpp"
+#include "AABBTreeLines.hpp"
 namespace Slic3r {
 
 /// <summary>
@@ -68,6 +69,96 @@ public:
     /// </summary>
     /// <returns>Count of points in expolygons</returns>
     uint32_t get_count() const;
+
+    /// <summary>
+    /// Count of expolygons
+    /// </summary>
+    /// <returns>Count of expolygons</returns>
+    uint32_t get_expolygons_count() const;
+
+    /// <summary>
+    /// Count of polygons (contour and holes) in expolygon
+    /// </summary>
+    /// <param name="expolygons_index">Index of expolygon</param>
+    /// <returns>Count of polygons in expolygon</returns>
+    uint32_t get_polygons_count(uint32_t expolygons_index) const;
+};
+
+/// <summary>
+/// Cached line index over ExPolygons for repeated point-to-contour lookups
+/// (emboss surface projection, cut surface). Keeps the expanded lines and
+/// the AABB tree alive between queries instead of rebuilding them per call,
+/// and after an edit re-extracts lines of the changed expolygons only.
+/// The referenced ExPolygons must outlive the index.
+/// </summary>
+class ExPolygonsLineIndex
+{
+    const ExPolygons           *m_shapes;
+    ExPolygonsIndices           m_indices;
+    Linesf                      m_lines;
+    AABBTreeIndirect::Tree2d    m_tree;
+    // False when m_lines/m_tree need (partial) rebuild before the next query
+    bool                        m_valid = false;
+    // ExPolygons indices whose lines have to be re-extracted, empty m_lines means full rebuild
+    std::vector<uint32_t>       m_dirty;
+public:
+    ExPolygonsLineIndex(const ExPolygons &shapes);
+
+    /// <summary>
+    /// Conversion between line (point) index and adress into expolygons
+    /// </summary>
+    const ExPolygonsIndices &indices() const { return m_indices; }
+
+    /// <summary>
+    /// Lines of all contours and holes, indexed as Slic3r::to_linesf
+    /// </summary>
+    const Linesf &lines() { ensure_valid(); return m_lines; }
+
+    /// <summary>
+    /// AABB tree over lines()
+    /// </summary>
+    const AABBTreeIndirect::Tree2d &tree() { ensure_valid(); return m_tree; }
+
+    /// <summary>
+    /// Mark one expolygon as changed, only its lines are re-extracted on the next query.
+    /// When its point count changed the whole index is rebuilt.
+    /// </summary>
+    /// <param name="expolygons_index">Index of changed expolygon into shapes</param>
+    void invalidate(uint32_t expolygons_index);
+
+    /// <summary>
+    /// Discard the whole index, e.g. after expolygons were added or removed
+    /// </summary>
+    void invalidate();
+
+    /// Result of a nearest line query
+    struct NearestLine
+    {
+        // index of line, addressable by indices()
+        size_t line_index;
+        // closest point laying on the line
+        Vec2d  hit_point;
+        // squared distance of queried point to hit_point
+        double distance_sqr;
+    };
+
+    /// <summary>
+    /// Find the nearest contour line for each of the given points
+    /// </summary>
+    /// <param name="points">Queried points</param>
+    /// <returns>Nearest line for each point, line_index == size_t(-1) for an empty index</returns>
+    std::vector<NearestLine> nearest_lines(const std::vector<Vec2d> &points);
+
+    /// <summary>
+    /// Collect indices of all lines within radius around point
+    /// </summary>
+    /// <param name="point">Center of the queried circle</param>
+    /// <param name="radius">Radius of the queried circle</param>
+    /// <returns>Indices of lines closer than radius</returns>
+    std::vector<size_t> lines_in_radius(const Vec2d &point, double radius);
+
+private:
+    void ensure_valid();
 };
 
 } // namespace Slic3r
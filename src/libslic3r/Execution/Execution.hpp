@@ -53,6 +53,31 @@ void for_each(const EP &ep, It from, It to, Fn &&fn, size_t granularity = 1)
                            std::max(granularity, size_t(1)));
 }
 
+// Each execution policy should declare an affinity hint type. An instance kept alive by the
+// caller and passed to repeated for_each calls over the same data asks the scheduler to replay
+// the chunk to thread assignment of the previous run, improving cache locality.
+template<class EP> using AffinityHint = typename AsTraits<EP>::AffinityHint;
+
+// An overload of for_each caching the chunk to thread assignment inside the hint object.
+template<class EP, class It, class Fn, class = ExecutionPolicyOnly<EP>>
+void for_each(const EP &ep, AffinityHint<EP> &hint, It from, It to, Fn &&fn, size_t granularity = 1)
+{
+    AsTraits<EP>::for_each(ep, hint, from, to, std::forward<Fn>(fn),
+                           std::max(granularity, size_t(1)));
+}
+
+// foreach loop over an integer range with a per-element cost hint, for ranges with heavily
+// skewed per-element run time (e.g. object layers). costfn has size_t(I) signature and returns
+// a relative cost estimate of processing element i. The policy forms chunks of roughly equal
+// total cost instead of equal element count, so a work stealing scheduler is not left waiting
+// for a single chunk that happened to collect all the expensive elements.
+template<class EP, class I, class Fn, class CostFn, class = ExecutionPolicyOnly<EP>>
+void for_each_weighted(const EP &ep, I from, I to, Fn &&fn, CostFn &&costfn)
+{
+    AsTraits<EP>::for_each_weighted(ep, from, to, std::forward<Fn>(fn),
+                                    std::forward<CostFn>(costfn));
+}
+
 // A reduce operation with the execution policy passed as argument.
 // mergefn has T(const T&, const T&) signature
 // accessfn has T(I) signature if I is an integral type and
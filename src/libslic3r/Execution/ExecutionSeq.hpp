@@ -54,6 +54,7 @@ private:
 public:
     using SpinningMutex = _Mtx;
     using BlockingMutex = _Mtx;
+    struct AffinityHint {};
 
     template<class It, class Fn>
     static void for_each(const EP &,
@@ -65,6 +66,25 @@ public:
         loop_(from, to, std::forward<Fn>(fn));
     }
 
+    template<class It, class Fn>
+    static void for_each(const EP &,
+                         AffinityHint &/* no threads, nothing to replay */,
+                         It   from,
+                         It   to,
+                         Fn &&fn,
+                         size_t /* ignore granularity */ = 1)
+    {
+        loop_(from, to, std::forward<Fn>(fn));
+    }
+
+    template<class I, class Fn, class CostFn>
+    static void for_each_weighted(const EP &,
+                                  I from, I to, Fn &&fn,
+                                  CostFn && /* ignore cost hints */)
+    {
+        loop_(from, to, std::forward<Fn>(fn));
+    }
+
     template<class I, class MergeFn, class T, class AccessFn>
     static T reduce(const EP &,
                     I         from,
@@ -6,6 +6,7 @@
 #define EXECUTIONTBB_HPP
 
 #include <mutex>
+#include <vector>
 
 #include <tbb/spin_mutex.h>
 #include <tbb/parallel_for.h>
@@ -40,6 +41,7 @@ private:
 public:
     using SpinningMutex = tbb::spin_mutex;
     using BlockingMutex = std::mutex;
+    using AffinityHint  = tbb::affinity_partitioner;
 
     template<class It, class Fn>
     static void for_each(const ExecutionTBB &,
@@ -51,6 +53,47 @@ public:
         });
     }
 
+    template<class It, class Fn>
+    static void for_each(const ExecutionTBB &, AffinityHint &hint,
+                         It from, It to, Fn &&fn, size_t granularity)
+    {
+        tbb::parallel_for(tbb::blocked_range{from, to, granularity},
+                          [&fn](const auto &range) {
+            loop_(range, std::forward<Fn>(fn));
+        }, hint);
+    }
+
+    template<class I, class Fn, class CostFn>
+    static IntegerOnly<I, void> for_each_weighted(const ExecutionTBB &ep,
+                                                  I from, I to, Fn &&fn, CostFn &&costfn)
+    {
+        if (to <= from)
+            return;
+        std::vector<size_t> costs(size_t(to - from));
+        size_t total = 0;
+        for (I i = from; i < to; ++i)
+            total += costs[size_t(i - from)] = std::max(size_t(1), size_t(costfn(i)));
+        // Aim for a couple of chunks per worker: enough headroom for the stealing to correct
+        // an imperfect cost estimate, few enough to keep the scheduling overhead negligible.
+        size_t target = std::max(size_t(1), total / (4 * max_concurrency(ep)));
+        std::vector<I> chunks;
+        chunks.emplace_back(from);
+        size_t acc = 0;
+        for (I i = from; i < to; ++i) {
+            acc += costs[size_t(i - from)];
+            if (acc >= target && i + 1 < to) {
+                chunks.emplace_back(i + 1);
+                acc = 0;
+            }
+        }
+        chunks.emplace_back(to);
+        // Granularity of one: idle workers steal whole chunks, each already carrying
+        // a balanced share of the total cost.
+        tbb::parallel_for(size_t(0), chunks.size() - 1, [&chunks, &fn](size_t chunk) {
+            for (I i = chunks[chunk]; i < chunks[chunk + 1]; ++i) fn(i);
+        });
+    }
+
     template<class I, class MergeFn, class T, class AccessFn>
     static T reduce(const ExecutionTBB &,
                     I          from,
@@ -0,0 +1,219 @@
+///|/ Copyright (c) Prusa Research 2023 Vojtěch Bubník @bubnikv
+///|/
+///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
+///|/
+#include "GrainCalibration.hpp"
+
+#include "../ClipperUtils.hpp"
+#include "../ExPolygon.hpp"
+#include "../Point.hpp"
+#include "../Polygon.hpp"
+#include "../Polyline.hpp"
+#include "../Utils.hpp"
+
+#include <boost/log/trivial.hpp>
+#include <boost/nowide/fstream.hpp>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace Slic3r { namespace execution {
+
+// Key names of the calibrated kernels inside grain_calibration.ini, indexed by CalibratedKernel.
+static const char* grain_calibration_kernel_names[] = { "geometry", "clipper", "fill" };
+static_assert(sizeof(grain_calibration_kernel_names) / sizeof(grain_calibration_kernel_names[0]) == size_t(CalibratedKernel::Count),
+    "One key name per calibrated kernel");
+
+struct CalibrationProfile
+{
+    // Zero means "not calibrated, use the compiled-in default".
+    size_t values[size_t(CalibratedKernel::Count)] = { 0, 0, 0 };
+};
+
+static CalibrationProfile s_calibration_profile;
+static std::atomic<bool>  s_calibration_profile_loaded { false };
+static std::mutex         s_calibration_profile_mutex;
+
+static std::string grain_calibration_path()
+{
+    return data_dir().empty() ? std::string() : data_dir() + "/grain_calibration.ini";
+}
+
+static void load_calibration_profile()
+{
+    CalibrationProfile profile;
+    if (std::string path = grain_calibration_path(); ! path.empty()) {
+        boost::nowide::ifstream file(path);
+        std::string line;
+        while (std::getline(file, line)) {
+            size_t pos = line.find('=');
+            if (pos == std::string::npos)
+                continue;
+            std::string key = line.substr(0, pos);
+            key.erase(std::remove_if(key.begin(), key.end(), [](char c) { return c == ' ' || c == '\t'; }), key.end());
+            for (size_t i = 0; i < size_t(CalibratedKernel::Count); ++ i)
+                if (key == grain_calibration_kernel_names[i]) {
+                    long value = strtol(line.c_str() + pos + 1, nullptr, 10);
+                    if (value > 0)
+                        profile.values[i] = size_t(value);
+                    break;
+                }
+        }
+    }
+    s_calibration_profile = profile;
+}
+
+size_t calibrated_granularity(CalibratedKernel kernel, size_t def)
+{
+    if (! s_calibration_profile_loaded.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(s_calibration_profile_mutex);
+        if (! s_calibration_profile_loaded.load(std::memory_order_relaxed)) {
+            load_calibration_profile();
+            s_calibration_profile_loaded.store(true, std::memory_order_release);
+        }
+    }
+    size_t value = s_calibration_profile.values[size_t(kernel)];
+    return value > 0 ? value : def;
+}
+
+// Wall clock of the best out of three runs of fn, in seconds. The warm-up run inside the repeats
+// also pre-faults the working buffers, thus the first candidate is not penalized by page faults.
+template<typename Fn>
+static double benchmark_best_of(Fn &&fn)
+{
+    double best = std::numeric_limits<double>::max();
+    for (int run = 0; run < 3; ++ run) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+template<typename KernelFn>
+static size_t calibrate_kernel(const char *name, const std::vector<size_t> &candidates, KernelFn &&kernel_fn, std::ostringstream &report)
+{
+    report << name << ":\n";
+    size_t best_grain = candidates.front();
+    double best_time  = std::numeric_limits<double>::max();
+    for (size_t grain : candidates) {
+        double t = benchmark_best_of([&kernel_fn, grain]() { kernel_fn(grain); });
+        report << "    grain " << grain << ": " << t * 1000. << " ms\n";
+        if (t < best_time) {
+            best_time  = t;
+            best_grain = grain;
+        }
+    }
+    report << "    -> " << best_grain << "\n";
+    return best_grain;
+}
+
+// Stands in for the per-vertex transform of mesh slicing: a short arithmetic body over a flat buffer.
+static size_t calibrate_geometry_kernel(std::ostringstream &report)
+{
+    std::vector<float> src(4 * 1024 * 1024);
+    for (size_t i = 0; i < src.size(); ++ i)
+        src[i] = float(i & 0x3FF) * 0.001f;
+    std::vector<float> dst(src.size());
+    return calibrate_kernel("geometry (per-vertex transform)", { 1024, 2048, 4096, 8192, 16384, 32768 },
+        [&src, &dst](size_t grain) {
+            tbb::parallel_for(
+                tbb::blocked_range<size_t>(0, src.size(), grain),
+                [&src, &dst](const tbb::blocked_range<size_t> &range) {
+                    for (size_t i = range.begin(); i < range.end(); ++ i)
+                        dst[i] = src[i] * 0.70710678f + 42.f;
+                });
+        }, report);
+}
+
+// Stands in for the hierarchical parallel Clipper unions: per-chunk unions of small contours
+// followed by a merge of the partial results.
+static size_t calibrate_clipper_kernel(std::ostringstream &report)
+{
+    // A grid of touching squares, so that the unions have actual merging work to do.
+    static constexpr const coord_t edge = scaled<double>(1.);
+    Polygons squares;
+    for (coord_t y = 0; y < 128; ++ y)
+        for (coord_t x = 0; x < 64; ++ x) {
+            coord_t x0 = x * edge, y0 = y * edge;
+            squares.emplace_back(Points{ { x0, y0 }, { x0 + edge, y0 }, { x0 + edge, y0 + edge }, { x0, y0 + edge } });
+        }
+    return calibrate_kernel("clipper (chunked union)", { 64, 128, 256, 512, 1024 },
+        [&squares](size_t chunk_size) {
+            size_t num_chunks = (squares.size() + chunk_size - 1) / chunk_size;
+            std::vector<Polygons> partial(num_chunks);
+            tbb::parallel_for(size_t(0), num_chunks, [&squares, &partial, chunk_size](size_t chunk) {
+                Polygons in(squares.begin() + chunk * chunk_size,
+                            squares.begin() + std::min((chunk + 1) * chunk_size, squares.size()));
+                partial[chunk] = union_(in);
+            });
+            Polygons merged;
+            for (Polygons &p : partial)
+                append(merged, std::move(p));
+            union_ex(merged);
+        }, report);
+}
+
+// Stands in for the per-layer fill generation loop: a moderate number of coarse work items,
+// each clipping a set of hatch lines by a layer contour.
+static size_t calibrate_fill_kernel(std::ostringstream &report)
+{
+    static constexpr const coord_t size = scaled<double>(100.);
+    ExPolygon contour(Polygon{ { 0, 0 }, { size, 0 }, { size, size }, { 0, size } });
+    Polylines hatch;
+    for (coord_t x = 0; x < size; x += scaled<double>(0.45))
+        hatch.emplace_back(Points{ { x, - size / 8 }, { x, size + size / 8 } });
+    static constexpr const size_t num_layers = 64;
+    return calibrate_kernel("fill (per-layer clipping)", { 1, 2, 4, 8 },
+        [&contour, &hatch](size_t grain) {
+            tbb::parallel_for(
+                tbb::blocked_range<size_t>(0, num_layers, grain),
+                [&contour, &hatch](const tbb::blocked_range<size_t> &range) {
+                    for (size_t i = range.begin(); i < range.end(); ++ i)
+                        intersection_pl(hatch, contour);
+                });
+        }, report);
+}
+
+std::string run_grain_calibration()
+{
+    std::ostringstream report;
+    report << "Calibrating parallel grain sizes, this may take a while ...\n";
+
+    CalibrationProfile profile;
+    profile.values[size_t(CalibratedKernel::Geometry)] = calibrate_geometry_kernel(report);
+    profile.values[size_t(CalibratedKernel::Clipper)]  = calibrate_clipper_kernel(report);
+    profile.values[size_t(CalibratedKernel::Fill)]     = calibrate_fill_kernel(report);
+
+    if (std::string path = grain_calibration_path(); ! path.empty()) {
+        boost::nowide::ofstream file(path);
+        file << "# Host specific parallel grain sizes measured by --calibrate-parallelism.\n";
+        file << "# Delete this file to return to the compiled-in defaults.\n";
+        for (size_t i = 0; i < size_t(CalibratedKernel::Count); ++ i)
+            file << grain_calibration_kernel_names[i] << " = " << profile.values[i] << "\n";
+        report << "Stored into " << path << "\n";
+    } else {
+        BOOST_LOG_TRIVIAL(warning) << "Grain calibration: data directory not set, results will not be persisted";
+        report << "Data directory not set, results were not persisted.\n";
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(s_calibration_profile_mutex);
+        s_calibration_profile = profile;
+        s_calibration_profile_loaded.store(true, std::memory_order_release);
+    }
+    return report.str();
+}
+
+} } // namespace Slic3r::execution
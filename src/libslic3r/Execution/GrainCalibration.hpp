@@ -0,0 +1,41 @@
+///|/ Copyright (c) Prusa Research 2023 Vojtěch Bubník @bubnikv
+///|/
+///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
+///|/
+#ifndef GRAINCALIBRATION_HPP
+#define GRAINCALIBRATION_HPP
+
+#include <cstddef>
+#include <string>
+
+namespace Slic3r { namespace execution {
+
+// Computational kernels whose parallel grain size may be tuned per host by run_grain_calibration().
+// A single compiled-in grain constant cannot serve both a 4 core embedded box and a 96 core
+// workstation: the former wants coarse chunks to amortize scheduling overhead, the latter fine
+// chunks to keep all workers busy.
+enum class CalibratedKernel {
+    // Per-vertex / per-facet geometry transforms (mesh slicing).
+    Geometry,
+    // Chunk size of the hierarchical parallel Clipper unions.
+    Clipper,
+    // Per-layer granularity of the fill generation loop.
+    Fill,
+    Count
+};
+
+// Granularity to be used by the given kernel: the value calibrated on this host if a calibration
+// profile exists in the application data directory, the compiled-in default def otherwise.
+// The profile is loaded lazily on first call and cached, thus this query is cheap enough
+// to be evaluated at the head of a hot parallel loop.
+size_t calibrated_granularity(CalibratedKernel kernel, size_t def);
+
+// Benchmark representative computational kernels on this host over a range of candidate grain
+// sizes, store the winners into "grain_calibration.ini" inside the application data directory
+// and make them available to calibrated_granularity() immediately.
+// Returns a human readable report of the measurements, to be shown on the console.
+std::string run_grain_calibration();
+
+} } // namespace Slic3r::execution
+
+#endif // GRAINCALIBRATION_HPP
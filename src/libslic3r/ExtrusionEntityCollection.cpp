@@ -142,6 +142,15 @@ ExtrusionEntityCollection ExtrusionEntityCollection::flatten(bool preserve_order
     return flatten.out;
 }
 
+void ExtrusionEntityCollection::collect_entities(std::vector<const ExtrusionEntity*> &dst) const
+{
+    for (const ExtrusionEntity *entity : this->entities)
+        if (entity->is_collection())
+            static_cast<const ExtrusionEntityCollection*>(entity)->collect_entities(dst);
+        else
+            dst.emplace_back(entity);
+}
+
 double ExtrusionEntityCollection::min_mm3_per_mm() const
 {
     double min_mm3_per_mm = std::numeric_limits<double>::max();
@@ -127,6 +127,16 @@ public:
     /// You should be iterating over flatten().entities if you are interested in the underlying ExtrusionEntities (and don't care about hierarchy).
     /// \param preserve_ordering Flag to method that will flatten if and only if the underlying collection is sortable when True (default: False).
     ExtrusionEntityCollection flatten(bool preserve_ordering = false) const;
+    /// Collect pointers to all non-collection entities of this collection, recursively, in depth first order.
+    /// Unlike flatten(), nothing is cloned: the pointers reference entities owned by this collection
+    /// and stay valid only until the collection is modified.
+    void collect_entities(std::vector<const ExtrusionEntity*> &dst) const;
+    std::vector<const ExtrusionEntity*> collect_entities() const {
+        std::vector<const ExtrusionEntity*> out;
+        out.reserve(this->items_count());
+        this->collect_entities(out);
+        return out;
+    }
     double min_mm3_per_mm() const override;
     double total_volume() const override { double volume=0.; for (const auto& ent : entities) volume+=ent->total_volume(); return volume; }
 
@@ -351,19 +351,10 @@ static void insert_fills_into_islands(Layer &layer, uint32_t fill_region_id, uin
 {
 	if (fill_begin < fill_end) {
     	// Sort the extrusion range into its LayerIsland.
-	    // Traverse the slices in an increasing order of bounding box size, so that the islands inside another islands are tested first,
-	    // so we can just test a point inside ExPolygon::contour and we may skip testing the holes.
-	    auto point_inside_surface = [&layer](const size_t lslice_idx, const Point &point) {
-	        const BoundingBox &bbox = layer.lslices_ex[lslice_idx].bbox;
-	        return point.x() >= bbox.min.x() && point.x() < bbox.max.x() &&
-	               point.y() >= bbox.min.y() && point.y() < bbox.max.y() &&
-	               layer.lslices[lslice_idx].contour.contains(point);
-	    };
+	    // The layer slice index returns the innermost island containing the point (the islands inside
+	    // another islands win), testing the contour only, so the holes of the islands may be skipped.
 	    Point point = layer.get_region(fill_region_id)->fills().entities[fill_begin]->first_point();
-	    int lslice_idx = int(layer.lslices_ex.size()) - 1;
-	    for (; lslice_idx >= 0; -- lslice_idx)
-	        if (point_inside_surface(lslice_idx, point))
-	        	break;
+	    int lslice_idx = layer.lslices_index().slice_idx_containing(point, /* contour_only */ true);
 	    assert(lslice_idx >= 0);
 	    if (lslice_idx >= 0) {
 	    	LayerSlice &lslice = layer.lslices_ex[lslice_idx];
@@ -435,8 +426,10 @@ static void insert_fills_into_islands(Layer &layer, uint32_t fill_region_id, uin
 
 void Layer::clear_fills()
 {
-    for (LayerRegion *layerm : m_regions)
+    for (LayerRegion *layerm : m_regions) {
         layerm->m_fills.clear();
+        layerm->m_fill_role_mask = 0;
+    }
     for (LayerSlice &lslice : lslices_ex)
 		for (LayerIsland &island : lslice.islands)
 			island.fills.clear();
@@ -463,6 +456,9 @@ void Layer::make_fills(FillAdaptive::Octree* adaptive_fill_octree, FillAdaptive:
 #endif /* SLIC3R_DEBUG_SLICE_PROCESSING */
 
 	size_t first_object_layer_id = this->object()->get_layer(0)->id();
+    // Scratch buffers reused across the surfaces to limit the allocation churn.
+    Polylines      polylines;
+    ThickPolylines thick_polylines;
     for (SurfaceFill &surface_fill : surface_fills) {
         // Create the filler object.
         std::unique_ptr<Fill> f = std::unique_ptr<Fill>(Fill::new_from_type(surface_fill.params.pattern));
@@ -521,14 +517,16 @@ void Layer::make_fills(FillAdaptive::Octree* adaptive_fill_octree, FillAdaptive:
 			// Spacing is modified by the filler to indicate adjustments. Reset it for each expolygon.
 			f->spacing = surface_fill.params.spacing;
 			surface_fill.surface.expolygon = std::move(expoly);
-            Polylines      polylines;
-            ThickPolylines thick_polylines;
+            polylines.clear();
+            thick_polylines.clear();
 			try {
                 if (params.use_arachne)
-                    thick_polylines = f->fill_surface_arachne(&surface_fill.surface, params);
+                    f->fill_surface_arachne(&surface_fill.surface, params, thick_polylines);
                 else
-				    polylines = f->fill_surface(&surface_fill.surface, params);
+				    f->fill_surface(&surface_fill.surface, params, polylines);
 			} catch (InfillFailedException &) {
+                polylines.clear();
+                thick_polylines.clear();
 			}
             if (!polylines.empty() || !thick_polylines.empty()) {
                 // calculate actual flow from spacing (which might have been adjusted by the infill
@@ -617,6 +615,10 @@ void Layer::make_fills(FillAdaptive::Octree* adaptive_fill_octree, FillAdaptive:
 			}
 		}
 
+	// Cache the fill role summary while the newly created extrusions are hot, see ToolOrdering::collect_extruders().
+	for (LayerRegion *layerm : m_regions)
+		layerm->cache_fill_role_mask();
+
 #ifndef NDEBUG
 	for (LayerRegion *layerm : m_regions)
 	    for (const ExtrusionEntity *e : layerm->fills())
@@ -631,6 +633,8 @@ Polylines Layer::generate_sparse_infill_polylines_for_anchoring(FillAdaptive::Oc
     const auto                resolution    = this->object()->print()->config().gcode_resolution.value;
 
     Polylines sparse_infill_polylines{};
+    // Scratch buffer reused across the surfaces to limit the allocation churn.
+    Polylines polylines;
 
     for (SurfaceFill &surface_fill : surface_fills) {
 		if (surface_fill.surface.surface_type != stInternal) {
@@ -708,9 +712,10 @@ Polylines Layer::generate_sparse_infill_polylines_for_anchoring(FillAdaptive::Oc
             // Spacing is modified by the filler to indicate adjustments. Reset it for each expolygon.
             f->spacing                     = surface_fill.params.spacing;
             surface_fill.surface.expolygon = std::move(expoly);
+            polylines.clear();
             try {
-                Polylines polylines = f->fill_surface(&surface_fill.surface, params);
-                sparse_infill_polylines.insert(sparse_infill_polylines.end(), polylines.begin(), polylines.end());
+                f->fill_surface(&surface_fill.surface, params, polylines);
+                sparse_infill_polylines.insert(sparse_infill_polylines.end(), std::make_move_iterator(polylines.begin()), std::make_move_iterator(polylines.end()));
             } catch (InfillFailedException &) {}
         }
     }
@@ -906,13 +911,16 @@ void Layer::make_ironing()
 		float  extrusion_width  = Flow::rounded_rectangle_extrusion_width_from_spacing(float(nozzle_dmr), float(extrusion_height));
 		double flow_mm3_per_mm = nozzle_dmr * extrusion_height;
         Surface surface_fill(stTop, ExPolygon());
+        // Scratch buffer reused across the ironing areas to limit the allocation churn.
+        Polylines polylines;
         for (ExPolygon &expoly : ironing_areas) {
 			surface_fill.expolygon = std::move(expoly);
-			Polylines polylines;
+            polylines.clear();
 			try {
                 assert(!fill_params.use_arachne);
-				polylines = fill.fill_surface(&surface_fill, fill_params);
+				fill.fill_surface(&surface_fill, fill_params, polylines);
 			} catch (InfillFailedException &) {
+                polylines.clear();
 			}
 	        if (! polylines.empty()) {
 		        // Save into layer.
@@ -927,6 +935,8 @@ void Layer::make_ironing()
 						ExtrusionFlow{ flow_mm3_per_mm, extrusion_width, float(extrusion_height) }
 					});
 				insert_fills_into_islands(*this, ironing_params.region_id, fill_begin, uint32_t(ironing_params.layerm->fills().size()));
+				// The ironing extrusions change the fill role summary of the region.
+				ironing_params.layerm->cache_fill_role_mask();
 		    }
 		}
 
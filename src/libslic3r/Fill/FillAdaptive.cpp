@@ -20,6 +20,8 @@
 #include <algorithm>
 #include <numeric>
 
+#include <tbb/parallel_for.h>
+
 // Boost pool: Don't use mutexes to synchronize memory allocation.
 #define BOOST_POOL_NO_MT
 #include <boost/pool/object_pool.hpp>
@@ -263,6 +265,9 @@ struct Octree
     // Octree will allocate its Cubes from the pool. The pool only supports deletion of the complete pool,
     // perfect for building up our octree.
     boost::object_pool<Cube>    pool;
+    // The first level subtrees may be built concurrently, each build task allocating
+    // from its own pool. The pools only release their memory with the whole Octree.
+    std::array<std::unique_ptr<boost::object_pool<Cube>>, 8> subtree_pools;
     Cube*                       root_cube { nullptr };
     Vec3d                       origin;
     std::vector<CubeProperties> cubes_properties;
@@ -270,7 +275,7 @@ struct Octree
     Octree(const Vec3d &origin, const std::vector<CubeProperties> &cubes_properties)
         : root_cube(pool.construct(origin)), origin(origin), cubes_properties(cubes_properties) {}
 
-    void insert_triangle(const Vec3d &a, const Vec3d &b, const Vec3d &c, Cube *current_cube, const BoundingBoxf3 &current_bbox, int depth);
+    void insert_triangle(const Vec3d &a, const Vec3d &b, const Vec3d &c, Cube *current_cube, const BoundingBoxf3 &current_bbox, int depth, boost::object_pool<Cube> &pool);
 };
 
 void OctreeDeleter::operator()(Octree *p) {
@@ -1466,6 +1471,24 @@ static void transform_center(Cube *current_cube, const Eigen::Matrix3d &rot)
             transform_center(child, rot);
 }
 
+// Calculate a slightly expanded bounding box of a child cube to cope with triangles touching a cube wall and other numeric errors.
+// We will rather densify the octree a bit more than necessary instead of missing a triangle.
+static inline BoundingBoxf3 child_cube_bbox(const Vec3d &parent_center, const BoundingBoxf3 &parent_bbox, size_t child_idx)
+{
+    const Vec3d  &child_center_dir = child_centers[child_idx];
+    BoundingBoxf3 bbox;
+    for (int k = 0; k < 3; ++ k) {
+        if (child_center_dir[k] == -1.) {
+            bbox.min[k] = parent_bbox.min[k];
+            bbox.max[k] = parent_center[k] + EPSILON;
+        } else {
+            bbox.min[k] = parent_center[k] - EPSILON;
+            bbox.max[k] = parent_bbox.max[k];
+        }
+    }
+    return bbox;
+}
+
 OctreePtr build_octree(
     // Mesh is rotated to the coordinate system of the octree.
     const indexed_triangle_set  &triangle_mesh,
@@ -1488,23 +1511,76 @@ OctreePtr build_octree(
         double edge_length_half = 0.5 * cubes_properties.back().edge_length;
         Vec3d  diag_half(edge_length_half, edge_length_half, edge_length_half);
         int    max_depth = int(cubes_properties.size()) - 1;
-        auto process_triangle = [octree_ptr, max_depth, diag_half](const Vec3d &a, const Vec3d &b, const Vec3d &c) {
-            octree_ptr->insert_triangle(
-                a, b, c,
-                octree_ptr->root_cube,
-                BoundingBoxf3(octree_ptr->root_cube->center - diag_half, octree_ptr->root_cube->center + diag_half),
-                max_depth);
+        auto   up_vector = support_overhangs_only ? Vec3d(transform_to_octree() * Vec3d(0., 0., 1.)) : Vec3d();
+        const BoundingBoxf3 root_bbox(octree_ptr->root_cube->center - diag_half, octree_ptr->root_cube->center + diag_half);
+        const size_t num_mesh_triangles = triangle_mesh.indices.size();
+        const size_t num_triangles      = num_mesh_triangles + overhang_triangles.size() / 3;
+        auto triangle_vertices = [&triangle_mesh, &overhang_triangles, num_mesh_triangles](size_t idx, Vec3d &a, Vec3d &b, Vec3d &c) {
+            if (idx < num_mesh_triangles) {
+                const Vec3i &tri = triangle_mesh.indices[idx];
+                a = triangle_mesh.vertices[tri[0]].cast<double>();
+                b = triangle_mesh.vertices[tri[1]].cast<double>();
+                c = triangle_mesh.vertices[tri[2]].cast<double>();
+            } else {
+                size_t i = (idx - num_mesh_triangles) * 3;
+                a = overhang_triangles[i];
+                b = overhang_triangles[i + 1];
+                c = overhang_triangles[i + 2];
+            }
         };
-        auto up_vector = support_overhangs_only ? Vec3d(transform_to_octree() * Vec3d(0., 0., 1.)) : Vec3d();
-        for (auto &tri : triangle_mesh.indices) {
-            auto a = triangle_mesh.vertices[tri[0]].cast<double>();
-            auto b = triangle_mesh.vertices[tri[1]].cast<double>();
-            auto c = triangle_mesh.vertices[tri[2]].cast<double>();
-            if (! support_overhangs_only || is_overhang_triangle(a, b, c, up_vector))
-                process_triangle(a, b, c);
+        // Minimal amount of triangles to pay off the parallel build.
+        constexpr size_t parallel_build_min_triangles = 32768;
+        if (max_depth > 1 && num_triangles >= parallel_build_min_triangles) {
+            // Build the first level subtrees concurrently. First mark for each triangle
+            // which root children it intersects, then build each subtree in its own task
+            // from its own memory pool.
+            std::array<BoundingBoxf3, 8> root_child_bboxes;
+            std::array<Vec3d, 8>         root_child_centers;
+            for (size_t i = 0; i < 8; ++ i) {
+                root_child_bboxes[i]  = child_cube_bbox(octree_ptr->root_cube->center, root_bbox, i);
+                root_child_centers[i] = octree_ptr->root_cube->center + (child_centers[i] * (cubes_properties[max_depth - 1].edge_length / 2.));
+            }
+            std::vector<uint8_t> masks(num_triangles);
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, num_triangles, 4096),
+                [&](const tbb::blocked_range<size_t> &range) {
+                    for (size_t idx = range.begin(); idx < range.end(); ++ idx) {
+                        Vec3d a, b, c;
+                        triangle_vertices(idx, a, b, c);
+                        uint8_t mask = 0;
+                        if (! support_overhangs_only || idx >= num_mesh_triangles || is_overhang_triangle(a, b, c, up_vector))
+                            for (size_t i = 0; i < 8; ++ i)
+                                if (triangle_AABB_intersects(a, b, c, root_child_bboxes[i]))
+                                    mask |= uint8_t(1) << i;
+                        masks[idx] = mask;
+                    }
+                });
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, 8, 1),
+                [&](const tbb::blocked_range<size_t> &range) {
+                    for (size_t i = range.begin(); i < range.end(); ++ i) {
+                        octree_ptr->subtree_pools[i] = std::make_unique<boost::object_pool<Cube>>();
+                        boost::object_pool<Cube> &pool = *octree_ptr->subtree_pools[i];
+                        const uint8_t bit = uint8_t(1) << i;
+                        for (size_t idx = 0; idx < num_triangles; ++ idx) {
+                            if ((masks[idx] & bit) == 0)
+                                continue;
+                            if (! octree_ptr->root_cube->children[i])
+                                octree_ptr->root_cube->children[i] = pool.construct(root_child_centers[i]);
+                            if (max_depth > 1) {
+                                Vec3d a, b, c;
+                                triangle_vertices(idx, a, b, c);
+                                octree_ptr->insert_triangle(a, b, c, octree_ptr->root_cube->children[i], root_child_bboxes[i], max_depth - 1, pool);
+                            }
+                        }
+                    }
+                });
+        } else {
+            for (size_t idx = 0; idx < num_triangles; ++ idx) {
+                Vec3d a, b, c;
+                triangle_vertices(idx, a, b, c);
+                if (! support_overhangs_only || idx >= num_mesh_triangles || is_overhang_triangle(a, b, c, up_vector))
+                    octree_ptr->insert_triangle(a, b, c, octree_ptr->root_cube, root_bbox, max_depth, octree_ptr->pool);
+            }
         }
-        for (size_t i = 0; i < overhang_triangles.size(); i += 3)
-            process_triangle(overhang_triangles[i], overhang_triangles[i + 1], overhang_triangles[i + 2]);
         {
             // Transform the octree to world coordinates to reduce computation when extracting infill lines.
             auto rot = transform_to_world().toRotationMatrix();
@@ -1516,7 +1592,7 @@ OctreePtr build_octree(
     return octree;
 }
 
-void Octree::insert_triangle(const Vec3d &a, const Vec3d &b, const Vec3d &c, Cube *current_cube, const BoundingBoxf3 &current_bbox, int depth)
+void Octree::insert_triangle(const Vec3d &a, const Vec3d &b, const Vec3d &c, Cube *current_cube, const BoundingBoxf3 &current_bbox, int depth, boost::object_pool<Cube> &pool)
 {
     assert(current_cube);
     assert(depth > 0);
@@ -1527,27 +1603,15 @@ void Octree::insert_triangle(const Vec3d &a, const Vec3d &b, const Vec3d &c, Cub
     // const double r2_cube = Slic3r::sqr(0.5 * this->cubes_properties[depth].height + EPSILON);
 
     for (size_t i = 0; i < 8; ++ i) {
-        const Vec3d &child_center_dir = child_centers[i];
-        // Calculate a slightly expanded bounding box of a child cube to cope with triangles touching a cube wall and other numeric errors.
-        // We will rather densify the octree a bit more than necessary instead of missing a triangle.
-        BoundingBoxf3 bbox;
-        for (int k = 0; k < 3; ++ k) {
-            if (child_center_dir[k] == -1.) {
-                bbox.min[k] = current_bbox.min[k];
-                bbox.max[k] = current_cube->center[k] + EPSILON;
-            } else {
-                bbox.min[k] = current_cube->center[k] - EPSILON;
-                bbox.max[k] = current_bbox.max[k];
-            }
-        }
-        Vec3d child_center = current_cube->center + (child_center_dir * (this->cubes_properties[depth].edge_length / 2.));
+        BoundingBoxf3 bbox = child_cube_bbox(current_cube->center, current_bbox, i);
+        Vec3d child_center = current_cube->center + (child_centers[i] * (this->cubes_properties[depth].edge_length / 2.));
         //if (dist2_to_triangle(a, b, c, child_center) < r2_cube) {
         // dist2_to_triangle and r2_cube are commented out too.
         if (triangle_AABB_intersects(a, b, c, bbox)) {
             if (! current_cube->children[i])
-                current_cube->children[i] = this->pool.construct(child_center);
+                current_cube->children[i] = pool.construct(child_center);
             if (depth > 0)
-                this->insert_triangle(a, b, c, current_cube->children[i], bbox, depth);
+                this->insert_triangle(a, b, c, current_cube->children[i], bbox, depth, pool);
         }
     }
 }
@@ -90,25 +90,35 @@ bool Fill::use_bridge_flow(const InfillPattern type)
 	return cached[type] != 0;
 }
 
-Polylines Fill::fill_surface(const Surface *surface, const FillParams &params)
+void Fill::fill_surface(const Surface *surface, const FillParams &params, Polylines &polylines_out)
 {
     // Perform offset.
     Slic3r::ExPolygons expp = offset_ex(surface->expolygon, float(scale_(this->overlap - 0.5 * this->spacing)));
     // Create the infills for each of the regions.
-    Polylines polylines_out;
     for (ExPolygon &expoly : expp)
         _fill_surface_single(params, surface->thickness_layers, _infill_direction(surface), std::move(expoly), polylines_out);
-    return polylines_out;
 }
 
-ThickPolylines Fill::fill_surface_arachne(const Surface *surface, const FillParams &params)
+void Fill::fill_surface_arachne(const Surface *surface, const FillParams &params, ThickPolylines &thick_polylines_out)
 {
     // Perform offset.
     Slic3r::ExPolygons expp = offset_ex(surface->expolygon, float(scale_(this->overlap - 0.5 * this->spacing)));
     // Create the infills for each of the regions.
-    ThickPolylines thick_polylines_out;
     for (ExPolygon &expoly : expp)
         _fill_surface_single(params, surface->thickness_layers, _infill_direction(surface), std::move(expoly), thick_polylines_out);
+}
+
+Polylines Fill::fill_surface(const Surface *surface, const FillParams &params)
+{
+    Polylines polylines_out;
+    this->fill_surface(surface, params, polylines_out);
+    return polylines_out;
+}
+
+ThickPolylines Fill::fill_surface_arachne(const Surface *surface, const FillParams &params)
+{
+    ThickPolylines thick_polylines_out;
+    this->fill_surface_arachne(surface, params, thick_polylines_out);
     return thick_polylines_out;
 }
 
@@ -125,9 +125,14 @@ public:
 
     virtual bool is_self_crossing() = 0;
 
-    // Perform the fill.
-    virtual Polylines fill_surface(const Surface *surface, const FillParams &params);
-    virtual ThickPolylines fill_surface_arachne(const Surface *surface, const FillParams &params);
+    // Perform the fill. The results are appended into a caller supplied buffer,
+    // so that its capacity can be reused across the surfaces of a layer
+    // (see Layer::make_fills()).
+    virtual void fill_surface(const Surface *surface, const FillParams &params, Polylines &polylines_out);
+    virtual void fill_surface_arachne(const Surface *surface, const FillParams &params, ThickPolylines &thick_polylines_out);
+    // Convenience wrappers returning the fill by value.
+    Polylines fill_surface(const Surface *surface, const FillParams &params);
+    ThickPolylines fill_surface_arachne(const Surface *surface, const FillParams &params);
 
 protected:
     Fill() :
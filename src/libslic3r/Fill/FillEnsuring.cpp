@@ -110,11 +110,16 @@ ThickPolylines make_fill_polylines(
         coord_t length_filter     = scale_(4);
         size_t  skips_allowed     = 2;
         size_t  min_removal_conut = 5;
+        // The traversal structures are reused between the seed lines to avoid allocation churn.
+        std::set<std::pair<int, int>> to_remove;
+        std::vector<Node>             to_visit;
         for (int section_idx = 0; section_idx < int(polygon_sections.size()); ++ section_idx) {
             for (int line_idx = 0; line_idx < int(polygon_sections[section_idx].size()); ++ line_idx) {
                 if (const Line &line = polygon_sections[section_idx][line_idx]; line.a != line.b && line.length() < length_filter) {
-                    std::set<std::pair<int, int>> to_remove{{section_idx, line_idx}};
-                    std::vector<Node>             to_visit{{section_idx, line_idx}};
+                    to_remove.clear();
+                    to_remove.insert({section_idx, line_idx});
+                    to_visit.clear();
+                    to_visit.push_back({section_idx, line_idx});
 
                     bool initial_touches_long_lines = false;
                     if (section_idx > 0) {
@@ -183,6 +188,10 @@ ThickPolylines make_fill_polylines(
 
     ThickPolylines thick_polylines;
     {
+        size_t num_segments = 0;
+        for (const auto &polygon_slice : polygon_sections)
+            num_segments += polygon_slice.size();
+        thick_polylines.reserve(num_segments);
         for (const auto &polygon_slice : polygon_sections) {
             for (const Line &segment : polygon_slice) {
                 ThickPolyline &new_path = thick_polylines.emplace_back();
@@ -205,7 +214,9 @@ ThickPolylines make_fill_polylines(
                 Points highs;
             };
 
-            std::vector<std::vector<Line>> polygon_sections_w_width = polygon_sections;
+            // polygon_sections are not used after this point, thus the width is applied in place
+            // instead of on a deep copy.
+            std::vector<std::vector<Line>> &polygon_sections_w_width = polygon_sections;
             for (auto &slice : polygon_sections_w_width) {
                 for (Line &l : slice) {
                     l.a -= Point{0.0, 0.5 * scaled_spacing};
@@ -213,9 +224,10 @@ ThickPolylines make_fill_polylines(
                 }
             }
 
-            std::vector<TracedPoly> current_traced_polys;
+            std::vector<TracedPoly>          current_traced_polys;
+            std::unordered_set<const Line *> used_segments;
             for (const auto &polygon_slice : polygon_sections_w_width) {
-                std::unordered_set<const Line *> used_segments;
+                used_segments.clear();
                 for (TracedPoly &traced_poly : current_traced_polys) {
                     auto candidates_begin = std::upper_bound(polygon_slice.begin(), polygon_slice.end(), traced_poly.lows.back(),
                                                              [](const Point &low, const Line &seg) { return seg.b.y() > low.y(); });
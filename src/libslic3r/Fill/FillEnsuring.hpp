@@ -18,10 +18,10 @@ class FillEnsuring : public Fill
 public:
     Fill *clone() const override { return new FillEnsuring(*this); }
     ~FillEnsuring() override = default;
-    Polylines      fill_surface(const Surface *surface, const FillParams &params) override { return {}; };
-    ThickPolylines fill_surface_arachne(const Surface *surface, const FillParams &params) override
+    void fill_surface(const Surface *surface, const FillParams &params, Polylines &polylines_out) override {};
+    void fill_surface_arachne(const Surface *surface, const FillParams &params, ThickPolylines &thick_polylines_out) override
     {
-        return make_fill_polylines(this, surface, params, true, true, true);
+        append(thick_polylines_out, make_fill_polylines(this, surface, params, true, true, true));
     };
     bool is_self_crossing() override { return false; }
 
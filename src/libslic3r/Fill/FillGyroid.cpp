@@ -9,6 +9,8 @@
 #include <cmath>
 #include <algorithm>
 #include <iostream>
+#include <memory>
+#include <mutex>
 
 #include "FillGyroid.hpp"
 
@@ -107,6 +109,52 @@ static std::vector<Vec2d> make_one_period(double width, double scaleFactor, doub
     return points;
 }
 
+// The one period sample table depends on the width only through its 2*PI cap inside
+// make_one_period(), therefore it is shared by all the islands of a layer and by all
+// the layers with the same z phase. As the adaptive refinement evaluates the costly
+// f() thousands of times per table, recently used tables are kept in a small cache.
+// Infill of several layers is generated concurrently, thus the cache is mutex guarded.
+static std::shared_ptr<const std::vector<Vec2d>> cached_one_period(
+    double width, double scaleFactor, double z_cos, double z_sin, bool vertical, bool flip, double tolerance)
+{
+    struct Key {
+        double limit, z_cos, z_sin, tolerance;
+        bool   vertical, flip;
+        bool operator==(const Key &rhs) const {
+            return limit == rhs.limit && z_cos == rhs.z_cos && z_sin == rhs.z_sin &&
+                   tolerance == rhs.tolerance && vertical == rhs.vertical && flip == rhs.flip;
+        }
+    };
+    using CacheEntry = std::pair<Key, std::shared_ptr<const std::vector<Vec2d>>>;
+    static std::mutex               cache_mutex;
+    static std::vector<CacheEntry>  cache;
+    constexpr size_t                cache_capacity = 16;
+
+    const Key key { std::min(2. * M_PI, width), z_cos, z_sin, tolerance, vertical, flip };
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        for (auto it = cache.begin(); it != cache.end(); ++ it)
+            if (it->first == key) {
+                // Move the hit to the back, the front is evicted first.
+                std::rotate(it, it + 1, cache.end());
+                return cache.back().second;
+            }
+    }
+    auto table = std::make_shared<const std::vector<Vec2d>>(
+        make_one_period(key.limit, scaleFactor, z_cos, z_sin, vertical, flip, tolerance));
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        for (const CacheEntry &entry : cache)
+            if (entry.first == key)
+                // Computed concurrently by another layer meanwhile.
+                return entry.second;
+        if (cache.size() >= cache_capacity)
+            cache.erase(cache.begin());
+        cache.emplace_back(key, table);
+    }
+    return table;
+}
+
 static Polylines make_gyroid_waves(double gridZ, double density_adjusted, double line_spacing, double width, double height)
 {
     const double scaleFactor = scale_(line_spacing) / density_adjusted;
@@ -132,18 +180,18 @@ static Polylines make_gyroid_waves(double gridZ, double density_adjusted, double
         std::swap(width,height);
     }
 
-    std::vector<Vec2d> one_period_odd = make_one_period(width, scaleFactor, z_cos, z_sin, vertical, flip, tolerance); // creates one period of the waves, so it doesn't have to be recalculated all the time
+    auto one_period_odd = cached_one_period(width, scaleFactor, z_cos, z_sin, vertical, flip, tolerance); // creates one period of the waves, so it doesn't have to be recalculated all the time
     flip = !flip;                                                                   // even polylines are a bit shifted
-    std::vector<Vec2d> one_period_even = make_one_period(width, scaleFactor, z_cos, z_sin, vertical, flip, tolerance);
+    auto one_period_even = cached_one_period(width, scaleFactor, z_cos, z_sin, vertical, flip, tolerance);
     Polylines result;
 
     for (double y0 = lower_bound; y0 < upper_bound + EPSILON; y0 += M_PI) {
         // creates odd polylines
-        result.emplace_back(make_wave(one_period_odd, width, height, y0, scaleFactor, z_cos, z_sin, vertical, flip));
+        result.emplace_back(make_wave(*one_period_odd, width, height, y0, scaleFactor, z_cos, z_sin, vertical, flip));
         // creates even polylines
         y0 += M_PI;
         if (y0 < upper_bound + EPSILON) {
-            result.emplace_back(make_wave(one_period_even, width, height, y0, scaleFactor, z_cos, z_sin, vertical, flip));
+            result.emplace_back(make_wave(*one_period_even, width, height, y0, scaleFactor, z_cos, z_sin, vertical, flip));
         }
     }
 
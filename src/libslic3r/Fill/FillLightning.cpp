@@ -30,9 +30,12 @@ void GeneratorDeleter::operator()(Generator *p) {
     delete p;
 }
 
-GeneratorPtr build_generator(const PrintObject &print_object, const coordf_t fill_density, const std::function<void()> &throw_on_cancel_callback)
+GeneratorPtr build_generator(GeneratorPtr previous, const PrintObject &print_object, const coordf_t fill_density, const std::function<void()> &throw_on_cancel_callback)
 {
-    return GeneratorPtr(new Generator(print_object, fill_density, throw_on_cancel_callback));
+    const size_t input_hash = generator_input_hash(print_object, fill_density);
+    if (previous && previous->input_hash() == input_hash)
+        return previous;
+    return GeneratorPtr(new Generator(print_object, fill_density, input_hash, throw_on_cancel_callback));
 }
 
 } // namespace Slic3r::FillAdaptive
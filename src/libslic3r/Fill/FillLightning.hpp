@@ -18,7 +18,10 @@ class Generator;
 struct GeneratorDeleter { void operator()(Generator *p); };
 using  GeneratorPtr = std::unique_ptr<Generator, GeneratorDeleter>;
 
-GeneratorPtr build_generator(const PrintObject &print_object, const coordf_t fill_density, const std::function<void()> &throw_on_cancel_callback);
+// Builds a new Generator, or returns the previous one when the infill surfaces and the
+// parameters it was built from are unchanged (detected by a hash of the inputs), so that
+// a re-slice touching unrelated settings does not regenerate the lightning trees.
+GeneratorPtr build_generator(GeneratorPtr previous, const PrintObject &print_object, const coordf_t fill_density, const std::function<void()> &throw_on_cancel_callback);
 
 class Filler : public Slic3r::Fill
 {
@@ -800,7 +800,7 @@ static std::vector<SegmentedIntersectionLine> slice_region_by_vertical_lines(con
                 continue;
             assert(il >= 0 && size_t(il) < segs.size());
             assert(ir >= 0 && size_t(ir) < segs.size());
-            for (int i = il; i <= ir; ++ i) {
+            auto emit_intersection_exact = [&](int i) {
                 coord_t this_x = segs[i].pos;
 				assert(this_x == i * line_spacing + x0);
                 SegmentIntersection is;
@@ -812,12 +812,12 @@ static std::vector<SegmentedIntersectionLine> slice_region_by_vertical_lines(con
                 if (p1.x() == this_x) {
                     if (p2.x() == this_x) {
                         // Ignore strictly vertical segments.
-                        continue;
+                        return;
                     }
                     const Point &p0 = prev_value_modulo(iPrev, contour);
                     if (int64_t(p0.x() - p1.x()) * int64_t(p2.x() - p1.x()) > 0) {
                         // Ignore points of a contour touching the infill line from one side.
-                        continue;
+                        return;
                     }
                     is.pos_p = p1.y();
                     is.pos_q = 1;
@@ -825,7 +825,7 @@ static std::vector<SegmentedIntersectionLine> slice_region_by_vertical_lines(con
                     const Point &p3 = next_value_modulo(iSegment, contour);
                     if (int64_t(p3.x() - p2.x()) * int64_t(p1.x() - p2.x()) > 0) {
                         // Ignore points of a contour touching the infill line from one side.
-                        continue;
+                        return;
                     }
                     is.pos_p = p2.y();
                     is.pos_q = 1;
@@ -848,6 +848,40 @@ static std::vector<SegmentedIntersectionLine> slice_region_by_vertical_lines(con
                 assert(is.pos() + 1 >= std::min(p1.y(), p2.y()));
                 assert(is.pos() <= std::max(p1.y(), p2.y()) + 1);
                 segs[i].intersections.push_back(is);
+            };
+            if (ir - il < 2) {
+                for (int i = il; i <= ir; ++ i)
+                    emit_intersection_exact(i);
+            } else {
+                // Only the first and the last vertical line may pass exactly through one of
+                // the segment end points, needing the full treatment above. All the interior
+                // lines intersect the open segment: pos_q is the constant horizontal extent
+                // of the segment and pos_p grows by a constant step per vertical line, thus
+                // the exact rational intersections are extended incrementally without any
+                // per-line branching or multiplication.
+                emit_intersection_exact(il);
+                SegmentIntersection is;
+                is.iContour = iContour;
+                is.iSegment = iSegment;
+                const int64_t dy     = int64_t(p2.y() - p1.y());
+                const coord_t x      = segs[il + 1].pos;
+                int64_t       step   = int64_t(line_spacing) * dy;
+                if (p2.x() > p1.x()) {
+                    is.pos_q = p2.x() - p1.x();
+                    is.pos_p = int64_t(x - p1.x()) * dy + p1.y() * int64_t(is.pos_q);
+                } else {
+                    is.pos_q = p1.x() - p2.x();
+                    is.pos_p = int64_t(p1.x() - x) * dy + p1.y() * int64_t(is.pos_q);
+                    step     = - step;
+                }
+                assert(is.pos_q > 1);
+                for (int i = il + 1; i < ir; ++ i, is.pos_p += step) {
+                    // +-1 to take rounding into account.
+                    assert(is.pos() + 1 >= std::min(p1.y(), p2.y()));
+                    assert(is.pos() <= std::max(p1.y(), p2.y()) + 1);
+                    segs[i].intersections.push_back(is);
+                }
+                emit_intersection_exact(ir);
             }
         }
     }
@@ -2965,85 +2999,72 @@ bool FillRectilinear::fill_surface_by_multilines(const Surface *surface, FillPar
     return true;
 }
 
-Polylines FillRectilinear::fill_surface(const Surface *surface, const FillParams &params)
+void FillRectilinear::fill_surface(const Surface *surface, const FillParams &params, Polylines &polylines_out)
 {
-    Polylines polylines_out;
     if (! fill_surface_by_lines(surface, params, 0.f, 0.f, polylines_out))
         BOOST_LOG_TRIVIAL(error) << "FillRectilinear::fill_surface() failed to fill a region.";
-    return polylines_out;
 }
 
-Polylines FillMonotonic::fill_surface(const Surface *surface, const FillParams &params)
+void FillMonotonic::fill_surface(const Surface *surface, const FillParams &params, Polylines &polylines_out)
 {
     FillParams params2 = params;
     params2.monotonic = true;
-    Polylines polylines_out;
     if (! fill_surface_by_lines(surface, params2, 0.f, 0.f, polylines_out))
         BOOST_LOG_TRIVIAL(error) << "FillMonotonic::fill_surface() failed to fill a region.";
-    return polylines_out;
 }
 
-Polylines FillMonotonicLines::fill_surface(const Surface *surface, const FillParams &params)
+void FillMonotonicLines::fill_surface(const Surface *surface, const FillParams &params, Polylines &polylines_out)
 {
     FillParams params2 = params;
     params2.monotonic = true;
     params2.anchor_length_max = 0.0f;
-    Polylines polylines_out;
     if (! fill_surface_by_lines(surface, params2, 0.f, 0.f, polylines_out))
         BOOST_LOG_TRIVIAL(error) << "FillMonotonicLines::fill_surface() failed to fill a region.";
-    return polylines_out;
 }
 
-Polylines FillGrid::fill_surface(const Surface *surface, const FillParams &params)
+void FillGrid::fill_surface(const Surface *surface, const FillParams &params, Polylines &polylines_out)
 {
-    Polylines polylines_out;
     if (! this->fill_surface_by_multilines(
             surface, params,
             { { 0.f, 0.f }, { float(M_PI / 2.), 0.f } },
             polylines_out))
         BOOST_LOG_TRIVIAL(error) << "FillGrid::fill_surface() failed to fill a region.";
-    return polylines_out;
 }
 
-Polylines FillTriangles::fill_surface(const Surface *surface, const FillParams &params)
+void FillTriangles::fill_surface(const Surface *surface, const FillParams &params, Polylines &polylines_out)
 {
-    Polylines polylines_out;
     if (! this->fill_surface_by_multilines(
             surface, params,
             { { 0.f, 0.f }, { float(M_PI / 3.), 0.f }, { float(2. * M_PI / 3.), 0. } },
             polylines_out))
         BOOST_LOG_TRIVIAL(error) << "FillTriangles::fill_surface() failed to fill a region.";
-    return polylines_out;
 }
 
-Polylines FillStars::fill_surface(const Surface *surface, const FillParams &params)
+void FillStars::fill_surface(const Surface *surface, const FillParams &params, Polylines &polylines_out)
 {
-    Polylines polylines_out;
     if (! this->fill_surface_by_multilines(
             surface, params,
             { { 0.f, 0.f }, { float(M_PI / 3.), 0.f }, { float(2. * M_PI / 3.), float((3./2.) * this->spacing / params.density) } },
             polylines_out))
         BOOST_LOG_TRIVIAL(error) << "FillStars::fill_surface() failed to fill a region.";
-    return polylines_out;
 }
 
-Polylines FillCubic::fill_surface(const Surface *surface, const FillParams &params)
+void FillCubic::fill_surface(const Surface *surface, const FillParams &params, Polylines &polylines_out)
 {
-    Polylines polylines_out;
     coordf_t dx = sqrt(0.5) * z;
     if (! this->fill_surface_by_multilines(
-            surface, params, 
+            surface, params,
             { { 0.f, float(dx) }, { float(M_PI / 3.), - float(dx) }, { float(M_PI * 2. / 3.), float(dx) } },
             polylines_out))
         BOOST_LOG_TRIVIAL(error) << "FillCubic::fill_surface() failed to fill a region.";
-    return polylines_out; 
 }
 
-Polylines FillSupportBase::fill_surface(const Surface *surface, const FillParams &params)
+void FillSupportBase::fill_surface(const Surface *surface, const FillParams &params, Polylines &polylines_out)
 {
     assert(! params.full_infill());
 
-    Polylines polylines_out;
+    // At the end, only the new polylines will be rotated back.
+    size_t n_polylines_out_initial = polylines_out.size();
     std::pair<float, Point> rotate_vector = this->_infill_direction(surface);
     ExPolygonWithOffset poly_with_offset(surface->expolygon, - rotate_vector.first, float(scale_(this->overlap - 0.5 * this->spacing)));
     if (poly_with_offset.n_contours > 0) {
@@ -3056,11 +3077,10 @@ Polylines FillSupportBase::fill_surface(const Surface *surface, const FillParams
         // Rotate back by rotate_vector.first
         const double cos_a = cos(rotate_vector.first);
         const double sin_a = sin(rotate_vector.first);
-        for (Polyline &pl : polylines_out)
-            for (Point &pt : pl.points)
+        for (Polylines::iterator it = polylines_out.begin() + n_polylines_out_initial; it != polylines_out.end(); ++ it)
+            for (Point &pt : it->points)
                 pt.rotate(cos_a, sin_a);
     }
-    return polylines_out;
 }
 
 // Lightning infill assumes that the distance between any two sampled points is always
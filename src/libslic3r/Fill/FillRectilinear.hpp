@@ -25,7 +25,7 @@ class FillRectilinear : public Fill
 public:
     Fill* clone() const override { return new FillRectilinear(*this); }
     ~FillRectilinear() override = default;
-    Polylines fill_surface(const Surface *surface, const FillParams &params) override;
+    void fill_surface(const Surface *surface, const FillParams &params, Polylines &polylines_out) override;
     bool is_self_crossing() override { return false; }
 
 protected:
@@ -57,7 +57,7 @@ class FillMonotonic : public FillRectilinear
 public:
     Fill* clone() const override { return new FillMonotonic(*this); }
     ~FillMonotonic() override = default;
-    Polylines fill_surface(const Surface *surface, const FillParams &params) override;
+    void fill_surface(const Surface *surface, const FillParams &params, Polylines &polylines_out) override;
 	bool no_sort() const override { return true; }
 };
 
@@ -66,7 +66,7 @@ class FillMonotonicLines : public FillRectilinear
 public:
     Fill* clone() const override { return new FillMonotonicLines(*this); }
     ~FillMonotonicLines() override = default;
-    Polylines fill_surface(const Surface *surface, const FillParams &params) override;
+    void fill_surface(const Surface *surface, const FillParams &params, Polylines &polylines_out) override;
     bool no_sort() const override { return true; }
 };
 
@@ -75,7 +75,7 @@ class FillGrid : public FillRectilinear
 public:
     Fill* clone() const override { return new FillGrid(*this); }
     ~FillGrid() override = default;
-    Polylines fill_surface(const Surface *surface, const FillParams &params) override;
+    void fill_surface(const Surface *surface, const FillParams &params, Polylines &polylines_out) override;
     bool is_self_crossing() override { return true; }
 
 protected:
@@ -88,7 +88,7 @@ class FillTriangles : public FillRectilinear
 public:
     Fill* clone() const override { return new FillTriangles(*this); }
     ~FillTriangles() override = default;
-    Polylines fill_surface(const Surface *surface, const FillParams &params) override;
+    void fill_surface(const Surface *surface, const FillParams &params, Polylines &polylines_out) override;
     bool is_self_crossing() override { return true; }
 
 protected:
@@ -101,7 +101,7 @@ class FillStars : public FillRectilinear
 public:
     Fill* clone() const override { return new FillStars(*this); }
     ~FillStars() override = default;
-    Polylines fill_surface(const Surface *surface, const FillParams &params) override;
+    void fill_surface(const Surface *surface, const FillParams &params, Polylines &polylines_out) override;
     bool is_self_crossing() override { return true; }
 
 protected:
@@ -114,7 +114,7 @@ class FillCubic : public FillRectilinear
 public:
     Fill* clone() const override { return new FillCubic(*this); }
     ~FillCubic() override = default;
-    Polylines fill_surface(const Surface *surface, const FillParams &params) override;
+    void fill_surface(const Surface *surface, const FillParams &params, Polylines &polylines_out) override;
     bool is_self_crossing() override { return true; }
 
 protected:
@@ -127,7 +127,7 @@ class FillSupportBase : public FillRectilinear
 public:
     Fill* clone() const override { return new FillSupportBase(*this); }
     ~FillSupportBase() override = default;
-    Polylines fill_surface(const Surface *surface, const FillParams &params) override;
+    void fill_surface(const Surface *surface, const FillParams &params, Polylines &polylines_out) override;
 
 protected:
     // The grid fill will keep the angle constant between the layers, see the implementation of Slic3r::Fill.
@@ -8,6 +8,8 @@
 #include "../../Layer.hpp"
 #include "../../Print.hpp"
 
+#include <boost/functional/hash.hpp>
+
 /* Possible future tasks/optimizations,etc.:
  * - Improve connecting heuristic to favor connecting to shorter trees
  * - Change which node of a tree is the root when that would be better in reconnectRoots.
@@ -24,7 +26,40 @@
 
 namespace Slic3r::FillLightning {
 
-Generator::Generator(const PrintObject &print_object, const coordf_t fill_density, const std::function<void()> &throw_on_cancel_callback)
+size_t generator_input_hash(const PrintObject &print_object, const coordf_t fill_density)
+{
+    size_t seed = boost::hash<coordf_t>{}(fill_density);
+    const PrintConfig       &print_config  = print_object.print()->config();
+    const PrintObjectConfig &object_config = print_object.config();
+    const PrintRegionConfig &region_config = print_object.shared_regions()->all_regions.front()->config();
+    boost::hash_combine(seed, object_config.layer_height.value);
+    boost::hash_combine(seed, region_config.infill_extrusion_width.value);
+    boost::hash_combine(seed, region_config.infill_extrusion_width.percent);
+    for (double nozzle_diameter : print_config.nozzle_diameter.values)
+        boost::hash_combine(seed, nozzle_diameter);
+    boost::hash_combine(seed, print_object.layers().size());
+    auto hash_points = [&seed](const Points &pts) {
+        for (const Point &pt : pts) {
+            boost::hash_combine(seed, pt.x());
+            boost::hash_combine(seed, pt.y());
+        }
+        boost::hash_combine(seed, pts.size());
+    };
+    for (const auto *layer : print_object.layers()) {
+        boost::hash_combine(seed, layer->print_z);
+        for (const LayerRegion *layerm : layer->regions())
+            for (const Surface &surface : layerm->fill_surfaces())
+                if (surface.surface_type == stInternal || surface.surface_type == stInternalVoid) {
+                    hash_points(surface.expolygon.contour.points);
+                    for (const Polygon &hole : surface.expolygon.holes)
+                        hash_points(hole.points);
+                }
+    }
+    return seed;
+}
+
+Generator::Generator(const PrintObject &print_object, const coordf_t fill_density, const size_t input_hash, const std::function<void()> &throw_on_cancel_callback)
+    : m_input_hash(input_hash)
 {
     const PrintConfig         &print_config         = print_object.print()->config();
     const PrintObjectConfig   &object_config        = print_object.config();
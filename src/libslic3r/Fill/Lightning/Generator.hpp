@@ -44,7 +44,12 @@ public:
      * Lightning Infill for the infill areas in that mesh. The infill areas must
      * already be calculated at this point.
      */
-    explicit Generator(const PrintObject &print_object, const coordf_t fill_density, const std::function<void()> &throw_on_cancel_callback);
+    explicit Generator(const PrintObject &print_object, const coordf_t fill_density, const size_t input_hash, const std::function<void()> &throw_on_cancel_callback);
+
+    /*!
+     * Hash of the inputs this generator was built from, see generator_input_hash().
+     */
+    size_t input_hash() const { return m_input_hash; }
 
     /*!
      * Get a tree of paths generated for a certain layer of the mesh.
@@ -77,6 +82,12 @@ protected:
 
     float m_infill_extrusion_width;
 
+    /*!
+     * Hash of the inputs this generator was built from, allows reusing the
+     * generator between slicing runs with unchanged inputs.
+     */
+    size_t m_input_hash;
+
     /*!
      * How far each piece of infill can support skin in the layer above.
      */
@@ -125,6 +136,13 @@ protected:
     std::vector<Layer> m_lightning_layers;
 };
 
+/*!
+ * Hash of everything the generated lightning trees depend on: the internal infill
+ * surfaces of all layers, the layer positions and the parameters derived from the
+ * configuration. Used to decide whether a previous Generator may be reused.
+ */
+size_t generator_input_hash(const PrintObject &print_object, coordf_t fill_density);
+
 } // namespace FillLightning
 } // namespace Slic3r
 
@@ -32,6 +32,10 @@ enum FlowRole {
     frSupportMaterialInterface,
 };
 
+// Number of FlowRole values resolvable from the region configuration by PrintRegion::flow()
+// (the remaining values are the support material roles).
+inline constexpr size_t num_region_flow_roles = size_t(frTopSolidInfill) + 1;
+
 class FlowError : public Slic3r::InvalidArgument
 {
 public:
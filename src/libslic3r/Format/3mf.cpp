@@ -39,6 +39,24 @@ namespace pt = boost::property_tree;
 #include <expat.h>
 #include <Eigen/Dense>
 #include "miniz_extension.hpp"
+#include "Thread.hpp"
+
+// Intel redesigned some TBB interface considerably when merging TBB with their oneAPI set of libraries, see GH #7332.
+// We are using quite an old TBB 2017 U7. Before we update our build servers, let's use the old API, which is deprecated in up to date TBB.
+#if ! defined(TBB_VERSION_MAJOR)
+    #include <tbb/version.h>
+#endif
+#if ! defined(TBB_VERSION_MAJOR)
+    static_assert(false, "TBB_VERSION_MAJOR not defined");
+#endif
+#if TBB_VERSION_MAJOR >= 2021
+    #include <tbb/parallel_pipeline.h>
+    using slic3r_tbb_filtermode = tbb::filter_mode;
+#else
+    #include <tbb/pipeline.h>
+    using slic3r_tbb_filtermode = tbb::filter;
+#endif
+#include <tbb/task_arena.h>
 
 #include "TextConfiguration.hpp"
 #include "EmbossShape.hpp"
@@ -269,22 +287,29 @@ Slic3r::Transform3d get_transform_from_3mf_specs_string(const std::string& mat_s
         // empty string means default identity matrix
         return ret;
 
-    std::vector<std::string> mat_elements_str;
-    boost::split(mat_elements_str, mat_str, boost::is_any_of(" "), boost::token_compress_on);
-
-    unsigned int size = (unsigned int)mat_elements_str.size();
-    if (size != 12)
-        // invalid data, return identity matrix
-        return ret;
-
-    unsigned int i = 0;
-    // matrices are stored into 3mf files as 4x3
-    // we need to transpose them
+    // matrices are stored into 3mf files as 4x3, we need to transpose them.
+    // The values are scanned in place, this is parsed for every component
+    // and build item and the split + atof route is measurably slower.
+    const char *pos = mat_str.c_str();
+    const char *end = pos + mat_str.size();
     for (unsigned int c = 0; c < 4; ++c) {
         for (unsigned int r = 0; r < 3; ++r) {
-            ret(r, c) = ::atof(mat_elements_str[i++].c_str());
+            while (pos != end && *pos == ' ') ++pos;
+            double value = 0.;
+            auto res = fast_float::from_chars(pos, end, value);
+            if (res.ec != std::errc())
+                // invalid data, return identity matrix
+                return Slic3r::Transform3d::Identity();
+            ret(r, c) = value;
+            pos = res.ptr;
         }
     }
+
+    while (pos != end && *pos == ' ') ++pos;
+    if (pos != end)
+        // extra data past the 12 elements, return identity matrix
+        return Slic3r::Transform3d::Identity();
+
     return ret;
 }
 
@@ -907,13 +932,13 @@ namespace Slic3r {
             // m_sla_support_points are indexed by a 1 based model object index.
             IdToSlaSupportPointsMap::iterator obj_sla_support_points = m_sla_support_points.find(object.second + 1);
             if (obj_sla_support_points != m_sla_support_points.end() && !obj_sla_support_points->second.empty()) {
-                model_object->sla_support_points = std::move(obj_sla_support_points->second);
+                model_object->sla_support_points.set(std::move(obj_sla_support_points->second));
                 model_object->sla_points_status = sla::PointsStatus::UserModified;
             }
 
             IdToSlaDrainHolesMap::iterator obj_drain_holes = m_sla_drain_holes.find(object.second + 1);
             if (obj_drain_holes != m_sla_drain_holes.end() && !obj_drain_holes->second.empty()) {
-                model_object->sla_drain_holes = std::move(obj_drain_holes->second);
+                model_object->sla_drain_holes.set(std::move(obj_drain_holes->second));
             }
 
             ObjectMetadata::VolumeMetadataList volumes;
@@ -2662,7 +2687,11 @@ namespace Slic3r {
         mz_zip_archive archive;
         mz_zip_zero_struct(&archive);
 
-        if (!open_zip_writer(&archive, filename)) {
+        // Write the archive into a temporary file and rename it over the destination only after
+        // it was finalized, so a failed or interrupted save cannot destroy an existing file
+        // (for example the previously saved revision of a project) at the destination path.
+        const std::string filename_tmp = filename + ".tmp";
+        if (!open_zip_writer(&archive, filename_tmp)) {
             add_error("Unable to open the file");
             return false;
         }
@@ -2671,7 +2700,7 @@ namespace Slic3r {
         // The content of this file is the same for each PrusaSlicer 3mf.
         if (!_add_content_types_file_to_archive(archive)) {
             close_zip_writer(&archive);
-            boost::filesystem::remove(filename);
+            boost::filesystem::remove(filename_tmp);
             return false;
         }
 
@@ -2679,7 +2708,7 @@ namespace Slic3r {
             // Adds the file Metadata/thumbnail.png.
             if (!_add_thumbnail_file_to_archive(archive, *thumbnail_data)) {
                 close_zip_writer(&archive);
-                boost::filesystem::remove(filename);
+                boost::filesystem::remove(filename_tmp);
                 return false;
             }
         }
@@ -2689,7 +2718,7 @@ namespace Slic3r {
         // The relationshis file contains a reference to the geometry file "3D/3dmodel.model", the name was chosen to be compatible with CURA.
         if (!_add_relationships_file_to_archive(archive)) {
             close_zip_writer(&archive);
-            boost::filesystem::remove(filename);
+            boost::filesystem::remove(filename_tmp);
             return false;
         }
 
@@ -2698,7 +2727,7 @@ namespace Slic3r {
         IdToObjectDataMap objects_data;
         if (!_add_model_file_to_archive(filename, archive, model, objects_data)) {
             close_zip_writer(&archive);
-            boost::filesystem::remove(filename);
+            boost::filesystem::remove(filename_tmp);
             return false;
         }
 
@@ -2707,7 +2736,7 @@ namespace Slic3r {
         // The index differes from the index of an object ID of an object instance of a 3MF file!
         if (!_add_cut_information_file_to_archive(archive, model)) {
             close_zip_writer(&archive);
-            boost::filesystem::remove(filename);
+            boost::filesystem::remove(filename_tmp);
             return false;
         }
 
@@ -2716,7 +2745,7 @@ namespace Slic3r {
         // The index differes from the index of an object ID of an object instance of a 3MF file!
         if (!_add_layer_height_profile_file_to_archive(archive, model)) {
             close_zip_writer(&archive);
-            boost::filesystem::remove(filename);
+            boost::filesystem::remove(filename_tmp);
             return false;
         }
 
@@ -2725,7 +2754,7 @@ namespace Slic3r {
         // The index differes from the index of an object ID of an object instance of a 3MF file!
         if (!_add_layer_config_ranges_file_to_archive(archive, model)) {
             close_zip_writer(&archive);
-            boost::filesystem::remove(filename);
+            boost::filesystem::remove(filename_tmp);
             return false;
         }
 
@@ -2734,13 +2763,13 @@ namespace Slic3r {
         // The index differes from the index of an object ID of an object instance of a 3MF file!
         if (!_add_sla_support_points_file_to_archive(archive, model)) {
             close_zip_writer(&archive);
-            boost::filesystem::remove(filename);
+            boost::filesystem::remove(filename_tmp);
             return false;
         }
         
         if (!_add_sla_drain_holes_file_to_archive(archive, model)) {
             close_zip_writer(&archive);
-            boost::filesystem::remove(filename);
+            boost::filesystem::remove(filename_tmp);
             return false;
         }
         
@@ -2749,7 +2778,7 @@ namespace Slic3r {
         // All custom gcode per height of whole Model are stored here
         if (!_add_custom_gcode_per_print_z_file_to_archive(archive, model, config)) {
             close_zip_writer(&archive);
-            boost::filesystem::remove(filename);
+            boost::filesystem::remove(filename_tmp);
             return false;
         }
 
@@ -2758,7 +2787,7 @@ namespace Slic3r {
         if (config != nullptr) {
             if (!_add_print_config_file_to_archive(archive, *config)) {
                 close_zip_writer(&archive);
-                boost::filesystem::remove(filename);
+                boost::filesystem::remove(filename_tmp);
                 return false;
             }
         }
@@ -2769,19 +2798,27 @@ namespace Slic3r {
         // is stored here as well.
         if (!_add_model_config_file_to_archive(archive, model, objects_data)) {
             close_zip_writer(&archive);
-            boost::filesystem::remove(filename);
+            boost::filesystem::remove(filename_tmp);
             return false;
         }
 
         if (!mz_zip_writer_finalize_archive(&archive)) {
             close_zip_writer(&archive);
-            boost::filesystem::remove(filename);
+            boost::filesystem::remove(filename_tmp);
             add_error("Unable to finalize the archive");
             return false;
         }
 
         close_zip_writer(&archive);
 
+        boost::system::error_code ec;
+        boost::filesystem::rename(filename_tmp, filename, ec);
+        if (ec) {
+            boost::filesystem::remove(filename_tmp, ec);
+            add_error("Unable to replace the destination file");
+            return false;
+        }
+
         return true;
     }
 
@@ -3020,23 +3057,26 @@ namespace Slic3r {
 
     bool _3MF_Exporter::_add_mesh_to_object_stream(mz_zip_writer_staged_context &context, ModelObject& object, VolumeToOffsetsMap& volumes_offsets)
     {
-        std::string output_buffer;
-        output_buffer += "   <";
-        output_buffer += MESH_TAG;
-        output_buffer += ">\n    <";
-        output_buffer += VERTICES_TAG;
-        output_buffer += ">\n";
+        // Compute the vertex and triangle offsets of all the volumes up
+        // front, the chunk formatters below need them.
+        unsigned int vertices_count = 0;
+        unsigned int triangles_count = 0;
+        for (ModelVolume* volume : object.volumes) {
+            if (volume == nullptr)
+                continue;
 
-        auto flush = [this, &output_buffer, &context](bool force = false) {
-            if ((force && ! output_buffer.empty()) || output_buffer.size() >= 65536 * 16) {
-                if (! mz_zip_writer_add_staged_data(&context, output_buffer.data(), output_buffer.size())) {
-                    add_error("Error during writing or compression");
-                    return false;
-                }
-                output_buffer.clear();
+            const indexed_triangle_set &its = volume->mesh().its;
+            if (its.vertices.empty()) {
+                add_error("Found invalid mesh");
+                return false;
             }
-            return true;
-        };
+
+            VolumeToOffsetsMap::iterator volume_it = volumes_offsets.insert({ volume, Offsets(vertices_count) }).first;
+            vertices_count += (unsigned int)its.vertices.size();
+            volume_it->second.first_triangle_id = triangles_count;
+            triangles_count += (unsigned int)its.indices.size();
+            volume_it->second.last_triangle_id = triangles_count - 1;
+        }
 
         auto format_coordinate = [](float f, char *buf) -> char* {
             assert(is_decimal_separator_point());
@@ -3068,25 +3108,56 @@ namespace Slic3r {
 #endif
         };
 
-        char buf[256];
-        unsigned int vertices_count = 0;
+        // A chunk is either a literal piece of XML or a range of vertices or
+        // triangles of a single volume. Formatting the ranges into text is
+        // what dominates the export of large plates, so the chunks are
+        // formatted concurrently and the results are handed over to the zip
+        // deflater in document order by the pipeline below.
+        struct Chunk {
+            enum class Type { Literal, Vertices, Triangles };
+            Type               type;
+            std::string        literal;
+            const ModelVolume *volume = nullptr;
+            size_t             begin = 0;
+            size_t             end = 0;
+            unsigned int       first_vertex_id = 0;
+        };
+
+        constexpr size_t ChunkSize = 16384;
+
+        std::vector<Chunk> chunks;
+        chunks.push_back({Chunk::Type::Literal,
+                          std::string("   <") + MESH_TAG + ">\n    <" + VERTICES_TAG + ">\n"});
         for (ModelVolume* volume : object.volumes) {
             if (volume == nullptr)
                 continue;
 
-            volumes_offsets.insert({ volume, Offsets(vertices_count) });
-
-            const indexed_triangle_set &its = volume->mesh().its;
-            if (its.vertices.empty()) {
-                add_error("Found invalid mesh");
-                return false;
-            }
-
-            vertices_count += (int)its.vertices.size();
+            size_t cnt = volume->mesh().its.vertices.size();
+            for (size_t from = 0; from < cnt; from += ChunkSize)
+                chunks.push_back({Chunk::Type::Vertices, {}, volume, from, std::min(from + ChunkSize, cnt)});
+        }
+        chunks.push_back({Chunk::Type::Literal,
+                          std::string("    </") + VERTICES_TAG + ">\n    <" + TRIANGLES_TAG + ">\n"});
+        for (ModelVolume* volume : object.volumes) {
+            if (volume == nullptr)
+                continue;
 
-            const Transform3d& matrix = volume->get_matrix();
-            for (const auto& vertex: its.vertices) {
-                Vec3f v = (matrix * vertex.cast<double>()).cast<float>();
+            size_t cnt = volume->mesh().its.indices.size();
+            unsigned int first_vertex_id = volumes_offsets.find(volume)->second.first_vertex_id;
+            for (size_t from = 0; from < cnt; from += ChunkSize)
+                chunks.push_back({Chunk::Type::Triangles, {}, volume, from, std::min(from + ChunkSize, cnt), first_vertex_id});
+        }
+        chunks.push_back({Chunk::Type::Literal,
+                          std::string("    </") + TRIANGLES_TAG + ">\n   </" + MESH_TAG + ">\n"});
+
+        auto format_vertices = [&format_coordinate](const Chunk &chunk) {
+            const Transform3d& matrix = chunk.volume->get_matrix();
+            const indexed_triangle_set &its = chunk.volume->mesh().its;
+            std::string out;
+            out.reserve((chunk.end - chunk.begin) * 64);
+            char buf[256];
+            for (size_t i = chunk.begin; i < chunk.end; ++ i) {
+                Vec3f v = (matrix * its.vertices[i].cast<double>()).cast<float>();
                 char *ptr = buf;
                 boost::spirit::karma::generate(ptr, boost::spirit::lit("     <") << VERTEX_TAG << " x=\"");
                 ptr = format_coordinate(v.x(), ptr);
@@ -3095,36 +3166,19 @@ namespace Slic3r {
                 boost::spirit::karma::generate(ptr, "\" z=\"");
                 ptr = format_coordinate(v.z(), ptr);
                 boost::spirit::karma::generate(ptr, "\"/>\n");
-                *ptr = '\0';
-                output_buffer += buf;
-                if (! flush())
-                    return false;
+                out.append(buf, ptr - buf);
             }
-        }
-
-        output_buffer += "    </";
-        output_buffer += VERTICES_TAG;
-        output_buffer += ">\n    <";
-        output_buffer += TRIANGLES_TAG;
-        output_buffer += ">\n";
-
-        unsigned int triangles_count = 0;
-        for (ModelVolume* volume : object.volumes) {
-            if (volume == nullptr)
-                continue;
-
-            bool is_left_handed = volume->is_left_handed();
-            VolumeToOffsetsMap::iterator volume_it = volumes_offsets.find(volume);
-            assert(volume_it != volumes_offsets.end());
+            return out;
+        };
 
+        auto format_triangles = [](const Chunk &chunk) {
+            const ModelVolume *volume = chunk.volume;
             const indexed_triangle_set &its = volume->mesh().its;
-
-            // updates triangle offsets
-            volume_it->second.first_triangle_id = triangles_count;
-            triangles_count += (int)its.indices.size();
-            volume_it->second.last_triangle_id = triangles_count - 1;
-
-            for (int i = 0; i < int(its.indices.size()); ++ i) {
+            bool is_left_handed = volume->is_left_handed();
+            std::string out;
+            out.reserve((chunk.end - chunk.begin) * 48);
+            char buf[256];
+            for (size_t i = chunk.begin; i < chunk.end; ++ i) {
                 {
                     const Vec3i &idx = its.indices[i];
                     char *ptr = buf;
@@ -3132,55 +3186,77 @@ namespace Slic3r {
                         " v1=\"" << boost::spirit::int_ <<
                         "\" v2=\"" << boost::spirit::int_ <<
                         "\" v3=\"" << boost::spirit::int_ << "\"",
-                        idx[is_left_handed ? 2 : 0] + volume_it->second.first_vertex_id,
-                        idx[1] + volume_it->second.first_vertex_id,
-                        idx[is_left_handed ? 0 : 2] + volume_it->second.first_vertex_id);
-                    *ptr = '\0';
-                    output_buffer += buf;
+                        idx[is_left_handed ? 2 : 0] + chunk.first_vertex_id,
+                        idx[1] + chunk.first_vertex_id,
+                        idx[is_left_handed ? 0 : 2] + chunk.first_vertex_id);
+                    out.append(buf, ptr - buf);
                 }
 
-                std::string custom_supports_data_string = volume->supported_facets.get_triangle_as_string(i);
+                std::string custom_supports_data_string = volume->supported_facets.get_triangle_as_string(int(i));
                 if (! custom_supports_data_string.empty()) {
-                    output_buffer += " ";
-                    output_buffer += CUSTOM_SUPPORTS_ATTR;
-                    output_buffer += "=\"";
-                    output_buffer += custom_supports_data_string;
-                    output_buffer += "\"";
+                    out += " ";
+                    out += CUSTOM_SUPPORTS_ATTR;
+                    out += "=\"";
+                    out += custom_supports_data_string;
+                    out += "\"";
                 }
 
-                std::string custom_seam_data_string = volume->seam_facets.get_triangle_as_string(i);
+                std::string custom_seam_data_string = volume->seam_facets.get_triangle_as_string(int(i));
                 if (! custom_seam_data_string.empty()) {
-                    output_buffer += " ";
-                    output_buffer += CUSTOM_SEAM_ATTR;
-                    output_buffer += "=\"";
-                    output_buffer += custom_seam_data_string;
-                    output_buffer += "\"";
+                    out += " ";
+                    out += CUSTOM_SEAM_ATTR;
+                    out += "=\"";
+                    out += custom_seam_data_string;
+                    out += "\"";
                 }
 
-                std::string mm_painting_data_string = volume->mm_segmentation_facets.get_triangle_as_string(i);
+                std::string mm_painting_data_string = volume->mm_segmentation_facets.get_triangle_as_string(int(i));
                 if (! mm_painting_data_string.empty()) {
-                    output_buffer += " ";
-                    output_buffer += MM_SEGMENTATION_ATTR;
-                    output_buffer += "=\"";
-                    output_buffer += mm_painting_data_string;
-                    output_buffer += "\"";
+                    out += " ";
+                    out += MM_SEGMENTATION_ATTR;
+                    out += "=\"";
+                    out += mm_painting_data_string;
+                    out += "\"";
                 }
 
-                output_buffer += "/>\n";
-
-                if (! flush())
-                    return false;
+                out += "/>\n";
             }
-        }
+            return out;
+        };
+
+        std::atomic<bool> error{ false };
+        size_t feed_idx = 0;
+        const auto chunk_feeder = tbb::make_filter<void, Chunk*>(slic3r_tbb_filtermode::serial_in_order,
+            [&chunks, &feed_idx, &error](tbb::flow_control &fc) -> Chunk* {
+                if (error || feed_idx == chunks.size()) {
+                    fc.stop();
+                    return nullptr;
+                }
+                return &chunks[feed_idx ++];
+            });
+        const auto chunk_formatter = tbb::make_filter<Chunk*, std::string>(slic3r_tbb_filtermode::parallel,
+            [&format_vertices, &format_triangles](Chunk *chunk) -> std::string {
+                switch (chunk->type) {
+                case Chunk::Type::Literal:  return chunk->literal;
+                case Chunk::Type::Vertices: return format_vertices(*chunk);
+                default:                    return format_triangles(*chunk);
+                }
+            });
+        const auto chunk_writer = tbb::make_filter<std::string, void>(slic3r_tbb_filtermode::serial_in_order,
+            [this, &context, &error](const std::string &buf) {
+                if (! error && ! buf.empty() && ! mz_zip_writer_add_staged_data(&context, buf.data(), buf.size())) {
+                    add_error("Error during writing or compression");
+                    error = true;
+                }
+            });
 
-        output_buffer += "    </";
-        output_buffer += TRIANGLES_TAG;
-        output_buffer += ">\n   </";
-        output_buffer += MESH_TAG;
-        output_buffer += ">\n";
+        // It registers a handler that sets locales to "C" before any TBB thread starts participating in
+        // tbb::parallel_pipeline, the coordinate formatters rely on it.
+        TBBLocalesSetter locales_setter;
+        // A bit more tokens than threads to keep the serial deflater stage fed.
+        tbb::parallel_pipeline(size_t(tbb::this_task_arena::max_concurrency()) + 4, chunk_feeder & chunk_formatter & chunk_writer);
 
-        // Force flush.
-        return flush(true);
+        return ! error;
     }
 
     void _3MF_Exporter::add_transformation(std::stringstream &stream, const Transform3d &tr)
@@ -3378,7 +3454,7 @@ namespace Slic3r {
         unsigned int count = 0;
         for (const ModelObject* object : model.objects) {
             ++count;
-            const std::vector<sla::SupportPoint>& sla_support_points = object->sla_support_points;
+            const std::vector<sla::SupportPoint>& sla_support_points = object->sla_support_points.get();
             if (!sla_support_points.empty()) {
                 sprintf(buffer, "object_id=%d|", count);
                 out += buffer;
@@ -3413,7 +3489,7 @@ namespace Slic3r {
         unsigned int count = 0;
         for (const ModelObject* object : model.objects) {
             ++count;
-            sla::DrainHoles drain_holes = object->sla_drain_holes;
+            sla::DrainHoles drain_holes = object->sla_drain_holes.get();
 
             // The holes were placed 1mm above the mesh in the first implementation.
             // This was a bad idea and the reference point was changed in 2.3 so
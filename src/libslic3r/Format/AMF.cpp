@@ -774,7 +774,7 @@ void AMFParserContext::endElement(const char * /* name */)
 
                     point(coord_idx) = float(atof(p));
                     if (++coord_idx == 5) {
-                        m_object->sla_support_points.push_back(sla::SupportPoint(point));
+                        m_object->sla_support_points.modify().push_back(sla::SupportPoint(point));
                         coord_idx = 0;
                     }
 					if (end == nullptr)
@@ -1189,7 +1189,7 @@ bool store_amf(const char* path, Model* model, const DynamicPrintConfig* config,
         }
 
 
-        const std::vector<sla::SupportPoint>& sla_support_points = object->sla_support_points;
+        const std::vector<sla::SupportPoint>& sla_support_points = object->sla_support_points.get();
         if (!sla_support_points.empty()) {
             // Store the SLA supports as a single semicolon separated list.
             stream << "    <metadata type=\"slic3r.sla_support_points\">";
@@ -35,7 +35,6 @@
 #define PREV_H 168
 #define PREV_DPI 42
 
-#define LAYER_SIZE_ESTIMATE (32 * 1024)
 
 namespace Slic3r {
 
@@ -412,15 +411,12 @@ sla::RasterEncoder AnycubicSLAArchive::get_encoder() const
 // Endian safe write of little endian 32bit ints
 static void anycubicsla_write_int32(std::ofstream &out, std::uint32_t val)
 {
-    const char i1 = (val & 0xFF);
-    const char i2 = (val >> 8) & 0xFF;
-    const char i3 = (val >> 16) & 0xFF;
-    const char i4 = (val >> 24) & 0xFF;
-
-    out.write((const char *) &i1, 1);
-    out.write((const char *) &i2, 1);
-    out.write((const char *) &i3, 1);
-    out.write((const char *) &i4, 1);
+    const char b[4] = {char(val & 0xFF),
+                       char((val >> 8) & 0xFF),
+                       char((val >> 16) & 0xFF),
+                       char((val >> 24) & 0xFF)};
+
+    out.write(b, sizeof(b));
 }
 static void anycubicsla_write_float(std::ofstream &out, float val)
 {
@@ -502,14 +498,13 @@ void AnycubicSLAArchive::export_print(const std::string     fname,
                                const ThumbnailsList &thumbnails,
                                const std::string    &/*projectname*/)
 {
-    std::uint32_t layer_count = m_layers.size();
+    std::uint32_t layer_count = this->layer_count();
 
     anycubicsla_format_intro         intro = {};
     anycubicsla_format_header        header = {};
     anycubicsla_format_preview       preview = {};
     anycubicsla_format_layers_header layers_header = {};
     anycubicsla_format_misc          misc = {};
-    std::vector<uint8_t>      layer_images;
     std::uint32_t             image_offset;
 
     assert(m_version == ANYCUBIC_SLA_FORMAT_VERSION_1);
@@ -527,8 +522,11 @@ void AnycubicSLAArchive::export_print(const std::string     fname,
     fill_preview(preview, misc, thumbnails);
 
     try {
-        // open the file and write the contents
+        // open the file and write the contents through a generous stream
+        // buffer, the layer table is composed of many small writes
+        std::vector<char> iobuf(1024 * 1024);
         std::ofstream out;
+        out.rdbuf()->pubsetbuf(iobuf.data(), std::streamsize(iobuf.size()));
         out.open(fname, std::ios::binary | std::ios::out | std::ios::trunc);
         anycubicsla_write_intro(out, intro);
         anycubicsla_write_header(out, header);
@@ -540,14 +538,12 @@ void AnycubicSLAArchive::export_print(const std::string     fname,
         anycubicsla_write_layers_header(out, layers_header);
 
         //layers
-        layer_images.reserve(layer_count * LAYER_SIZE_ESTIMATE);
         image_offset = intro.image_data_offset;
-        size_t i = 0;
-        for (const sla::EncodedRaster &rst : m_layers) {
+        for (std::uint32_t i = 0; i < layer_count; ++ i) {
             anycubicsla_format_layer l;
             std::memset(&l, 0, sizeof(l));
             l.image_offset = image_offset;
-            l.image_size = rst.size();
+            l.image_size = layer_size(i);
             if (i < header.bottom_layer_count) {
                 l.exposure_time_s = header.bottom_exposure_time_s;
                 l.layer_height_mm = misc.bottom_layer_height_mm;
@@ -561,14 +557,12 @@ void AnycubicSLAArchive::export_print(const std::string     fname,
             }
             image_offset += l.image_size;
             anycubicsla_write_layer(out, l);
-            // add the rle encoded layer image into the buffer
-            const char* img_start = reinterpret_cast<const char*>(rst.data());
-            const char* img_end = img_start + rst.size();
-            std::copy(img_start, img_end, std::back_inserter(layer_images));
-            i++;
         }
-        const char* img_buffer = reinterpret_cast<const char*>(layer_images.data());
-        out.write(img_buffer, layer_images.size());
+        // stream the rle encoded layer images from the spool file one at a time
+        for (std::uint32_t i = 0; i < layer_count; ++ i) {
+            sla::EncodedRaster rst = read_layer(i);
+            out.write(reinterpret_cast<const char*>(rst.data()), rst.size());
+        }
         out.close();
     } catch(std::exception& e) {
         BOOST_LOG_TRIVIAL(error) << e.what();
@@ -0,0 +1,165 @@
+///|/ Copyright (c) Prusa Research 2023 Vojtěch Bubník @bubnikv
+///|/
+///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
+///|/
+#include "MeshCache.hpp"
+
+#include "../libslic3r.h"
+#include "../Model.hpp"
+#include "../TriangleMesh.hpp"
+#include "../Utils.hpp"
+
+#include <cstdint>
+#include <string>
+
+#include <boost/algorithm/hex.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <boost/log/trivial.hpp>
+#include <boost/nowide/convert.hpp>
+#include <boost/nowide/fstream.hpp>
+//FIXME replace the two following includes with <boost/md5.hpp> after it becomes mainstream.
+#include <boost/uuid/detail/md5.hpp>
+
+#include <cereal/archives/binary.hpp>
+#include <cereal/types/string.hpp>
+#include <cereal/types/vector.hpp>
+
+namespace Slic3r {
+
+// Bumping the version invalidates all existing cache entries, do so whenever
+// the entry layout or the TriangleMesh serialization changes.
+static constexpr std::uint32_t MeshCacheVersion = 1;
+
+// Small files parse faster than the checksum round trip, don't cache them.
+static constexpr std::size_t MeshCacheMinFileSize = 1024 * 1024;
+
+// Derive the cache entry path for a source file: memory map the file and key
+// the entry by the MD5 checksum of its content, so a modified source never
+// matches a stale entry. Returns an empty string if the file shall not be
+// cached (no data directory configured, file too small or not mappable).
+static std::string mesh_cache_entry_path(const std::string &path, std::uint64_t &source_size)
+{
+    if (data_dir().empty())
+        return {};
+
+    boost::iostreams::mapped_file_source map;
+    try {
+#ifdef _WIN32
+        map.open(boost::filesystem::path(boost::nowide::widen(path)));
+#else
+        map.open(path);
+#endif
+    } catch (const std::exception &) { return {}; }
+
+    if (! map.is_open() || map.size() < MeshCacheMinFileSize)
+        return {};
+    source_size = map.size();
+
+    // boost::uuids::detail::md5 is an internal namespace thus it may change in the future.
+    using boost::uuids::detail::md5;
+    md5              md5_hash;
+    // unsigned int[4], 128 bits
+    md5::digest_type md5_digest{};
+    std::string      key;
+    md5_hash.process_bytes(map.data(), map.size());
+    md5_hash.get_digest(md5_digest);
+    boost::algorithm::hex(md5_digest, md5_digest + std::size(md5_digest), std::back_inserter(key));
+
+    return (boost::filesystem::path(data_dir()) / "cache" / "mesh" / (key + ".bin")).string();
+}
+
+bool load_model_from_mesh_cache(const std::string &path, Model *model)
+{
+    std::uint64_t source_size = 0;
+    std::string   cache_path  = mesh_cache_entry_path(path, source_size);
+    if (cache_path.empty())
+        return false;
+
+    boost::nowide::ifstream in(cache_path, std::ios::binary);
+    if (! in.good())
+        return false;
+
+    size_t num_objects_initial = model->objects.size();
+    try {
+        cereal::BinaryInputArchive archive(in);
+        std::uint32_t version = 0;
+        std::uint64_t size    = 0;
+        archive(version, size);
+        if (version != MeshCacheVersion || size != source_size)
+            return false;
+        std::uint64_t num_objects = 0;
+        archive(num_objects);
+        if (num_objects == 0)
+            throw Slic3r::RuntimeError("Mesh cache entry contains no objects.");
+        for (std::uint64_t i = 0; i < num_objects; ++ i) {
+            ModelObject *new_object = model->add_object();
+            archive(new_object->name);
+            new_object->input_file = path;
+            std::uint64_t num_volumes = 0;
+            archive(num_volumes);
+            for (std::uint64_t j = 0; j < num_volumes; ++ j) {
+                std::string  volume_name;
+                TriangleMesh mesh;
+                archive(volume_name, mesh);
+                if (mesh.empty())
+                    throw Slic3r::RuntimeError("Mesh cache entry contains an empty mesh.");
+                ModelVolume *new_volume = new_object->add_volume(std::move(mesh));
+                new_volume->name              = volume_name;
+                new_volume->source.input_file = path;
+                new_volume->source.object_idx = (int)model->objects.size() - 1;
+                new_volume->source.volume_idx = (int)new_object->volumes.size() - 1;
+            }
+            if (new_object->volumes.empty())
+                throw Slic3r::RuntimeError("Mesh cache entry contains an object without volumes.");
+            new_object->invalidate_bounding_box();
+        }
+    } catch (const std::exception &ex) {
+        BOOST_LOG_TRIVIAL(warning) << "Reading of the mesh cache entry for " << path << " failed: " << ex.what();
+        // Roll back the partially deserialized objects and drop the corrupted
+        // entry, the caller falls back to a full reparse which will rewrite it.
+        while (model->objects.size() > num_objects_initial)
+            model->delete_object(model->objects.size() - 1);
+        in.close();
+        boost::system::error_code ec;
+        boost::filesystem::remove(cache_path, ec);
+        return false;
+    }
+
+    BOOST_LOG_TRIVIAL(debug) << "Loaded " << path << " from the mesh cache.";
+    return true;
+}
+
+void store_model_to_mesh_cache(const std::string &path, const Model &model)
+{
+    std::uint64_t source_size = 0;
+    std::string   cache_path  = mesh_cache_entry_path(path, source_size);
+    if (cache_path.empty())
+        return;
+
+    try {
+        boost::filesystem::create_directories(boost::filesystem::path(cache_path).parent_path());
+        // Write a temporary file first and rename it over the final name, so
+        // a concurrent reader never sees a partially written entry.
+        std::string cache_path_tmp = cache_path + ".tmp";
+        {
+            boost::nowide::ofstream out(cache_path_tmp, std::ios::binary | std::ios::trunc);
+            cereal::BinaryOutputArchive archive(out);
+            archive(std::uint32_t(MeshCacheVersion), source_size);
+            archive(std::uint64_t(model.objects.size()));
+            for (const ModelObject *object : model.objects) {
+                archive(object->name);
+                archive(std::uint64_t(object->volumes.size()));
+                for (const ModelVolume *volume : object->volumes)
+                    archive(volume->name, volume->mesh());
+            }
+            if (! out.good())
+                throw Slic3r::RuntimeError("Writing of the mesh cache entry failed.");
+        }
+        boost::filesystem::rename(cache_path_tmp, cache_path);
+    } catch (const std::exception &ex) {
+        BOOST_LOG_TRIVIAL(warning) << "Storing of the mesh cache entry for " << path << " failed: " << ex.what();
+    }
+}
+
+} // namespace Slic3r
@@ -0,0 +1,32 @@
+///|/ Copyright (c) Prusa Research 2023 Vojtěch Bubník @bubnikv
+///|/
+///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
+///|/
+#ifndef slic3r_Format_MeshCache_hpp_
+#define slic3r_Format_MeshCache_hpp_
+
+#include <string>
+
+namespace Slic3r {
+
+class Model;
+
+// Binary sidecar cache for meshes imported from plain geometry files (STL, OBJ, STEP).
+// The cache entry is keyed by the checksum of the source file content and stores
+// the parsed (and repaired) meshes together with the object / volume names,
+// which is all the state these importers produce. A repeated import of an
+// unchanged file is then served by a single pass over the source file (checksum)
+// plus a binary deserialization, skipping the parser and the mesh repair.
+// Project formats (3MF, AMF) carry configuration and are not cached here.
+
+// Try to satisfy a geometry file import from the mesh cache.
+// Returns true and fills the model on a cache hit, returns false otherwise.
+extern bool load_model_from_mesh_cache(const std::string &path, Model *model);
+
+// Store a freshly imported geometry file into the mesh cache. Best effort,
+// failures (no data directory, disk full) are logged and otherwise ignored.
+extern void store_model_to_mesh_cache(const std::string &path, const Model &model);
+
+} // namespace Slic3r
+
+#endif /* slic3r_Format_MeshCache_hpp_ */
@@ -326,10 +326,12 @@ void SL1Archive::export_print(Zipper               &zipper,
         zipper.add_entry("config.json");
         zipper << to_json(print, iniconf);
 
-        size_t i = 0;
-        for (const sla::EncodedRaster &rst : m_layers) {
+        for (size_t i = 0, n = layer_count(); i < n; ++ i) {
+            // Stream the layer images from the spool file one at a time, so
+            // the whole print is never held in memory at once.
+            sla::EncodedRaster rst = read_layer(i);
 
-            std::string imgname = project + string_printf("%.5d", i++) + "." +
+            std::string imgname = project + string_printf("%.5d", i) + "." +
                                   rst.extension();
 
             zipper.add_entry(imgname.c_str(), rst.data(), rst.size());
@@ -6,8 +6,76 @@
 #include "SLAArchiveWriter.hpp"
 #include "SLAArchiveFormatRegistry.hpp"
 
+#include "libslic3r/Exception.hpp"
+
+#include <boost/filesystem/operations.hpp>
+
 namespace Slic3r {
 
+SLAArchiveWriter::~SLAArchiveWriter()
+{
+    if (m_spool.is_open()) {
+        m_spool.close();
+        boost::system::error_code ec;
+        boost::filesystem::remove(m_spool_path, ec);
+    }
+}
+
+void SLAArchiveWriter::spool_reset(size_t layer_num)
+{
+    if (m_spool_path.empty())
+        m_spool_path = boost::filesystem::temp_directory_path() /
+                       boost::filesystem::unique_path();
+
+    // Truncating also reclaims the disk space of a previous rasterization.
+    if (m_spool.is_open())
+        m_spool.close();
+
+    m_spool.open(m_spool_path.string(),
+                 std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if (!m_spool.is_open())
+        throw RuntimeError("Unable to open layer spool file " + m_spool_path.string());
+
+    m_spool_pos = 0;
+    m_layers.assign(layer_num, LayerRecord{});
+}
+
+void SLAArchiveWriter::spool_write(size_t idx, const sla::EncodedRaster &enc)
+{
+    std::lock_guard<std::mutex> lock(m_spool_mutex);
+
+    LayerRecord &rec = m_layers[idx];
+    rec.offset = m_spool_pos;
+    rec.size   = enc.size();
+    rec.ext    = enc.extension();
+
+    m_spool.seekp(std::streamoff(m_spool_pos));
+    m_spool.write(static_cast<const char *>(enc.data()), std::streamsize(enc.size()));
+
+    if (!m_spool.good())
+        throw RuntimeError("Unable to write layer spool file " + m_spool_path.string());
+
+    m_spool_pos += enc.size();
+}
+
+sla::EncodedRaster SLAArchiveWriter::read_layer(size_t idx) const
+{
+    std::lock_guard<std::mutex> lock(m_spool_mutex);
+
+    const LayerRecord &rec = m_layers[idx];
+    std::vector<uint8_t> buf(rec.size);
+
+    m_spool.clear();
+    m_spool.seekg(std::streamoff(rec.offset));
+    m_spool.read(reinterpret_cast<char *>(buf.data()), std::streamsize(rec.size));
+
+    if (!m_spool.good())
+        throw RuntimeError("Unable to read layer spool file " + m_spool_path.string());
+
+    return sla::EncodedRaster{std::move(buf), rec.ext};
+}
+
 std::unique_ptr<SLAArchiveWriter>
 SLAArchiveWriter::create(const std::string &archtype, const SLAPrinterConfig &cfg)
 {
@@ -5,8 +5,13 @@
 #ifndef SLAARCHIVE_HPP
 #define SLAARCHIVE_HPP
 
+#include <cstdint>
+#include <mutex>
 #include <vector>
 
+#include <boost/filesystem/path.hpp>
+#include <boost/nowide/fstream.hpp>
+
 #include "libslic3r/SLA/RasterBase.hpp"
 #include "libslic3r/Execution/ExecutionTBB.hpp"
 #include "libslic3r/GCode/ThumbnailData.hpp"
@@ -18,13 +23,30 @@ class SLAPrinterConfig;
 
 class SLAArchiveWriter {
 protected:
-    std::vector<sla::EncodedRaster> m_layers;
+    // Position of one encoded layer image inside the spool file.
+    struct LayerRecord {
+        uint64_t    offset = 0;
+        uint64_t    size   = 0;
+        std::string ext;
+    };
+
+    // The encoded layer images are spooled into a temporary file as the layers
+    // get rasterized, so that the peak memory consumption does not scale with
+    // the layer count. Only the (offset, size) records are kept in memory, the
+    // exporters stream the images back one at a time with read_layer().
+    std::vector<LayerRecord> m_layers;
 
     virtual std::unique_ptr<sla::RasterBase> create_raster() const = 0;
     virtual sla::RasterEncoder get_encoder() const = 0;
 
+    size_t   layer_count() const { return m_layers.size(); }
+    uint64_t layer_size(size_t idx) const { return m_layers[idx].size; }
+
+    // Read one encoded layer image back from the spool file.
+    sla::EncodedRaster read_layer(size_t idx) const;
+
 public:
-    virtual ~SLAArchiveWriter() = default;
+    virtual ~SLAArchiveWriter();
 
     // Fn have to be thread safe: void(sla::RasterBase& raster, size_t lyrid);
     template<class Fn, class CancelFn, class EP = ExecutionTBB>
@@ -34,16 +56,15 @@ public:
         CancelFn cancelfn = []() { return false; },
         const EP & ep       = {})
     {
-        m_layers.resize(layer_num);
+        spool_reset(layer_num);
         execution::for_each(
-            ep, size_t(0), m_layers.size(),
+            ep, size_t(0), layer_num,
             [this, &drawfn, &cancelfn](size_t idx) {
                 if (cancelfn()) return;
 
-                sla::EncodedRaster &enc = m_layers[idx];
-                auto                rst = create_raster();
+                auto rst = create_raster();
                 drawfn(*rst, idx);
-                enc = rst->encode(get_encoder());
+                spool_write(idx, rst->encode(get_encoder()));
             },
             execution::max_concurrency(ep));
     }
@@ -57,6 +78,17 @@ public:
     // Factory method to create an archiver instance
     static std::unique_ptr<SLAArchiveWriter> create(
         const std::string &archtype, const SLAPrinterConfig &);
+
+private:
+    // (Re)open the spool file truncated and prepare records for layer_num layers.
+    void spool_reset(size_t layer_num);
+    // Append one encoded layer image to the spool file. Thread safe.
+    void spool_write(size_t idx, const sla::EncodedRaster &enc);
+
+    boost::filesystem::path        m_spool_path;
+    mutable boost::nowide::fstream m_spool;
+    uint64_t                       m_spool_pos = 0;
+    mutable std::mutex             m_spool_mutex;
 };
 
 } // namespace Slic3r
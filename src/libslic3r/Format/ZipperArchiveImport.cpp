@@ -7,11 +7,18 @@
 #include "libslic3r/miniz_extension.hpp"
 #include "libslic3r/Exception.hpp"
 #include "libslic3r/PrintConfig.hpp"
+#include "libslic3r/Execution/ExecutionTBB.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
 
 #include <boost/property_tree/ini_parser.hpp>
 #include <boost/filesystem/path.hpp>
 #include <boost/algorithm/string.hpp>
 
+#include <tbb/enumerable_thread_specific.h>
+
 namespace Slic3r {
 
 namespace {
@@ -32,25 +39,12 @@ boost::property_tree::ptree read_ini(const mz_zip_archive_file_stat &entry,
     return tree;
 }
 
-// Read an arbitrary file into EntryBuffer
-EntryBuffer read_entry(const mz_zip_archive_file_stat &entry,
-                       MZ_Archive                     &zip,
-                       const std::string              &name)
-{
-    std::vector<uint8_t> buf(entry.m_uncomp_size);
-
-    if (!mz_zip_reader_extract_to_mem(&zip.arch, entry.m_file_index,
-                                           buf.data(), buf.size(), 0))
-        throw Slic3r::FileIOError(zip.get_errorstr());
-
-    return {std::move(buf), (name.empty() ? entry.m_filename : name)};
-}
-
 } // namespace
 
 ZipperArchive read_zipper_archive(const std::string &zipfname,
                                   const std::vector<std::string> &includes,
-                                  const std::vector<std::string> &excludes)
+                                  const std::vector<std::string> &excludes,
+                                  const ZipEntryFilter &filter)
 {
     ZipperArchive arch;
 
@@ -68,6 +62,12 @@ ZipperArchive read_zipper_archive(const std::string &zipfname,
 
     mz_uint num_entries = mz_zip_reader_get_num_files(&zip.arch);
 
+    // First pass: walk the central directory, read the metadata files and
+    // collect the payload entries passing the filters. Nothing is inflated
+    // here except the two small ini files.
+    struct PendingEntry { mz_uint file_index; std::string name; size_t size; };
+    auto pending = reserve_vector<PendingEntry>(num_entries);
+
     for (mz_uint i = 0; i < num_entries; ++i) {
         mz_zip_archive_file_stat entry;
 
@@ -97,17 +97,68 @@ ZipperArchive read_zipper_archive(const std::string &zipfname,
                 continue;
             }
 
-            auto it = std::lower_bound(
-                arch.entries.begin(), arch.entries.end(),
-                EntryBuffer{{}, name},
-                [](const EntryBuffer &r1, const EntryBuffer &r2) {
-                    return std::less<std::string>()(r1.fname, r2.fname);
-                });
+            if (filter && !filter(name, size_t(entry.m_uncomp_size)))
+                continue;
 
-            arch.entries.insert(it, read_entry(entry, zip, name));
+            pending.emplace_back(PendingEntry{entry.m_file_index, std::move(name),
+                                              size_t(entry.m_uncomp_size)});
         }
     }
 
+    // Keep the entries ordered by file name, as the insertion sort of the
+    // serial implementation did.
+    std::sort(pending.begin(), pending.end(),
+              [](const PendingEntry &r1, const PendingEntry &r2) {
+                  return std::less<std::string>()(r1.name, r2.name);
+              });
+
+    // Allocate the output buffers up front, the workers inflate straight into
+    // their final place without intermediate copies.
+    arch.entries.resize(pending.size());
+    for (size_t i = 0; i < pending.size(); ++i) {
+        arch.entries[i].fname = pending[i].name;
+        arch.entries[i].buf.resize(pending[i].size);
+    }
+
+    if (pending.size() == 1) {
+        if (!mz_zip_reader_extract_to_mem(&zip.arch, pending.front().file_index,
+                                          arch.entries.front().buf.data(),
+                                          arch.entries.front().buf.size(), 0))
+            throw Slic3r::FileIOError(zip.get_errorstr());
+    } else if (!pending.empty()) {
+        // Second pass: inflate the entries concurrently. An mz_zip_archive
+        // reader keeps mutable state, so each worker thread opens its own
+        // handle over the same (memory mapped, hence shared) archive.
+        tbb::enumerable_thread_specific<std::unique_ptr<Arch>> tls_zip;
+        std::mutex          err_mtx;
+        std::exception_ptr  err;
+
+        execution::for_each(
+            ex_tbb, size_t(0), pending.size(),
+            [&](size_t i) {
+                try {
+                    std::unique_ptr<Arch> &z = tls_zip.local();
+                    if (!z)
+                        z = std::make_unique<Arch>(zipfname);
+
+                    EntryBuffer &eb = arch.entries[i];
+                    if (!mz_zip_reader_extract_to_mem(&z->arch,
+                                                      pending[i].file_index,
+                                                      eb.buf.data(),
+                                                      eb.buf.size(), 0))
+                        throw Slic3r::FileIOError(z->get_errorstr());
+                } catch (...) {
+                    std::lock_guard lk{err_mtx};
+                    if (!err)
+                        err = std::current_exception();
+                }
+            },
+            execution::max_concurrency(ex_tbb));
+
+        if (err)
+            std::rethrow_exception(err);
+    }
+
     return arch;
 }
 
@@ -8,6 +8,7 @@
 #include <vector>
 #include <string>
 #include <cstdint>
+#include <functional>
 
 #include <boost/property_tree/ptree.hpp>
 
@@ -33,6 +34,12 @@ struct ZipperArchive
 const constexpr char *CONFIG_FNAME  = "config.ini";
 const constexpr char *PROFILE_FNAME = "prusaslicer.ini";
 
+// Predicate deciding whether an archive entry shall be decoded. Receives the
+// lowercased entry name and the uncompressed size, entries rejected here are
+// never inflated. More expressive than the include/exclude substrings, e.g.
+// preview images can be skipped based on their size.
+using ZipEntryFilter = std::function<bool(const std::string &name, size_t uncomp_size)>;
+
 // Read an archive that was written using the Zipper class.
 // The includes parameter is a set of file name substrings that the entries
 // must contain to be included in ZipperArchive.
@@ -41,9 +48,11 @@ const constexpr char *PROFILE_FNAME = "prusaslicer.ini";
 // Every file in the archive is read into ZipperArchive::entries
 // except the files CONFIG_FNAME, and PROFILE_FNAME which are read into
 // ZipperArchive::config and ZipperArchive::profile structures.
+// The entries surviving the filters are decompressed concurrently.
 ZipperArchive read_zipper_archive(const std::string &zipfname,
                                   const std::vector<std::string> &includes,
-                                  const std::vector<std::string> &excludes);
+                                  const std::vector<std::string> &excludes,
+                                  const ZipEntryFilter &filter = {});
 
 // Extract the print profile form the archive into 'out'.
 // Returns a profile that has correct parameters to use for model reconstruction
@@ -343,6 +343,33 @@ static bool obj_parseline(const char *line, ObjData &data)
 	return true;
 }
 
+// Split the buffer into lines on '\n' and '\r' with memchr(), which is
+// vectorized in common libc implementations, instead of testing every byte,
+// and feed the lines to obj_parseline(). Returns the offset of the first
+// unterminated line, to be retained for the next buffer refill.
+static size_t obj_parse_buffer(char *buf, size_t len, ObjData &data)
+{
+	size_t lastLine = 0;
+	for (;;) {
+		char  *rest      = buf + lastLine;
+		size_t remaining = len - lastLine;
+		char  *eol       = (char *)memchr(rest, '\n', remaining);
+		if (char *cr = (char *)memchr(rest, '\r', eol == nullptr ? remaining : size_t(eol - rest)); cr != nullptr)
+			eol = cr;
+		if (eol == nullptr)
+			break;
+		*eol = 0;
+		char *c = rest;
+		while (*c == ' ' || *c == '\t')
+			++ c;
+		//FIXME check the return value and exit on error?
+		// Will it break parsing of some obj files?
+		obj_parseline(c, data);
+		lastLine = size_t(eol - buf) + 1;
+	}
+	return lastLine;
+}
+
 bool objparse(const char *path, ObjData &data)
 {
     Slic3r::CNumericLocalesSetter locales_setter;
@@ -357,18 +384,7 @@ bool objparse(const char *path, ObjData &data)
 		size_t lenPrev = 0;
 		while ((len = ::fread(buf + lenPrev, 1, 65536, pFile)) != 0) {
 			len += lenPrev;
-			size_t lastLine = 0;
-			for (size_t i = 0; i < len; ++ i)
-				if (buf[i] == '\r' || buf[i] == '\n') {
-					buf[i] = 0;
-					char *c = buf + lastLine;
-					while (*c == ' ' || *c == '\t')
-						++ c;
-					//FIXME check the return value and exit on error?
-					// Will it break parsing of some obj files?
-					obj_parseline(c, data);
-					lastLine = i + 1;
-				}
+			size_t lastLine = obj_parse_buffer(buf, len, data);
 			lenPrev = len - lastLine;
 			if (lenPrev > 65536) {
 		    	BOOST_LOG_TRIVIAL(error) << "ObjParser: Excessive line length";
@@ -398,16 +414,7 @@ bool objparse(std::istream &stream, ObjData &data)
         size_t lenPrev = 0;
         while ((len = size_t(stream.read(buf + lenPrev, 65536).gcount())) != 0) {
             len += lenPrev;
-            size_t lastLine = 0;
-            for (size_t i = 0; i < len; ++ i)
-                if (buf[i] == '\r' || buf[i] == '\n') {
-                    buf[i] = 0;
-                    char *c = buf + lastLine;
-                    while (*c == ' ' || *c == '\t')
-                        ++ c;
-                    obj_parseline(c, data);
-                    lastLine = i + 1;
-                }
+            size_t lastLine = obj_parse_buffer(buf, len, data);
             lenPrev = len - lastLine;
             memmove(buf, buf + lastLine, lenPrev);
         }
@@ -41,6 +41,7 @@
 #include "ShortestPath.hpp"
 #include "Print.hpp"
 #include "Thread.hpp"
+#include "Tracing.hpp"
 #include "Utils.hpp"
 #include "ClipperUtils.hpp"
 #include "libslic3r.h"
@@ -84,6 +85,14 @@
     #include <tbb/pipeline.h>
     using slic3r_tbb_filtermode = tbb::filter;
 #endif
+#include <tbb/task_arena.h>
+
+// Number of tokens in flight in the G-code export tbb::parallel_pipeline:
+// a bit more than the number of threads to keep the serial stages fed.
+static inline size_t gcode_pipeline_tokens()
+{
+    return size_t(tbb::this_task_arena::max_concurrency()) + 4;
+}
 
 using namespace std::literals::string_view_literals;
 
@@ -576,8 +585,21 @@ GCodeGenerator::GCodeGenerator(const Print* print) :
     m_print(print)
     {}
 
+//FIXME A checkpointed re-export (splicing the unchanged leading layers of the previous export and
+// resuming the generator from a per-layer state snapshot) was evaluated for the frequent case of
+// editing just the per-layer custom G-code (e.g. a color change at a late layer): the first modified
+// print_z is cheap to derive from the custom G-code diff in Print::apply() and everything below it
+// produces identical G-code. It was not implemented, because the serial cross-layer state of the
+// generator is not limited to the writer position / extruder state and the CoolingBuffer history:
+// the seam history, the wipe tower, the PlaceholderParser variables mutated by custom G-code blocks,
+// the PressureEqualizer window and the GCodeProcessor stream (which consumes the output while it is
+// being written and then rewrites the whole file with the time estimates) would all have to be
+// snapshotted and restored consistently, and a partial snapshot silently produces subtly wrong
+// G-code. Revisit when the generator state is consolidated into a snapshot friendly form.
 void GCodeGenerator::do_export(Print* print, const char* path, GCodeProcessorResult* result, ThumbnailsGeneratorCallback thumbnail_cb)
 {
+    Tracing::Span span("GCodeGenerator::do_export");
+
     CNumericLocalesSetter locales_setter;
 
     // Does the file exist? If so, we hope that it is still valid.
@@ -1238,6 +1260,11 @@ void GCodeGenerator::_do_export(Print& print, GCodeOutputStream &file, Thumbnail
     const Seams::Params params{Seams::Placer::get_params(print.full_print_config())};
     m_seam_placer.init(print.objects(), params, throw_if_canceled_func);
 
+    // Precompute the per-layer boundaries for travel planning in parallel,
+    // so that the serial G-code export below only reads them.
+    if (print.config().avoid_crossing_perimeters)
+        m_avoid_crossing_perimeters.init(print, throw_if_canceled_func);
+
     if (! (has_wipe_tower && print.config().single_extruder_multi_material_priming)) {
         // Set initial extruder only after custom start G-code.
         // Ugly hack: Do not set the initial extruder if the extruder is primed using the MMU priming towers at the edge of the print bed.
@@ -1496,25 +1523,32 @@ void GCodeGenerator::process_layers(
 {
     size_t layer_to_print_idx = 0;
     const GCode::SmoothPathCache::InterpolationParameters interpolation_params = interpolation_parameters(print.config());
-    const auto smooth_path_interpolator = tbb::make_filter<void, std::pair<size_t, GCode::SmoothPathCache>>(slic3r_tbb_filtermode::serial_in_order,
-        [this, &print, &layers_to_print, &layer_to_print_idx, &interpolation_params](tbb::flow_control &fc) -> std::pair<size_t, GCode::SmoothPathCache> {
+    // Pipeline source, producing the indices of the layers to print in the print order.
+    const auto layer_index_source = tbb::make_filter<void, size_t>(slic3r_tbb_filtermode::serial_in_order,
+        [this, &print, &layers_to_print, &layer_to_print_idx](tbb::flow_control &fc) -> size_t {
             if (layer_to_print_idx >= layers_to_print.size()) {
                 if (layer_to_print_idx == layers_to_print.size() + (m_pressure_equalizer ? 1 : 0)) {
                     fc.stop();
-                    return {};
+                    return 0;
                 } else {
                     // Pressure equalizer need insert empty input. Because it returns one layer back.
                     // Insert NOP (no operation) layer;
-                    return { layer_to_print_idx ++, {} };
+                    return layer_to_print_idx ++;
                 }
             } else {
                 print.throw_if_canceled();
-                size_t idx = layer_to_print_idx ++;
-                GCode::SmoothPathCache smooth_path_cache;
+                return layer_to_print_idx ++;
+            }
+        });
+    // Fitting of smooth paths (arches) to the layer extrusions is independent of the other layers,
+    // thus it is being run in parallel. The following serial_in_order filters restore the layer order.
+    const auto smooth_path_interpolator = tbb::make_filter<size_t, std::pair<size_t, GCode::SmoothPathCache>>(slic3r_tbb_filtermode::parallel,
+        [&layers_to_print, &interpolation_params](size_t idx) -> std::pair<size_t, GCode::SmoothPathCache> {
+            GCode::SmoothPathCache smooth_path_cache;
+            if (idx < layers_to_print.size())
                 for (const ObjectLayerToPrint &l : layers_to_print[idx].second)
                     GCodeGenerator::smooth_path_interpolate(l, interpolation_params, smooth_path_cache);
-                return { idx, std::move(smooth_path_cache) };
-            }
+            return { idx, std::move(smooth_path_cache) };
         });
     const auto generator = tbb::make_filter<std::pair<size_t, GCode::SmoothPathCache>, LayerResult>(slic3r_tbb_filtermode::serial_in_order,
         [this, &print, &tool_ordering, &print_object_instances_ordering, &layers_to_print, &smooth_path_cache_global](
@@ -1555,7 +1589,9 @@ void GCodeGenerator::process_layers(
 
              return cooling_buffer->process_layer(std::move(in.gcode), in.layer_id, in.cooling_buffer_flush);
         });
-    const auto find_replace = tbb::make_filter<std::string, std::string>(slic3r_tbb_filtermode::serial_in_order,
+    // G-code substitutions only read the immutable list of patterns, thus layers may be processed in parallel,
+    // the output filter restores the layer order.
+    const auto find_replace = tbb::make_filter<std::string, std::string>(slic3r_tbb_filtermode::parallel,
         [find_replace = this->m_find_replace.get()](std::string s) -> std::string {
             return find_replace->process_layer(std::move(s));
         });
@@ -1563,7 +1599,7 @@ void GCodeGenerator::process_layers(
         [&output_stream](std::string s) { output_stream.write(s); }
     );
 
-    tbb::filter<void, LayerResult> pipeline_to_layerresult = smooth_path_interpolator & generator;
+    tbb::filter<void, LayerResult> pipeline_to_layerresult = layer_index_source & smooth_path_interpolator & generator;
     if (m_spiral_vase)
         pipeline_to_layerresult = pipeline_to_layerresult & spiral_vase;
     if (m_pressure_equalizer)
@@ -1578,7 +1614,7 @@ void GCodeGenerator::process_layers(
     TBBLocalesSetter locales_setter;
     // The pipeline elements are joined using const references, thus no copying is performed.
     output_stream.find_replace_supress();
-    tbb::parallel_pipeline(12, pipeline_to_layerresult & pipeline_to_string & output);
+    tbb::parallel_pipeline(gcode_pipeline_tokens(), pipeline_to_layerresult & pipeline_to_string & output);
     output_stream.find_replace_enable();
 }
 
@@ -1595,25 +1631,32 @@ void GCodeGenerator::process_layers(
 {
     size_t layer_to_print_idx = 0;
     const GCode::SmoothPathCache::InterpolationParameters interpolation_params = interpolation_parameters(print.config());
-    const auto smooth_path_interpolator = tbb::make_filter<void, std::pair<size_t, GCode::SmoothPathCache>> (slic3r_tbb_filtermode::serial_in_order,
-        [this, &print, &layers_to_print, &layer_to_print_idx, interpolation_params](tbb::flow_control &fc) -> std::pair<size_t, GCode::SmoothPathCache> {
+    // Pipeline source, producing the indices of the layers to print in the print order.
+    const auto layer_index_source = tbb::make_filter<void, size_t>(slic3r_tbb_filtermode::serial_in_order,
+        [this, &print, &layers_to_print, &layer_to_print_idx](tbb::flow_control &fc) -> size_t {
             if (layer_to_print_idx >= layers_to_print.size()) {
                 if (layer_to_print_idx == layers_to_print.size() + (m_pressure_equalizer ? 1 : 0)) {
                     fc.stop();
-                    return {};
+                    return 0;
                 } else {
                     // Pressure equalizer need insert empty input. Because it returns one layer back.
                     // Insert NOP (no operation) layer;
-                    return { layer_to_print_idx ++, {} };
+                    return layer_to_print_idx ++;
                 }
             } else {
                 print.throw_if_canceled();
-                size_t idx = layer_to_print_idx ++;
-                GCode::SmoothPathCache smooth_path_cache;
-                GCodeGenerator::smooth_path_interpolate(layers_to_print[idx], interpolation_params, smooth_path_cache);
-                return { idx, std::move(smooth_path_cache) };
+                return layer_to_print_idx ++;
             }
         });
+    // Fitting of smooth paths (arches) to the layer extrusions is independent of the other layers,
+    // thus it is being run in parallel. The following serial_in_order filters restore the layer order.
+    const auto smooth_path_interpolator = tbb::make_filter<size_t, std::pair<size_t, GCode::SmoothPathCache>> (slic3r_tbb_filtermode::parallel,
+        [&layers_to_print, interpolation_params](size_t idx) -> std::pair<size_t, GCode::SmoothPathCache> {
+            GCode::SmoothPathCache smooth_path_cache;
+            if (idx < layers_to_print.size())
+                GCodeGenerator::smooth_path_interpolate(layers_to_print[idx], interpolation_params, smooth_path_cache);
+            return { idx, std::move(smooth_path_cache) };
+        });
     const auto generator = tbb::make_filter<std::pair<size_t, GCode::SmoothPathCache>, LayerResult>(slic3r_tbb_filtermode::serial_in_order,
         [this, &print, &tool_ordering, &layers_to_print, &smooth_path_cache_global, single_object_idx](std::pair<size_t, GCode::SmoothPathCache> in) -> LayerResult {
             size_t layer_to_print_idx = in.first;
@@ -1648,7 +1691,9 @@ void GCodeGenerator::process_layers(
                 return in.gcode;
             return cooling_buffer->process_layer(std::move(in.gcode), in.layer_id, in.cooling_buffer_flush);
         });
-    const auto find_replace = tbb::make_filter<std::string, std::string>(slic3r_tbb_filtermode::serial_in_order,
+    // G-code substitutions only read the immutable list of patterns, thus layers may be processed in parallel,
+    // the output filter restores the layer order.
+    const auto find_replace = tbb::make_filter<std::string, std::string>(slic3r_tbb_filtermode::parallel,
         [find_replace = this->m_find_replace.get()](std::string s) -> std::string {
             return find_replace->process_layer(std::move(s));
         });
@@ -1656,7 +1701,7 @@ void GCodeGenerator::process_layers(
         [&output_stream](std::string s) { output_stream.write(s); }
     );
 
-    tbb::filter<void, LayerResult> pipeline_to_layerresult = smooth_path_interpolator & generator;
+    tbb::filter<void, LayerResult> pipeline_to_layerresult = layer_index_source & smooth_path_interpolator & generator;
     if (m_spiral_vase)
         pipeline_to_layerresult = pipeline_to_layerresult & spiral_vase;
     if (m_pressure_equalizer)
@@ -1671,7 +1716,7 @@ void GCodeGenerator::process_layers(
     TBBLocalesSetter locales_setter;
     // The pipeline elements are joined using const references, thus no copying is performed.
     output_stream.find_replace_supress();
-    tbb::parallel_pipeline(12, pipeline_to_layerresult & pipeline_to_string & output);
+    tbb::parallel_pipeline(gcode_pipeline_tokens(), pipeline_to_layerresult & pipeline_to_string & output);
     output_stream.find_replace_enable();
 }
 
@@ -3021,7 +3066,7 @@ std::string GCodeGenerator::extrude_loop(const ExtrusionLoop &loop_src, const GC
         // Make a little move inwards before leaving loop.
         if (std::optional<Point> pt = wipe_hide_seam(smooth_path, reverse_loop, scale_(EXTRUDER_CONFIG(nozzle_diameter))); pt) {
             // Generate the seam hiding travel move.
-            gcode += m_writer.travel_to_xy(this->point_to_gcode(*pt), "move inwards before travel");
+            m_writer.travel_to_xy(gcode, this->point_to_gcode(*pt), "move inwards before travel");
             this->last_position = *pt;
         }
     }
@@ -3152,22 +3197,20 @@ std::string GCodeGenerator::extrude_support(const ExtrusionEntityReferences &sup
     return gcode;
 }
 
-bool GCodeGenerator::GCodeOutputStream::is_error() const 
+bool GCodeGenerator::GCodeOutputStream::is_error() const
 {
-    return ::ferror(this->f);
+    return m_sink->is_error();
 }
 
 void GCodeGenerator::GCodeOutputStream::flush()
-{ 
-    ::fflush(this->f);
+{
+    m_sink->flush();
 }
 
 void GCodeGenerator::GCodeOutputStream::close()
-{ 
-    if (this->f) {
-        ::fclose(this->f);
-        this->f = nullptr;
-    }
+{
+    if (m_sink)
+        m_sink->close();
 }
 
 void GCodeGenerator::GCodeOutputStream::write(const char *what)
@@ -3175,8 +3218,8 @@ void GCodeGenerator::GCodeOutputStream::write(const char *what)
     if (what != nullptr) {
         //FIXME don't allocate a string, maybe process a batch of lines?
         std::string gcode(m_find_replace ? m_find_replace->process_layer(what) : what);
-        // writes string to file
-        fwrite(gcode.c_str(), 1, gcode.size(), this->f);
+        // writes string to the output sink
+        m_sink->write(gcode.c_str(), gcode.size());
         m_processor.process_buffer(gcode);
     }
 }
@@ -3319,7 +3362,7 @@ std::string GCodeGenerator::_extrude(
             const std::string comment{"move to print after unknown position"};
             gcode += this->retract_and_wipe();
             gcode += m_writer.multiple_extruders ? "" : m_label_objects.maybe_change_instance(m_writer);
-            gcode += this->m_writer.travel_to_xy(this->point_to_gcode(path.front().point), comment);
+            this->m_writer.travel_to_xy(gcode, this->point_to_gcode(path.front().point), comment);
             gcode += this->m_writer.get_travel_to_z_gcode(z, comment);
         } else if ( this->last_position != path.front().point) {
             std::string comment = "move to first ";
@@ -3489,7 +3532,7 @@ std::string GCodeGenerator::_extrude(
     }
 
     // F is mm per minute.
-    gcode += m_writer.set_speed(F, "", cooling_marker_setspeed_comments);
+    m_writer.set_speed(gcode, F, "", cooling_marker_setspeed_comments);
     if (dynamic_speed_and_fan_speed.second >= 0)
         gcode += ";_SET_FAN_SPEED" + std::to_string(int(dynamic_speed_and_fan_speed.second)) + "\n";
 
@@ -3527,14 +3570,14 @@ std::string GCodeGenerator::_extrude(
             if (radius == 0) {
                 // Extrude line segment.
                 if (const double line_length = (p - prev).norm(); line_length > 0)
-                    gcode += m_writer.extrude_to_xy(p, e_per_mm * line_length, comment);
+                    m_writer.extrude_to_xy(gcode, p, e_per_mm * line_length, comment);
             } else {
                 double angle = Geometry::ArcWelder::arc_angle(prev.cast<double>(), p.cast<double>(), double(radius));
                 assert(angle > 0);
                 const double line_length = angle * std::abs(radius);
                 const double dE          = e_per_mm * line_length;
                 assert(dE > 0);
-                gcode += m_writer.extrude_to_xy_G2G3IJ(p, ij, it->ccw(), dE, comment);
+                m_writer.extrude_to_xy_G2G3IJ(gcode, p, ij, it->ccw(), dE, comment);
             }
             prev = p;
             prev_exact = p_exact;
@@ -3748,7 +3791,7 @@ std::string GCodeGenerator::retract_and_wipe(bool toolchange, bool reset_e)
 
     // wipe (if it's enabled for this extruder and we have a stored wipe path)
     if (EXTRUDER_CONFIG(wipe) && m_wipe.has_path()) {
-        gcode += toolchange ? m_writer.retract_for_toolchange(true) : m_writer.retract(true);
+        toolchange ? m_writer.retract_for_toolchange(gcode, true) : m_writer.retract(gcode, true);
         gcode += m_wipe.wipe(*this, toolchange);
     }
 
@@ -3756,7 +3799,7 @@ std::string GCodeGenerator::retract_and_wipe(bool toolchange, bool reset_e)
         (the extruder might be already retracted fully or partially). We call these
         methods even if we performed wipe, since this will ensure the entire retraction
         length is honored in case wipe path was too short.  */
-    gcode += toolchange ? m_writer.retract_for_toolchange() : m_writer.retract();
+    toolchange ? m_writer.retract_for_toolchange(gcode) : m_writer.retract(gcode);
 
     if (reset_e) {
         gcode += m_writer.reset_e();
@@ -27,6 +27,7 @@
 #include "GCode/AvoidCrossingPerimeters.hpp"
 #include "GCode/CoolingBuffer.hpp"
 #include "GCode/FindReplace.hpp"
+#include "GCode/GCodeOutputSink.hpp"
 #include "GCode/GCodeWriter.hpp"
 #include "GCode/LabelObjects.hpp"
 #include "GCode/PressureEqualizer.hpp"
@@ -185,7 +186,12 @@ public:
 private:
     class GCodeOutputStream {
     public:
-        GCodeOutputStream(FILE *f, GCodeProcessor &processor) : f(f), m_processor(processor) {}
+        // Writes into a file, taking ownership of the FILE handle.
+        GCodeOutputStream(FILE *f, GCodeProcessor &processor) :
+            m_sink(std::make_unique<FileGCodeOutputSink>(f)), m_processor(processor) {}
+        // Writes into a generic sink (in-memory buffer, upload stream ...).
+        GCodeOutputStream(std::unique_ptr<GCodeOutputSink> sink, GCodeProcessor &processor) :
+            m_sink(std::move(sink)), m_processor(processor) {}
         ~GCodeOutputStream() { this->close(); }
 
         // Set a find-replace post-processor to modify the G-code before GCodePostProcessor.
@@ -195,7 +201,7 @@ private:
         void find_replace_enable() { m_find_replace = m_find_replace_backup; }
         void find_replace_supress() { m_find_replace = nullptr; }
 
-        bool is_open() const { return f; }
+        bool is_open() const { return m_sink && m_sink->is_open(); }
         bool is_error() const;
         
         void flush();
@@ -214,7 +220,7 @@ private:
         void write_format(const char* format, ...);
 
     private:
-        FILE             *f { nullptr };
+        std::unique_ptr<GCodeOutputSink> m_sink;
         // Find-replace post-processor to be called before GCodePostProcessor.
         GCodeFindReplace *m_find_replace { nullptr };
         // If suppressed, the backoup holds m_find_replace.
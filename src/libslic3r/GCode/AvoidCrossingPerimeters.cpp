@@ -17,6 +17,8 @@
 #include <unordered_set>
 #include <boost/range/adaptor/reversed.hpp>
 
+#include <tbb/parallel_for.h>
+
 //#define AVOID_CROSSING_PERIMETERS_DEBUG_OUTPUT
 
 namespace Slic3r {
@@ -1186,15 +1188,17 @@ Polyline AvoidCrossingPerimeters::travel_to(const GCodeGenerator &gcodegen, cons
     Vec2d startf = start.cast<double>();
     Vec2d endf   = end  .cast<double>();
 
-    bool is_support_layer = dynamic_cast<const SupportLayer *>(gcodegen.layer()) != nullptr;
-    if (!use_external && (is_support_layer || (!m_lslices_offset.empty() && !any_expolygon_contains(m_lslices_offset, m_lslices_offset_bboxes, m_grid_lslices_offset, travel)))) {
-        // Initialize m_internal only when it is necessary.
-        if (m_internal.boundaries.empty())
-            init_boundary(&m_internal, to_polygons(get_boundary(*gcodegen.layer())));
+    assert(m_layer_data != nullptr);
+    LayerData &layer_data       = *m_layer_data;
+    bool       is_support_layer = dynamic_cast<const SupportLayer *>(gcodegen.layer()) != nullptr;
+    if (!use_external && (is_support_layer || (!layer_data.lslices_offset.empty() && !any_expolygon_contains(layer_data.lslices_offset, layer_data.lslices_offset_bboxes, layer_data.grid_lslices_offset, travel)))) {
+        // Initialize the internal boundary only when it was not precomputed by init().
+        if (layer_data.internal.boundaries.empty())
+            init_boundary(&layer_data.internal, to_polygons(get_boundary(*gcodegen.layer())));
 
         // Trim the travel line by the bounding box.
-        if (!m_internal.boundaries.empty() && Geometry::liang_barsky_line_clipping(startf, endf, m_internal.bbox)) {
-            travel_intersection_count = avoid_perimeters(m_internal, startf.cast<coord_t>(), endf.cast<coord_t>(), *gcodegen.layer(), result_pl);
+        if (!layer_data.internal.boundaries.empty() && Geometry::liang_barsky_line_clipping(startf, endf, layer_data.internal.bbox)) {
+            travel_intersection_count = avoid_perimeters(layer_data.internal, startf.cast<coord_t>(), endf.cast<coord_t>(), *gcodegen.layer(), result_pl);
             result_pl.points.front()  = start;
             result_pl.points.back()   = end;
         }
@@ -1237,32 +1241,74 @@ Polyline AvoidCrossingPerimeters::travel_to(const GCodeGenerator &gcodegen, cons
     } else if (max_detour_length_exceeded) {
         *could_be_wipe_disabled = false;
     } else
-        *could_be_wipe_disabled = !need_wipe(gcodegen, m_lslices_offset, m_lslices_offset_bboxes, m_grid_lslices_offset, travel, result_pl, travel_intersection_count);
+        *could_be_wipe_disabled = !need_wipe(gcodegen, layer_data.lslices_offset, layer_data.lslices_offset_bboxes, layer_data.grid_lslices_offset, travel, result_pl, travel_intersection_count);
 
     return result_pl;
 }
 
 // ************************************* AvoidCrossingPerimeters::init_layer() *****************************************
 
-void AvoidCrossingPerimeters::init_layer(const Layer &layer)
+std::unique_ptr<AvoidCrossingPerimeters::LayerData> AvoidCrossingPerimeters::make_layer_data(const Layer &layer, const bool with_internal_boundary)
 {
-    m_internal.clear();
-    m_external.clear();
-    m_lslices_offset.clear();
-    m_lslices_offset_bboxes.clear();
+    auto layer_data = std::make_unique<LayerData>();
 
-    float perimeter_offset = -get_external_perimeter_width(layer) / float(2.);
-    m_lslices_offset        = offset_ex(layer.lslices, perimeter_offset);
+    float perimeter_offset     = -get_external_perimeter_width(layer) / float(2.);
+    layer_data->lslices_offset = offset_ex(layer.lslices, perimeter_offset);
 
-    m_lslices_offset_bboxes.reserve(m_lslices_offset.size());
-    for (const ExPolygon &ex_poly : m_lslices_offset)
-        m_lslices_offset_bboxes.emplace_back(get_extents(ex_poly));
+    layer_data->lslices_offset_bboxes.reserve(layer_data->lslices_offset.size());
+    for (const ExPolygon &ex_poly : layer_data->lslices_offset)
+        layer_data->lslices_offset_bboxes.emplace_back(get_extents(ex_poly));
 
     BoundingBox bbox_slice(get_extents(layer.lslices));
     bbox_slice.offset(SCALED_EPSILON);
 
-    m_grid_lslices_offset.set_bbox(bbox_slice);
-    m_grid_lslices_offset.create(m_lslices_offset, coord_t(scale_(1.)));
+    layer_data->grid_lslices_offset.set_bbox(bbox_slice);
+    layer_data->grid_lslices_offset.create(layer_data->lslices_offset, coord_t(scale_(1.)));
+
+    if (with_internal_boundary)
+        init_boundary(&layer_data->internal, to_polygons(get_boundary(layer)));
+
+    return layer_data;
+}
+
+void AvoidCrossingPerimeters::init(const Print &print, const std::function<void()> &throw_if_canceled)
+{
+    // Collect the layers the G-code export will process, including the support layers.
+    std::vector<const Layer *> layers;
+    for (const PrintObject *object : print.objects()) {
+        layers.reserve(layers.size() + object->layers().size() + object->support_layers().size());
+        for (const Layer *layer : object->layers())
+            layers.emplace_back(layer);
+        for (const SupportLayer *support_layer : object->support_layers())
+            layers.emplace_back(support_layer);
+    }
+
+    // The layers are independent of each other, thus their boundaries are computed in parallel,
+    // including the internal boundaries, which would otherwise be computed lazily by travel_to()
+    // inside the serial part of the G-code export.
+    std::vector<std::unique_ptr<LayerData>> layers_data(layers.size());
+    tbb::parallel_for(size_t(0), layers.size(), [&layers, &layers_data, &throw_if_canceled](size_t layer_idx) {
+        throw_if_canceled();
+        layers_data[layer_idx] = make_layer_data(*layers[layer_idx], true);
+    });
+
+    m_layer_data_cache.clear();
+    m_layer_data_cache.reserve(layers.size());
+    for (size_t layer_idx = 0; layer_idx < layers.size(); ++layer_idx)
+        m_layer_data_cache.emplace(layers[layer_idx], std::move(layers_data[layer_idx]));
+    m_layer_data = nullptr;
+}
+
+void AvoidCrossingPerimeters::init_layer(const Layer &layer)
+{
+    m_external.clear();
+
+    std::unique_ptr<LayerData> &layer_data = m_layer_data_cache[&layer];
+    if (! layer_data)
+        // The layer was not precomputed by init(). Compute it now, without the internal boundary,
+        // which will be computed by travel_to() only when some travel needs it.
+        layer_data = make_layer_data(layer, false);
+    m_layer_data = layer_data.get();
 }
 
 #if 0
@@ -9,12 +9,17 @@
 #include "../ExPolygon.hpp"
 #include "../EdgeGrid.hpp"
 
+#include <functional>
+#include <memory>
+#include <unordered_map>
+
 namespace Slic3r {
 
 // Forward declarations.
 class GCodeGenerator;
 class Layer;
 class Point;
+class Print;
 
 class AvoidCrossingPerimeters
 {
@@ -26,6 +31,9 @@ public:
     bool        disabled_once() const   { return m_disabled_once; }
     void        reset_once_modifiers()  { use_external_mp_once = false; m_disabled_once = false; }
 
+    // Precompute the boundaries of all layers in parallel ahead of the G-code export,
+    // so that travel_to() only reads the shared per-layer data inside the export hot loop.
+    void        init(const Print &print, const std::function<void()> &throw_if_canceled);
     void        init_layer(const Layer &layer);
 
     Polyline    travel_to(const GCodeGenerator &gcodegen, const Point& point)
@@ -53,21 +61,36 @@ public:
         }
     };
 
+    // Boundaries of a single layer, either precomputed in parallel by init() or computed
+    // on demand by init_layer(). Owned by m_layer_data_cache, only read by travel_to().
+    struct LayerData {
+        // Store all needed data for travels inside object
+        Boundary                 internal;
+        // Lslices offseted by half an external perimeter width. Used for detection if line or polyline is inside of any polygon.
+        ExPolygons               lslices_offset;
+        std::vector<BoundingBox> lslices_offset_bboxes;
+        // Used for detection of line or polyline is inside of any polygon.
+        EdgeGrid::Grid           grid_lslices_offset;
+    };
+
     // just for the next travel move
     bool           use_external_mp_once { false };
 private:
+    // Compute the LayerData of a single layer, with_internal_boundary enables the eager
+    // computation of the internal boundary, otherwise it is left to travel_to().
+    static std::unique_ptr<LayerData> make_layer_data(const Layer &layer, bool with_internal_boundary);
+
     bool           m_use_external_mp { false };
     // this flag disables avoid_crossing_perimeters just for the next travel move
     // we enable it by default for the first travel move in print
     bool           m_disabled_once { true };
 
-    // Lslices offseted by half an external perimeter width. Used for detection if line or polyline is inside of any polygon.
-    ExPolygons               m_lslices_offset;
-    std::vector<BoundingBox> m_lslices_offset_bboxes;
-    // Used for detection of line or polyline is inside of any polygon.
-    EdgeGrid::Grid           m_grid_lslices_offset;
-    // Store all needed data for travels inside object
-    Boundary m_internal;
+    // Per-layer data of all layers, filled by init() resp. init_layer(). The EdgeGrids reference
+    // the polygons stored in the same LayerData, thus the LayerData is allocated on the heap
+    // and never moves.
+    std::unordered_map<const Layer*, std::unique_ptr<LayerData>> m_layer_data_cache;
+    // Data of the layer currently being exported, points into m_layer_data_cache.
+    LayerData *m_layer_data { nullptr };
     // Store all needed data for travels outside object
     Boundary m_external;
 };
@@ -12,6 +12,8 @@
 #include <functional>
 #include <atomic>
 
+#include <ankerl/unordered_dense.h>
+
 namespace Slic3r {
 
 namespace RasterizationImpl {
@@ -275,7 +277,15 @@ std::pair<std::vector<ExtrusionPaths>, std::vector<ExtrusionPaths>> getAllLayers
 ConflictComputeOpt ConflictChecker::find_inter_of_lines(const LineWithIDs &lines)
 {
     using namespace RasterizationImpl;
-    std::map<IndexPair, std::vector<int>> indexToLine;
+    // Candidates per grid cell keep their insertion order, only the cell lookup
+    // changes from a tree walk to a hash, so the first reported intersection
+    // stays the same.
+    struct IndexPairHash {
+        size_t operator()(const IndexPair &ip) const noexcept {
+            return size_t((89 * 31 + ip.first) * 31 + ip.second);
+        }
+    };
+    ankerl::unordered_dense::map<IndexPair, std::vector<int>, IndexPairHash> indexToLine;
 
     for (int i = 0; i < (int)lines.size(); ++i) {
         const LineWithID &l1      = lines[i];
@@ -308,15 +318,23 @@ ConflictResultOpt ConflictChecker::find_inter_of_lines_in_diff_objs(SpanOfConstP
         std::vector<ExtrusionPaths> wtpaths = getFakeExtrusionPathsFromWipeTower(wipe_tower_data);
         conflictQueue.emplace_back_bucket(std::move(wtpaths), &wtptr, Points{Point(plate_origin)});
     }
-    for (const PrintObject *obj : objs) {
-        std::pair<std::vector<ExtrusionPaths>, std::vector<ExtrusionPaths>> layers = getAllLayersExtrusionPathsFromObject(obj);
+    // Collecting the extrusion paths walks every entity of every layer, which is
+    // independent per object, so the objects are processed in parallel and their
+    // buckets are queued in the original object order afterwards.
+    std::vector<std::pair<std::vector<ExtrusionPaths>, std::vector<ExtrusionPaths>>> objs_layers(objs.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, objs.size()), [&objs, &objs_layers](tbb::blocked_range<size_t> range) {
+        for (size_t i = range.begin(); i < range.end(); ++i)
+            objs_layers[i] = getAllLayersExtrusionPathsFromObject(objs[i]);
+    });
+    for (size_t i = 0; i < objs.size(); ++i) {
+        const PrintObject *obj = objs[i];
 
         Points instances_shifts;
         for (const PrintInstance& inst : obj->instances())
             instances_shifts.emplace_back(inst.shift);
 
-        conflictQueue.emplace_back_bucket(std::move(layers.first), obj, instances_shifts);
-        conflictQueue.emplace_back_bucket(std::move(layers.second), obj, instances_shifts);
+        conflictQueue.emplace_back_bucket(std::move(objs_layers[i].first), obj, instances_shifts);
+        conflictQueue.emplace_back_bucket(std::move(objs_layers[i].second), obj, instances_shifts);
     }
     conflictQueue.build_queue();
 
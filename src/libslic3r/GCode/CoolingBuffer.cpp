@@ -11,8 +11,8 @@
 #include "../GCode.hpp"
 #include "CoolingBuffer.hpp"
 #include <algorithm>
+#include <array>
 #include <boost/algorithm/string/predicate.hpp>
-#include <boost/algorithm/string/replace.hpp>
 #include <boost/log/trivial.hpp>
 #include <iostream>
 #include <float.h>
@@ -373,6 +373,11 @@ std::vector<PerExtruderAdjustments> CoolingBuffer::parse_layer_gcode(const std::
             ++ line_end;
         // sline will not contain the trailing '\n'.
         std::string_view sline(line_start, line_end - line_start);
+        // The markers emitted by the G-code generator (";_EXTRUDE_SET_SPEED" and the like) are only
+        // ever found in the comment, thus locate the comment once and limit the marker searches
+        // to it instead of scanning the whole line repeatedly.
+        size_t comment_begin = sline.find(';');
+        std::string_view comment = comment_begin == std::string_view::npos ? std::string_view() : sline.substr(comment_begin);
         // CoolingLine will contain the trailing '\n'.
         if (*line_end == '\n')
             ++ line_end;
@@ -428,13 +433,13 @@ std::vector<PerExtruderAdjustments> CoolingBuffer::parse_layer_gcode(const std::
                 (line.type & (CoolingLine::TYPE_G2G3_IJ | CoolingLine::TYPE_G2G3_R)));
             // Arc is defined either by IJ or by R, not by both.
             assert(! ((line.type & CoolingLine::TYPE_G2G3_IJ) && (line.type & CoolingLine::TYPE_G2G3_R)));
-            bool external_perimeter = boost::contains(sline, ";_EXTERNAL_PERIMETER");
-            bool wipe               = boost::contains(sline, ";_WIPE");
+            bool external_perimeter = boost::contains(comment, ";_EXTERNAL_PERIMETER");
+            bool wipe               = boost::contains(comment, ";_WIPE");
             if (external_perimeter)
                 line.type |= CoolingLine::TYPE_EXTERNAL_PERIMETER;
             if (wipe)
                 line.type |= CoolingLine::TYPE_WIPE;
-            if (boost::contains(sline, ";_EXTRUDE_SET_SPEED") && ! wipe) {
+            if (boost::contains(comment, ";_EXTRUDE_SET_SPEED") && ! wipe) {
                 line.type |= CoolingLine::TYPE_ADJUSTABLE;
                 active_speed_modifier = adjustment->lines.size();
             }
@@ -562,15 +567,15 @@ std::vector<PerExtruderAdjustments> CoolingBuffer::parse_layer_gcode(const std::
             line.time_max = line.time;
         }
 
-        if (boost::contains(sline, ";_SET_FAN_SPEED")) {
-            auto speed_start = sline.find_last_of('D');
+        if (boost::contains(comment, ";_SET_FAN_SPEED")) {
+            auto speed_start = comment.find_last_of('D');
             int  speed       = 0;
-            for (char num : sline.substr(speed_start + 1)) {
+            for (char num : comment.substr(speed_start + 1)) {
                 speed = speed * 10 + (num - '0');
             }
             line.type |= CoolingLine::TYPE_SET_FAN_SPEED;
             line.fan_speed = speed;
-        } else if (boost::contains(sline, ";_RESET_FAN_SPEED")) {
+        } else if (boost::contains(comment, ";_RESET_FAN_SPEED")) {
             line.type |= CoolingLine::TYPE_RESET_FAN_SPEED;
         }
 
@@ -957,14 +962,32 @@ std::string CoolingBuffer::apply_layer_cooldown(
             // Process the rest of the line.
             if (end < line_end) {
                 if (line->type & (CoolingLine::TYPE_ADJUSTABLE | CoolingLine::TYPE_ADJUSTABLE_EMPTY | CoolingLine::TYPE_EXTERNAL_PERIMETER | CoolingLine::TYPE_WIPE)) {
-                    // Process comments, remove ";_EXTRUDE_SET_SPEED", ";_EXTERNAL_PERIMETER", ";_WIPE"
-                    std::string comment(end, line_end);
-                    boost::replace_all(comment, ";_EXTRUDE_SET_SPEED", "");
+                    // Process comments, remove ";_EXTRUDE_SET_SPEED", ";_EXTERNAL_PERIMETER", ";_WIPE".
+                    // Copied into new_gcode in a single pass, skipping the markers, without a temporary string.
+                    std::array<std::string_view, 3> markers;
+                    size_t num_markers = 0;
+                    markers[num_markers ++] = ";_EXTRUDE_SET_SPEED";
                     if (line->type & CoolingLine::TYPE_EXTERNAL_PERIMETER)
-                        boost::replace_all(comment, ";_EXTERNAL_PERIMETER", "");
+                        markers[num_markers ++] = ";_EXTERNAL_PERIMETER";
                     if (line->type & CoolingLine::TYPE_WIPE)
-                        boost::replace_all(comment, ";_WIPE", "");
-                    new_gcode += comment;
+                        markers[num_markers ++] = ";_WIPE";
+                    const char *segment_begin = end;
+                    for (const char *c = end; c != line_end;) {
+                        std::string_view marker_matched;
+                        if (*c == ';')
+                            for (size_t i = 0; i < num_markers; ++ i)
+                                if (std::string_view rest(c, line_end - c); rest.substr(0, markers[i].size()) == markers[i]) {
+                                    marker_matched = markers[i];
+                                    break;
+                                }
+                        if (! marker_matched.empty()) {
+                            new_gcode.append(segment_begin, c - segment_begin);
+                            c += marker_matched.size();
+                            segment_begin = c;
+                        } else
+                            ++ c;
+                    }
+                    new_gcode.append(segment_begin, line_end - segment_begin);
                 } else {
                     // Just attach the rest of the source line.
                     new_gcode.append(end, line_end - end);
@@ -0,0 +1,32 @@
+///|/ Copyright (c) Prusa Research 2023 Vojtěch Bubník @bubnikv
+///|/
+///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
+///|/
+#include "GCodeOutputSink.hpp"
+
+namespace Slic3r {
+
+bool FileGCodeOutputSink::is_error() const
+{
+    return m_file != nullptr && ::ferror(m_file);
+}
+
+void FileGCodeOutputSink::write(const char *data, size_t size)
+{
+    ::fwrite(data, 1, size, m_file);
+}
+
+void FileGCodeOutputSink::flush()
+{
+    ::fflush(m_file);
+}
+
+void FileGCodeOutputSink::close()
+{
+    if (m_file) {
+        ::fclose(m_file);
+        m_file = nullptr;
+    }
+}
+
+} // namespace Slic3r
@@ -0,0 +1,73 @@
+///|/ Copyright (c) Prusa Research 2023 Vojtěch Bubník @bubnikv
+///|/
+///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
+///|/
+#ifndef slic3r_GCodeOutputSink_hpp_
+#define slic3r_GCodeOutputSink_hpp_
+
+#include <cstdio>
+#include <string>
+
+namespace Slic3r {
+
+// Abstract destination of the exported G-code byte stream.
+// GCodeGenerator::GCodeOutputStream writes through this interface, thus the export
+// may target a plain file, an in-memory buffer for preview, or in the future
+// a compressing / uploading stream without materializing an intermediate file first.
+class GCodeOutputSink
+{
+public:
+    virtual ~GCodeOutputSink() = default;
+
+    // Is the sink ready to accept data?
+    virtual bool is_open() const = 0;
+    // Did any of the preceding writes fail?
+    virtual bool is_error() const = 0;
+
+    virtual void write(const char *data, size_t size) = 0;
+    virtual void flush() = 0;
+    virtual void close() = 0;
+};
+
+// Writes the G-code into a FILE, taking ownership of the handle.
+class FileGCodeOutputSink : public GCodeOutputSink
+{
+public:
+    // Takes ownership of f, which may be nullptr when opening the file failed.
+    explicit FileGCodeOutputSink(FILE *f) : m_file(f) {}
+    ~FileGCodeOutputSink() override { this->close(); }
+
+    bool is_open() const override { return m_file != nullptr; }
+    bool is_error() const override;
+
+    void write(const char *data, size_t size) override;
+    void flush() override;
+    void close() override;
+
+private:
+    FILE *m_file { nullptr };
+};
+
+// Collects the G-code into a memory buffer, for preview or tests
+// without touching the file system.
+class StringGCodeOutputSink : public GCodeOutputSink
+{
+public:
+    bool is_open() const override { return ! m_closed; }
+    bool is_error() const override { return false; }
+
+    void write(const char *data, size_t size) override { m_data.append(data, size); }
+    void flush() override {}
+    void close() override { m_closed = true; }
+
+    const std::string& data() const { return m_data; }
+    std::string&&      extract_data() { return std::move(m_data); }
+
+private:
+    std::string m_data;
+    bool        m_closed { false };
+};
+
+} // namespace Slic3r
+
+#endif // slic3r_GCodeOutputSink_hpp_
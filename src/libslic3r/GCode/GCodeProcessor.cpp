@@ -6,6 +6,7 @@
 #include "libslic3r/Utils.hpp"
 #include "libslic3r/Print.hpp"
 #include "libslic3r/LocalesUtils.hpp"
+#include "libslic3r/Thread.hpp"
 #include "libslic3r/format.hpp"
 #include "libslic3r/I18N.hpp"
 #include "libslic3r/GCode/GCodeWriter.hpp"
@@ -30,6 +31,24 @@
 #endif
 
 #include <chrono>
+#include <memory>
+
+// Intel redesigned some TBB interface considerably when merging TBB with their oneAPI set of libraries, see GH #7332.
+// We are using quite an old TBB 2017 U7. Before we update our build servers, let's use the old API, which is deprecated in up to date TBB.
+#if ! defined(TBB_VERSION_MAJOR)
+    #include <tbb/version.h>
+#endif
+#if ! defined(TBB_VERSION_MAJOR)
+    static_assert(false, "TBB_VERSION_MAJOR not defined");
+#endif
+#if TBB_VERSION_MAJOR >= 2021
+    #include <tbb/parallel_pipeline.h>
+    using slic3r_tbb_filtermode = tbb::filter_mode;
+#else
+    #include <tbb/pipeline.h>
+    using slic3r_tbb_filtermode = tbb::filter;
+#endif
+#include <tbb/parallel_for.h>
 
 static const float DEFAULT_TOOLPATH_WIDTH = 0.4f;
 static const float DEFAULT_TOOLPATH_HEIGHT = 0.2f;
@@ -203,6 +222,7 @@ void GCodeProcessor::TimeMachine::reset()
     blocks = std::vector<TimeBlock>();
     g1_times_cache = std::vector<G1LinesCacheItem>();
     first_layer_time = 0.0f;
+    layers_time = std::vector<float>();
 }
 
 static void planner_forward_pass_kernel(const GCodeProcessor::TimeBlock& prev, GCodeProcessor::TimeBlock& curr)
@@ -315,14 +335,19 @@ void GCodeProcessor::TimeMachine::calculate_time(GCodeProcessorResult& result, P
             block_time += additional_time;
 
         time += block_time;
-        result.moves[block.move_id].time[static_cast<size_t>(mode)] = block_time;
+        result.moves.set_time(block.move_id, static_cast<size_t>(mode), block_time);
         gcode_time.cache += block_time;
         if (block.layer_id == 1)
             first_layer_time += block_time;
+        if (block.layer_id > 0) {
+            if (layers_time.size() < block.layer_id)
+                layers_time.resize(block.layer_id, 0.0f);
+            layers_time[block.layer_id - 1] += block_time;
+        }
 
         // detect actual speed moves required to render toolpaths using actual speed
         if (mode == PrintEstimatedStatistics::ETimeMode::Normal) {
-            GCodeProcessorResult::MoveVertex& curr_move = result.moves[block.move_id];
+            const GCodeProcessorResult::MoveVertex curr_move = result.moves[block.move_id];
             if (curr_move.type != EMoveType::Extrude &&
                 curr_move.type != EMoveType::Travel &&
                 curr_move.type != EMoveType::Wipe)
@@ -330,13 +355,13 @@ void GCodeProcessor::TimeMachine::calculate_time(GCodeProcessorResult& result, P
 
             assert(curr_move.actual_feedrate == 0.0f);
 
-            GCodeProcessorResult::MoveVertex& prev_move = result.moves[block.move_id - 1];
+            const GCodeProcessorResult::MoveVertex prev_move = result.moves[block.move_id - 1];
             const bool interpolate = (prev_move.type == curr_move.type);
             if (!interpolate &&
                 prev_move.type != EMoveType::Extrude &&
                 prev_move.type != EMoveType::Travel &&
                 prev_move.type != EMoveType::Wipe)
-                prev_move.actual_feedrate = block.feedrate_profile.entry;
+                result.moves.set_actual_feedrate(block.move_id - 1, block.feedrate_profile.entry);
 
             if (EPSILON < block.trapezoid.accelerate_until && block.trapezoid.accelerate_until < block.distance - EPSILON) {
                 const float t = block.trapezoid.accelerate_until / block.distance;
@@ -446,10 +471,12 @@ void GCodeProcessor::UsedFilaments::reset()
     role_cache = 0.0;
     filaments_per_role.clear();
 
+    volumes_per_layer.clear();
+
     extruder_retracted_volume.clear();
 }
 
-void GCodeProcessor::UsedFilaments::increase_caches(double extruded_volume, unsigned char extruder_id, double parking_volume, double extra_loading_volume)
+void GCodeProcessor::UsedFilaments::increase_caches(double extruded_volume, unsigned char extruder_id, unsigned int layer_id, double parking_volume, double extra_loading_volume)
 {
     if (extruder_id >= extruder_retracted_volume.size())
         extruder_retracted_volume.resize(extruder_id + 1, parking_volume);
@@ -468,6 +495,12 @@ void GCodeProcessor::UsedFilaments::increase_caches(double extruded_volume, unsi
         color_change_cache += extruded_volume;
         tool_change_cache += extruded_volume;
         role_cache += extruded_volume;
+
+        if (layer_id > 0) {
+            if (volumes_per_layer.size() < layer_id)
+                volumes_per_layer.resize(layer_id, 0.0);
+            volumes_per_layer[layer_id - 1] += extruded_volume;
+        }
     }
 }
 
@@ -515,6 +548,85 @@ void GCodeProcessor::UsedFilaments::process_caches(const GCodeProcessor* process
     process_role_cache(processor);
 }
 
+void GCodeProcessorResult::Moves::clear()
+{
+    this->for_each_column([](auto &column) { column.clear(); });
+}
+
+void GCodeProcessorResult::Moves::reserve(size_t cap)
+{
+    this->for_each_column([cap](auto &column) { column.reserve(cap); });
+}
+
+void GCodeProcessorResult::Moves::resize(size_t new_size)
+{
+    this->for_each_column([new_size](auto &column) { column.resize(new_size); });
+}
+
+void GCodeProcessorResult::Moves::push_back(const MoveVertex &move)
+{
+    m_gcode_ids.emplace_back(move.gcode_id);
+    m_attributes.push_back({ move.type, move.extrusion_role, move.extruder_id, move.cp_color_id, move.internal_only });
+    m_positions.emplace_back(move.position);
+    m_deltas_extruder.emplace_back(move.delta_extruder);
+    m_feedrates.emplace_back(move.feedrate);
+    m_actual_feedrates.emplace_back(move.actual_feedrate);
+    m_widths.emplace_back(move.width);
+    m_heights.emplace_back(move.height);
+    m_mm3_per_mms.emplace_back(move.mm3_per_mm);
+    m_fan_speeds.emplace_back(move.fan_speed);
+    m_temperatures.emplace_back(move.temperature);
+    m_times.emplace_back(move.time);
+    m_layer_ids.emplace_back(move.layer_id);
+}
+
+void GCodeProcessorResult::Moves::erase(size_t i)
+{
+    this->for_each_column([i](auto &column) { column.erase(column.begin() + i); });
+}
+
+GCodeProcessorResult::MoveVertex GCodeProcessorResult::Moves::operator[](size_t i) const
+{
+    assert(i < this->size());
+    MoveVertex move;
+    move.gcode_id        = m_gcode_ids[i];
+    move.type            = m_attributes[i].type;
+    move.extrusion_role  = m_attributes[i].extrusion_role;
+    move.extruder_id     = m_attributes[i].extruder_id;
+    move.cp_color_id     = m_attributes[i].cp_color_id;
+    move.position        = m_positions[i];
+    move.delta_extruder  = m_deltas_extruder[i];
+    move.feedrate        = m_feedrates[i];
+    move.actual_feedrate = m_actual_feedrates[i];
+    move.width           = m_widths[i];
+    move.height          = m_heights[i];
+    move.mm3_per_mm      = m_mm3_per_mms[i];
+    move.fan_speed       = m_fan_speeds[i];
+    move.temperature     = m_temperatures[i];
+    move.time            = m_times[i];
+    move.layer_id        = m_layer_ids[i];
+    move.internal_only   = m_attributes[i].internal_only;
+    return move;
+}
+
+void GCodeProcessorResult::Moves::set(size_t i, const MoveVertex &move)
+{
+    assert(i < this->size());
+    m_gcode_ids[i]        = move.gcode_id;
+    m_attributes[i]       = { move.type, move.extrusion_role, move.extruder_id, move.cp_color_id, move.internal_only };
+    m_positions[i]        = move.position;
+    m_deltas_extruder[i]  = move.delta_extruder;
+    m_feedrates[i]        = move.feedrate;
+    m_actual_feedrates[i] = move.actual_feedrate;
+    m_widths[i]           = move.width;
+    m_heights[i]          = move.height;
+    m_mm3_per_mms[i]      = move.mm3_per_mm;
+    m_fan_speeds[i]       = move.fan_speed;
+    m_temperatures[i]     = move.temperature;
+    m_times[i]            = move.time;
+    m_layer_ids[i]        = move.layer_id;
+}
+
 void GCodeProcessorResult::reset() {
     is_binary_file = false;
     moves.clear();
@@ -1152,17 +1264,94 @@ void GCodeProcessor::process_ascii_file(const std::string& filename, GCodeReader
     m_result.is_binary_file = false;
     m_result.id = ++s_result_id;
     initialize_result_moves();
+    m_result.lines_ends.clear();
+    m_result.lines_ends.push_back(std::vector<size_t>());
+
+    FilePtr in{ boost::nowide::fopen(filename.c_str(), "rb") };
+    if (in.f == nullptr)
+        throw Slic3r::RuntimeError(format("Error opening file %1%", filename));
+    fseek(in.f, 0, SEEK_END);
+    const long file_size = ftell(in.f);
+    rewind(in.f);
+
+    // Process the G-code in two phases running as a parallel pipeline: chunks of the file are
+    // lexed into pre-parsed lines by concurrent workers, while this thread consumes the chunks
+    // in file order, simulating the print time. Lexing the G-code lines dominates the processing
+    // time and parallelizes cleanly, while the time simulation is inherently sequential.
+    struct Chunk {
+        // Chunk of the file content, ending at a line boundary unless it is the last chunk.
+        std::string                         buffer;
+        // Offset of the first character of buffer in the file.
+        size_t                              file_pos { 0 };
+        std::vector<GCodeReader::GCodeLine> lines;
+        // Positions just after the line ends inside this chunk, file based.
+        std::vector<size_t>                 lines_ends;
+    };
+
+    static constexpr const size_t chunk_size = 65536 * 10;
+    std::string carry;
+    size_t      file_pos = 0;
+    bool        eof      = false;
+    const auto  chunk_reader = tbb::make_filter<void, std::shared_ptr<Chunk>>(slic3r_tbb_filtermode::serial_in_order,
+        [&in, &carry, &file_pos, &eof](tbb::flow_control &fc) -> std::shared_ptr<Chunk> {
+            if (eof && carry.empty()) {
+                fc.stop();
+                return {};
+            }
+            auto chunk = std::make_shared<Chunk>();
+            chunk->file_pos = file_pos;
+            // The trailing incomplete line of the previous chunk starts this one.
+            chunk->buffer   = std::move(carry);
+            carry.clear();
+            while (! eof) {
+                const size_t buffer_pos = chunk->buffer.size();
+                chunk->buffer.resize(buffer_pos + chunk_size);
+                const size_t cnt_read = ::fread(chunk->buffer.data() + buffer_pos, 1, chunk_size, in.f);
+                chunk->buffer.resize(buffer_pos + cnt_read);
+                if (cnt_read < chunk_size)
+                    eof = true;
+                if (const size_t last_eol = chunk->buffer.find_last_of('\n'); last_eol != std::string::npos) {
+                    // Split the chunk at the last line boundary, carrying the incomplete tail over.
+                    carry.assign(chunk->buffer, last_eol + 1, std::string::npos);
+                    chunk->buffer.erase(last_eol + 1);
+                    break;
+                }
+                // No end of line was read yet (extremely long line), keep reading.
+            }
+            file_pos = chunk->file_pos + chunk->buffer.size();
+            return chunk;
+        });
+    const auto  chunk_lexer = tbb::make_filter<std::shared_ptr<Chunk>, std::shared_ptr<Chunk>>(slic3r_tbb_filtermode::parallel,
+        [this](std::shared_ptr<Chunk> chunk) -> std::shared_ptr<Chunk> {
+            const std::string &buffer = chunk->buffer;
+            m_parser.lex_buffer(buffer.c_str(), buffer.c_str() + buffer.size(), chunk->lines);
+            for (size_t i = 0; i < buffer.size(); ++ i)
+                if (buffer[i] == '\n')
+                    chunk->lines_ends.emplace_back(chunk->file_pos + i + 1);
+            return chunk;
+        });
     size_t parse_line_callback_cntr = 10000;
-    m_parser.set_progress_callback(progress_callback);
-    m_parser.parse_file(filename, [this, cancel_callback, &parse_line_callback_cntr](GCodeReader& reader, const GCodeReader::GCodeLine& line) {
-        if (-- parse_line_callback_cntr == 0) {
-            // Don't call the cancel_callback() too often, do it every at every 10000'th line.
-            parse_line_callback_cntr = 10000;
-            if (cancel_callback)
-                cancel_callback();
-        }
-        this->process_gcode_line(line, true);
-    }, m_result.lines_ends);
+    const auto  simulator = tbb::make_filter<std::shared_ptr<Chunk>, void>(slic3r_tbb_filtermode::serial_in_order,
+        [this, file_size, progress_callback, cancel_callback, &parse_line_callback_cntr](std::shared_ptr<Chunk> chunk) {
+            append(m_result.lines_ends.front(), chunk->lines_ends);
+            m_parser.parse_preparsed(chunk->lines, [this, cancel_callback, &parse_line_callback_cntr](GCodeReader& reader, const GCodeReader::GCodeLine& line) {
+                if (-- parse_line_callback_cntr == 0) {
+                    // Don't call the cancel_callback() too often, do it every at every 10000'th line.
+                    parse_line_callback_cntr = 10000;
+                    if (cancel_callback)
+                        cancel_callback();
+                }
+                this->process_gcode_line(line, true);
+            });
+            if (progress_callback != nullptr && file_size > 0)
+                progress_callback(float(chunk->file_pos + chunk->buffer.size()) / float(file_size));
+        });
+
+    // It registers a handler that sets locales to "C" before any TBB thread starts participating in tbb::parallel_pipeline.
+    // Handler is unregistered when the destructor is called.
+    TBBLocalesSetter tbb_locales_setter;
+    // Up to 8 chunks are in flight at a time, bounding the memory held by the pre-parsed lines.
+    tbb::parallel_pipeline(8, chunk_reader & chunk_lexer & simulator);
 
     // Don't post-process the G-code to update time stamps.
     this->finalize(false);
@@ -1363,10 +1552,10 @@ void GCodeProcessor::finalize(bool perform_post_process)
     m_result.z_offset = m_z_offset;
 
     // update width/height of wipe moves
-    for (GCodeProcessorResult::MoveVertex& move : m_result.moves) {
-        if (move.type == EMoveType::Wipe) {
-            move.width = Wipe_Width;
-            move.height = Wipe_Height;
+    for (size_t i = 0; i < m_result.moves.size(); ++ i) {
+        if (m_result.moves.type(i) == EMoveType::Wipe) {
+            m_result.moves.set_width(i, Wipe_Width);
+            m_result.moves.set_height(i, Wipe_Height);
         }
     }
 
@@ -1393,6 +1582,12 @@ float GCodeProcessor::get_time(PrintEstimatedStatistics::ETimeMode mode) const
     return (mode < PrintEstimatedStatistics::ETimeMode::Count) ? m_time_processor.machines[static_cast<size_t>(mode)].time : 0.0f;
 }
 
+const std::vector<float>& GCodeProcessor::get_layers_time(PrintEstimatedStatistics::ETimeMode mode) const
+{
+    static const std::vector<float> empty;
+    return (mode < PrintEstimatedStatistics::ETimeMode::Count) ? m_time_processor.machines[static_cast<size_t>(mode)].layers_time : empty;
+}
+
 std::string GCodeProcessor::get_time_dhm(PrintEstimatedStatistics::ETimeMode mode) const
 {
     return (mode < PrintEstimatedStatistics::ETimeMode::Count) ? short_time(get_time_dhms(m_time_processor.machines[static_cast<size_t>(mode)].time)) : std::string("N/A");
@@ -2613,7 +2808,8 @@ void GCodeProcessor::process_G1(const std::array<std::optional<double>, 4>& axes
     const float volume_extruded_filament = area_filament_cross_section * delta_pos[E];
 
     if (volume_extruded_filament != 0.)
-        m_used_filaments.increase_caches(volume_extruded_filament, m_extruder_id, area_filament_cross_section * m_parking_position,
+        m_used_filaments.increase_caches(volume_extruded_filament, m_extruder_id, std::max<unsigned int>(1, m_layer_id),
+                                         area_filament_cross_section * m_parking_position,
                                          area_filament_cross_section * m_extra_loading_move);
 
     const EMoveType type = move_type(delta_pos);
@@ -4085,12 +4281,13 @@ void GCodeProcessor::post_process()
 
         void synchronize_moves(GCodeProcessorResult& result) const {
             auto it = m_gcode_lines_map.begin();
-            for (GCodeProcessorResult::MoveVertex& move : result.moves) {
-                while (it != m_gcode_lines_map.end() && it->first < move.gcode_id) {
+            for (size_t i = 0; i < result.moves.size(); ++i) {
+                const unsigned int gcode_id = result.moves.gcode_id(i);
+                while (it != m_gcode_lines_map.end() && it->first < gcode_id) {
                     ++it;
                 }
-                if (it != m_gcode_lines_map.end() && it->first == move.gcode_id)
-                    move.gcode_id = it->second;
+                if (it != m_gcode_lines_map.end() && it->first == gcode_id)
+                    result.moves.set_gcode_id(i, it->second);
             }
         }
 
@@ -4647,14 +4844,15 @@ void GCodeProcessor::process_filaments(CustomGCode::Type code)
 
 void GCodeProcessor::calculate_time(GCodeProcessorResult& result, size_t keep_last_n_blocks, float additional_time)
 {
-    // calculate times
-    std::vector<TimeMachine::ActualSpeedMove> actual_speed_moves;
-    for (size_t i = 0; i < static_cast<size_t>(PrintEstimatedStatistics::ETimeMode::Count); ++i) {
-        TimeMachine& machine = m_time_processor.machines[i];
-        machine.calculate_time(m_result, static_cast<PrintEstimatedStatistics::ETimeMode>(i), keep_last_n_blocks, additional_time);
-        if (static_cast<PrintEstimatedStatistics::ETimeMode>(i) == PrintEstimatedStatistics::ETimeMode::Normal)
-            actual_speed_moves = std::move(machine.actual_speed_moves);
-    }
+    // Calculate times. The machines are fully independent of each other: each one simulates
+    // its own planner state and writes its own time slot of the shared moves, thus they run
+    // in parallel and the result is bit for bit identical to the serial evaluation.
+    tbb::parallel_for(size_t(0), static_cast<size_t>(PrintEstimatedStatistics::ETimeMode::Count),
+        [this, keep_last_n_blocks, additional_time](size_t i) {
+            m_time_processor.machines[i].calculate_time(m_result, static_cast<PrintEstimatedStatistics::ETimeMode>(i), keep_last_n_blocks, additional_time);
+        });
+    std::vector<TimeMachine::ActualSpeedMove> actual_speed_moves =
+        std::move(m_time_processor.machines[static_cast<size_t>(PrintEstimatedStatistics::ETimeMode::Normal)].actual_speed_moves);
 
     // insert actual speed moves into the move list. We will do this in two stages (to avoid inserting in the middle of
     // result.moves repeatedly). First, we create individual vectors of MoveVertices, and store them along with their
@@ -4688,30 +4886,29 @@ void GCodeProcessor::calculate_time(GCodeProcessorResult& result, size_t keep_la
             id_map[base_id_old]          = base_id_old + inserted_count; // Remember where the old element will end up.
             inserted_count += moves_to_insert.back().second.size();      // Increase the number of moves that are already planned to be added.
 
-            result.moves[base_id_old].actual_feedrate = it->actual_feedrate; // update move actual speed
-            
+            result.moves.set_actual_feedrate(base_id_old, it->actual_feedrate); // update move actual speed
+
             // synchronize seams actual speed
-            if (base_id_old + 1 < result.moves.size()) {
-                GCodeProcessorResult::MoveVertex& move = result.moves[base_id_old + 1];
-                if (move.type == EMoveType::Seam)
-                    move.actual_feedrate = it->actual_feedrate;
-            }
+            if (base_id_old + 1 < result.moves.size() &&
+                result.moves.type(base_id_old + 1) == EMoveType::Seam)
+                result.moves.set_actual_feedrate(base_id_old + 1, it->actual_feedrate);
             moves_to_insert.emplace_back(std::make_pair(0, std::vector<GCodeProcessorResult::MoveVertex>{}));
         }
     }
 
     // Now actually do the insertion of the ranges into the destination vector.
-    std::vector<GCodeProcessorResult::MoveVertex>& m = result.moves;
-    size_t offset = inserted_count;    
-    m.resize(m.size() + offset); // grow the vector to its final size   
+    GCodeProcessorResult::Moves& m = result.moves;
+    size_t offset = inserted_count;
+    m.resize(m.size() + offset); // grow the vector to its final size
     size_t last_pos = m.size() - 1;  // index of the last element that still needs to be moved
     for (auto it = moves_to_insert.rbegin(); it != moves_to_insert.rend(); ++it) {
         const auto& [new_pos, new_moves] = *it;
         if (new_moves.empty())
             continue;
         for (int i = last_pos; i >= new_pos + new_moves.size(); --i) // Move the elements to their final place.
-            m[i] = m[i - offset];
-        std::copy(new_moves.begin(), new_moves.end(), m.begin() + new_pos);
+            m.set(i, m[i - offset]);
+        for (size_t i = 0; i < new_moves.size(); ++i)
+            m.set(new_pos + i, new_moves[i]);
         last_pos = new_pos - 1;
         offset -= new_moves.size();
     }
@@ -4737,6 +4934,7 @@ void GCodeProcessor::update_estimated_statistics()
         PrintEstimatedStatistics::Mode& data = m_result.print_statistics.modes[static_cast<size_t>(mode)];
         data.time = get_time(mode);
         data.custom_gcode_times = get_custom_gcode_times(mode, true);
+        data.layers_times = m_time_processor.machines[static_cast<size_t>(mode)].layers_time;
     };
 
     update_mode(PrintEstimatedStatistics::ETimeMode::Normal);
@@ -4748,6 +4946,7 @@ void GCodeProcessor::update_estimated_statistics()
     m_result.print_statistics.volumes_per_color_change  = m_used_filaments.volumes_per_color_change;
     m_result.print_statistics.volumes_per_extruder      = m_used_filaments.volumes_per_extruder;
     m_result.print_statistics.used_filaments_per_role   = m_used_filaments.filaments_per_role;
+    m_result.print_statistics.volumes_per_layer         = m_used_filaments.volumes_per_layer;
 }
 
 double GCodeProcessor::extract_absolute_position_on_axis(Axis axis, const GCodeReader::GCodeLine& line, double area_filament_cross_section)
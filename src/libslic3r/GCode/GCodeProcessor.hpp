@@ -17,6 +17,7 @@
 
 #include <cstdint>
 #include <array>
+#include <iterator>
 #include <vector>
 #include <string>
 #include <string_view>
@@ -55,11 +56,15 @@ namespace Slic3r {
         {
             float time;
             std::vector<std::pair<CustomGCode::Type, std::pair<float, float>>> custom_gcode_times;
+            // Time spent in each layer, index is layer id - 1.
+            std::vector<float> layers_times;
 
             void reset() {
                 time = 0.0f;
                 custom_gcode_times.clear();
                 custom_gcode_times.shrink_to_fit();
+                layers_times.clear();
+                layers_times.shrink_to_fit();
             }
         };
 
@@ -67,6 +72,8 @@ namespace Slic3r {
         std::map<size_t, double>                                volumes_per_extruder;
         std::map<GCodeExtrusionRole, std::pair<double, double>> used_filaments_per_role;
         std::map<size_t, double>                                cost_per_extruder;
+        // Filament volume extruded in each layer, index is layer id - 1.
+        std::vector<double>                                     volumes_per_layer;
 
         std::array<Mode, static_cast<size_t>(ETimeMode::Count)> modes;
 
@@ -81,6 +88,8 @@ namespace Slic3r {
             volumes_per_extruder.clear();
             used_filaments_per_role.clear();
             cost_per_extruder.clear();
+            volumes_per_layer.clear();
+            volumes_per_layer.shrink_to_fit();
         }
     };
 
@@ -139,10 +148,113 @@ namespace Slic3r {
             float actual_volumetric_rate() const { return actual_feedrate * mm3_per_mm; }
         };
 
+        // Structure of arrays storage of the move vertices. Large prints hold tens of millions
+        // of moves, thus the fields are stored in per column vectors with narrow types instead
+        // of a single std::vector<MoveVertex>, removing the padding of the combined struct and
+        // growing one column at a time. Full MoveVertex records are gathered on access.
+        class Moves
+        {
+        public:
+            size_t size() const { return m_attributes.size(); }
+            bool   empty() const { return m_attributes.empty(); }
+            void   clear();
+            void   reserve(size_t cap);
+            void   resize(size_t new_size);
+            void   push_back(const MoveVertex &move);
+            void   erase(size_t i);
+            // Gather the full record of the i'th move from the columns.
+            MoveVertex operator[](size_t i) const;
+            MoveVertex back() const { assert(! this->empty()); return (*this)[this->size() - 1]; }
+            // Scatter a full move record into the columns.
+            void set(size_t i, const MoveVertex &move);
+
+            // Single field accessors, sparing the gather of a full record.
+            unsigned int       gcode_id(size_t i) const { return m_gcode_ids[i]; }
+            EMoveType          type(size_t i) const { return m_attributes[i].type; }
+            GCodeExtrusionRole extrusion_role(size_t i) const { return m_attributes[i].extrusion_role; }
+            const Vec3f&       position(size_t i) const { return m_positions[i]; }
+            float              width(size_t i) const { return m_widths[i]; }
+            float              height(size_t i) const { return m_heights[i]; }
+            float              actual_feedrate(size_t i) const { return m_actual_feedrates[i]; }
+            void set_gcode_id(size_t i, unsigned int gcode_id) { m_gcode_ids[i] = gcode_id; }
+            void set_position(size_t i, const Vec3f &position) { m_positions[i] = position; }
+            void set_width(size_t i, float width) { m_widths[i] = width; }
+            void set_height(size_t i, float height) { m_heights[i] = height; }
+            void set_actual_feedrate(size_t i, float feedrate) { m_actual_feedrates[i] = feedrate; }
+            void set_time(size_t i, size_t mode, float time) { m_times[i][mode] = time; }
+
+            // Read only iteration over gathered records, compatible with range based loops
+            // and the standard algorithms.
+            class const_iterator
+            {
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type        = MoveVertex;
+                using difference_type   = std::ptrdiff_t;
+                using pointer           = const MoveVertex*;
+                using reference         = MoveVertex;
+                const_iterator(const Moves &moves, size_t pos) : m_moves(&moves), m_pos(pos) {}
+                MoveVertex      operator*() const { return (*m_moves)[m_pos]; }
+                const_iterator& operator++() { ++ m_pos; return *this; }
+                const_iterator  operator++(int) { const_iterator out = *this; ++ m_pos; return out; }
+                bool operator==(const const_iterator &rhs) const { return m_pos == rhs.m_pos; }
+                bool operator!=(const const_iterator &rhs) const { return ! (*this == rhs); }
+            private:
+                const Moves *m_moves;
+                size_t       m_pos;
+            };
+            const_iterator begin() const { return const_iterator(*this, 0); }
+            const_iterator end() const { return const_iterator(*this, this->size()); }
+
+        private:
+            // Narrow per move attributes packed into a single column.
+            struct Attributes
+            {
+                EMoveType          type { EMoveType::Noop };
+                GCodeExtrusionRole extrusion_role { GCodeExtrusionRole::None };
+                unsigned char      extruder_id { 0 };
+                unsigned char      cp_color_id { 0 };
+                bool               internal_only { false };
+            };
+            using Times = std::array<float, static_cast<size_t>(PrintEstimatedStatistics::ETimeMode::Count)>;
+
+            // Apply op to all the columns, keeping them in sync for resizing operations.
+            template<typename ColumnsOp>
+            void for_each_column(ColumnsOp op) {
+                op(m_gcode_ids);
+                op(m_attributes);
+                op(m_positions);
+                op(m_deltas_extruder);
+                op(m_feedrates);
+                op(m_actual_feedrates);
+                op(m_widths);
+                op(m_heights);
+                op(m_mm3_per_mms);
+                op(m_fan_speeds);
+                op(m_temperatures);
+                op(m_times);
+                op(m_layer_ids);
+            }
+
+            std::vector<unsigned int> m_gcode_ids;
+            std::vector<Attributes>   m_attributes;
+            std::vector<Vec3f>        m_positions;
+            std::vector<float>        m_deltas_extruder;
+            std::vector<float>        m_feedrates;
+            std::vector<float>        m_actual_feedrates;
+            std::vector<float>        m_widths;
+            std::vector<float>        m_heights;
+            std::vector<float>        m_mm3_per_mms;
+            std::vector<float>        m_fan_speeds;
+            std::vector<float>        m_temperatures;
+            std::vector<Times>        m_times;
+            std::vector<unsigned int> m_layer_ids;
+        };
+
         std::string filename;
         bool is_binary_file;
         unsigned int id;
-        std::vector<MoveVertex> moves;
+        Moves moves;
         // Positions of ends of lines of the final G-code this->filename after TimeProcessor::post_process() finalizes the G-code.
         // Binarized gcodes usually have several gcode blocks. Each block has its own list on ends of lines.
         // Ascii gcodes have only one list on ends of lines
@@ -358,6 +470,9 @@ namespace Slic3r {
             std::vector<TimeBlock> blocks;
             std::vector<G1LinesCacheItem> g1_times_cache;
             float first_layer_time;
+            // Partial time per layer, accumulated as the time blocks are flushed during
+            // the simulation, thus it grows incrementally while the G-code is processed.
+            std::vector<float> layers_time;
             std::vector<ActualSpeedMove> actual_speed_moves;
 
             void reset();
@@ -407,9 +522,13 @@ namespace Slic3r {
             double role_cache;
             std::map<GCodeExtrusionRole, std::pair<double, double>> filaments_per_role; // ExtrusionRole -> (m, g)
 
+            // Filament volume extruded in each layer, index is layer id - 1.
+            // Updated continuously during the simulation, not cached like the maps above.
+            std::vector<double> volumes_per_layer;
+
             void reset();
 
-            void increase_caches(double extruded_volume, unsigned char extruder_id, double parking_volume, double extra_loading_volume);
+            void increase_caches(double extruded_volume, unsigned char extruder_id, unsigned int layer_id, double parking_volume, double extra_loading_volume);
 
             void process_color_change_cache();
             void process_extruder_cache(unsigned char extruder_id);
@@ -465,10 +584,11 @@ namespace Slic3r {
 
                 const Vec3f position = m_result.moves.back().position;
 
-                GCodeProcessorResult::MoveVertex& move = m_result.moves.emplace_back(m_result.moves[*m_move_id]);
+                GCodeProcessorResult::MoveVertex move = m_result.moves[*m_move_id];
                 move.position = position;
                 move.height = height;
-                m_result.moves.erase(m_result.moves.begin() + *m_move_id);
+                m_result.moves.push_back(move);
+                m_result.moves.erase(*m_move_id);
                 m_result.custom_gcode_per_print_z[*m_custom_gcode_per_print_z_id].print_z = position.z();
                 reset();
             }
@@ -595,7 +715,7 @@ namespace Slic3r {
         void initialize_result_moves() {
             // 1st move must be a dummy move
             assert(m_result.moves.empty());
-            m_result.moves.emplace_back(GCodeProcessorResult::MoveVertex());
+            m_result.moves.push_back(GCodeProcessorResult::MoveVertex());
         }
         void process_buffer(const std::string& buffer);
         void finalize(bool post_process);
@@ -606,6 +726,11 @@ namespace Slic3r {
 
         float get_first_layer_time(PrintEstimatedStatistics::ETimeMode mode) const;
 
+        // Per layer partials accumulated so far. Both may be polled from the processing
+        // thread while the G-code is still being exported, they grow as layers complete.
+        const std::vector<float>&  get_layers_time(PrintEstimatedStatistics::ETimeMode mode) const;
+        const std::vector<double>& get_layers_volume() const { return m_used_filaments.volumes_per_layer; }
+
     private:
         void apply_config(const DynamicPrintConfig& config);
         void apply_config_simplify3d(const std::string& filename);
@@ -285,6 +285,13 @@ std::string GCodeWriter::toolchange(unsigned int extruder_id)
 }
 
 std::string GCodeWriter::set_speed(double F, const std::string_view comment, const std::string_view cooling_marker) const
+{
+    std::string gcode;
+    this->set_speed(gcode, F, comment, cooling_marker);
+    return gcode;
+}
+
+void GCodeWriter::set_speed(std::string &gcode, double F, const std::string_view comment, const std::string_view cooling_marker) const
 {
     assert(F > 0.);
     assert(F < 100000.);
@@ -293,16 +300,23 @@ std::string GCodeWriter::set_speed(double F, const std::string_view comment, con
     w.emit_f(F);
     w.emit_comment(this->config.gcode_comments, comment);
     w.emit_string(cooling_marker);
-    return w.string();
+    w.string_to(gcode);
 }
 
 std::string GCodeWriter::get_travel_to_xy_gcode(const Vec2d &point, const std::string_view comment) const
+{
+    std::string gcode;
+    this->get_travel_to_xy_gcode(gcode, point, comment);
+    return gcode;
+}
+
+void GCodeWriter::get_travel_to_xy_gcode(std::string &gcode, const Vec2d &point, const std::string_view comment) const
 {
     GCodeG1Formatter w;
     w.emit_xy(point);
     w.emit_f(this->config.travel_speed.value * 60.0);
     w.emit_comment(this->config.gcode_comments, comment);
-    return w.string();
+    w.string_to(gcode);
 }
 
 std::string GCodeWriter::travel_to_xy(const Vec2d &point, const std::string_view comment)
@@ -311,6 +325,12 @@ std::string GCodeWriter::travel_to_xy(const Vec2d &point, const std::string_view
     return this->get_travel_to_xy_gcode(point, comment);
 }
 
+void GCodeWriter::travel_to_xy(std::string &gcode, const Vec2d &point, const std::string_view comment)
+{
+    m_pos.head<2>() = point.head<2>();
+    this->get_travel_to_xy_gcode(gcode, point, comment);
+}
+
 std::string GCodeWriter::travel_to_xy_G2G3IJ(const Vec2d &point, const Vec2d &ij, const bool ccw, const std::string_view comment)
 {
     assert(std::abs(point.x()) < 1200.);
@@ -387,6 +407,13 @@ std::string GCodeWriter::get_travel_to_z_gcode(double z, const std::string_view
 }
 
 std::string GCodeWriter::extrude_to_xy(const Vec2d &point, double dE, const std::string_view comment)
+{
+    std::string gcode;
+    this->extrude_to_xy(gcode, point, dE, comment);
+    return gcode;
+}
+
+void GCodeWriter::extrude_to_xy(std::string &gcode, const Vec2d &point, double dE, const std::string_view comment)
 {
     assert(dE != 0);
     assert(std::abs(dE) < 1000.0);
@@ -397,10 +424,17 @@ std::string GCodeWriter::extrude_to_xy(const Vec2d &point, double dE, const std:
     w.emit_xy(point);
     w.emit_e(m_extrusion_axis, m_extruder->extrude(dE).second);
     w.emit_comment(this->config.gcode_comments, comment);
-    return w.string();
+    w.string_to(gcode);
 }
 
 std::string GCodeWriter::extrude_to_xy_G2G3IJ(const Vec2d &point, const Vec2d &ij, const bool ccw, double dE, const std::string_view comment)
+{
+    std::string gcode;
+    this->extrude_to_xy_G2G3IJ(gcode, point, ij, ccw, dE, comment);
+    return gcode;
+}
+
+void GCodeWriter::extrude_to_xy_G2G3IJ(std::string &gcode, const Vec2d &point, const Vec2d &ij, const bool ccw, double dE, const std::string_view comment)
 {
     assert(std::abs(dE) < 1000.0);
     assert(dE != 0);
@@ -417,7 +451,7 @@ std::string GCodeWriter::extrude_to_xy_G2G3IJ(const Vec2d &point, const Vec2d &i
     w.emit_ij(ij);
     w.emit_e(m_extrusion_axis, m_extruder->extrude(dE).second);
     w.emit_comment(this->config.gcode_comments, comment);
-    return w.string();
+    w.string_to(gcode);
 }
 
 #if 0
@@ -436,10 +470,17 @@ std::string GCodeWriter::extrude_to_xyz(const Vec3d &point, double dE, const std
 #endif
 
 std::string GCodeWriter::retract(bool before_wipe)
+{
+    std::string gcode;
+    this->retract(gcode, before_wipe);
+    return gcode;
+}
+
+void GCodeWriter::retract(std::string &gcode, bool before_wipe)
 {
     double factor = before_wipe ? m_extruder->retract_before_wipe() : 1.;
     assert(factor >= 0. && factor <= 1. + EPSILON);
-    return this->_retract(
+    this->_retract(gcode,
         factor * m_extruder->retract_length(),
         m_extruder->retract_restart_extra(),
         "retract"
@@ -447,17 +488,24 @@ std::string GCodeWriter::retract(bool before_wipe)
 }
 
 std::string GCodeWriter::retract_for_toolchange(bool before_wipe)
+{
+    std::string gcode;
+    this->retract_for_toolchange(gcode, before_wipe);
+    return gcode;
+}
+
+void GCodeWriter::retract_for_toolchange(std::string &gcode, bool before_wipe)
 {
     double factor = before_wipe ? m_extruder->retract_before_wipe() : 1.;
     assert(factor >= 0. && factor <= 1. + EPSILON);
-    return this->_retract(
+    this->_retract(gcode,
         factor * m_extruder->retract_length_toolchange(),
         m_extruder->retract_restart_extra_toolchange(),
         "retract for toolchange"
     );
 }
 
-std::string GCodeWriter::_retract(double length, double restart_extra, const std::string_view comment)
+void GCodeWriter::_retract(std::string &gcode, double length, double restart_extra, const std::string_view comment)
 {
     assert(std::abs(length) < 1000.0);
     assert(std::abs(restart_extra) < 1000.0);
@@ -476,32 +524,34 @@ std::string GCodeWriter::_retract(double length, double restart_extra, const std
         restart_extra = restart_extra * area;
     }
     
-    std::string gcode;
     if (auto [dE, emitE] = m_extruder->retract(length, restart_extra);  dE != 0) {
         if (this->config.use_firmware_retraction) {
-            gcode = FLAVOR_IS(gcfMachinekit) ? "G22 ; retract\n" : "G10 ; retract\n";
+            gcode += FLAVOR_IS(gcfMachinekit) ? "G22 ; retract\n" : "G10 ; retract\n";
         } else if (! m_extrusion_axis.empty()) {
             GCodeG1Formatter w;
             w.emit_e(m_extrusion_axis, emitE);
             w.emit_f(m_extruder->retract_speed() * 60.);
             w.emit_comment(this->config.gcode_comments, comment);
-            gcode = w.string();
+            w.string_to(gcode);
         }
     }
-    
+
     if (FLAVOR_IS(gcfMakerWare))
         gcode += "M103 ; extruder off\n";
-
-    return gcode;
 }
 
 std::string GCodeWriter::unretract()
 {
     std::string gcode;
-    
+    this->unretract(gcode);
+    return gcode;
+}
+
+void GCodeWriter::unretract(std::string &gcode)
+{
     if (FLAVOR_IS(gcfMakerWare))
-        gcode = "M101 ; extruder on\n";
-    
+        gcode += "M101 ; extruder on\n";
+
     if (auto [dE, emitE] = m_extruder->unretract(); dE != 0) {
         if (this->config.use_firmware_retraction) {
             gcode += FLAVOR_IS(gcfMachinekit) ? "G23 ; unretract\n" : "G11 ; unretract\n";
@@ -512,11 +562,9 @@ std::string GCodeWriter::unretract()
             w.emit_e(m_extrusion_axis, emitE);
             w.emit_f(m_extruder->deretract_speed() * 60.);
             w.emit_comment(this->config.gcode_comments, " ; unretract");
-            gcode += w.string();
+            w.string_to(gcode);
         }
     }
-    
-    return gcode;
 }
 
 void GCodeWriter::update_position(const Vec3d &new_pos)
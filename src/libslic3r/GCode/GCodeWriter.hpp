@@ -67,9 +67,14 @@ public:
     std::string toolchange_prefix() const;
     std::string toolchange(unsigned int extruder_id);
     std::string set_speed(double F, const std::string_view comment = {}, const std::string_view cooling_marker = {}) const;
+    // Variant of set_speed() appending to a caller provided buffer, so the export hot loop
+    // does not allocate a temporary string per emitted G-code line.
+    void        set_speed(std::string &gcode, double F, const std::string_view comment = {}, const std::string_view cooling_marker = {}) const;
 
     std::string get_travel_to_xy_gcode(const Vec2d &point, const std::string_view comment) const;
+    void        get_travel_to_xy_gcode(std::string &gcode, const Vec2d &point, const std::string_view comment) const;
     std::string travel_to_xy(const Vec2d &point, const std::string_view comment = {});
+    void        travel_to_xy(std::string &gcode, const Vec2d &point, const std::string_view comment = {});
     std::string travel_to_xy_G2G3IJ(const Vec2d &point, const Vec2d &ij, const bool ccw, const std::string_view comment = {});
 
     /**
@@ -86,11 +91,16 @@ public:
     std::string get_travel_to_z_gcode(double z, const std::string_view comment) const;
     std::string travel_to_z(double z, const std::string_view comment = {});
     std::string extrude_to_xy(const Vec2d &point, double dE, const std::string_view comment = {});
+    void        extrude_to_xy(std::string &gcode, const Vec2d &point, double dE, const std::string_view comment = {});
     std::string extrude_to_xy_G2G3IJ(const Vec2d &point, const Vec2d &ij, const bool ccw, double dE, const std::string_view comment);
+    void        extrude_to_xy_G2G3IJ(std::string &gcode, const Vec2d &point, const Vec2d &ij, const bool ccw, double dE, const std::string_view comment);
 //    std::string extrude_to_xyz(const Vec3d &point, double dE, const std::string_view comment = {});
     std::string retract(bool before_wipe = false);
+    void        retract(std::string &gcode, bool before_wipe = false);
     std::string retract_for_toolchange(bool before_wipe = false);
+    void        retract_for_toolchange(std::string &gcode, bool before_wipe = false);
     std::string unretract();
+    void        unretract(std::string &gcode);
 
     // Current position of the printer, in G-code coordinates.
     // Z coordinate of current position contains zhop. If zhop is applied (this->zhop() > 0),
@@ -135,7 +145,7 @@ private:
         Print
     };
 
-    std::string _retract(double length, double restart_extra, const std::string_view comment);
+    void _retract(std::string &gcode, double length, double restart_extra, const std::string_view comment);
     std::string set_acceleration_internal(Acceleration type, unsigned int acceleration);
 };
 
@@ -233,6 +243,13 @@ public:
         return std::string(this->buf, ptr_err.ptr - buf);
     }
 
+    // Append the formatted line to the end of a caller provided buffer,
+    // not allocating a temporary std::string.
+    void string_to(std::string &out) {
+        *ptr_err.ptr ++ = '\n';
+        out.append(this->buf, ptr_err.ptr - buf);
+    }
+
 protected:
     static constexpr const size_t   buflen = 256;
     char                            buf[buflen];
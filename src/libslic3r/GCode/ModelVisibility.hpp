@@ -19,17 +19,25 @@ struct CoordinateFunctor
 };
 } // namespace Impl
 
+struct VisibilityParams
+{
+    // Number of samples generated on the mesh. There are
+    // sqr_rays_per_sample_point*sqr_rays_per_sample_point rays casted from each samples
+    size_t raycasting_visibility_samples_count{};
+    size_t fast_decimation_triangle_count_target{};
+    // square of number of rays per sample point
+    size_t sqr_rays_per_sample_point{};
+
+    bool operator==(const VisibilityParams &rhs) const {
+        return raycasting_visibility_samples_count == rhs.raycasting_visibility_samples_count &&
+               fast_decimation_triangle_count_target == rhs.fast_decimation_triangle_count_target &&
+               sqr_rays_per_sample_point == rhs.sqr_rays_per_sample_point;
+    }
+};
+
 struct Visibility
 {
-    struct Params
-    {
-        // Number of samples generated on the mesh. There are
-        // sqr_rays_per_sample_point*sqr_rays_per_sample_point rays casted from each samples
-        size_t raycasting_visibility_samples_count{};
-        size_t fast_decimation_triangle_count_target{};
-        // square of number of rays per sample point
-        size_t sqr_rays_per_sample_point{};
-    };
+    using Params = VisibilityParams;
 
     Visibility(
         const Transform3d &obj_transform,
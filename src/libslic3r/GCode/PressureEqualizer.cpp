@@ -7,6 +7,7 @@
 #include <cstring>
 #include <cfloat>
 #include <algorithm>
+#include <string_view>
 
 #include "../libslic3r.h"
 #include "../PrintConfig.hpp"
@@ -143,13 +144,28 @@ void PressureEqualizer::process_layer(const std::string &gcode)
 
         // Now, run the pressure equalizer across the segment like a streamroller.
         // It operates on a sliding window that moves forward across gcode line by line.
+        // First gather the indices of the extruding lines of this segment into a contiguous array,
+        // so that the sliding window passes below don't rescan the interleaved travels and other
+        // non-extruding lines over and over again.
         const std::ptrdiff_t current_extrusion_begin_idx = std::distance(m_gcode_lines.cbegin(), current_extrusion_begin_it);
-        for (auto current_line_it = current_extrusion_begin_it; current_line_it != current_extrusion_end_it; ++current_line_it) {
-            const std::ptrdiff_t current_line_idx = std::distance(m_gcode_lines.cbegin(), current_line_it);
+        m_segment_extruding_line_idxs.clear();
+        for (auto line_it = current_extrusion_begin_it; line_it != current_extrusion_end_it; ++line_it)
+            if (line_it->extruding())
+                m_segment_extruding_line_idxs.emplace_back(std::distance(m_gcode_lines.cbegin(), line_it));
+
+        size_t window_first_pos = 0;
+        for (size_t current_pos = 0; current_pos < m_segment_extruding_line_idxs.size(); ++current_pos) {
+            const size_t current_line_idx = m_segment_extruding_line_idxs[current_pos];
 
             // Feed pressure equalizer past lines, going back to max_look_back_limit (or start of segment).
-            const size_t start_idx = size_t(std::max<std::ptrdiff_t>(current_extrusion_begin_idx, current_line_idx - max_look_back_limit));
-            adjust_volumetric_rate(start_idx, size_t(current_line_idx));
+            const size_t start_idx = size_t(std::max<std::ptrdiff_t>(current_extrusion_begin_idx, std::ptrdiff_t(current_line_idx) - max_look_back_limit));
+            if (current_line_idx - start_idx < 2)
+                // Don't bother adjusting volumetric rate if there's no gcode to adjust.
+                continue;
+            // The look back limit only ever moves forward, so does the start of the window.
+            while (m_segment_extruding_line_idxs[window_first_pos] < start_idx)
+                ++window_first_pos;
+            adjust_volumetric_rate(window_first_pos, current_pos);
         }
 
         // Current extrusion is all done processing so advance beyond it for the next loop.
@@ -292,9 +308,9 @@ bool PressureEqualizer::process_line(const char *line, const char *line_end, GCo
     buf.max_volumetric_extrusion_rate_slope_negative = 0.f;
     buf.extrusion_role = m_current_extrusion_role;
 
-    std::string str_line(line, line_end);
-    const bool found_extrude_set_speed_tag = boost::contains(str_line, EXTRUDE_SET_SPEED_TAG);
-    const bool found_extrude_end_tag = boost::contains(str_line, EXTRUDE_END_TAG);
+    const std::string_view str_line(line, len);
+    const bool found_extrude_set_speed_tag = str_line.find(EXTRUDE_SET_SPEED_TAG) != std::string_view::npos;
+    const bool found_extrude_end_tag = str_line.find(EXTRUDE_END_TAG) != std::string_view::npos;
     assert(!found_extrude_set_speed_tag || !found_extrude_end_tag);
 
     if (found_extrude_set_speed_tag)
@@ -583,36 +599,27 @@ void PressureEqualizer::output_gcode_line(const size_t line_idx)
     }
 }
 
-void PressureEqualizer::adjust_volumetric_rate(const size_t first_line_idx, const size_t last_line_idx)
+void PressureEqualizer::adjust_volumetric_rate(const size_t first_pos, const size_t last_pos)
 {
-    // Don't bother adjusting volumetric rate if there's no gcode to adjust.
-    if (last_line_idx <= first_line_idx || last_line_idx - first_line_idx < 2)
-        return;
-
-    size_t line_idx = last_line_idx;
-    if (line_idx == first_line_idx || !m_gcode_lines[line_idx].extruding())
-        // Nothing to do, the last move is not extruding.
-        return;
+    // Positions index into the contiguous array of extruding lines of the current segment,
+    // so both passes below visit extruding lines only, without rescanning anything in between.
+    const std::vector<size_t> &extruding_line_idxs = m_segment_extruding_line_idxs;
+    size_t pos = last_pos;
 
     std::array<float, size_t(GCodeExtrusionRole::Count)> feedrate_per_extrusion_role{};
     feedrate_per_extrusion_role.fill(std::numeric_limits<float>::max());
-    feedrate_per_extrusion_role[int(m_gcode_lines[line_idx].extrusion_role)] = m_gcode_lines[line_idx].volumetric_extrusion_rate_start;
+    feedrate_per_extrusion_role[int(m_gcode_lines[extruding_line_idxs[pos]].extrusion_role)] = m_gcode_lines[extruding_line_idxs[pos]].volumetric_extrusion_rate_start;
 
-    while (line_idx != first_line_idx) {
-        size_t idx_prev = line_idx - 1;
-        for (; !m_gcode_lines[idx_prev].extruding() && idx_prev != first_line_idx; --idx_prev);
-        if (!m_gcode_lines[idx_prev].extruding())
-            break;
+    while (pos != first_pos) {
         // Don't decelerate before ironing.
-        if (m_gcode_lines[line_idx].extrusion_role == GCodeExtrusionRole::Ironing) {
-            line_idx = idx_prev;
+        if (m_gcode_lines[extruding_line_idxs[pos]].extrusion_role == GCodeExtrusionRole::Ironing) {
+            --pos;
             continue;
         }
         // Volumetric extrusion rate at the start of the succeding segment.
-        float rate_succ = m_gcode_lines[line_idx].volumetric_extrusion_rate_start;
-        // What is the gradient of the extrusion rate between idx_prev and idx?
-        line_idx        = idx_prev;
-        GCodeLine &line = m_gcode_lines[line_idx];
+        float rate_succ = m_gcode_lines[extruding_line_idxs[pos]].volumetric_extrusion_rate_start;
+        // What is the gradient of the extrusion rate between the previous extruding line and this one?
+        GCodeLine &line = m_gcode_lines[extruding_line_idxs[--pos]];
 
         for (size_t iRole = 1; iRole < size_t(GCodeExtrusionRole::Count); ++ iRole) {
             const float &rate_slope = m_max_volumetric_extrusion_rate_slopes[iRole].negative;
@@ -655,23 +662,18 @@ void PressureEqualizer::adjust_volumetric_rate(const size_t first_line_idx, cons
     }
 
     feedrate_per_extrusion_role.fill(std::numeric_limits<float>::max());
-    feedrate_per_extrusion_role[size_t(m_gcode_lines[line_idx].extrusion_role)] = m_gcode_lines[line_idx].volumetric_extrusion_rate_end;
+    feedrate_per_extrusion_role[size_t(m_gcode_lines[extruding_line_idxs[pos]].extrusion_role)] = m_gcode_lines[extruding_line_idxs[pos]].volumetric_extrusion_rate_end;
 
-    assert(m_gcode_lines[line_idx].extruding());
-    while (line_idx != last_line_idx) {
-        size_t idx_next = line_idx + 1;
-        for (; !m_gcode_lines[idx_next].extruding() && idx_next != last_line_idx; ++idx_next);
-        if (!m_gcode_lines[idx_next].extruding())
-            break;
+    assert(m_gcode_lines[extruding_line_idxs[pos]].extruding());
+    while (pos != last_pos) {
         // Don't accelerate after ironing.
-        if (m_gcode_lines[line_idx].extrusion_role == GCodeExtrusionRole::Ironing) {
-            line_idx = idx_next;
+        if (m_gcode_lines[extruding_line_idxs[pos]].extrusion_role == GCodeExtrusionRole::Ironing) {
+            ++pos;
             continue;
         }
-        float rate_prec = m_gcode_lines[line_idx].volumetric_extrusion_rate_end;
-        // What is the gradient of the extrusion rate between idx_prev and idx?
-        line_idx = idx_next;
-        GCodeLine &line = m_gcode_lines[line_idx];
+        float rate_prec = m_gcode_lines[extruding_line_idxs[pos]].volumetric_extrusion_rate_end;
+        // What is the gradient of the extrusion rate between the previous extruding line and this one?
+        GCodeLine &line = m_gcode_lines[extruding_line_idxs[++pos]];
 
         for (size_t iRole = 1; iRole < size_t(GCodeExtrusionRole::Count); ++ iRole) {
             const float &rate_slope = m_max_volumetric_extrusion_rate_slopes[iRole].positive;
@@ -755,7 +757,8 @@ inline void PressureEqualizer::push_to_output(const char *text, const size_t len
     output_buffer[output_buffer_length] = 0;
 }
 
-inline bool is_just_line_with_extrude_set_speed_tag(const std::string &line)
+// The line is expected to view a NUL terminated range, so it may point directly into the output buffer.
+inline bool is_just_line_with_extrude_set_speed_tag(const std::string_view line)
 {
     if (line.empty() && !boost::starts_with(line, "G1 ") && !boost::ends_with(line, EXTRUDE_SET_SPEED_TAG))
         return false;
@@ -778,9 +781,10 @@ void PressureEqualizer::push_line_to_output(const size_t line_idx, const float n
 {
     const GCodeLine &line = m_gcode_lines[line_idx];
     if (line_idx > 0 && output_buffer_length > 0) {
-        const std::string prev_line_str = std::string(output_buffer.begin() + int(this->output_buffer_prev_length),
-                                                      output_buffer.begin() + int(this->output_buffer_length) + 1);
-        if (is_just_line_with_extrude_set_speed_tag(prev_line_str))
+        // View the previously emitted line in place, including its trailing NUL terminator.
+        const std::string_view prev_line(output_buffer.data() + this->output_buffer_prev_length,
+                                         this->output_buffer_length - this->output_buffer_prev_length + 1);
+        if (is_just_line_with_extrude_set_speed_tag(prev_line))
             this->output_buffer_length = this->output_buffer_prev_length; // Remove the last line because it only sets the speed for an empty block of g-code lines, so it is useless.
         else
             push_to_output(EXTRUDE_END_TAG.data(), EXTRUDE_END_TAG.length(), true);
@@ -789,9 +793,9 @@ void PressureEqualizer::push_line_to_output(const size_t line_idx, const float n
 
     GCodeG1Formatter feedrate_formatter;
     feedrate_formatter.emit_f(new_feedrate);
-    feedrate_formatter.emit_string(std::string(EXTRUDE_SET_SPEED_TAG.data(), EXTRUDE_SET_SPEED_TAG.length()));
+    feedrate_formatter.emit_string(EXTRUDE_SET_SPEED_TAG);
     if (line.extrusion_role == GCodeExtrusionRole::ExternalPerimeter)
-        feedrate_formatter.emit_string(std::string(EXTERNAL_PERIMETER_TAG.data(), EXTERNAL_PERIMETER_TAG.length()));
+        feedrate_formatter.emit_string(EXTERNAL_PERIMETER_TAG);
     push_to_output(feedrate_formatter);
 
     GCodeG1Formatter extrusion_formatter;
@@ -801,7 +805,7 @@ void PressureEqualizer::push_line_to_output(const size_t line_idx, const float n
     extrusion_formatter.emit_axis('E', m_use_relative_e_distances ? (line.pos_end[3] - line.pos_start[3]) : line.pos_end[3], GCodeFormatter::E_EXPORT_DIGITS);
 
     if (comment != nullptr)
-        extrusion_formatter.emit_string(std::string(comment));
+        extrusion_formatter.emit_string(comment);
 
     push_to_output(extrusion_formatter);
 }
@@ -182,6 +182,11 @@ private:
     size_t                          output_buffer_length;
     size_t                          output_buffer_prev_length;
 
+    // Indices of the extruding lines of the extrusion segment currently being adjusted, gathered
+    // into a contiguous array so that the sliding window of adjust_volumetric_rate() does not
+    // rescan the interleaved non-extruding lines. Kept as a member to reuse the allocation.
+    std::vector<size_t>             m_segment_extruding_line_idxs;
+
 #ifdef PRESSURE_EQUALIZER_DEBUG
     // For debugging purposes. Index of the G-code line processed.
     size_t                          line_idx;
@@ -192,9 +197,10 @@ private:
 
     GCodeLinesConstIt advance_segment_beyond_small_gap(const GCodeLinesConstIt &last_extruding_line_it) const;
 
-    // Go back from the current circular_buffer_pos and lower the feedtrate to decrease the slope of the extrusion rate changes.
+    // Go back from the current position and lower the feedtrate to decrease the slope of the extrusion rate changes.
     // Then go forward and adjust the feedrate to decrease the slope of the extrusion rate changes.
-    void adjust_volumetric_rate(size_t first_line_idx, size_t last_line_idx);
+    // Both positions index into m_segment_extruding_line_idxs.
+    void adjust_volumetric_rate(size_t first_pos, size_t last_pos);
 
     // Push the text to the end of the output_buffer.
     inline void push_to_output(GCodeG1Formatter &formatter);
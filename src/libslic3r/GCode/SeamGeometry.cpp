@@ -151,6 +151,8 @@ Geometry::Extrusions get_external_perimeters(const Slic3r::Layer &layer, const L
     std::vector<Geometry::Extrusion> result;
     for (const LayerIsland &island : slice.islands) {
         const LayerRegion &layer_region = *layer.get_region(island.perimeters.region());
+        // The flow is constant over the layer region, resolve it once for all its perimeters.
+        const double width{layer_region.flow(FlowRole::frExternalPerimeter).width()};
         for (const uint32_t perimeter_id : island.perimeters) {
             const auto collection{static_cast<const ExtrusionEntityCollection *>(
                 layer_region.perimeters().entities[perimeter_id]
@@ -159,7 +161,6 @@ Geometry::Extrusions get_external_perimeters(const Slic3r::Layer &layer, const L
                 if (entity->role().is_external_perimeter()) {
                     Polygon polygon{entity->as_polyline().points};
                     const BoundingBox bounding_box{polygon.bounding_box()};
-                    const double width{layer_region.flow(FlowRole::frExternalPerimeter).width()};
                     result.emplace_back(std::move(polygon), bounding_box, width, island.boundary);
                 }
             }
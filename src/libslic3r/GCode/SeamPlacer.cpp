@@ -5,7 +5,10 @@
 ///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
 ///|/
 
+#include <mutex>
+
 #include <boost/filesystem/operations.hpp>
+#include <boost/functional/hash.hpp>
 #include <boost/property_tree/json_parser.hpp>
 
 #include "SeamPlacer.hpp"
@@ -19,32 +22,154 @@
 
 namespace Slic3r::Seams {
 
-using ObjectPainting = std::map<const PrintObject*, ModelInfo::Painting>;
-
-ObjectLayerPerimeters get_perimeters(
-    SpanOfConstPtrs<PrintObject> objects,
-    const Params &params,
-    const ObjectPainting& object_painting,
-    const std::function<void(void)> &throw_if_canceled
-) {
-    ObjectLayerPerimeters result;
+namespace {
+
+// Hash of everything the precalculated seam data of a single object depends on: the seam
+// parameters, the object transformation, the model volumes with their seam painting, the layer
+// slicing and the perimeter extrusions. Used for reusing the data between G-code exports.
+size_t seam_input_hash(const PrintObject &print_object, const Params &params)
+{
+    size_t seed    = boost::hash<int>{}(int(params.seam_preference));
+    auto   combine = [&seed](const auto value) { boost::hash_combine(seed, value); };
+
+    combine(params.max_nearest_detour);
+    combine(params.rear_tolerance);
+    combine(params.rear_y_offset);
+    combine(params.aligned.max_detour);
+    combine(params.aligned.jump_visibility_threshold);
+    combine(params.aligned.continuity_modifier);
+    combine(params.max_distance);
+    combine(params.random_seed);
+    combine(params.convex_visibility_modifier);
+    combine(params.concave_visibility_modifier);
+    combine(params.perimeter.elephant_foot_compensation);
+    combine(params.perimeter.oversampling_max_distance);
+    combine(params.perimeter.embedding_threshold);
+    combine(params.perimeter.overhang_threshold);
+    combine(params.perimeter.convex_threshold);
+    combine(params.perimeter.concave_threshold);
+    combine(params.perimeter.painting_radius);
+    combine(params.perimeter.simplification_epsilon);
+    combine(params.perimeter.smooth_angle_arm_length);
+    combine(params.perimeter.sharp_angle_arm_length);
+    combine(params.visibility.raycasting_visibility_samples_count);
+    combine(params.visibility.fast_decimation_triangle_count_target);
+    combine(params.visibility.sqr_rays_per_sample_point);
+    combine(params.staggered_inner_seams);
+
+    auto combine_matrix = [&combine](const Transform3d &matrix) {
+        const double *coeffs = matrix.data();
+        for (size_t i = 0; i < 16; ++ i)
+            combine(coeffs[i]);
+    };
+    combine_matrix(print_object.trafo_centered());
+
+    // The model volumes drive both the seam painting and the visibility raycasts. Volume IDs are
+    // unique within a session and geometry edits produce new volumes, so the IDs together with
+    // the painting timestamps identify these inputs.
+    for (const ModelVolume *volume : print_object.model_object()->volumes) {
+        combine(volume->id().id);
+        combine(volume->seam_facets.timestamp());
+        combine_matrix(volume->get_matrix());
+    }
 
-    for (const PrintObject *print_object : objects) {
-        const ModelInfo::Painting &painting{object_painting.at(print_object)};
-        throw_if_canceled();
+    std::function<void(const ExtrusionEntity &)> combine_extrusion =
+        [&combine, &combine_extrusion](const ExtrusionEntity &entity) {
+            if (entity.is_collection()) {
+                for (const ExtrusionEntity *child : static_cast<const ExtrusionEntityCollection &>(entity).entities)
+                    combine_extrusion(*child);
+            } else {
+                for (const Point &point : entity.as_polyline().points) {
+                    combine(point.x());
+                    combine(point.y());
+                }
+            }
+        };
+
+    combine(print_object.slicing_parameters().raft_layers());
+    combine(print_object.layer_count());
+    for (const Layer *layer : print_object.layers()) {
+        combine(layer->print_z);
+        combine(layer->height);
+        for (const LayerRegion *layer_region : layer->regions())
+            for (const ExtrusionEntity *entity : layer_region->perimeters())
+                combine_extrusion(*entity);
+    }
+    return seed;
+}
 
-        const std::vector<Geometry::Extrusions> extrusions{
-            Geometry::get_extrusions(print_object->layers())};
-        const Perimeters::LayerInfos layer_infos{Perimeters::get_layer_infos(
-            print_object->layers(), params.perimeter.elephant_foot_compensation
-        )};
-        const std::vector<Geometry::BoundedPolygons> projected{Geometry::project_to_geometry(extrusions, params.max_distance)};
-        Perimeters::LayerPerimeters perimeters{Perimeters::create_perimeters(projected, layer_infos, painting, params.perimeter)};
+// Seam data computed by Placer::init() for a single object, keyed by seam_input_hash() and kept
+// across G-code exports, so that a re-export with unchanged inputs skips the visibility raycasts
+// and the seam precalculation.
+struct SeamDataCache
+{
+    struct Entry
+    {
+        size_t                                             input_hash{0};
+        // Exactly one of the two is set, depending on the seam preference (part of the hash).
+        std::shared_ptr<const ObjectSeamData>              seams;
+        std::shared_ptr<const Perimeters::LayerPerimeters> perimeters;
+        // For the least recently used eviction.
+        size_t                                             age{0};
+    };
+
+    std::optional<Entry> lookup(const size_t input_hash)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (Entry &entry : m_entries)
+            if (entry.input_hash == input_hash) {
+                entry.age = ++ m_access_counter;
+                return entry;
+            }
+        return std::nullopt;
+    }
 
-        throw_if_canceled();
-        result.emplace(print_object, std::move(perimeters));
+    void insert(Entry &&entry)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const Entry &existing : m_entries)
+            if (existing.input_hash == entry.input_hash)
+                return;
+        if (m_entries.size() >= capacity) {
+            auto it_oldest = std::min_element(m_entries.begin(), m_entries.end(),
+                                              [](const Entry &l, const Entry &r) { return l.age < r.age; });
+            *it_oldest = std::move(entry);
+            it_oldest->age = ++ m_access_counter;
+        } else {
+            m_entries.emplace_back(std::move(entry));
+            m_entries.back().age = ++ m_access_counter;
+        }
     }
-    return result;
+
+private:
+    static constexpr size_t capacity = 8;
+
+    std::mutex         m_mutex;
+    std::vector<Entry> m_entries;
+    size_t             m_access_counter{0};
+};
+
+SeamDataCache seam_data_cache;
+
+} // namespace
+
+Perimeters::LayerPerimeters get_object_perimeters(
+    const PrintObject &print_object,
+    const Params &params,
+    const ModelInfo::Painting &painting,
+    const std::function<void(void)> &throw_if_canceled
+) {
+    throw_if_canceled();
+    const std::vector<Geometry::Extrusions> extrusions{
+        Geometry::get_extrusions(print_object.layers())};
+    const Perimeters::LayerInfos layer_infos{Perimeters::get_layer_infos(
+        print_object.layers(), params.perimeter.elephant_foot_compensation
+    )};
+    const std::vector<Geometry::BoundedPolygons> projected{Geometry::project_to_geometry(extrusions, params.max_distance)};
+    Perimeters::LayerPerimeters perimeters{Perimeters::create_perimeters(projected, layer_infos, painting, params.perimeter)};
+
+    throw_if_canceled();
+    return perimeters;
 }
 
 Perimeters::LayerPerimeters sort_to_layers(Shells::Shells<> &&shells) {
@@ -62,46 +187,44 @@ Perimeters::LayerPerimeters sort_to_layers(Shells::Shells<> &&shells) {
     return result;
 }
 
-ObjectSeams precalculate_seams(
+ObjectSeamData precalculate_object_seams(
+    const PrintObject &print_object,
     const Params &params,
-    ObjectLayerPerimeters &&seam_data,
+    Perimeters::LayerPerimeters &&layer_perimeters,
     const std::function<void(void)> &throw_if_canceled
 ) {
-    ObjectSeams result;
-
-    for (auto &[print_object, layer_perimeters] : seam_data) {
-        switch (params.seam_preference) {
-        case spAligned: {
-            const Transform3d transformation{print_object->trafo_centered()};
-            const ModelVolumePtrs &volumes{print_object->model_object()->volumes};
-
-            Slic3r::ModelInfo::Visibility
-                points_visibility{transformation, volumes, params.visibility, throw_if_canceled};
-            throw_if_canceled();
-            const Aligned::VisibilityCalculator visibility_calculator{
-                points_visibility, params.convex_visibility_modifier,
-                params.concave_visibility_modifier};
-
-            Shells::Shells<> shells{Shells::create_shells(std::move(layer_perimeters), params.max_distance)};
-            result[print_object] = Aligned::get_object_seams(
-                std::move(shells), visibility_calculator, params.aligned
-            );
-            break;
-        }
-        case spRear: {
-            result[print_object] = Rear::get_object_seams(std::move(layer_perimeters), params.rear_tolerance, params.rear_y_offset);
-            break;
-        }
-        case spRandom: {
-            result[print_object] = Random::get_object_seams(std::move(layer_perimeters), params.random_seed);
-            break;
-        }
-        case spNearest: {
-            throw std::runtime_error("Cannot precalculate seams for nearest position!");
-        }
-        }
+    ObjectSeamData result;
+
+    switch (params.seam_preference) {
+    case spAligned: {
+        // Lazily computed per object analysis shared with the other visibility consumers,
+        // kept cached at the PrintObject until its geometry or transformation changes.
+        std::shared_ptr<const Slic3r::ModelInfo::Visibility> points_visibility =
+            print_object.model_visibility(params.visibility, throw_if_canceled);
         throw_if_canceled();
+        const Aligned::VisibilityCalculator visibility_calculator{
+            *points_visibility, params.convex_visibility_modifier,
+            params.concave_visibility_modifier};
+
+        Shells::Shells<> shells{Shells::create_shells(std::move(layer_perimeters), params.max_distance)};
+        result = Aligned::get_object_seams(
+            std::move(shells), visibility_calculator, params.aligned
+        );
+        break;
+    }
+    case spRear: {
+        result = Rear::get_object_seams(std::move(layer_perimeters), params.rear_tolerance, params.rear_y_offset);
+        break;
+    }
+    case spRandom: {
+        result = Random::get_object_seams(std::move(layer_perimeters), params.random_seed);
+        break;
+    }
+    case spNearest: {
+        throw std::runtime_error("Cannot precalculate seams for nearest position!");
+    }
     }
+    throw_if_canceled();
     return result;
 }
 
@@ -151,21 +274,41 @@ void Placer::init(
 ) {
     BOOST_LOG_TRIVIAL(debug) << "SeamPlacer: init: start";
 
-    ObjectPainting object_painting;
+    this->params = params;
+    this->seams_per_object.clear();
+    this->perimeters_per_layer.clear();
+
     for (const PrintObject *print_object : objects) {
-        const Transform3d transformation{print_object->trafo_centered()};
-        const ModelVolumePtrs &volumes{print_object->model_object()->volumes};
-        object_painting.emplace(print_object, ModelInfo::Painting{transformation, volumes});
-    }
+        throw_if_canceled();
 
-    ObjectLayerPerimeters perimeters{get_perimeters(objects, params, object_painting, throw_if_canceled)};
-    this->params = params;
+        const size_t input_hash = seam_input_hash(*print_object, params);
+        if (std::optional<SeamDataCache::Entry> entry = seam_data_cache.lookup(input_hash); entry.has_value()) {
+            // Nothing the seam data depends on changed since the last export, reuse it.
+            BOOST_LOG_TRIVIAL(debug) << "SeamPlacer: init: reusing cached seam data";
+            if (entry->seams)
+                this->seams_per_object.emplace(print_object, std::move(entry->seams));
+            else
+                this->perimeters_per_layer.emplace(print_object, std::move(entry->perimeters));
+            continue;
+        }
 
-    if (this->params.seam_preference != spNearest) {
-        this->seams_per_object =
-            precalculate_seams(params, std::move(perimeters), throw_if_canceled);
-    } else {
-        this->perimeters_per_layer = std::move(perimeters);
+        const Transform3d transformation{print_object->trafo_centered()};
+        const ModelVolumePtrs &volumes{print_object->model_object()->volumes};
+        const ModelInfo::Painting painting{transformation, volumes};
+        Perimeters::LayerPerimeters perimeters{
+            get_object_perimeters(*print_object, params, painting, throw_if_canceled)};
+
+        SeamDataCache::Entry entry;
+        entry.input_hash = input_hash;
+        if (params.seam_preference != spNearest) {
+            entry.seams = std::make_shared<const ObjectSeamData>(
+                precalculate_object_seams(*print_object, params, std::move(perimeters), throw_if_canceled));
+            this->seams_per_object.emplace(print_object, entry.seams);
+        } else {
+            entry.perimeters = std::make_shared<const Perimeters::LayerPerimeters>(std::move(perimeters));
+            this->perimeters_per_layer.emplace(print_object, entry.perimeters);
+        }
+        seam_data_cache.insert(std::move(entry));
     }
 
     BOOST_LOG_TRIVIAL(debug) << "SeamPlacer: init: end";
@@ -361,11 +504,11 @@ Point Placer::place_seam(const Layer *layer, const ExtrusionLoop &loop, const Po
 
 
     if (this->params.seam_preference == spNearest) {
-        const std::vector<Perimeters::BoundedPerimeter> &perimeters{this->perimeters_per_layer.at(po)[layer_index]};
+        const std::vector<Perimeters::BoundedPerimeter> &perimeters{(*this->perimeters_per_layer.at(po))[layer_index]};
         const auto [seam_choice, perimeter_index] = place_seam_near(perimeters, loop, last_pos, this->params.max_nearest_detour);
         return finalize_seam_position(loop_polygon, seam_choice, perimeters[perimeter_index].perimeter, loop_width, do_staggering);
     } else {
-        const std::vector<SeamPerimeterChoice> &seams_on_perimeters{this->seams_per_object.at(po)[layer_index]};
+        const std::vector<SeamPerimeterChoice> &seams_on_perimeters{(*this->seams_per_object.at(po))[layer_index]};
 
         // Special case.
         // If there are only two perimeters and the current perimeter is hole (clockwise).
@@ -21,9 +21,11 @@
 
 namespace Slic3r::Seams {
 
-using ObjectSeams =
-    std::unordered_map<const PrintObject *, std::vector<std::vector<SeamPerimeterChoice>>>;
-using ObjectLayerPerimeters = std::unordered_map<const PrintObject *, Perimeters::LayerPerimeters>;
+using ObjectSeamData = std::vector<std::vector<SeamPerimeterChoice>>;
+// The per-object data is shared with a cache keeping it alive across G-code exports, thus immutable.
+using ObjectSeams = std::unordered_map<const PrintObject *, std::shared_ptr<const ObjectSeamData>>;
+using ObjectLayerPerimeters =
+    std::unordered_map<const PrintObject *, std::shared_ptr<const Perimeters::LayerPerimeters>>;
 
 struct Params
 {
@@ -33,10 +33,16 @@ std::string SpiralVase::process_layer(const std::string &gcode, bool last_layer)
         - each layer is composed by suitable geometry (i.e. a single complete loop)
         - loops were not clipped before calling this method  */
 
+    // Lex the layer into pre-parsed lines once. Both the measurement pass and
+    // the transformation pass below feed on the lexed lines, so the layer text
+    // is tokenized and its numbers are parsed just a single time.
+    std::vector<GCodeReader::GCodeLine> lines;
+    m_reader.lex_buffer(gcode.c_str(), gcode.c_str() + gcode.size(), lines);
+
     // If we're not going to modify G-code, just feed it to the reader
     // in order to update positions.
     if (!m_enabled) {
-        m_reader.parse_buffer(gcode);
+        m_reader.parse_preparsed(lines, [](GCodeReader&, const GCodeReader::GCodeLine&){});
         return gcode;
     }
 
@@ -49,7 +55,7 @@ std::string SpiralVase::process_layer(const std::string &gcode, bool last_layer)
         //FIXME Performance warning: This copies the GCodeConfig of the reader.
         GCodeReader r = m_reader;  // clone
         bool set_z = false;
-        r.parse_buffer(gcode, [&total_layer_length, &layer_height, &z, &set_z]
+        r.parse_preparsed(lines, [&total_layer_length, &layer_height, &z, &set_z]
             (GCodeReader &reader, const GCodeReader::GCodeLine &line) {
             if (line.cmd_is("G1")) {
                 if (line.extruding(reader)) {
@@ -81,8 +87,9 @@ std::string SpiralVase::process_layer(const std::string &gcode, bool last_layer)
     float                               len                      = 0.f;
 
     std::string        new_gcode, transition_gcode;
+    new_gcode.reserve(gcode.size() + gcode.size() / 8);
     std::vector<Vec2f> current_layer;
-    m_reader.parse_buffer(gcode, [z, total_layer_length, layer_height, transition_in, transition_out, smooth_spiral, max_xy_smoothing = m_max_xy_smoothing,
+    m_reader.parse_preparsed(lines, [z, total_layer_length, layer_height, transition_in, transition_out, smooth_spiral, max_xy_smoothing = m_max_xy_smoothing,
                                   &len, &last_point, &new_gcode, &transition_gcode, &current_layer, &previous_layer_distancer]
         (GCodeReader &reader, GCodeReader::GCodeLine line) {
         if (line.cmd_is("G1")) {
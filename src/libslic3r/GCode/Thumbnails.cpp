@@ -5,6 +5,7 @@
 #include "Thumbnails.hpp"
 #include "../miniz_extension.hpp"
 #include "../format.hpp"
+#include "../Execution/ExecutionTBB.hpp"
 
 #include <qoi/qoi.h>
 #include <jpeglib.h>
@@ -124,6 +125,39 @@ std::unique_ptr<CompressedImageBuffer> compress_thumbnail(const ThumbnailData &d
     }
 }
 
+std::vector<CompressedThumbnail> render_and_compress_thumbnails(
+    ThumbnailsGeneratorCallback         &thumbnail_cb,
+    const GCodeThumbnailDefinitionsList &thumbnails_list,
+    const std::function<void()>         &throw_if_canceled)
+{
+    // Render all the requested sizes first. The generator callback renders on
+    // the calling thread and is invoked serially, only the pixel data are
+    // kept around for the encoders.
+    struct Job { GCodeThumbnailsFormat format; ThumbnailData data; };
+    auto jobs = reserve_vector<Job>(thumbnails_list.size());
+    for (const auto &[format, size] : thumbnails_list) {
+        ThumbnailsList thumbnails = thumbnail_cb(ThumbnailsParams{ {size}, true, true, true, true });
+        for (ThumbnailData &data : thumbnails)
+            if (data.is_valid())
+                jobs.emplace_back(Job{format, std::move(data)});
+        throw_if_canceled();
+    }
+
+    // Encode the thumbnails concurrently. All the encoders (PNG through
+    // miniz, JPG through libjpeg with per call state, QOI) are reentrant.
+    std::vector<CompressedThumbnail> out(jobs.size());
+    execution::for_each(ex_tbb, size_t(0), jobs.size(), [&jobs, &out](size_t i) {
+        const Job &job = jobs[i];
+        out[i].width      = job.data.width;
+        out[i].height     = job.data.height;
+        out[i].format     = job.format;
+        out[i].compressed = compress_thumbnail(job.data, job.format);
+    });
+    throw_if_canceled();
+
+    return out;
+}
+
 std::pair<GCodeThumbnailDefinitionsList, ThumbnailErrors> make_and_check_thumbnail_list(const std::string& thumbnails_string, const std::string_view def_ext /*= "PNG"sv*/)
 {
     if (thumbnails_string.empty())
@@ -11,6 +11,7 @@
 
 #include <vector>
 #include <memory>
+#include <functional>
 #include <string_view>
 
 #include <LibBGCode/binarize/binarize.hpp>
@@ -39,6 +40,23 @@ std::unique_ptr<CompressedImageBuffer> compress_thumbnail(const ThumbnailData &d
 
 typedef std::vector<std::pair<GCodeThumbnailsFormat, Vec2d>> GCodeThumbnailDefinitionsList;
 
+struct CompressedThumbnail
+{
+    unsigned int                           width { 0 };
+    unsigned int                           height { 0 };
+    GCodeThumbnailsFormat                  format { GCodeThumbnailsFormat::PNG };
+    std::unique_ptr<CompressedImageBuffer> compressed;
+};
+
+// Render all thumbnails of the list through thumbnail_cb and compress them.
+// The rendering happens serially on the calling thread (the callback is not
+// required to be thread safe), the encoders for the individual sizes run
+// concurrently. Results are returned in the order of the list.
+std::vector<CompressedThumbnail> render_and_compress_thumbnails(
+    ThumbnailsGeneratorCallback         &thumbnail_cb,
+    const GCodeThumbnailDefinitionsList &thumbnails_list,
+    const std::function<void()>         &throw_if_canceled);
+
 using namespace std::literals;
 std::pair<GCodeThumbnailDefinitionsList, ThumbnailErrors> make_and_check_thumbnail_list(const std::string& thumbnails_string, const std::string_view def_ext = "PNG"sv);
 std::pair<GCodeThumbnailDefinitionsList, ThumbnailErrors> make_and_check_thumbnail_list(const ConfigBase &config);
@@ -50,31 +68,28 @@ inline void export_thumbnails_to_file(ThumbnailsGeneratorCallback &thumbnail_cb,
 {
     // Write thumbnails using base64 encoding
     if (thumbnail_cb != nullptr) {
-        for (const auto& [format, size] : thumbnails_list) {
-            static constexpr const size_t max_row_length = 78;
-            ThumbnailsList thumbnails = thumbnail_cb(ThumbnailsParams{ {size}, true, true, true, true });
-            for (const ThumbnailData& data : thumbnails)
-                if (data.is_valid()) {
-                    auto compressed = compress_thumbnail(data, format);
-                    if (compressed->data && compressed->size) {
-                        std::string encoded;
-                        encoded.resize(boost::beast::detail::base64::encoded_size(compressed->size));
-                        encoded.resize(boost::beast::detail::base64::encode((void*)encoded.data(), (const void*)compressed->data, compressed->size));
-
-                        output((boost::format("\n;\n; %s begin %dx%d %d\n") % compressed->tag() % data.width % data.height % encoded.size()).str().c_str());
-
-                        while (encoded.size() > max_row_length) {
-                            output((boost::format("; %s\n") % encoded.substr(0, max_row_length)).str().c_str());
-                            encoded = encoded.substr(max_row_length);
-                        }
-
-                        if (encoded.size() > 0)
-                            output((boost::format("; %s\n") % encoded).str().c_str());
-
-                        output((boost::format("; %s end\n;\n") % compressed->tag()).str().c_str());
-                    }
-                    throw_if_canceled();
+        static constexpr const size_t max_row_length = 78;
+        auto compressed_thumbnails = render_and_compress_thumbnails(thumbnail_cb, thumbnails_list, throw_if_canceled);
+        for (const CompressedThumbnail &thumb : compressed_thumbnails) {
+            const auto &compressed = thumb.compressed;
+            if (compressed && compressed->data && compressed->size) {
+                std::string encoded;
+                encoded.resize(boost::beast::detail::base64::encoded_size(compressed->size));
+                encoded.resize(boost::beast::detail::base64::encode((void*)encoded.data(), (const void*)compressed->data, compressed->size));
+
+                output((boost::format("\n;\n; %s begin %dx%d %d\n") % compressed->tag() % thumb.width % thumb.height % encoded.size()).str().c_str());
+
+                while (encoded.size() > max_row_length) {
+                    output((boost::format("; %s\n") % encoded.substr(0, max_row_length)).str().c_str());
+                    encoded = encoded.substr(max_row_length);
                 }
+
+                if (encoded.size() > 0)
+                    output((boost::format("; %s\n") % encoded).str().c_str());
+
+                output((boost::format("; %s end\n;\n") % compressed->tag()).str().c_str());
+            }
+            throw_if_canceled();
         }
     }
 }
@@ -88,24 +103,21 @@ inline void generate_binary_thumbnails(ThumbnailsGeneratorCallback& thumbnail_cb
     out_thumbnails.clear();
     assert(thumbnail_cb != nullptr);
     if (thumbnail_cb != nullptr) {
-        for (const auto& [format, size] : thumbnails_list) {
-            ThumbnailsList thumbnails = thumbnail_cb(ThumbnailsParams{ {size}, true, true, true, true });
-            for (const ThumbnailData &data : thumbnails)
-                if (data.is_valid()) {
-                    auto compressed = compress_thumbnail(data, format);
-                    if (compressed->data != nullptr && compressed->size > 0) {
-                        ThumbnailBlock& block = out_thumbnails.emplace_back(ThumbnailBlock());
-                        block.params.width = (uint16_t)data.width;
-                        block.params.height = (uint16_t)data.height;
-                        switch (format) {
-                        case GCodeThumbnailsFormat::PNG: { block.params.format = (uint16_t)EThumbnailFormat::PNG; break; }
-                        case GCodeThumbnailsFormat::JPG: { block.params.format = (uint16_t)EThumbnailFormat::JPG; break; }
-                        case GCodeThumbnailsFormat::QOI: { block.params.format = (uint16_t)EThumbnailFormat::QOI; break; }
-                        }
-                        block.data.resize(compressed->size);
-                        memcpy(block.data.data(), compressed->data, compressed->size);
-                    }
+        auto compressed_thumbnails = render_and_compress_thumbnails(thumbnail_cb, thumbnails_list, throw_if_canceled);
+        for (const CompressedThumbnail &thumb : compressed_thumbnails) {
+            const auto &compressed = thumb.compressed;
+            if (compressed && compressed->data != nullptr && compressed->size > 0) {
+                ThumbnailBlock& block = out_thumbnails.emplace_back(ThumbnailBlock());
+                block.params.width = (uint16_t)thumb.width;
+                block.params.height = (uint16_t)thumb.height;
+                switch (thumb.format) {
+                case GCodeThumbnailsFormat::PNG: { block.params.format = (uint16_t)EThumbnailFormat::PNG; break; }
+                case GCodeThumbnailsFormat::JPG: { block.params.format = (uint16_t)EThumbnailFormat::JPG; break; }
+                case GCodeThumbnailsFormat::QOI: { block.params.format = (uint16_t)EThumbnailFormat::QOI; break; }
                 }
+                block.data.resize(compressed->size);
+                memcpy(block.data.data(), compressed->data, compressed->size);
+            }
         }
     }
 }
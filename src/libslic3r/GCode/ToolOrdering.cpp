@@ -225,6 +225,24 @@ void ToolOrdering::initialize_layers(std::vector<coordf_t> &zs)
     return true;
 }
 
+// Variant of is_overriddable() above, deciding from a cached fill island role signature
+// (a single bit of LayerRegion::fill_role_mask()) instead of traversing the extrusions themselves.
+[[nodiscard]] static bool is_overriddable(FillRoleBits signature, const LayerTools& lt, const PrintConfig& print_config, const PrintObject& object, const PrintRegion& region)
+{
+    unsigned int extruder =
+        signature == frbSolidInfill                                   ? lt.solid_infill_extruder(region) :
+        signature == frbInternalInfill || signature == frbSparseInfill ? lt.infill_extruder(region) :
+        // Mixed roles or no role assigned: such an island is assigned the perimeter extruder.
+        lt.perimeter_extruder(region);
+    if (print_config.filament_soluble.get_at(extruder))
+        return false;
+
+    if (object.config().wipe_into_objects)
+        return true;
+
+    return region.config().wipe_into_infill && signature == frbInternalInfill;
+}
+
 // Collect extruders reuqired to print layers.
 void ToolOrdering::collect_extruders(
     const PrintObject                                  &object,
@@ -281,12 +299,12 @@ void ToolOrdering::collect_extruders(
                 bool something_nonoverriddable = true;
 
                 if (m_print_config_ptr) { // in this case complete_objects is false (see ToolOrdering constructors)
-                    something_nonoverriddable = false;
-                    for (const ExtrusionEntity *eec : layerm->perimeters()) // let's check if there are nonoverriddable entities
-                        if (is_overriddable(dynamic_cast<const ExtrusionEntityCollection&>(*eec), layer_tools, *m_print_config_ptr, object, region))
-                            layer_tools.wiping_extrusions_nonconst().set_something_overridable();
-                        else
-                            something_nonoverriddable = true;
+                    // All the perimeter islands share the same role signature: they are never pure
+                    // internal infill, thus whether they may be wiped into depends on the configuration only.
+                    if (! m_print_config_ptr->filament_soluble.get_at(layer_tools.perimeter_extruder(region)) && object.config().wipe_into_objects) {
+                        layer_tools.wiping_extrusions_nonconst().set_something_overridable();
+                        something_nonoverriddable = false;
+                    }
                 }
 
                 if (something_nonoverriddable)
@@ -295,24 +313,20 @@ void ToolOrdering::collect_extruders(
                 layer_tools.has_object = true;
             }
 
-            bool has_infill       = false;
-            bool has_solid_infill = false;
+            // Decide from the role signatures of the fill islands cached at the LayerRegion
+            // when the fills were generated, without traversing the extrusion entities.
+            const uint32_t fill_role_mask    = layerm->fill_role_mask();
+            bool           has_solid_infill  = (fill_role_mask & (frbSolidInfill | frbMixedSolidFirst)) != 0;
+            bool           has_infill        = (fill_role_mask & (frbInternalInfill | frbSparseInfill | frbMixedSparseFirst)) != 0;
             bool something_nonoverriddable = false;
-            for (const ExtrusionEntity *ee : layerm->fills()) {
-                // fill represents infill extrusions of a single island.
-                const auto *fill = dynamic_cast<const ExtrusionEntityCollection*>(ee);
-                ExtrusionRole role = fill->entities.empty() ? ExtrusionRole::None : fill->entities.front()->role();
-                if (role.is_solid_infill())
-                    has_solid_infill = true;
-                else if (role != ExtrusionRole::None)
-                    has_infill = true;
-
-                if (m_print_config_ptr) {
-                    if (is_overriddable(*fill, layer_tools, *m_print_config_ptr, object, region))
-                        layer_tools.wiping_extrusions_nonconst().set_something_overridable();
-                    else
-                        something_nonoverriddable = true;
-                }
+            if (m_print_config_ptr) {
+                for (uint32_t signature = 1; signature <= fill_role_mask; signature <<= 1)
+                    if (fill_role_mask & signature) {
+                        if (is_overriddable(FillRoleBits(signature), layer_tools, *m_print_config_ptr, object, region))
+                            layer_tools.wiping_extrusions_nonconst().set_something_overridable();
+                        else
+                            something_nonoverriddable = true;
+                    }
             }
 
             if (something_nonoverriddable || !m_print_config_ptr) {
@@ -71,7 +71,7 @@ std::string Wipe::wipe(GCodeGenerator &gcodegen, bool toolchange)
             if (! wiped) {
                 wiped = true;
                 gcode += ";" + GCodeProcessor::reserved_tag(GCodeProcessor::ETags::Wipe_Start) + "\n";
-                gcode += gcodegen.writer().set_speed(wipe_speed * 60, {}, gcodegen.enable_cooling_markers() ? ";_WIPE"sv : ""sv);
+                gcodegen.writer().set_speed(gcode, wipe_speed * 60, {}, gcodegen.enable_cooling_markers() ? ";_WIPE"sv : ""sv);
             }
         };
         const double xy_to_e    = this->calc_xy_to_e_ratio(gcodegen.writer().config, extruder.id());
@@ -95,7 +95,7 @@ std::string Wipe::wipe(GCodeGenerator &gcodegen, bool toolchange)
                 done = true;
             } else
                 p = p_quantized;
-            gcode += gcodegen.writer().extrude_to_xy(p, -dE, wipe_retract_comment);
+            gcodegen.writer().extrude_to_xy(gcode, p, -dE, wipe_retract_comment);
             retract_length -= dE;
             return done;
         };
@@ -140,8 +140,8 @@ std::string Wipe::wipe(GCodeGenerator &gcodegen, bool toolchange)
                     // Degenerated arc after quantization. Process it as if it was a line segment.
                     return wipe_linear(prev_quantized, p);
                 // The arc is valid.
-                gcode += gcodegen.writer().extrude_to_xy_G2G3IJ(
-                    p, ij, ccw, -dE, wipe_retract_comment);
+                gcodegen.writer().extrude_to_xy_G2G3IJ(
+                    gcode, p, ij, ccw, -dE, wipe_retract_comment);
             }
             retract_length -= dE;
             return done;
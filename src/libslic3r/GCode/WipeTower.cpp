@@ -1646,9 +1646,29 @@ void WipeTower::generate(std::vector<std::vector<WipeTower::ToolChangeResult>> &
         return;
 
 	plan_tower();
+    // Snapshot of the planned depths and wipe volumes, to detect the fixed point of the iteration below.
+    auto tower_plan_snapshot = [this]() {
+        std::vector<float> snapshot;
+        for (const WipeTowerInfo &layer : m_plan) {
+            snapshot.emplace_back(layer.depth);
+            for (const WipeTowerInfo::ToolChange &toolchange : layer.tool_changes) {
+                snapshot.emplace_back(toolchange.required_depth);
+                snapshot.emplace_back(toolchange.wipe_volume);
+            }
+        }
+        return snapshot;
+    };
+    // Each round of save_on_last_wipe() simulates the full tower G-code just to measure extrusion
+    // lengths, which dominates the generation time on multi-tool prints. The fixed point is
+    // usually reached after a round or two, so stop as soon as the plan stops changing.
+    std::vector<float> last_snapshot = tower_plan_snapshot();
     for (int i = 0; i<5; ++i) {
         save_on_last_wipe();
         plan_tower();
+        std::vector<float> snapshot = tower_plan_snapshot();
+        if (snapshot == last_snapshot)
+            break;
+        last_snapshot = std::move(snapshot);
     }
 
     m_layer_info = m_plan.begin();
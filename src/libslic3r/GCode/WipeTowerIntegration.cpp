@@ -68,7 +68,7 @@ std::string WipeTowerIntegration::append_tcr(GCodeGenerator &gcodegen, const Wip
                     *gcodegen.last_position, xy_point, ExtrusionRole::Mixed, comment, [](){return "";}
                 );
             } else {
-                gcode += gcodegen.writer().travel_to_xy(gcodegen.point_to_gcode(xy_point), comment);
+                gcodegen.writer().travel_to_xy(gcode, gcodegen.point_to_gcode(xy_point), comment);
                 gcode += gcodegen.writer().get_travel_to_z_gcode(z, comment);
             }
         } else {
@@ -5,6 +5,9 @@
 #include "GCodeReader.hpp"
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/algorithm/string/split.hpp>
+#include <boost/filesystem/path.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <boost/nowide/convert.hpp>
 #include <boost/nowide/fstream.hpp>
 #include <boost/nowide/cstdio.hpp>
 #include <fstream>
@@ -12,6 +15,10 @@
 #include <iomanip>
 #include "Utils.hpp"
 
+#ifndef _WIN32
+    #include <sys/mman.h>
+#endif
+
 #include "LocalesUtils.hpp"
 
 #include <fast_float/fast_float.h>
@@ -113,7 +120,7 @@ const char* GCodeReader::parse_line_internal(const char *ptr, const char *end, G
     return c;
 }
 
-void GCodeReader::update_coordinates(GCodeLine &gline, std::pair<const char*, const char*> &command)
+void GCodeReader::update_coordinates(const GCodeLine &gline, std::pair<const char*, const char*> &command)
 {
     if (*command.first == 'G') {
         int cmd_len = int(command.second - command.first);
@@ -126,6 +133,27 @@ void GCodeReader::update_coordinates(GCodeLine &gline, std::pair<const char*, co
     }
 }
 
+void GCodeReader::update_coordinates(const GCodeLine &gline)
+{
+    const char *cmd_begin = skip_whitespaces(gline.raw().c_str());
+    std::pair<const char*, const char*> command { cmd_begin, skip_word(cmd_begin) };
+    this->update_coordinates(gline, command);
+}
+
+void GCodeReader::lex_buffer(const char *begin, const char *end, std::vector<GCodeLine> &lines) const
+{
+    // parse_line_internal() clears the E position as a side effect when lexing a line with
+    // relative E distances. Lex with a throwaway copy of this reader, so that this reader
+    // stays untouched and its position is updated by parse_preparsed() only.
+    GCodeReader reader = *this;
+    std::pair<const char*, const char*> command;
+    const char *ptr = begin;
+    while (ptr != end && *ptr != 0) {
+        GCodeLine &gline = lines.emplace_back();
+        ptr = reader.parse_line_internal(ptr, end, gline, command);
+    }
+}
+
 template<typename ParseLineCallback, typename LineEndCallback>
 bool GCodeReader::parse_file_raw_internal(const std::string &filename, ParseLineCallback parse_line_callback, LineEndCallback line_end_callback)
 {
@@ -189,16 +217,115 @@ bool GCodeReader::parse_file_raw_internal(const std::string &filename, ParseLine
     return true;
 }
 
+// Parse the file memory mapped, calling parse_line_callback(begin, end) with spans into the mapping
+// for each line without copying and line_end_callback with the file position just after each line end.
+// Returns false without parsing anything if the file cannot be memory mapped (for example an empty
+// file), in which case the caller shall fall back to parse_file_raw_internal().
+template<typename ParseLineCallback, typename LineEndCallback>
+bool GCodeReader::parse_file_mapped_internal(const std::string &filename, ParseLineCallback parse_line_callback, LineEndCallback line_end_callback)
+{
+    boost::iostreams::mapped_file_source map;
+    try {
+#ifdef _WIN32
+        map.open(boost::filesystem::path(boost::nowide::widen(filename)));
+#else
+        map.open(filename);
+#endif
+    } catch (const std::exception&) {
+        return false;
+    }
+    if (! map.is_open())
+        return false;
+
+    const char  *begin     = map.data();
+    const char  *end       = begin + map.size();
+    const size_t file_size = map.size();
+#ifdef POSIX_MADV_SEQUENTIAL
+    // We will touch every page of the mapping in order, ask the kernel for aggressive readahead.
+    posix_madvise(const_cast<char*>(begin), file_size, POSIX_MADV_SEQUENTIAL);
+#endif
+#ifdef POSIX_MADV_WILLNEED
+    // Prefetch window, advanced incrementally as the parser approaches its boundary, so that pages
+    // are being faulted in (on NFS: transferred) while the previous window is still being parsed.
+    constexpr size_t readahead_window = 16 * 1024 * 1024;
+    size_t           next_readahead   = 0;
+    auto prefetch = [begin, file_size, &next_readahead](size_t pos) {
+        if (pos + readahead_window / 2 >= next_readahead && next_readahead < file_size) {
+            posix_madvise(const_cast<char*>(begin) + next_readahead, std::min(size_t(readahead_window), file_size - next_readahead), POSIX_MADV_WILLNEED);
+            next_readahead += readahead_window;
+        }
+    };
+#else
+    auto prefetch = [](size_t) {};
+#endif
+    // Cadence of the progress callback, matching the buffer size of parse_file_raw_internal().
+    constexpr size_t progress_step = 65536 * 10;
+    size_t           next_progress = progress_step;
+
+    // The line parsers expect an end of line character or a NUL to stop at, which the mapping does
+    // not guarantee at its very end. Unless the file ends with a newline, the trailing line is
+    // parsed from a terminated copy, while all the lines before it stop at the trailing newline
+    // at the latest.
+    const char *tail = end;
+    if (file_size > 0 && end[-1] != '\n') {
+        for (tail = end; tail != begin && tail[-1] != '\n'; -- tail) ;
+    }
+
+    m_parsing = true;
+    const char *ptr = begin;
+    while (m_parsing && ptr != tail) {
+        prefetch(size_t(ptr - begin));
+        // Find the end of line. Bounded by the newline at tail[-1].
+        const char *it = ptr;
+        for (; *it != '\r' && *it != '\n'; ++ it) ;
+        parse_line_callback(ptr, it);
+        if (! m_parsing)
+            // The callback wishes to exit.
+            return true;
+        // Skip the end of line.
+        if (*it == '\r')
+            ++ it;
+        if (*it == '\n') {
+            line_end_callback(size_t(it - begin) + 1);
+            ++ it;
+        }
+        ptr = it;
+        if (m_progress_callback != nullptr && size_t(ptr - begin) >= next_progress) {
+            m_progress_callback(static_cast<float>(ptr - begin) / static_cast<float>(file_size));
+            next_progress += progress_step;
+        }
+    }
+
+    if (m_parsing && tail != end) {
+        // Parse the trailing line missing the end of line character from a NUL terminated copy.
+        std::string last_line(tail, end);
+        const char *p  = last_line.c_str();
+        const char *pe = p + last_line.size();
+        while (m_parsing && p != pe) {
+            const char *it = p;
+            for (; it != pe && *it != '\r' && *it != '\n'; ++ it) ;
+            parse_line_callback(p, it);
+            if (! m_parsing)
+                return true;
+            if (*it == '\r')
+                ++ it;
+            p = it;
+        }
+    }
+    return true;
+}
+
 template<typename ParseLineCallback, typename LineEndCallback>
 bool GCodeReader::parse_file_internal(const std::string &filename, ParseLineCallback parse_line_callback, LineEndCallback line_end_callback)
 {
-    GCodeLine gline;    
-    return this->parse_file_raw_internal(filename, 
-        [this, &gline, parse_line_callback](const char *begin, const char *end) {
+    GCodeLine gline;
+    auto parse_raw_line = [this, &gline, parse_line_callback](const char *begin, const char *end) {
             gline.reset();
             this->parse_line(begin, end, gline, parse_line_callback);
-        }, 
-        line_end_callback);
+        };
+    // Prefer parsing the file memory mapped, fall back to buffered reads if it cannot be mapped.
+    return this->parse_file_mapped_internal(filename, parse_raw_line, line_end_callback) ||
+           this->parse_file_raw_internal(filename, parse_raw_line, line_end_callback);
 }
 
 bool GCodeReader::parse_file(const std::string &file, callback_t callback)
@@ -215,9 +342,10 @@ bool GCodeReader::parse_file(const std::string& file, callback_t callback, std::
 
 bool GCodeReader::parse_file_raw(const std::string &filename, raw_line_callback_t line_callback)
 {
-    return this->parse_file_raw_internal(filename,
-        [this, line_callback](const char *begin, const char *end) { line_callback(*this, begin, end); }, 
-        [](size_t){});
+    auto parse_raw_line = [this, line_callback](const char *begin, const char *end) { line_callback(*this, begin, end); };
+    // Prefer parsing the file memory mapped, fall back to buffered reads if it cannot be mapped.
+    return this->parse_file_mapped_internal(filename, parse_raw_line, [](size_t){}) ||
+           this->parse_file_raw_internal(filename, parse_raw_line, [](size_t){});
 }
 
 const char* GCodeReader::axis_pos(const char *raw_str, char axis)
@@ -11,6 +11,7 @@
 #include <functional>
 #include <string>
 #include <string_view>
+#include <vector>
 #include "PrintConfig.hpp"
 
 namespace Slic3r {
@@ -124,6 +125,27 @@ public:
     void parse_buffer(const std::string &buffer)
         { this->parse_buffer(buffer, [](GCodeReader&, const GCodeReader::GCodeLine&){}); }
 
+    // Lex a complete, NUL terminated buffer into pre-parsed lines without updating the position
+    // of this reader. Only the reader configuration is accessed, thus chunks of a single G-code
+    // stream may be lexed concurrently by multiple threads sharing one configured reader.
+    void lex_buffer(const char *begin, const char *end, std::vector<GCodeLine> &lines) const;
+
+    // Feed lines pre-parsed by lex_buffer() to the callback, updating the reader position
+    // in between the same way parse_buffer() does.
+    template<typename Callback>
+    void parse_preparsed(const std::vector<GCodeLine> &lines, Callback callback)
+    {
+        m_parsing = true;
+        for (const GCodeLine &gline : lines) {
+            if (! m_parsing)
+                break;
+            if (gline.has(E) && m_config.use_relative_e_distances)
+                m_position[E] = 0;
+            callback(*this, gline);
+            this->update_coordinates(gline);
+        }
+    }
+
     template<typename Callback>
     const char* parse_line(const char *ptr, const char *end, GCodeLine &gline, Callback &callback)
     {
@@ -172,10 +194,14 @@ private:
     template<typename ParseLineCallback, typename LineEndCallback>
     bool        parse_file_raw_internal(const std::string &filename, ParseLineCallback parse_line_callback, LineEndCallback line_end_callback);
     template<typename ParseLineCallback, typename LineEndCallback>
+    bool        parse_file_mapped_internal(const std::string &filename, ParseLineCallback parse_line_callback, LineEndCallback line_end_callback);
+    template<typename ParseLineCallback, typename LineEndCallback>
     bool        parse_file_internal(const std::string &filename, ParseLineCallback parse_line_callback, LineEndCallback line_end_callback);
 
     const char* parse_line_internal(const char *ptr, const char *end, GCodeLine &gline, std::pair<const char*, const char*> &command);
-    void        update_coordinates(GCodeLine &gline, std::pair<const char*, const char*> &command);
+    void        update_coordinates(const GCodeLine &gline, std::pair<const char*, const char*> &command);
+    // Variant for pre-parsed lines, locating the command token in gline.raw().
+    void        update_coordinates(const GCodeLine &gline);
 
     static bool         is_whitespace(char c)           { return c == ' ' || c == '\t'; }
     static bool         is_end_of_line(char c)          { return c == '\r' || c == '\n' || c == 0; }
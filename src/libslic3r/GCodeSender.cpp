@@ -55,11 +55,20 @@ std::fstream fs;
 
 #define KEEP_SENT 20
 
+// Number of lines sent ahead of the firmware acknowledgments. Keeps the firmware's
+// receive buffer busy on fast moves instead of stalling on each ack round-trip.
+// Must be smaller than KEEP_SENT so that a resend request can always be satisfied.
+#define SEND_WINDOW 4
+
+// Bounds of the lookahead queue when streaming from a file, see GCodeSender::send_file().
+#define QUEUE_LOW_WATER 256
+#define QUEUE_HIGH_WATER 1024
+
 namespace Slic3r {
 
 GCodeSender::GCodeSender()
-    : io(), serial(io), can_send(false), sent(0), open(false), error(false),
-      connected(false), queue_paused(false)
+    : io(), serial(io), can_send(false), inflight(0), write_in_progress(false),
+      sent(0), open(false), error(false), connected(false), queue_paused(false)
 {
 #ifdef DEBUG_SERIAL
     std::srand(std::time(nullptr));
@@ -102,6 +111,8 @@ GCodeSender::connect(std::string devname, unsigned int baud_rate)
     // a reset firmware expect line numbers to start again from 1
     this->sent = 0;
     this->last_sent.clear();
+    this->inflight = 0;
+    this->write_in_progress = false;
 
     /* Initialize debugger */
 #ifdef DEBUG_SERIAL
@@ -237,9 +248,10 @@ GCodeSender::purge_queue(bool priority)
         std::list<std::string> empty;
         std::swap(this->priqueue, empty);
     } else {
-        // clear queue
+        // clear queue and stop streaming from the source file
         std::queue<std::string> empty;
         std::swap(this->queue, empty);
+        this->source_file.reset();
         this->queue_paused = false;
     }
 }
@@ -357,12 +369,15 @@ GCodeSender::on_read(const boost::system::error_code& error,
             {
                 boost::lock_guard<boost::mutex> l(this->queue_mutex);
                 this->can_send = true;
+                this->inflight = 0;
             }
             this->send();
         } else if (boost::starts_with(line, "ok")) {
             {
                 boost::lock_guard<boost::mutex> l(this->queue_mutex);
                 this->can_send = true;
+                if (this->inflight > 0)
+                    -- this->inflight;
             }
             this->send();
         } else if (boost::istarts_with(line, "resend")  // Marlin uses "Resend: "
@@ -396,6 +411,8 @@ GCodeSender::on_read(const boost::system::error_code& error,
                     // start resending with the requested line number
                     this->sent = toresend - 1;
                     this->can_send = true;
+                    // the firmware discarded everything from the requested line on
+                    this->inflight = 0;
                 }
                 this->send();
             } else {
@@ -460,6 +477,35 @@ GCodeSender::send(const std::string &line, bool priority)
     this->send();
 }
 
+bool
+GCodeSender::send_file(const std::string &path)
+{
+    {
+        boost::lock_guard<boost::mutex> l(this->queue_mutex);
+        auto file = std::make_unique<boost::nowide::ifstream>(path);
+        if (!file->good()) return false;
+        this->source_file = std::move(file);
+        this->refill_queue();
+    }
+    this->send();
+    return true;
+}
+
+// Top up the lookahead queue from the source file.
+// The caller is responsible for holding queue_mutex.
+void
+GCodeSender::refill_queue()
+{
+    if (!this->source_file || this->queue.size() >= QUEUE_LOW_WATER) return;
+    std::string line;
+    while (this->queue.size() < QUEUE_HIGH_WATER && std::getline(*this->source_file, line))
+        this->queue.push(line);
+    if (!this->source_file->good()) {
+        // whole file was read (or it turned unreadable), close it
+        this->source_file.reset();
+    }
+}
+
 void
 GCodeSender::send()
 {
@@ -470,10 +516,13 @@ void
 GCodeSender::do_send()
 {
     boost::lock_guard<boost::mutex> l(this->queue_mutex);
-    
-    // printer is not connected or we're still waiting for the previous ack
-    if (!this->can_send) return;
-    
+
+    // printer is not connected, the send window is full or a write is still pending
+    if (!this->can_send || this->inflight >= SEND_WINDOW || this->write_in_progress) return;
+
+    // top up the lookahead queue from the source file before draining it
+    this->refill_queue();
+
     std::string line;
     while (!this->priqueue.empty() || (!this->queue.empty() && !this->queue_paused)) {
         if (!this->priqueue.empty()) {
@@ -521,8 +570,9 @@ GCodeSender::do_send()
 #endif
     
     this->last_sent.push_back(line);
-    this->can_send = false;
-    
+    ++ this->inflight;
+    this->write_in_progress = true;
+
     while (this->last_sent.size() > KEEP_SENT) {
         this->last_sent.pop_front();
     }
@@ -540,6 +590,10 @@ GCodeSender::on_write(const boost::system::error_code& error,
     size_t bytes_transferred)
 {
     this->set_error_status(false);
+    {
+        boost::lock_guard<boost::mutex> l(this->queue_mutex);
+        this->write_in_progress = false;
+    }
     if (error) {
         if (this->open) {
             this->do_close();
@@ -547,7 +601,7 @@ GCodeSender::on_write(const boost::system::error_code& error,
         }
         return;
     }
-    
+
     this->do_send();
 }
 
@@ -7,11 +7,13 @@
 #define slic3r_GCodeSender_hpp_
 
 #include "libslic3r.h"
+#include <memory>
 #include <queue>
 #include <string>
 #include <vector>
 #include <boost/asio.hpp>
 #include <boost/bind/bind.hpp>
+#include <boost/nowide/fstream.hpp>
 #include <boost/thread.hpp>
 
 namespace Slic3r {
@@ -25,6 +27,11 @@ class GCodeSender : private boost::noncopyable {
     bool connect(std::string devname, unsigned int baud_rate);
     void send(const std::vector<std::string> &lines, bool priority = false);
     void send(const std::string &s, bool priority = false);
+    // Stream a G-code file from disk instead of queueing all of its lines in memory.
+    // The queue acts as a bounded lookahead buffer which is topped up from the file
+    // as lines are sent. Returns false if the file could not be opened.
+    // Lines queued by send() with priority = true are still injected ahead of the file.
+    bool send_file(const std::string &path);
     void disconnect();
     bool error_status() const;
     bool is_connected() const;
@@ -49,11 +56,17 @@ class GCodeSender : private boost::noncopyable {
     bool error;
     mutable boost::mutex error_mutex;
     
-    // this mutex guards queue, priqueue, can_send, queue_paused, sent, last_sent
+    // this mutex guards queue, priqueue, source_file, can_send, inflight, write_in_progress, queue_paused, sent, last_sent
     mutable boost::mutex queue_mutex;
     std::queue<std::string> queue;
     std::list<std::string> priqueue;
+    // File the queue is topped up from, see send_file()
+    std::unique_ptr<boost::nowide::ifstream> source_file;
     bool can_send;
+    // number of sent lines not yet acknowledged by the firmware
+    size_t inflight;
+    // whether an async_write on write_buffer is pending
+    bool write_in_progress;
     bool queue_paused;
     size_t sent;
     std::deque<std::string> last_sent;
@@ -65,6 +78,7 @@ class GCodeSender : private boost::noncopyable {
     
     void set_baud_rate(unsigned int baud_rate);
     void set_error_status(bool e);
+    void refill_queue();
     void do_send();
     void on_write(const boost::system::error_code& error, size_t bytes_transferred);
     void do_close();
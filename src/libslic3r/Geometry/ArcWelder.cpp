@@ -100,22 +100,29 @@ static inline bool circle_approximation_sufficient(const Circle &circle, const P
     assert(std::abs((*begin - circle.center).cast<double>().norm() - circle.radius) < SCALED_EPSILON);
     assert(std::abs((*std::prev(end) - circle.center).cast<double>().norm() - circle.radius) < SCALED_EPSILON);
     assert(end - begin >= 3);
+    assert(circle.radius >= 0);
+
+    // Compare the squared distances from the circle center against a squared band around the circle
+    // radius, which avoids evaluating a square root for each tested point and lets the compiler
+    // vectorize the distance test.
+    const double radius_min2 = sqr(std::max(0., circle.radius - tolerance));
+    const double radius_max2 = sqr(circle.radius + tolerance);
+    auto outside_tolerance_band = [&circle, radius_min2, radius_max2](const Point &pt) {
+        double distance_from_center2 = (pt - circle.center).cast<double>().squaredNorm();
+        return distance_from_center2 < radius_min2 || distance_from_center2 > radius_max2;
+    };
 
     // Test the 1st point.
-    if (double distance_from_center = (*begin - circle.center).cast<double>().norm();
-        std::abs(distance_from_center - circle.radius) > tolerance)
+    if (outside_tolerance_band(*begin))
         return false;
 
     for (auto it = std::next(begin); it != end; ++ it) {
-        if (double distance_from_center = (*it - circle.center).cast<double>().norm();
-            std::abs(distance_from_center - circle.radius) > tolerance)
+        if (outside_tolerance_band(*it))
             return false;
         Point closest_point;
-        if (foot_pt_on_segment(*std::prev(it), *it, circle.center, closest_point)) {
-            if (double distance_from_center = (closest_point - circle.center).cast<double>().norm();
-                std::abs(distance_from_center - circle.radius) > tolerance)
-                return false;
-        }
+        if (foot_pt_on_segment(*std::prev(it), *it, circle.center, closest_point) &&
+            outside_tolerance_band(closest_point))
+            return false;
     }
     return true;
 }
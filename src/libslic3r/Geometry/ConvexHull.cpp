@@ -6,6 +6,7 @@
 #include "ConvexHull.hpp"
 #include "BoundingBox.hpp"
 #include "../Geometry.hpp"
+#include "../RadixSort.hpp"
 
 #include <boost/multiprecision/integer.hpp>
 
@@ -14,8 +15,7 @@ namespace Slic3r { namespace Geometry {
 // This implementation is based on Andrew's monotone chain 2D convex hull algorithm
 Polygon convex_hull(Points pts)
 {
-    std::sort(pts.begin(), pts.end(), [](const Point& a, const Point& b) { return a.x() < b.x() || (a.x() == b.x() && a.y() < b.y()); });
-    pts.erase(std::unique(pts.begin(), pts.end(), [](const Point& a, const Point& b) { return a.x() == b.x() && a.y() == b.y(); }), pts.end());
+    radix_sort_remove_duplicate_points(pts);
 
     Polygon hull;
     int n = (int)pts.size();
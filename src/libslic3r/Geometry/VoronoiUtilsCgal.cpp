@@ -6,6 +6,9 @@
 #include <CGAL/Arr_segment_traits_2.h>
 #include <CGAL/Surface_sweep_2_algorithms.h>
 
+#include <atomic>
+#include <tbb/parallel_for.h>
+
 #include "libslic3r/Geometry/Voronoi.hpp"
 #include "libslic3r/Geometry/VoronoiUtils.hpp"
 #include "libslic3r/Arachne/utils/PolygonsSegmentIndex.hpp"
@@ -298,31 +301,45 @@ VoronoiUtilsCgal::is_voronoi_diagram_planar_angle(const VD             &voronoi_
                                                   const SegmentIterator segment_begin,
                                                   const SegmentIterator segment_end)
 {
-    for (const VD::vertex_type &vertex : voronoi_diagram.vertices()) {
-        std::vector<const VD::edge_type *> edges;
-        const VD::edge_type               *edge = vertex.incident_edge();
-
-        do {
-            if (edge->is_finite() && edge->vertex0() != nullptr && edge->vertex1() != nullptr && VoronoiUtils::is_finite(*edge->vertex0()) && VoronoiUtils::is_finite(*edge->vertex1()))
-                edges.emplace_back(edge);
-
-            edge = edge->rot_next();
-        } while (edge != vertex.incident_edge());
+    // Every vertex is validated independently and the diagram is read-only here,
+    // so the vertices are checked in parallel. The filtered kernel already falls
+    // back to exact arithmetic only for the rare uncertain orientation tests.
+    std::atomic<bool> is_planar = true;
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, voronoi_diagram.vertices().size()),
+    [&voronoi_diagram, &segment_begin, &segment_end, &is_planar](const tbb::blocked_range<size_t> &range) {
+        if (!is_planar.load(std::memory_order_relaxed))
+            return;
 
-        // Checking for CCW make sense for three and more edges.
-        if (edges.size() > 2) {
-            for (auto edge_it = edges.begin() ; edge_it != edges.end(); ++edge_it) {
-                const VD::edge_type *prev_edge = edge_it == edges.begin() ? edges.back() : *std::prev(edge_it);
-                const VD::edge_type *curr_edge = *edge_it;
-                const VD::edge_type *next_edge = std::next(edge_it) == edges.end() ? edges.front() : *std::next(edge_it);
-
-                if (!check_if_three_edges_are_ccw(*prev_edge, *curr_edge, *next_edge, segment_begin, segment_end))
-                    return false;
+        std::vector<const VD::edge_type *> edges;
+        for (size_t vertex_idx = range.begin(); vertex_idx < range.end(); ++vertex_idx) {
+            const VD::vertex_type &vertex = voronoi_diagram.vertices()[vertex_idx];
+            edges.clear();
+            const VD::edge_type *edge = vertex.incident_edge();
+
+            do {
+                if (edge->is_finite() && edge->vertex0() != nullptr && edge->vertex1() != nullptr && VoronoiUtils::is_finite(*edge->vertex0()) && VoronoiUtils::is_finite(*edge->vertex1()))
+                    edges.emplace_back(edge);
+
+                edge = edge->rot_next();
+            } while (edge != vertex.incident_edge());
+
+            // Checking for CCW make sense for three and more edges.
+            if (edges.size() > 2) {
+                for (auto edge_it = edges.begin() ; edge_it != edges.end(); ++edge_it) {
+                    const VD::edge_type *prev_edge = edge_it == edges.begin() ? edges.back() : *std::prev(edge_it);
+                    const VD::edge_type *curr_edge = *edge_it;
+                    const VD::edge_type *next_edge = std::next(edge_it) == edges.end() ? edges.front() : *std::next(edge_it);
+
+                    if (!check_if_three_edges_are_ccw(*prev_edge, *curr_edge, *next_edge, segment_begin, segment_end)) {
+                        is_planar.store(false, std::memory_order_relaxed);
+                        return;
+                    }
+                }
             }
         }
-    }
+    });
 
-    return true;
+    return is_planar.load(std::memory_order_relaxed);
 }
 
 } // namespace Slic3r::Geometry
\ No newline at end of file
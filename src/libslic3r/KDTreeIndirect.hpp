@@ -11,6 +11,8 @@
 #include <limits>
 #include <vector>
 
+#include <tbb/parallel_invoke.h>
+
 #include "Utils.hpp" // for next_highest_power_of_2()
 
 namespace Slic3r {
@@ -31,7 +33,9 @@ public:
     using					CoordType     = ACoordType;
     // Following could be static constexpr size_t, but that would not link in C++11
     enum : size_t {
-        npos = size_t(-1)
+        npos = size_t(-1),
+        // Subtrees of up to this size are built sequentially inside a parallel build.
+        build_parallel_min_size = 16384
     };
 
     KDTreeIndirect(CoordinateFn coordinate) : coordinate(coordinate) {}
@@ -106,9 +110,19 @@ private:
         size_t next_dimension = dimension;
         if (++ next_dimension == NumDimensions)
             next_dimension = 0;
-        if (center > left)
-            build_recursive(input, node * 2 + 1, next_dimension, left, center - 1);
-        build_recursive(input, node * 2 + 2, next_dimension, center + 1, right);
+        // The subtrees work on disjoint ranges of the input and disjoint ranges of m_nodes,
+        // thus they may be built in parallel. Small subtrees are built sequentially, as spawning
+        // a task costs more than the build itself; thousands of small per-layer trees are instead
+        // expected to be built by a parallel loop at the caller side, one tree per task.
+        if (center > left && right - left > build_parallel_min_size) {
+            tbb::parallel_invoke(
+                [this, &input, node, next_dimension, left, center]  { this->build_recursive(input, node * 2 + 1, next_dimension, left, center - 1); },
+                [this, &input, node, next_dimension, center, right] { this->build_recursive(input, node * 2 + 2, next_dimension, center + 1, right); });
+        } else {
+            if (center > left)
+                build_recursive(input, node * 2 + 1, next_dimension, left, center - 1);
+            build_recursive(input, node * 2 + 2, next_dimension, center + 1, right);
+        }
     }
 
        // Partition the input m_nodes <left, right> at "k" and "dimension" using the QuickSelect method:
@@ -56,18 +56,113 @@ void Layer::make_slices()
             // optimization: if we only have one region, take its slices
             slices = to_expolygons(m_regions.front()->slices().surfaces);
         } else {
+            // Count the contours first, so that the merged polygon set is allocated just once.
+            size_t num_polygons = 0;
+            for (const LayerRegion *layerm : m_regions)
+                for (const Surface &surface : layerm->slices().surfaces)
+                    num_polygons += surface.expolygon.num_contours();
             Polygons slices_p;
-            for (LayerRegion *layerm : m_regions)
-                polygons_append(slices_p, to_polygons(layerm->slices().surfaces));
-            slices = union_safety_offset_ex(slices_p);
+            slices_p.reserve(num_polygons);
+            for (const LayerRegion *layerm : m_regions)
+                for (const Surface &surface : layerm->slices().surfaces) {
+                    slices_p.emplace_back(surface.expolygon.contour);
+                    polygons_append(slices_p, surface.expolygon.holes);
+                }
+            slices = union_safety_offset_ex_parallel(slices_p);
         }
         // lslices are sorted by topological order from outside to inside from the clipper union used above
-        this->lslices = slices;
+        this->lslices = std::move(slices);
     }
+    this->invalidate_lslices_index();
 
     this->lslice_indices_sorted_by_print_order = chain_expolygons(this->lslices);
 }
 
+// Visit the leaves of the implicit AABB tree: descend into the nodes whose bounding box
+// satisfies pred, call leaf_fn on the matching leaves.
+template<typename TreeType, typename PredFn, typename LeafFn>
+static void visit_aabb_tree_leaves(const TreeType &tree, PredFn &&pred, LeafFn &&leaf_fn)
+{
+    std::vector<size_t> stack;
+    stack.reserve(32);
+    stack.emplace_back(0);
+    while (! stack.empty()) {
+        size_t node_idx = stack.back();
+        stack.pop_back();
+        const auto &node = tree.node(node_idx);
+        if (! node.is_valid() || ! pred(node.bbox))
+            continue;
+        if (node.is_leaf())
+            leaf_fn(node);
+        else {
+            stack.emplace_back(TreeType::left_child_idx(node_idx));
+            stack.emplace_back(TreeType::right_child_idx(node_idx));
+        }
+    }
+}
+
+void LayerSlicesIndex::build(const ExPolygons &lslices)
+{
+    m_lslices = &lslices;
+    using TreeBoundingBox = AABBTreeIndirect::Tree<2, coord_t>::BoundingBox;
+    struct InputNode {
+        size_t                  m_idx;
+        TreeBoundingBox         m_bbox;
+        Vec2crd                 m_centroid;
+        size_t                  idx() const { return m_idx; }
+        const TreeBoundingBox&  bbox() const { return m_bbox; }
+        const Vec2crd&          centroid() const { return m_centroid; }
+    };
+    std::vector<InputNode> input;
+    input.reserve(lslices.size());
+    for (size_t i = 0; i < lslices.size(); ++ i) {
+        const BoundingBox bbox = get_extents(lslices[i]);
+        input.push_back({ i, TreeBoundingBox(bbox.min, bbox.max), Vec2crd((bbox.min + bbox.max) / 2) });
+    }
+    m_tree.build(std::move(input));
+}
+
+int32_t LayerSlicesIndex::slice_idx_containing(const Point &pt, bool contour_only) const
+{
+    int32_t found_idx = -1;
+    if (! m_tree.empty())
+        visit_aabb_tree_leaves(m_tree,
+            [&pt](const auto &bbox) { return bbox.contains(pt); },
+            [this, &pt, contour_only, &found_idx](const auto &node) {
+                if (int32_t(node.idx) > found_idx) {
+                    const ExPolygon &expoly = (*m_lslices)[node.idx];
+                    if (contour_only ? expoly.contour.contains(pt) : expoly.contains(pt))
+                        found_idx = int32_t(node.idx);
+                }
+            });
+    return found_idx;
+}
+
+std::vector<uint32_t> LayerSlicesIndex::slice_indices_overlapping(const BoundingBox &bbox) const
+{
+    std::vector<uint32_t> out;
+    if (! m_tree.empty()) {
+        const AABBTreeIndirect::Tree<2, coord_t>::BoundingBox query(bbox.min, bbox.max);
+        visit_aabb_tree_leaves(m_tree,
+            [&query](const auto &node_bbox) { return query.intersects(node_bbox); },
+            [&out](const auto &node) { out.emplace_back(uint32_t(node.idx)); });
+        std::sort(out.begin(), out.end());
+    }
+    return out;
+}
+
+const LayerSlicesIndex& Layer::lslices_index() const
+{
+    if (! m_lslices_index_built.load(std::memory_order_acquire)) {
+        std::scoped_lock<std::mutex> lock(m_lslices_index_mutex);
+        if (! m_lslices_index_built.load(std::memory_order_relaxed)) {
+            m_lslices_index.build(this->lslices);
+            m_lslices_index_built.store(true, std::memory_order_release);
+        }
+    }
+    return m_lslices_index;
+}
+
 // used by Layer::build_up_down_graph()
 // Shrink source polygons one by one, so that they will be separated if they were touching
 // at vertices (non-manifold situation).
@@ -618,10 +713,58 @@ ExPolygons Layer::merged(float offset_scaled) const
     return out;
 }
 
+// Are the perimeters of the two regions identical in all parameters influencing their generation?
+static bool perimeter_config_compatible(const PrintRegionConfig &config, const PrintRegionConfig &other_config)
+{
+    bool dynamic_overhang_speed_compatibility = config.enable_dynamic_overhang_speeds ==
+                                other_config.enable_dynamic_overhang_speeds;
+    if (dynamic_overhang_speed_compatibility && config.enable_dynamic_overhang_speeds) {
+        dynamic_overhang_speed_compatibility = config.overhang_speed_0 == other_config.overhang_speed_0 &&
+                                               config.overhang_speed_1 == other_config.overhang_speed_1 &&
+                                               config.overhang_speed_2 == other_config.overhang_speed_2 &&
+                                               config.overhang_speed_3 == other_config.overhang_speed_3;
+    }
+
+    return config.perimeter_extruder             == other_config.perimeter_extruder
+        && config.perimeters                     == other_config.perimeters
+        && config.perimeter_speed                == other_config.perimeter_speed
+        && config.external_perimeter_speed       == other_config.external_perimeter_speed
+        && dynamic_overhang_speed_compatibility
+        && (config.gap_fill_enabled ? config.gap_fill_speed.value : 0.) ==
+           (other_config.gap_fill_enabled ? other_config.gap_fill_speed.value : 0.)
+        && config.overhangs                      == other_config.overhangs
+        && config.opt_serialize("perimeter_extrusion_width") == other_config.opt_serialize("perimeter_extrusion_width")
+        && config.thin_walls                     == other_config.thin_walls
+        && config.external_perimeters_first      == other_config.external_perimeters_first
+        && config.infill_overlap                 == other_config.infill_overlap
+        && config.fuzzy_skin                     == other_config.fuzzy_skin
+        && config.fuzzy_skin_thickness           == other_config.fuzzy_skin_thickness
+        && config.fuzzy_skin_point_dist          == other_config.fuzzy_skin_point_dist;
+}
+
+std::vector<uint32_t> perimeter_compatibility_classes(const PrintObject &print_object)
+{
+    std::vector<uint32_t> classes(print_object.num_printing_regions(), 0);
+    for (uint32_t region_id = 0; region_id < uint32_t(classes.size()); ++ region_id) {
+        const PrintRegionConfig &config = print_object.printing_region(region_id).config();
+        uint32_t class_id = region_id;
+        for (uint32_t other_id = 0; other_id < region_id; ++ other_id)
+            // Compare against class representatives only, compatibility is transitive.
+            if (classes[other_id] == other_id && perimeter_config_compatible(config, print_object.printing_region(other_id).config())) {
+                class_id = other_id;
+                break;
+            }
+        classes[region_id] = class_id;
+    }
+    return classes;
+}
+
 // Here the perimeters are created cummulatively for all layer regions sharing the same parameters influencing the perimeters.
 // The perimeter paths and the thin fills (ExtrusionEntityCollection) are assigned to the first compatible layer region.
 // The resulting fill surface is split back among the originating regions.
-void Layer::make_perimeters()
+// The perimeter_compatibility_classes were computed once per object by perimeter_compatibility_classes(),
+// see PrintObject::make_perimeters().
+void Layer::make_perimeters(const std::vector<uint32_t> &perimeter_compatibility_classes)
 {
     BOOST_LOG_TRIVIAL(trace) << "Generating perimeters for layer " << this->id();
     
@@ -637,6 +780,7 @@ void Layer::make_perimeters()
     auto layer_region_reset_perimeters = [](LayerRegion &layerm) {
         layerm.m_perimeters.clear();
         layerm.m_fills.clear();
+        layerm.m_fill_role_mask = 0;
         layerm.m_thin_fills.clear();
         layerm.m_fill_expolygons.clear();
         layerm.m_fill_expolygons_bboxes.clear();
@@ -654,49 +798,21 @@ void Layer::make_perimeters()
             if (! (*layerm)->slices().empty()) {
     	        BOOST_LOG_TRIVIAL(trace) << "Generating perimeters for layer " << this->id() << ", region " << region_id;
     	        done[region_id] = true;
-    	        const PrintRegionConfig &config = (*layerm)->region().config();
-    	        
+
                 perimeter_and_gapfill_ranges.clear();
                 fill_expolygons.clear();
                 fill_expolygons_ranges.clear();
                 surfaces_to_merge.clear();
 
-    	        // find compatible regions
+    	        // find compatible regions by the equivalence classes precomputed per object
                 layer_region_ids.clear();
     	        layer_region_ids.push_back(region_id);
     	        for (LayerRegionPtrs::const_iterator it = layerm + 1; it != m_regions.end(); ++it)
-    	            if (! (*it)->slices().empty()) {
-                        LayerRegion             *other_layerm                         = *it;
-                        const PrintRegionConfig &other_config                         = other_layerm->region().config();
-                        bool                     dynamic_overhang_speed_compatibility = config.enable_dynamic_overhang_speeds ==
-                                                                    other_config.enable_dynamic_overhang_speeds;
-                        if (dynamic_overhang_speed_compatibility && config.enable_dynamic_overhang_speeds) {
-                            dynamic_overhang_speed_compatibility = config.overhang_speed_0 == other_config.overhang_speed_0 &&
-                                                                   config.overhang_speed_1 == other_config.overhang_speed_1 &&
-                                                                   config.overhang_speed_2 == other_config.overhang_speed_2 &&
-                                                                   config.overhang_speed_3 == other_config.overhang_speed_3;
-                        }
-
-                        if (config.perimeter_extruder             == other_config.perimeter_extruder
-    		                && config.perimeters                  == other_config.perimeters
-    		                && config.perimeter_speed             == other_config.perimeter_speed
-    		                && config.external_perimeter_speed    == other_config.external_perimeter_speed
-                            && dynamic_overhang_speed_compatibility
-    		                && (config.gap_fill_enabled ? config.gap_fill_speed.value : 0.) == 
-                               (other_config.gap_fill_enabled ? other_config.gap_fill_speed.value : 0.)
-    		                && config.overhangs                   == other_config.overhangs
-    		                && config.opt_serialize("perimeter_extrusion_width") == other_config.opt_serialize("perimeter_extrusion_width")
-    		                && config.thin_walls                  == other_config.thin_walls
-    		                && config.external_perimeters_first   == other_config.external_perimeters_first
-    		                && config.infill_overlap              == other_config.infill_overlap
-                            && config.fuzzy_skin                  == other_config.fuzzy_skin
-                            && config.fuzzy_skin_thickness        == other_config.fuzzy_skin_thickness
-                            && config.fuzzy_skin_point_dist       == other_config.fuzzy_skin_point_dist)
-    		            {
-                            layer_region_reset_perimeters(*other_layerm);
-    		                layer_region_ids.push_back(it - m_regions.begin());
-    		                done[it - m_regions.begin()] = true;
-    		            }
+    	            if (! (*it)->slices().empty() &&
+                        perimeter_compatibility_classes[it - m_regions.begin()] == perimeter_compatibility_classes[region_id]) {
+                        layer_region_reset_perimeters(**it);
+                        layer_region_ids.push_back(it - m_regions.begin());
+                        done[it - m_regions.begin()] = true;
     		        }
 
     	        if (layer_region_ids.size() == 1) {  // optimization
@@ -709,29 +825,39 @@ void Layer::make_perimeters()
                     LayerRegion* layerm_config = m_regions[region_id_config];
                     {
     	                // Merge slices (surfaces) according to number of extra perimeters.
+                        bool mixed_extra_perimeters = false;
     	                for (uint32_t region_id : layer_region_ids) {
                             LayerRegion &layerm = *m_regions[region_id];
-    	                    for (const Surface &surface : layerm.slices())
+    	                    for (const Surface &surface : layerm.slices()) {
+                                if (! surfaces_to_merge.empty() && surface.extra_perimeters != surfaces_to_merge.front()->extra_perimeters)
+                                    mixed_extra_perimeters = true;
                                 surfaces_to_merge.emplace_back(&surface);
+                            }
                             if (layerm.region().config().fill_density > layerm_config->region().config().fill_density) {
                                 region_id_config = region_id;
                                 layerm_config    = &layerm;
                             }
     	                }
-                        std::sort(surfaces_to_merge.begin(), surfaces_to_merge.end(), [](const Surface *l, const Surface *r){ return l->extra_perimeters < r->extra_perimeters; });
-                        for (size_t i = 0; i < surfaces_to_merge.size();) {
-                            size_t j = i;
-                            const Surface &first = *surfaces_to_merge[i];
-                            size_t extra_perimeters = first.extra_perimeters;
-                            for (; j < surfaces_to_merge.size() && surfaces_to_merge[j]->extra_perimeters == extra_perimeters; ++ j) ;
-                            if (i + 1 == j)
-                                // Nothing to merge, just copy.
-                                new_slices.surfaces.emplace_back(*surfaces_to_merge[i]);
-                            else {
-                                surfaces_to_merge_temp.assign(surfaces_to_merge.begin() + i, surfaces_to_merge.begin() + j);
-                                new_slices.append(offset_ex(surfaces_to_merge_temp, ClipperSafetyOffset), first);
+                        if (! mixed_extra_perimeters) {
+                            // The common case: no region requested extra perimeters, merge all surfaces in one go
+                            // without sorting or grouping.
+                            new_slices.append(offset_ex(surfaces_to_merge, ClipperSafetyOffset), *surfaces_to_merge.front());
+                        } else {
+                            std::sort(surfaces_to_merge.begin(), surfaces_to_merge.end(), [](const Surface *l, const Surface *r){ return l->extra_perimeters < r->extra_perimeters; });
+                            for (size_t i = 0; i < surfaces_to_merge.size();) {
+                                size_t j = i;
+                                const Surface &first = *surfaces_to_merge[i];
+                                size_t extra_perimeters = first.extra_perimeters;
+                                for (; j < surfaces_to_merge.size() && surfaces_to_merge[j]->extra_perimeters == extra_perimeters; ++ j) ;
+                                if (i + 1 == j)
+                                    // Nothing to merge, just copy.
+                                    new_slices.surfaces.emplace_back(*surfaces_to_merge[i]);
+                                else {
+                                    surfaces_to_merge_temp.assign(surfaces_to_merge.begin() + i, surfaces_to_merge.begin() + j);
+                                    new_slices.append(offset_ex(surfaces_to_merge_temp, ClipperSafetyOffset), first);
+                                }
+                                i = j;
                             }
-                            i = j;
                         }
     	            }
     	            // make perimeters
@@ -999,28 +1125,36 @@ void Layer::sort_perimeters_into_islands(
     };
 
     // First sort into islands using exact fit.
-    // Traverse the slices in an increasing order of bounding box size, so that the islands inside another islands are tested first,
-    // so we can just test a point inside ExPolygon::contour and we may skip testing the holes.
-    auto point_inside_surface = [&lslices = this->lslices, &lslices_ex = this->lslices_ex](size_t lslice_idx, const Point &point) {
-        const BoundingBox &bbox = lslices_ex[lslice_idx].bbox;
-        return point.x() >= bbox.min.x() && point.x() < bbox.max.x() &&
-               point.y() >= bbox.min.y() && point.y() < bbox.max.y() &&
-               // Exact match: Don't just test whether a point is inside the outer contour of an island,
-               // test also whether the point is not inside some hole of the same expolygon.
-               // This is unfortunatelly necessary because the point may be inside an expolygon of one of this expolygon's hole
-               // and missed due to numerical issues.
-               lslices[lslice_idx].contains(point);
-    };
-    for (int lslice_idx = int(lslices_ex.size()) - 1; lslice_idx >= 0 && ! perimeter_slices_queue.empty(); -- lslice_idx)
-        for (auto it_source_slice = perimeter_slices_queue.begin(); it_source_slice != perimeter_slices_queue.end(); ++ it_source_slice)
-            if (point_inside_surface(lslice_idx, it_source_slice->second)) {
-                insert_into_island(lslice_idx, it_source_slice->first);
-                if (std::next(it_source_slice) != perimeter_slices_queue.end())
-                    // Remove the current slice & point pair from the queue.
-                    *it_source_slice = perimeter_slices_queue.back();
-                perimeter_slices_queue.pop_back();
+    // The candidate slices are collected from the lazily built layer slice index instead of scanning
+    // all the slices linearly per sample. Candidates are tested in a decreasing index order, thus in
+    // an increasing order of bounding box size, so that the islands inside another islands are matched
+    // first and a sample lands in the innermost island containing it.
+    // Exact match: Don't just test whether a point is inside the outer contour of an island,
+    // test also whether the point is not inside some hole of the same expolygon.
+    // This is unfortunatelly necessary because the point may be inside an expolygon of one of this expolygon's hole
+    // and missed due to numerical issues.
+    const LayerSlicesIndex &lslices_index = this->lslices_index();
+    std::vector<char>       lslice_claimed(lslices_ex.size(), 0);
+    for (auto it_source_slice = perimeter_slices_queue.begin(); it_source_slice != perimeter_slices_queue.end();) {
+        bool inserted = false;
+        const std::vector<uint32_t> candidates = lslices_index.slice_indices_overlapping(BoundingBox(it_source_slice->second, it_source_slice->second));
+        for (auto it = candidates.rbegin(); it != candidates.rend(); ++ it)
+            // Same as the linear traversal this replaces: at most one source slice is fitted into each
+            // island in the exact phase, later samples inside an already claimed island fall through
+            // to an outer island or to the closest fit below.
+            if (uint32_t lslice_idx = *it; ! lslice_claimed[lslice_idx] && lslices[lslice_idx].contains(it_source_slice->second)) {
+                insert_into_island(int(lslice_idx), it_source_slice->first);
+                lslice_claimed[lslice_idx] = 1;
+                inserted = true;
                 break;
             }
+        if (inserted) {
+            // Remove the current slice & point pair from the queue.
+            *it_source_slice = perimeter_slices_queue.back();
+            perimeter_slices_queue.pop_back();
+        } else
+            ++ it_source_slice;
+    }
     if (! perimeter_slices_queue.empty()) {
         // If the slice sample was not fitted into any slice using exact fit, try to find a closest island as a last resort.
         // This should be a rare event especially if the sample point was taken from infill or inner perimeter,
@@ -13,12 +13,16 @@
 
 #include "Line.hpp"
 #include "libslic3r.h"
+#include "AABBTreeIndirect.hpp"
 #include "BoundingBox.hpp"
 #include "Flow.hpp"
 #include "SurfaceCollection.hpp"
 #include "ExtrusionEntityCollection.hpp"
 #include "LayerRegion.hpp"
 
+#include <atomic>
+#include <mutex>
+
 #include <boost/container/small_vector.hpp>
 
 namespace Slic3r {
@@ -147,7 +151,30 @@ struct LayerSlice
 
 using LayerSlices = std::vector<LayerSlice>;
 
-class Layer 
+// Lazily bulk-loaded AABB index over Layer::lslices with batched containment / overlap queries,
+// replacing the repeated linear scans over the layer slices. Built on first use by
+// Layer::lslices_index(), invalidated together with the slices.
+class LayerSlicesIndex
+{
+public:
+    // Index of the lslice containing pt, -1 if none. With multiple nested candidates the one
+    // latest in the lslices order wins (the slices are sorted by a decreasing bounding box size,
+    // thus the innermost island), matching the descending linear traversal this replaces.
+    // With contour_only set, the holes of the slices are not tested.
+    int32_t               slice_idx_containing(const Point &pt, bool contour_only = false) const;
+    // Indices of the lslices whose bounding boxes overlap bbox, in an increasing order.
+    std::vector<uint32_t> slice_indices_overlapping(const BoundingBox &bbox) const;
+    bool                  empty() const { return m_tree.empty(); }
+
+private:
+    friend class Layer;
+    void                  build(const ExPolygons &lslices);
+
+    AABBTreeIndirect::Tree<2, coord_t> m_tree;
+    const ExPolygons                  *m_lslices { nullptr };
+};
+
+class Layer
 {
 public:
     // Sequential index of this layer in PrintObject::m_layers, offsetted by the number of raft layers.
@@ -179,6 +206,11 @@ public:
     std::vector<size_t>     lslice_indices_sorted_by_print_order;
     LayerSlices             lslices_ex;
 
+    // Lazily built spatial index over lslices for batched containment / overlap queries.
+    // Whoever modifies lslices is responsible for calling invalidate_lslices_index().
+    const LayerSlicesIndex& lslices_index() const;
+    void                    invalidate_lslices_index() { m_lslices_index_built.store(false, std::memory_order_release); }
+
     size_t                  region_count() const { return m_regions.size(); }
     const LayerRegion*      get_region(int idx) const { return m_regions[idx]; }
     LayerRegion*            get_region(int idx) { return m_regions[idx]; }
@@ -205,7 +237,9 @@ public:
         for (const LayerRegion *layerm : m_regions) if (layerm->slices().any_bottom_contains(item)) return true;
         return false;
     }
-    void                    make_perimeters();
+    // The perimeter_compatibility_classes map each region id to the id of the lowest compatible region,
+    // see perimeter_compatibility_classes() below.
+    void                    make_perimeters(const std::vector<uint32_t> &perimeter_compatibility_classes);
     void                    make_fills(FillAdaptive::Octree     *adaptive_fill_octree,
                                        FillAdaptive::Octree     *support_fill_octree,
                                        FillLightning::Generator *lightning_generator);
@@ -259,6 +293,12 @@ private:
     size_t              m_id;
     PrintObject        *m_object;
     LayerRegionPtrs     m_regions;
+
+    // Lazily built by lslices_index(). The mutex only guards the rare build,
+    // queries after the build are lock free.
+    mutable LayerSlicesIndex    m_lslices_index;
+    mutable std::atomic<bool>   m_lslices_index_built { false };
+    mutable std::mutex          m_lslices_index_mutex;
 };
 
 class SupportLayer : public Layer 
@@ -304,6 +344,12 @@ inline std::vector<float> zs_from_layers(const LayerContainer &layers)
 extern BoundingBox get_extents(const LayerRegion &layer_region);
 extern BoundingBox get_extents(const LayerRegionPtrs &layer_regions);
 
+// Equivalence classes of the print regions producing identical perimeters (same extruder, widths,
+// speeds etc.), each entry mapping a region id to the lowest compatible region id.
+// Computed once per object by PrintObject::make_perimeters() and consumed by Layer::make_perimeters(),
+// which used to re-evaluate the pairwise config compatibility on every layer.
+std::vector<uint32_t> perimeter_compatibility_classes(const PrintObject &print_object);
+
 }
 
 #endif
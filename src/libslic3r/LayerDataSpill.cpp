@@ -0,0 +1,214 @@
+///|/ Copyright (c) Prusa Research 2023 Vojtěch Bubník @bubnikv
+///|/
+///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
+///|/
+#include "LayerDataSpill.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <utility>
+
+#include <boost/filesystem/operations.hpp>
+#include <boost/filesystem/path.hpp>
+#include <boost/log/trivial.hpp>
+#include <boost/nowide/cstdlib.hpp>
+#include <boost/nowide/fstream.hpp>
+
+#include <cereal/archives/binary.hpp>
+#include <cereal/types/vector.hpp>
+
+#include "Exception.hpp"
+#include "ExPolygonSerialize.hpp"
+#include "Layer.hpp"
+#include "Print.hpp"
+#include "Surface.hpp"
+#include "Utils.hpp"
+
+namespace Slic3r {
+
+namespace {
+
+// Spill files of the per-layer intermediates, keyed by PrintObject ID.
+// Leftover files (of objects deleted without restoring) are removed at process exit.
+struct SpillRegistry
+{
+    std::mutex                                  mutex;
+    std::map<ObjectID, boost::filesystem::path> files;
+
+    ~SpillRegistry() {
+        for (const auto &entry : this->files) {
+            boost::system::error_code ec;
+            boost::filesystem::remove(entry.second, ec);
+        }
+    }
+};
+
+SpillRegistry& spill_registry()
+{
+    static SpillRegistry registry;
+    return registry;
+}
+
+// Surface has no default constructor, thus cereal cannot serialize a vector of them directly.
+void save_surfaces(cereal::BinaryOutputArchive &archive, const Surfaces &surfaces)
+{
+    archive(uint64_t(surfaces.size()));
+    for (const Surface &surface : surfaces)
+        archive(int32_t(surface.surface_type), surface.expolygon, surface.thickness,
+                surface.thickness_layers, surface.bridge_angle, surface.extra_perimeters);
+}
+
+void load_surfaces(cereal::BinaryInputArchive &archive, Surfaces &surfaces)
+{
+    uint64_t count = 0;
+    archive(count);
+    surfaces.clear();
+    surfaces.reserve(count);
+    for (uint64_t i = 0; i < count; ++ i) {
+        int32_t   surface_type = 0;
+        ExPolygon expolygon;
+        archive(surface_type, expolygon);
+        Surface &surface = surfaces.emplace_back(SurfaceType(surface_type), std::move(expolygon));
+        archive(surface.thickness, surface.thickness_layers, surface.bridge_angle, surface.extra_perimeters);
+    }
+}
+
+} // namespace
+
+size_t LayerDataSpill::budget_bytes()
+{
+    if (memory_budget)
+        return *memory_budget * 1048576;
+    if (const char *env = boost::nowide::getenv("SLIC3R_MEMORY_BUDGET"); env != nullptr && *env != 0) {
+        char *end   = nullptr;
+        long  value = strtol(env, &end, 10);
+        if (end != env && value > 0)
+            return size_t(value) * 1048576;
+    }
+    return 0;
+}
+
+bool LayerDataSpill::spill_object(PrintObject &object, const bool with_surfaces)
+{
+    boost::filesystem::path path = boost::filesystem::temp_directory_path() /
+        boost::filesystem::unique_path("prusaslicer-layer-spill-%%%%-%%%%-%%%%-%%%%.bin");
+    try {
+        boost::nowide::ofstream ofs(path.string(), std::ios::binary);
+        cereal::BinaryOutputArchive archive(ofs);
+        archive(with_surfaces, uint64_t(object.layer_count()));
+        for (const Layer *layer : object.layers()) {
+            archive(uint64_t(layer->region_count()));
+            for (const LayerRegion *layerm : layer->regions()) {
+                archive(layerm->m_raw_slices);
+                if (with_surfaces) {
+                    save_surfaces(archive, layerm->m_slices.surfaces);
+                    save_surfaces(archive, layerm->m_fill_surfaces.surfaces);
+                }
+            }
+        }
+        if (! ofs.good())
+            throw Slic3r::RuntimeError("Write failed.");
+    } catch (const std::exception &ex) {
+        BOOST_LOG_TRIVIAL(warning) << "Spilling per-layer data to " << path.string() << " failed: " << ex.what()
+                                   << " Keeping the data resident.";
+        boost::system::error_code ec;
+        boost::filesystem::remove(path, ec);
+        return false;
+    }
+    // The spill file is complete, release the serialized data.
+    for (Layer *layer : object.layers())
+        for (LayerRegion *layerm : layer->regions()) {
+            ExPolygons().swap(layerm->m_raw_slices);
+            if (with_surfaces) {
+                Surfaces().swap(layerm->m_slices.surfaces);
+                Surfaces().swap(layerm->m_fill_surfaces.surfaces);
+            }
+        }
+    SpillRegistry &registry = spill_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    if (auto it = registry.files.find(object.id()); it != registry.files.end()) {
+        // Should not happen as restore() drops the record, but don't leak the old file if it does.
+        boost::system::error_code ec;
+        boost::filesystem::remove(it->second, ec);
+        it->second = std::move(path);
+    } else
+        registry.files.emplace(object.id(), std::move(path));
+    return true;
+}
+
+void LayerDataSpill::spill_if_over_budget(Print &print)
+{
+    const size_t budget = budget_bytes();
+    if (budget == 0)
+        return;
+    const size_t resident = resident_memory();
+    if (resident == 0 || resident <= budget)
+        return;
+    // Slice and fill surfaces are read during the G-code export by the "avoid crossing perimeters"
+    // and "only retract when crossing perimeters" features, only spill them if both are disabled.
+    const bool with_surfaces = ! print.config().avoid_crossing_perimeters.value &&
+                               ! print.config().only_retract_when_crossing_perimeters.value;
+    size_t num_spilled = 0;
+    for (size_t idx = 0; idx < print.objects().size(); ++ idx) {
+        PrintObject &object = *print.get_object(idx);
+        if (object.is_step_done(posSlice) && object.layer_count() > 0 && spill_object(object, with_surfaces))
+            ++ num_spilled;
+    }
+    if (num_spilled > 0)
+        BOOST_LOG_TRIVIAL(info) << "Resident memory " << format_memsize_MB(resident) << " exceeded the budget of "
+                                << format_memsize_MB(budget) << ", spilled per-layer data of "
+                                << num_spilled << " objects to temporary files.";
+}
+
+void LayerDataSpill::restore_object(PrintObject &object, const boost::filesystem::path &path)
+{
+    boost::nowide::ifstream ifs(path.string(), std::ios::binary);
+    if (! ifs.good())
+        throw Slic3r::RuntimeError("Cannot open the layer data spill file " + path.string());
+    cereal::BinaryInputArchive archive(ifs);
+    bool     with_surfaces = false;
+    uint64_t num_layers    = 0;
+    archive(with_surfaces, num_layers);
+    if (num_layers != object.layer_count())
+        throw Slic3r::RuntimeError("Layer data spill file " + path.string() + " does not match the print object.");
+    for (Layer *layer : object.layers()) {
+        uint64_t num_regions = 0;
+        archive(num_regions);
+        if (num_regions != layer->region_count())
+            throw Slic3r::RuntimeError("Layer data spill file " + path.string() + " does not match the print object.");
+        for (LayerRegion *layerm : layer->regions()) {
+            archive(layerm->m_raw_slices);
+            if (with_surfaces) {
+                load_surfaces(archive, layerm->m_slices.surfaces);
+                load_surfaces(archive, layerm->m_fill_surfaces.surfaces);
+            }
+        }
+    }
+    if (! ifs.good())
+        throw Slic3r::RuntimeError("Failed reading the layer data spill file " + path.string());
+}
+
+void LayerDataSpill::restore(Print &print)
+{
+    SpillRegistry &registry = spill_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    if (registry.files.empty())
+        return;
+    for (size_t idx = 0; idx < print.objects().size(); ++ idx) {
+        PrintObject &object = *print.get_object(idx);
+        auto it = registry.files.find(object.id());
+        if (it == registry.files.end())
+            continue;
+        if (object.is_step_done(posSlice))
+            restore_object(object, it->second);
+        // Either the data was restored or the layers will be resliced from scratch,
+        // the spill file is stale in both cases.
+        boost::system::error_code ec;
+        boost::filesystem::remove(it->second, ec);
+        registry.files.erase(it);
+    }
+}
+
+} // namespace Slic3r
@@ -0,0 +1,53 @@
+///|/ Copyright (c) Prusa Research 2023 Vojtěch Bubník @bubnikv
+///|/
+///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
+///|/
+#ifndef slic3r_LayerDataSpill_hpp_
+#define slic3r_LayerDataSpill_hpp_
+
+#include <cstddef>
+
+namespace boost { namespace filesystem { class path; }}
+
+namespace Slic3r {
+
+class Print;
+class PrintObject;
+
+// Bounds peak resident memory of large prints by serializing cold per-layer intermediates
+// (LayerRegion raw slices and optionally slice / fill surfaces) to a temporary spill file
+// once the process exceeds a memory budget, and by loading them back before the next
+// incremental slicing pass needs them.
+//
+// The budget is configured with --memory-budget on the command line (in MB) or with the
+// SLIC3R_MEMORY_BUDGET environment variable. If neither is set, spilling is disabled.
+//
+// Spilled data is keyed by PrintObject ID. Spill files are stored in the system temporary
+// directory and removed when restored, discarded or at process exit.
+class LayerDataSpill
+{
+public:
+    // Memory budget in bytes, zero if spilling is disabled.
+    static size_t budget_bytes();
+
+    // To be called after the slicing process finished. If the resident memory of this process
+    // exceeds the budget, the cold per-layer intermediates of objects with finished slicing
+    // steps are serialized to spill files and released.
+    // Slice and fill surfaces are only spilled if neither "avoid_crossing_perimeters" nor
+    // "only_retract_when_crossing_perimeters" is enabled, as those read the surfaces
+    // during the G-code export.
+    static void spill_if_over_budget(Print &print);
+
+    // To be called before the slicing process starts. Spilled per-layer intermediates of objects
+    // with valid slicing steps are loaded back, stale spill files of invalidated objects are discarded.
+    // Throws RuntimeError if a spill file cannot be read back.
+    static void restore(Print &print);
+
+private:
+    static bool spill_object(PrintObject &object, bool with_surfaces);
+    static void restore_object(PrintObject &object, const boost::filesystem::path &path);
+};
+
+} // namespace Slic3r
+
+#endif // slic3r_LayerDataSpill_hpp_
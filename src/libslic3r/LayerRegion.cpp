@@ -22,6 +22,9 @@
 
 #include <boost/log/trivial.hpp>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 namespace Slic3r {
 
 Flow LayerRegion::flow(FlowRole role) const
@@ -34,6 +37,11 @@ Flow LayerRegion::flow(FlowRole role, double layer_height) const
     return m_region->flow(*m_layer->object(), role, layer_height, m_layer->id() == 0);
 }
 
+std::array<Flow, num_region_flow_roles> LayerRegion::flows() const
+{
+    return m_region->flows(*m_layer->object(), m_layer->height, m_layer->id() == 0);
+}
+
 Flow LayerRegion::bridging_flow(FlowRole role, bool force_thick_bridges) const
 {
     const PrintRegion       &region         = this->region();
@@ -52,6 +60,27 @@ Flow LayerRegion::bridging_flow(FlowRole role, bool force_thick_bridges) const
     }
 }
 
+// Recalculate m_fill_role_mask from this->fills(). To be called after the fill extrusions
+// of this LayerRegion are generated or modified.
+void LayerRegion::cache_fill_role_mask()
+{
+    uint32_t mask = 0;
+    for (const ExtrusionEntity *ee : this->fills()) {
+        // Fills are always stored as collections of extrusions of a single island.
+        const auto   *island     = static_cast<const ExtrusionEntityCollection*>(ee);
+        ExtrusionRole front_role = island->entities.empty() ? ExtrusionRole::None : island->entities.front()->role();
+        if (front_role == ExtrusionRole::None)
+            mask |= frbNoRole;
+        else if (ExtrusionRole island_role = island->role(); island_role == ExtrusionRole::InternalInfill)
+            mask |= frbInternalInfill;
+        else if (island_role.is_infill())
+            mask |= front_role.is_solid_infill() ? frbSolidInfill : frbSparseInfill;
+        else
+            mask |= front_role.is_solid_infill() ? frbMixedSolidFirst : frbMixedSparseFirst;
+    }
+    m_fill_role_mask = mask;
+}
+
 // Fill in layerm->fill_surfaces by trimming the layerm->slices by layerm->fill_expolygons.
 void LayerRegion::slices_to_fill_surfaces_clipped()
 {
@@ -365,19 +394,33 @@ ExpansionResult expand_expolygons(
     WaveSeeds bridge_anchors;
     std::vector<RegionExpansionEx> bridge_expansions;
 
+    // The expansion zones are independent of each other, thus their waves are propagated in parallel.
+    // Only the renumbering of boundary ids and the final merge are serial.
+    std::vector<WaveSeeds>                      zone_seeds(expansion_zones.size());
+    std::vector<std::vector<RegionExpansionEx>> zone_expansions(expansion_zones.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, expansion_zones.size()),
+        [&expolygons, &expansion_zones, &zone_seeds, &zone_expansions](const tbb::blocked_range<size_t> &range) {
+        for (size_t zone_idx = range.begin(); zone_idx < range.end(); ++ zone_idx) {
+            const ExpansionZone &expansion_zone = expansion_zones[zone_idx];
+            zone_seeds[zone_idx] = wave_seeds(
+                expolygons,
+                expansion_zone.expolygons,
+                expansion_zone.parameters.tiny_expansion,
+                true
+            );
+            zone_expansions[zone_idx] = propagate_waves_ex(
+                zone_seeds[zone_idx],
+                expansion_zone.expolygons,
+                expansion_zone.parameters
+            );
+        }
+    });
+
     unsigned processed_bridges_count = 0;
-    for (ExpansionZone& expansion_zone : expansion_zones) {
-        WaveSeeds seeds{wave_seeds(
-            expolygons,
-            expansion_zone.expolygons,
-            expansion_zone.parameters.tiny_expansion,
-            true
-        )};
-        std::vector<RegionExpansionEx> expansions{propagate_waves_ex(
-            seeds,
-            expansion_zone.expolygons,
-            expansion_zone.parameters
-        )};
+    for (size_t zone_idx = 0; zone_idx < expansion_zones.size(); ++ zone_idx) {
+        ExpansionZone                  &expansion_zone = expansion_zones[zone_idx];
+        WaveSeeds                      &seeds          = zone_seeds[zone_idx];
+        std::vector<RegionExpansionEx> &expansions     = zone_expansions[zone_idx];
 
         for (WaveSeed &seed : seeds)
             seed.boundary += processed_bridges_count;
@@ -431,10 +474,13 @@ Surfaces expand_bridges_detect_orientations(
     });
     Surfaces out{merge_bridges(bridges, expansion_result.expansions, closing_radius)};
 
-    // Clip by the expanded bridges.
-    for (ExpansionZone& expansion_zone : expansion_zones)
-        if (expansion_zone.expanded_into)
-            expansion_zone.expolygons = diff_ex(expansion_zone.expolygons, out);
+    // Clip by the expanded bridges, each zone independently.
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, expansion_zones.size()),
+        [&expansion_zones, &out](const tbb::blocked_range<size_t> &range) {
+        for (size_t zone_idx = range.begin(); zone_idx < range.end(); ++ zone_idx)
+            if (ExpansionZone &expansion_zone = expansion_zones[zone_idx]; expansion_zone.expanded_into)
+                expansion_zone.expolygons = diff_ex(expansion_zone.expolygons, out);
+    });
     return out;
 }
 
@@ -453,17 +499,26 @@ Surfaces expand_merge_surfaces(
     if (src.empty())
         return {};
 
+    // The expansion zones are independent of each other, thus their waves are propagated in parallel.
+    // Only the renumbering of boundary ids and the final merge are serial.
+    std::vector<std::vector<RegionExpansion>> zone_expansions(expansion_zones.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, expansion_zones.size()),
+        [&src, &expansion_zones, &zone_expansions](const tbb::blocked_range<size_t> &range) {
+        for (size_t zone_idx = range.begin(); zone_idx < range.end(); ++ zone_idx)
+            zone_expansions[zone_idx] = propagate_waves(src, expansion_zones[zone_idx].expolygons, expansion_zones[zone_idx].parameters);
+    });
+
     unsigned processed_expolygons_count = 0;
     std::vector<RegionExpansion> expansions;
-    for (ExpansionZone& expansion_zone : expansion_zones) {
-        std::vector<RegionExpansion> zone_expansions = propagate_waves(src, expansion_zone.expolygons, expansion_zone.parameters);
-        expansion_zone.expanded_into = !zone_expansions.empty();
+    for (size_t zone_idx = 0; zone_idx < expansion_zones.size(); ++ zone_idx) {
+        ExpansionZone &expansion_zone = expansion_zones[zone_idx];
+        expansion_zone.expanded_into = !zone_expansions[zone_idx].empty();
 
-        for (RegionExpansion &expansion : zone_expansions)
+        for (RegionExpansion &expansion : zone_expansions[zone_idx])
             expansion.boundary_id += processed_expolygons_count;
 
         processed_expolygons_count += expansion_zone.expolygons.size();
-        append(expansions, std::move(zone_expansions));
+        append(expansions, std::move(zone_expansions[zone_idx]));
     }
 
     std::vector<ExPolygon> expanded = merge_expansions_into_expolygons(std::move(src), std::move(expansions));
@@ -471,10 +526,13 @@ Surfaces expand_merge_surfaces(
     // without the following closing operation, those regions will stay unfilled and cause small holes in the expanded surface.
     // look for narrow_ensure_vertical_wall_thickness_region_radius filter.
     expanded = closing_ex(expanded, closing_radius);
-    // Trim the zones by the expanded expolygons.
-    for (ExpansionZone& expansion_zone : expansion_zones)
-        if (expansion_zone.expanded_into)
-            expansion_zone.expolygons = diff_ex(expansion_zone.expolygons, expanded);
+    // Trim the zones by the expanded expolygons, each zone independently.
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, expansion_zones.size()),
+        [&expansion_zones, &expanded](const tbb::blocked_range<size_t> &range) {
+        for (size_t zone_idx = range.begin(); zone_idx < range.end(); ++ zone_idx)
+            if (ExpansionZone &expansion_zone = expansion_zones[zone_idx]; expansion_zone.expanded_into)
+                expansion_zone.expolygons = diff_ex(expansion_zone.expolygons, expanded);
+    });
 
     Surface templ{ surface_type, {} };
     templ.bridge_angle = bridge_angle;
@@ -6,12 +6,16 @@
 #include "SurfaceCollection.hpp"
 #include "libslic3r/Algorithm/RegionExpansion.hpp"
 
+#include <array>
+
 
 namespace Slic3r {
 
 class Layer;
 using LayerPtrs = std::vector<Layer*>;
+class PrintObject;
 class PrintRegion;
+struct VolumeSlices;
 
 // Range of indices, providing support for range based loops.
 template<typename T>
@@ -51,6 +55,26 @@ template class IndexRange<uint32_t>;
 using ExtrusionRange = IndexRange<uint32_t>;
 using ExPolygonRange = IndexRange<uint32_t>;
 
+// Role signatures of fill islands stored in LayerRegion::fills(). ToolOrdering decides on
+// the extruders to print a layer and on wiping into infill from these signatures without
+// traversing all the fill extrusions again. An island is classified by the role of its leading
+// extrusion (deciding the extruder it is printed with) and by the role of the whole island
+// (a pure internal infill island is a candidate for wiping).
+enum FillRoleBits : uint32_t {
+    // Infill island led by a solid infill extrusion.
+    frbSolidInfill      = 0x01,
+    // The whole island is sparse internal infill.
+    frbInternalInfill   = 0x02,
+    // Infill island led by a sparse infill extrusion, not pure internal infill.
+    frbSparseInfill     = 0x04,
+    // Island of mixed roles led by a solid infill extrusion.
+    frbMixedSolidFirst  = 0x08,
+    // Island of mixed roles led by a sparse (non-solid) extrusion.
+    frbMixedSparseFirst = 0x10,
+    // Empty island or an island led by an extrusion with no role assigned.
+    frbNoRole           = 0x20,
+};
+
 class LayerRegion
 {
 public:
@@ -93,8 +117,20 @@ public:
     // (this collection contains only ExtrusionEntityCollection objects)
     [[nodiscard]] const ExtrusionEntityCollection&  fills() const { return m_fills; }
 
+    // Bit mask of FillRoleBits marking the role signatures of the fill islands present in this->fills().
+    // Cached by cache_fill_role_mask() when the fills are generated, thus refreshed by the same
+    // invalidation that regenerates the fills.
+    [[nodiscard]] uint32_t                          fill_role_mask() const { return m_fill_role_mask; }
+    // Recalculate m_fill_role_mask from this->fills(). To be called after the fill extrusions
+    // of this LayerRegion are generated or modified.
+    void    cache_fill_role_mask();
+
     Flow    flow(FlowRole role) const;
     Flow    flow(FlowRole role, double layer_height) const;
+    // Flows of this LayerRegion for all roles resolvable by PrintRegion::flow(), indexed by FlowRole.
+    // To be looked up by index in loops over extrusion paths, where calling flow() would resolve
+    // the same flow configuration repeatedly.
+    std::array<Flow, num_region_flow_roles> flows() const;
     Flow    bridging_flow(FlowRole role, bool force_thick_bridges = false) const;
 
     void    slices_to_fill_surfaces_clipped();
@@ -139,6 +175,9 @@ private:
     friend std::string fix_slicing_errors(LayerPtrs&, const std::function<void()>&);
     template<typename ThrowOnCancel>
     friend void apply_mm_segmentation(PrintObject& print_object, ThrowOnCancel throw_on_cancel);
+    friend void slices_to_regions(const PrintObject&, const std::vector<float>&, std::vector<VolumeSlices>&&, LayerPtrs&, const std::function<void()>&);
+    // Spilling / restoring m_raw_slices, m_slices and m_fill_surfaces under a memory budget.
+    friend class LayerDataSpill;
 
     Layer                      *m_layer;
     const PrintRegion          *m_region;
@@ -185,6 +224,9 @@ private:
     // (this collection contains only ExtrusionEntityCollection objects)
     ExtrusionEntityCollection   m_fills;
 
+    // Bit mask of FillRoleBits, cached summary of the role signatures of m_fills islands.
+    uint32_t                    m_fill_role_mask { 0 };
+
     // collection of expolygons representing the bridged areas (thus not
     // needing support material)
 //  Polygons                    bridged;
@@ -74,7 +74,7 @@ template<class T> TRasterValue<T> isoval(const T &rst, const Coord &crd)
 template<class ExecutionPolicy, class It, class Fn>
 void for_each(ExecutionPolicy&& policy, It from, It to, Fn &&fn)
 {
-    _Loop<ExecutionPolicy>::for_each(from, to, fn);
+    _Loop<std::decay_t<ExecutionPolicy>>::for_each(from, to, fn);
 }
 
 // Type of squares (tiles) depending on which vertices are inside an ROI
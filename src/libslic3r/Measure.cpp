@@ -12,6 +12,7 @@
 
 #include <numeric>
 #include <tbb/parallel_for.h>
+#include <tbb/parallel_invoke.h>
 
 #define DEBUG_EXTRACT_ALL_FEATURES_AT_ONCE 0
 
@@ -113,8 +114,12 @@ void MeasuringImpl::update_planes()
     // This part is still performed in mesh coordinate system.
     const size_t             num_of_facets = m_its.indices.size();
     m_face_to_plane.resize(num_of_facets, size_t(-1));
-    const std::vector<Vec3f> face_normals = its_face_normals(m_its);
-    const std::vector<Vec3i> face_neighbors = its_face_neighbors(m_its);
+    // both precomputed tables are independent, build them concurrently
+    std::vector<Vec3f> face_normals;
+    std::vector<Vec3i> face_neighbors;
+    tbb::parallel_invoke(
+        [this, &face_normals]() { face_normals = its_face_normals(m_its); },
+        [this, &face_neighbors]() { face_neighbors = its_face_neighbors_par(m_its); });
     std::vector<int>         facet_queue(num_of_facets, 0);
     int                      facet_queue_cnt = 0;
     const stl_normal*        normal_ptr      = nullptr;
@@ -160,9 +165,16 @@ void MeasuringImpl::update_planes()
         }
 
         m_planes.back().normal = normal_ptr->cast<double>();
-        std::sort(m_planes.back().facets.begin(), m_planes.back().facets.end());
     }
-    
+
+    // Sort the facet lists of all planes. The sorts are independent, the serial
+    // flood fill above only grows the lists, so they run in parallel here.
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, m_planes.size()),
+        [this](const tbb::blocked_range<size_t>& range) {
+            for (size_t plane_id = range.begin(); plane_id != range.end(); ++plane_id)
+                std::sort(m_planes[plane_id].facets.begin(), m_planes[plane_id].facets.end());
+        });
+
     // Check that each facet is part of one of the planes.
     assert(std::none_of(m_face_to_plane.begin(), m_face_to_plane.end(), [](size_t val) { return val == size_t(-1); }));
 
@@ -23,6 +23,7 @@
 #include "TriangleSelector.hpp"
 
 #include "Format/AMF.hpp"
+#include "Format/MeshCache.hpp"
 #include "Format/OBJ.hpp"
 #include "Format/STL.hpp"
 #include "Format/3mf.hpp"
@@ -127,8 +128,17 @@ Model Model::read_from_file(const std::string& input_file, DynamicPrintConfig* c
     if (config_substitutions == nullptr)
         config_substitutions = &temp_config_substitutions_context;
 
+    // Plain geometry files are backed by the binary mesh cache: a repeated
+    // import of an unchanged file skips the parser and the mesh repair.
+    const bool geometry_file = boost::algorithm::iends_with(input_file, ".stl")
+        || boost::algorithm::iends_with(input_file, ".obj")
+        || boost::algorithm::iends_with(input_file, ".step") || boost::algorithm::iends_with(input_file, ".stp");
+    const bool loaded_from_cache = geometry_file && load_model_from_mesh_cache(input_file, &model);
+
     bool result = false;
-    if (boost::algorithm::iends_with(input_file, ".stl"))
+    if (loaded_from_cache)
+        result = true;
+    else if (boost::algorithm::iends_with(input_file, ".stl"))
         result = load_stl(input_file.c_str(), &model);
     else if (boost::algorithm::iends_with(input_file, ".obj"))
         result = load_obj(input_file.c_str(), &model);
@@ -151,7 +161,10 @@ Model Model::read_from_file(const std::string& input_file, DynamicPrintConfig* c
 
     if (model.objects.empty())
         throw Slic3r::RuntimeError("The supplied file couldn't be read because it's empty");
-   
+
+    if (geometry_file && ! loaded_from_cache)
+        store_model_to_mesh_cache(input_file, model);
+
     if (!boost::ends_with(input_file, ".printRequest"))
         for (ModelObject *o : model.objects)
             o->input_file = input_file;
@@ -159,6 +172,9 @@ Model Model::read_from_file(const std::string& input_file, DynamicPrintConfig* c
     if (options & LoadAttribute::AddDefaultInstances)
         model.add_default_instances();
 
+    // A multi-object file with repeated parts stores a mesh copy per part, keep just one payload.
+    model.deduplicate_mesh_payloads();
+
     CustomGCode::update_custom_gcode_per_print_z_from_config(model.custom_gcode_per_print_z, config);
     CustomGCode::check_mode_for_custom_gcode_per_print_z(model.custom_gcode_per_print_z);
 
@@ -198,6 +214,9 @@ Model Model::read_from_archive(const std::string& input_file, DynamicPrintConfig
     if (options & LoadAttribute::AddDefaultInstances)
         model.add_default_instances();
 
+    // A project with repeated parts stores a mesh copy per part, keep just one payload.
+    model.deduplicate_mesh_payloads();
+
     CustomGCode::update_custom_gcode_per_print_z_from_config(model.custom_gcode_per_print_z, config);
     CustomGCode::check_mode_for_custom_gcode_per_print_z(model.custom_gcode_per_print_z);
 
@@ -588,6 +607,49 @@ int Model::removed_objects_with_zero_volume()
     return removed;
 }
 
+size_t Model::deduplicate_mesh_payloads()
+{
+    // FNV-1a over the raw vertex and index buffers.
+    auto hash_bytes = [](const void *data, size_t size, uint64_t hash) {
+        for (const unsigned char *p = static_cast<const unsigned char*>(data), *end = p + size; p != end; ++ p)
+            hash = (hash ^ *p) * 0x100000001b3ULL;
+        return hash;
+    };
+    auto meshes_equal = [](const indexed_triangle_set &l, const indexed_triangle_set &r) {
+        return l.vertices.size() == r.vertices.size() && l.indices.size() == r.indices.size() &&
+            memcmp(l.vertices.data(), r.vertices.data(), l.vertices.size() * sizeof(l.vertices.front())) == 0 &&
+            memcmp(l.indices.data(),  r.indices.data(),  l.indices.size()  * sizeof(l.indices.front()))  == 0;
+    };
+
+    // Bucket the volumes by a content hash of their geometry, share the payload of the first
+    // volume of a bucket with all the others that compare equal. The mesh statistics are derived
+    // from the geometry, thus they agree for bitwise identical meshes.
+    std::unordered_map<uint64_t, std::vector<ModelVolume*>> buckets;
+    size_t num_deduplicated = 0;
+    for (ModelObject *object : this->objects)
+        for (ModelVolume *volume : object->volumes) {
+            if (volume->mesh().empty())
+                continue;
+            const indexed_triangle_set &its = volume->mesh().its;
+            uint64_t hash = 0xcbf29ce484222325ULL;
+            hash = hash_bytes(its.vertices.data(), its.vertices.size() * sizeof(its.vertices.front()), hash);
+            hash = hash_bytes(its.indices.data(),  its.indices.size()  * sizeof(its.indices.front()),  hash);
+            std::vector<ModelVolume*> &bucket = buckets[hash];
+            auto it = std::find_if(bucket.begin(), bucket.end(),
+                [&its, &meshes_equal](const ModelVolume *candidate) { return meshes_equal(candidate->mesh().its, its); });
+            if (it == bucket.end())
+                bucket.emplace_back(volume);
+            else if ((*it)->get_mesh_shared_ptr() != volume->get_mesh_shared_ptr()) {
+                std::shared_ptr<const TriangleMesh> shared = (*it)->get_mesh_shared_ptr();
+                volume->set_mesh(shared);
+                ++ num_deduplicated;
+            }
+        }
+    if (num_deduplicated > 0)
+        BOOST_LOG_TRIVIAL(debug) << "Deduplicated " << num_deduplicated << " mesh payloads between model volumes.";
+    return num_deduplicated;
+}
+
 void Model::adjust_min_z()
 {
     if (objects.empty())
@@ -732,6 +794,8 @@ void ModelObject::assign_new_unique_ids_recursive()
     for (ModelInstance *model_instance : this->instances)
         model_instance->assign_new_unique_ids_recursive();
     this->layer_height_profile.set_new_unique_id();
+    this->sla_support_points.set_new_unique_id();
+    this->sla_drain_holes.set_new_unique_id();
 }
 
 // Clone this ModelObject including its volumes and instances, keep the IDs of the copies equal to the original.
@@ -233,6 +233,52 @@ private:
     friend class ModelObject;
 };
 
+// Vector of SLA support points or drain holes of a ModelObject. The vector carries a timestamp,
+// therefore the Undo / Redo stack will only serialize the vector if it was modified since the last
+// snapshot was taken, see LayerHeightProfile.
+template<typename DataType>
+class SLAPoints final : public ObjectWithTimestamp {
+public:
+    // Assign the content if the timestamp differs, don't assign an ObjectID.
+    void assign(const SLAPoints &rhs) { if (! this->timestamp_matches(rhs)) { m_data = rhs.m_data; this->copy_timestamp(rhs); } }
+    void assign(SLAPoints &&rhs) { if (! this->timestamp_matches(rhs)) { m_data = std::move(rhs.m_data); this->copy_timestamp(rhs); } }
+
+    const DataType&       get() const throw() { return m_data; }
+    bool                  empty() const throw() { return m_data.empty(); }
+    size_t                size() const throw() { return m_data.size(); }
+    void                  set(const DataType &data) { if (m_data != data) { m_data = data; this->touch(); } }
+    void                  set(DataType &&data) { if (m_data != data) { m_data = std::move(data); this->touch(); } }
+    void                  clear() { m_data.clear(); this->touch(); }
+    // Return a mutable reference to the data, assuming the caller will modify them.
+    DataType&             modify() { this->touch(); return m_data; }
+
+    template<class Archive> void serialize(Archive &ar)
+    {
+        ar(cereal::base_class<ObjectWithTimestamp>(this), m_data);
+    }
+
+private:
+    // Constructors to be only called by derived classes.
+    // Default constructor to assign a unique ID.
+    explicit SLAPoints() = default;
+    // Constructor with ignored int parameter to assign an invalid ID, to be replaced
+    // by an existing ID copied from elsewhere.
+    explicit SLAPoints(int) : ObjectWithTimestamp(-1) {}
+    // Copy constructor copies the ID.
+    explicit SLAPoints(const SLAPoints &rhs) = default;
+    // Move constructor copies the ID.
+    explicit SLAPoints(SLAPoints &&rhs) = default;
+
+    // called by ModelObject::assign_copy()
+    SLAPoints& operator=(const SLAPoints &rhs) = default;
+    SLAPoints& operator=(SLAPoints &&rhs) = default;
+
+    DataType m_data;
+
+    // to access set_new_unique_id() when copy / pasting an object
+    friend class ModelObject;
+};
+
 enum class CutConnectorType : int {
     Plug
     , Dowel
@@ -358,13 +404,13 @@ public:
     // This vector holds position of selected support points for SLA. The data are
     // saved in mesh coordinates to allow using them for several instances.
     // The format is (x, y, z, point_size, supports_island)
-    sla::SupportPoints      sla_support_points;
+    SLAPoints<sla::SupportPoints> sla_support_points;
     // To keep track of where the points came from (used for synchronization between
     // the SLA gizmo and the backend).
     sla::PointsStatus       sla_points_status = sla::PointsStatus::NoPoints;
 
     // Holes to be drilled into the object so resin can flow out
-    sla::DrainHoles         sla_drain_holes;
+    SLAPoints<sla::DrainHoles>    sla_drain_holes;
 
     // Connectors to be added into the object before cut and are used to create a solid/negative volumes during a cut perform
     CutConnectors           cut_connectors;
@@ -516,18 +562,20 @@ private:
         assert(this->config.id().valid());
         assert(this->layer_height_profile.id().valid());
     }
-    explicit ModelObject(int) : ObjectBase(-1), config(-1), layer_height_profile(-1), origin_translation(Vec3d::Zero())
-    { 
-        assert(this->id().invalid()); 
+    explicit ModelObject(int) : ObjectBase(-1), config(-1), layer_height_profile(-1), sla_support_points(-1), sla_drain_holes(-1), origin_translation(Vec3d::Zero())
+    {
+        assert(this->id().invalid());
         assert(this->config.id().invalid());
         assert(this->layer_height_profile.id().invalid());
+        assert(this->sla_support_points.id().invalid());
+        assert(this->sla_drain_holes.id().invalid());
     }
 	~ModelObject();
 	void assign_new_unique_ids_recursive() override;
 
     // To be able to return an object from own copy / clone methods. Hopefully the compiler will do the "Copy elision"
     // (Omits copy and move(since C++11) constructors, resulting in zero - copy pass - by - value semantics).
-    ModelObject(const ModelObject &rhs) : ObjectBase(-1), config(-1), layer_height_profile(-1), m_model(rhs.m_model) { 
+    ModelObject(const ModelObject &rhs) : ObjectBase(-1), config(-1), layer_height_profile(-1), sla_support_points(-1), sla_drain_holes(-1), m_model(rhs.m_model) {
     	assert(this->id().invalid()); 
         assert(this->config.id().invalid()); 
         assert(this->layer_height_profile.id().invalid());
@@ -543,7 +591,7 @@ private:
         assert(this->config.id() == rhs.config.id());
         assert(this->layer_height_profile.id() == rhs.layer_height_profile.id());
     }
-    explicit ModelObject(ModelObject &&rhs) : ObjectBase(-1), config(-1), layer_height_profile(-1) { 
+    explicit ModelObject(ModelObject &&rhs) : ObjectBase(-1), config(-1), layer_height_profile(-1), sla_support_points(-1), sla_drain_holes(-1) {
     	assert(this->id().invalid()); 
         assert(this->config.id().invalid()); 
         assert(this->layer_height_profile.id().invalid());
@@ -585,10 +633,12 @@ private:
         assert(this->layer_height_profile.id() == rhs.layer_height_profile.id());
     	return *this;
     }
-	void set_new_unique_id() { 
-        ObjectBase::set_new_unique_id(); 
+	void set_new_unique_id() {
+        ObjectBase::set_new_unique_id();
         this->config.set_new_unique_id();
         this->layer_height_profile.set_new_unique_id();
+        this->sla_support_points.set_new_unique_id();
+        this->sla_drain_holes.set_new_unique_id();
     }
 
     OBJECTBASE_DERIVED_COPY_MOVE_CLONE(ModelObject)
@@ -629,18 +679,22 @@ private:
 	friend class cereal::access;
 	friend class UndoRedo::StackImpl;
 	// Used for deserialization -> Don't allocate any IDs for the ModelObject or its config.
-	ModelObject() : 
-        ObjectBase(-1), config(-1), layer_height_profile(-1) {
-		assert(this->id().invalid()); 
+	ModelObject() :
+        ObjectBase(-1), config(-1), layer_height_profile(-1), sla_support_points(-1), sla_drain_holes(-1) {
+		assert(this->id().invalid());
         assert(this->config.id().invalid());
         assert(this->layer_height_profile.id().invalid());
+        assert(this->sla_support_points.id().invalid());
+        assert(this->sla_drain_holes.id().invalid());
 	}
 	template<class Archive> void serialize(Archive &ar) {
 		ar(cereal::base_class<ObjectBase>(this));
 		Internal::StaticSerializationWrapper<ModelConfigObject> config_wrapper(config);
         Internal::StaticSerializationWrapper<LayerHeightProfile> layer_heigth_profile_wrapper(layer_height_profile);
-        ar(name, input_file, instances, volumes, config_wrapper, layer_config_ranges, layer_heigth_profile_wrapper, 
-            sla_support_points, sla_points_status, sla_drain_holes, printable, origin_translation,
+        Internal::StaticSerializationWrapper<SLAPoints<sla::SupportPoints>> sla_support_points_wrapper(sla_support_points);
+        Internal::StaticSerializationWrapper<SLAPoints<sla::DrainHoles>> sla_drain_holes_wrapper(sla_drain_holes);
+        ar(name, input_file, instances, volumes, config_wrapper, layer_config_ranges, layer_heigth_profile_wrapper,
+            sla_support_points_wrapper, sla_points_status, sla_drain_holes_wrapper, printable, origin_translation,
             m_bounding_box_approx, m_bounding_box_approx_valid, 
             m_bounding_box_exact, m_bounding_box_exact_valid, m_min_max_z_valid,
             m_raw_bounding_box, m_raw_bounding_box_valid, m_raw_mesh_bounding_box, m_raw_mesh_bounding_box_valid,
@@ -1310,6 +1364,9 @@ public:
     bool          looks_like_saved_in_meters() const;
     void          convert_from_meters(bool only_small_volumes);
     int           removed_objects_with_zero_volume();
+    // Share a single immutable TriangleMesh payload between volumes with bitwise identical geometry,
+    // e.g. a plate of repeated parts imported as separate objects. Returns the number of mesh copies dropped.
+    size_t        deduplicate_mesh_payloads();
 
     // Ensures that the min z of the model is not negative
     void 		  adjust_min_z();
@@ -23,31 +23,49 @@ void MultiPoint::scale(double factor_x, double factor_y)
     }
 }
 
+// Map the contiguous coordinate buffer of a point vector as a single 2xN
+// matrix, so the transformations below run through Eigen's batched kernels
+// instead of point-by-point scalar code.
+static inline auto mapped_points(Points &points)
+{
+    return Eigen::Map<Eigen::Matrix<coord_t, 2, Eigen::Dynamic>>(
+        points.front().data(), 2, points.size());
+}
+
 void MultiPoint::translate(const Point &v)
 {
-    for (Point &pt : points)
-        pt += v;
+    if (points.empty())
+        return;
+
+    mapped_points(points).colwise() += v;
 }
 
 void MultiPoint::rotate(double cos_angle, double sin_angle)
 {
-    for (Point &pt : this->points) {
-        double cur_x = double(pt(0));
-        double cur_y = double(pt(1));
-        pt(0) = coord_t(round(cos_angle * cur_x - sin_angle * cur_y));
-        pt(1) = coord_t(round(cos_angle * cur_y + sin_angle * cur_x));
-    }
+    if (points.empty())
+        return;
+
+    Eigen::Matrix2d rot;
+    rot << cos_angle, - sin_angle,
+           sin_angle,   cos_angle;
+    auto map = mapped_points(points);
+    map = (rot * map.cast<double>()).array().round().cast<coord_t>();
 }
 
 void MultiPoint::rotate(double angle, const Point &center)
 {
+    if (points.empty())
+        return;
+
     double s = sin(angle);
     double c = cos(angle);
-    for (Point &pt : points) {
-        Vec2crd v(pt - center);
-        pt(0) = (coord_t)round(double(center(0)) + c * v[0] - s * v[1]);
-        pt(1) = (coord_t)round(double(center(1)) + c * v[1] + s * v[0]);
-    }
+    Eigen::Matrix2d rot;
+    rot << c, - s,
+           s,   c;
+    Vec2d cntr = center.cast<double>();
+    auto map = mapped_points(points);
+    map = ((rot * (map.cast<double>().colwise() - cntr)).colwise() + cntr)
+              .array().round().cast<coord_t>();
 }
 
 int MultiPoint::find_point(const Point &point) const
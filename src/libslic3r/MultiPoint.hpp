@@ -8,6 +8,7 @@
 
 #include "libslic3r.h"
 #include <algorithm>
+#include <cmath>
 #include <vector>
 #include "Line.hpp"
 #include "Point.hpp"
@@ -241,12 +242,28 @@ extern BoundingBox get_extents(const MultiPoint &mp);
 extern BoundingBox get_extents_rotated(const Points &points, double angle);
 extern BoundingBox get_extents_rotated(const MultiPoint &mp, double angle);
 
+// Sum of the Euclidean segment lengths of an open polyline.
+// Processed in blocks: the squared segment lengths are gathered into a small stack buffer first
+// and the square roots are taken in a second pass, so that the compiler may vectorize both loops
+// (fused multiply-adds for the squares, packed square roots for the second pass) instead of
+// serializing a scalar sqrt per segment.
 inline double length(const Points::const_iterator begin, const Points::const_iterator end) {
     double total = 0;
-    if (begin != end) {
-        auto it = begin;
-        for (auto it_prev = it ++; it != end; ++ it, ++ it_prev)
-            total += (*it - *it_prev).cast<double>().norm();
+    if (auto num_points = end - begin; num_points > 1) {
+        const size_t num_segments = size_t(num_points) - 1;
+        const Point *pts          = &*begin;
+        static constexpr const size_t BlockSize = 16;
+        double sqr_lengths[BlockSize];
+        for (size_t seg = 0; seg < num_segments; seg += BlockSize) {
+            const size_t cnt = std::min(BlockSize, num_segments - seg);
+            for (size_t i = 0; i < cnt; ++ i) {
+                double dx = double(pts[seg + i + 1].x()) - double(pts[seg + i].x());
+                double dy = double(pts[seg + i + 1].y()) - double(pts[seg + i].y());
+                sqr_lengths[i] = dx * dx + dy * dy;
+            }
+            for (size_t i = 0; i < cnt; ++ i)
+                total += std::sqrt(sqr_lengths[i]);
+        }
     }
     return total;
 }
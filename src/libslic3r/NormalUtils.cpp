@@ -4,6 +4,8 @@
 ///|/
 #include "NormalUtils.hpp"
 
+#include <tbb/parallel_for.h>
+
 using namespace Slic3r;
 
 Vec3f NormalUtils::create_triangle_normal(
@@ -21,32 +23,47 @@ Vec3f NormalUtils::create_triangle_normal(
 std::vector<Vec3f> NormalUtils::create_triangle_normals(
     const indexed_triangle_set &its)
 {
-    std::vector<Vec3f> normals;
-    normals.reserve(its.indices.size());
-    for (const Vec3crd &index : its.indices) {
-        normals.push_back(create_triangle_normal(index, its.vertices));
-    }
+    std::vector<Vec3f> normals(its.indices.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, its.indices.size()),
+    [&its, &normals](const tbb::blocked_range<size_t> &range) {
+        for (size_t i = range.begin(); i < range.end(); ++i)
+            normals[i] = create_triangle_normal(its.indices[i], its.vertices);
+    });
     return normals;
 }
 
+// divide each accumulated normal by its accumulated weight, in parallel
+static void normalize_normals(std::vector<Vec3f> &normals, const std::vector<float> &count)
+{
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, normals.size()),
+    [&normals, &count](const tbb::blocked_range<size_t> &range) {
+        for (size_t i = range.begin(); i < range.end(); ++i)
+            normals[i] /= count[i];
+    });
+}
+
 NormalUtils::Normals NormalUtils::create_normals_average_neighbor(
     const indexed_triangle_set &its)
 {
     size_t             count_vertices = its.vertices.size();
     std::vector<Vec3f> normals(count_vertices, Vec3f(.0f, .0f, .0f));
     std::vector<unsigned int> count(count_vertices, 0);
+    // the expensive per-triangle normals are computed in parallel,
+    // the scatter below stays serial to keep the accumulation order stable
+    std::vector<Vec3f> triangle_normals = create_triangle_normals(its);
     for (const Vec3crd &indice : its.indices) {
-        Vec3f normal = create_triangle_normal(indice, its.vertices);
+        const Vec3f &normal = triangle_normals[&indice - &its.indices.front()];
         for (int i = 0; i < 3; ++i) {
             normals[indice[i]] += normal;
             ++count[indice[i]];
         }
     }
     // normalize to size 1
-    for (auto &normal : normals) {
-        size_t index = &normal - &normals.front();
-        normal /= static_cast<float>(count[index]);
-    }
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, normals.size()),
+    [&normals, &count](const tbb::blocked_range<size_t> &range) {
+        for (size_t i = range.begin(); i < range.end(); ++i)
+            normals[i] /= static_cast<float>(count[i]);
+    });
     return normals;
 }
 
@@ -78,22 +95,31 @@ NormalUtils::Normals NormalUtils::create_normals_angle_weighted(
     size_t             count_vertices = its.vertices.size();
     std::vector<Vec3f> normals(count_vertices, Vec3f(.0f, .0f, .0f));
     std::vector<float> count(count_vertices, 0.f);
-    for (const Vec3crd &indice : its.indices) {
-        Vec3f normal = create_triangle_normal(indice, its.vertices);
-        Vec3f angles(indice_angle(0, indice, its.vertices),
-                     indice_angle(1, indice, its.vertices), 0.f);
-        angles[2] = (M_PI - angles[0] - angles[1]);
+    // per-triangle normals and corner weights are independent, compute them in parallel
+    std::vector<Vec3f> triangle_normals(its.indices.size());
+    std::vector<Vec3f> triangle_weights(its.indices.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, its.indices.size()),
+    [&its, &triangle_normals, &triangle_weights](const tbb::blocked_range<size_t> &range) {
+        for (size_t face_idx = range.begin(); face_idx < range.end(); ++face_idx) {
+            const Vec3crd &indice = its.indices[face_idx];
+            triangle_normals[face_idx] = create_triangle_normal(indice, its.vertices);
+            Vec3f angles(indice_angle(0, indice, its.vertices),
+                         indice_angle(1, indice, its.vertices), 0.f);
+            angles[2] = (M_PI - angles[0] - angles[1]);
+            triangle_weights[face_idx] = angles;
+        }
+    });
+    // serial scatter keeps the float accumulation order stable
+    for (size_t face_idx = 0; face_idx < its.indices.size(); ++face_idx) {
+        const Vec3crd &indice = its.indices[face_idx];
         for (int i = 0; i < 3; ++i) {
-            const float &weight = angles[i];
-            normals[indice[i]] += normal * weight;
+            const float &weight = triangle_weights[face_idx][i];
+            normals[indice[i]] += triangle_normals[face_idx] * weight;
             count[indice[i]] += weight;
         }
     }
     // normalize to size 1
-    for (auto &normal : normals) {
-        size_t index = &normal - &normals.front();
-        normal /= count[index];
-    }
+    normalize_normals(normals, count);
     return normals;
 }
 
@@ -104,29 +130,37 @@ NormalUtils::Normals NormalUtils::create_normals_nelson_weighted(
     std::vector<Vec3f> normals(count_vertices, Vec3f(.0f, .0f, .0f));
     std::vector<float> count(count_vertices, 0.f);
     const std::vector<stl_vertex> &vertices = its.vertices;
-    for (const Vec3crd &indice : its.indices) {
-        Vec3f normal = create_triangle_normal(indice, vertices);
+    // per-triangle normals and corner weights are independent, compute them in parallel
+    std::vector<Vec3f> triangle_normals(its.indices.size());
+    std::vector<Vec3f> triangle_weights(its.indices.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, its.indices.size()),
+    [&its, &vertices, &triangle_normals, &triangle_weights](const tbb::blocked_range<size_t> &range) {
+        for (size_t face_idx = range.begin(); face_idx < range.end(); ++face_idx) {
+            const Vec3crd &indice = its.indices[face_idx];
+            triangle_normals[face_idx] = create_triangle_normal(indice, vertices);
 
-        const stl_vertex &v0 = vertices[indice[0]];
-        const stl_vertex &v1 = vertices[indice[1]];
-        const stl_vertex &v2 = vertices[indice[2]];
+            const stl_vertex &v0 = vertices[indice[0]];
+            const stl_vertex &v1 = vertices[indice[1]];
+            const stl_vertex &v2 = vertices[indice[2]];
 
-        float e0 = (v0 - v1).norm();
-        float e1 = (v1 - v2).norm();
-        float e2 = (v2 - v0).norm();
+            float e0 = (v0 - v1).norm();
+            float e1 = (v1 - v2).norm();
+            float e2 = (v2 - v0).norm();
 
-        Vec3f coefs(e0 * e2, e0 * e1, e1 * e2);
+            triangle_weights[face_idx] = Vec3f(e0 * e2, e0 * e1, e1 * e2);
+        }
+    });
+    // serial scatter keeps the float accumulation order stable
+    for (size_t face_idx = 0; face_idx < its.indices.size(); ++face_idx) {
+        const Vec3crd &indice = its.indices[face_idx];
         for (int i = 0; i < 3; ++i) {
-            const float &weight = coefs[i];
-            normals[indice[i]] += normal * weight;
+            const float &weight = triangle_weights[face_idx][i];
+            normals[indice[i]] += triangle_normals[face_idx] * weight;
             count[indice[i]] += weight;
         }
     }
     // normalize to size 1
-    for (auto &normal : normals) {
-        size_t index = &normal - &normals.front();
-        normal /= count[index];
-    }
+    normalize_normals(normals, count);
     return normals;
 }
 
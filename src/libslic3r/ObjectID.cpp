@@ -6,7 +6,22 @@
 
 namespace Slic3r {
 
-size_t ObjectBase::s_last_id = 0;
+std::atomic<size_t> ObjectBase::s_last_id { 0 };
+
+ObjectID ObjectBase::generate_new_id()
+{
+    // Number of IDs a thread reserves from the shared counter at once. IDs of objects
+    // created by different threads will interleave at the block granularity, which is
+    // fine: the IDs only need to be unique, nothing relies on them being consecutive.
+    constexpr size_t IdBlockSize = 64;
+    static thread_local size_t id_next = 0;
+    static thread_local size_t id_end  = 0;
+    if (id_next == id_end) {
+        id_next = s_last_id.fetch_add(IdBlockSize, std::memory_order_relaxed) + 1;
+        id_end  = id_next + IdBlockSize;
+    }
+    return ObjectID(id_next ++);
+}
 
 // Unique object / instance ID for the wipe tower.
 ObjectID wipe_tower_object_id()
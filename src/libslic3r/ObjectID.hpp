@@ -5,6 +5,8 @@
 #ifndef slic3r_ObjectID_hpp_
 #define slic3r_ObjectID_hpp_
 
+#include <atomic>
+
 #include <cereal/access.hpp>
 #include <cereal/types/base_class.hpp>
 
@@ -49,8 +51,8 @@ private:
 // to synchronize the front end (UI) with the back end (BackgroundSlicingProcess / Print / PrintObject).
 // Also base for Print, PrintObject, SLAPrint, SLAPrintObject to provide a unique ID for matching Model / ModelObject
 // with their corresponding Print / PrintObject objects by the notification center at the UI when processing back-end warnings.
-// Achtung! The s_last_id counter is not thread safe, so it is expected, that the ObjectBase derived instances
-// are only instantiated from the main thread.
+// The s_last_id counter is atomic, so ObjectBase derived instances may be instantiated
+// from multiple threads (for example by the concurrent slicing jobs of the CLI).
 class ObjectBase
 {
 public:
@@ -85,8 +87,10 @@ protected:
 private:
     ObjectID                m_id;
 
-	static inline ObjectID  generate_new_id() { return ObjectID(++ s_last_id); }
-    static size_t           s_last_id;
+    // Draws from a thread local block of IDs, refilled from s_last_id, so threads
+    // constructing many objects in parallel do not contend on the shared counter.
+	static ObjectID             generate_new_id();
+    static std::atomic<size_t>  s_last_id;
 	
 	friend ObjectID wipe_tower_object_id();
 	friend ObjectID wipe_tower_instance_id();
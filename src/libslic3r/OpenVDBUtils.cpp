@@ -20,6 +20,8 @@
 #include <openvdb/tools/LevelSetRebuild.h>
 #include <openvdb/tools/FastSweeping.h>
 
+#include <tbb/parallel_for.h>
+
 namespace Slic3r {
 
 struct VoxelGrid
@@ -107,15 +109,24 @@ VoxelGridPtr mesh_to_grid(const indexed_triangle_set &mesh,
 
     Interrupter interrupter{params.statusfn()};
 
-    openvdb::FloatGrid::Ptr grid;
-    for (auto &m : meshparts) {
-        auto subgrid = openvdb::tools::meshToVolume<openvdb::FloatGrid>(
+    // Voxelize the parts concurrently. meshToVolume is parallelized
+    // internally, but small parts do not saturate the machine on their own,
+    // so let the scheduler interleave them.
+    std::vector<openvdb::FloatGrid::Ptr> subgrids(meshparts.size());
+    tbb::parallel_for(size_t(0), meshparts.size(),
+                      [&meshparts, &subgrids, &trafo, &params, &interrupter](size_t i) {
+        subgrids[i] = openvdb::tools::meshToVolume<openvdb::FloatGrid>(
             interrupter,
-            TriangleMeshDataAdapter{m, trafo},
+            TriangleMeshDataAdapter{meshparts[i], trafo},
             openvdb::math::Transform{},
             params.exterior_bandwidth(),
             params.interior_bandwidth());
+    });
 
+    // Merge the part grids in part order, releasing each of them as soon as
+    // it is consumed to keep the peak memory at bay.
+    openvdb::FloatGrid::Ptr grid;
+    for (openvdb::FloatGrid::Ptr &subgrid : subgrids) {
         if (interrupter.wasInterrupted())
             break;
 
@@ -123,6 +134,8 @@ VoxelGridPtr mesh_to_grid(const indexed_triangle_set &mesh,
             openvdb::tools::csgUnion(*grid, *subgrid);
         else if (subgrid)
             grid = std::move(subgrid);
+
+        subgrid.reset();
     }
 
     if (interrupter.wasInterrupted())
@@ -7,10 +7,15 @@
 ///|/
 #include "PNGReadWrite.hpp"
 
+#include "Execution/ExecutionTBB.hpp"
+
+#include <algorithm>
+#include <cstring>
 #include <memory>
 
 #include <cstdio>
 #include <png.h>
+#include <zlib.h>
 
 #include <boost/log/trivial.hpp>
 #include <boost/nowide/cstdio.hpp>
@@ -220,6 +225,165 @@ bool write_gray_to_file(const std::string &file_name_utf8, size_t width, size_t
     return write_gray_to_file(file_name_utf8.c_str(), width, height, data_gray.data());
 }
 
+// Write a 32 bit value in the big endian byte order used by PNG.
+static inline void store_be32(uint8_t *dst, uint32_t value)
+{
+    dst[0] = uint8_t(value >> 24);
+    dst[1] = uint8_t(value >> 16);
+    dst[2] = uint8_t(value >> 8);
+    dst[3] = uint8_t(value);
+}
+
+// Emit one PNG chunk: length, type, payload, CRC over type and payload.
+static void write_png_chunk(FILE *fp, const char (&type)[5], const uint8_t *data, size_t size)
+{
+    uint8_t header[8];
+    store_be32(header, uint32_t(size));
+    memcpy(header + 4, type, 4);
+    fwrite(header, 1, sizeof(header), fp);
+    if (size > 0)
+        fwrite(data, 1, size, fp);
+    uLong crc = crc32(0L, Z_NULL, 0);
+    crc = crc32(crc, header + 4, 4);
+    if (size > 0)
+        crc = crc32(crc, data, uInt(size));
+    uint8_t crc_be[4];
+    store_be32(crc_be, uint32_t(crc));
+    fwrite(crc_be, 1, sizeof(crc_be), fp);
+}
+
+// Parallel counterpart of write_rgb_or_gray_to_file: the scanlines are cut
+// into horizontal strips, each strip is filtered and raw-deflated by its own
+// worker. Non-final strips are flushed with Z_FULL_FLUSH, which ends on a
+// byte aligned block boundary and resets the dictionary, so the strips are
+// independent of each other and their concatenation, wrapped with a zlib
+// header and a combined Adler-32 trailer, forms one valid zlib stream.
+static bool write_rgb_or_gray_to_file_parallel(const char *file_name_utf8, size_t width, size_t height, int png_color_type, const uint8_t *data)
+{
+    if (width == 0 || height == 0)
+        return false;
+
+    const size_t pixel_bytes = png_color_type == PNG_COLOR_TYPE_RGB ? 3 : 1;
+    const size_t line_width  = width * pixel_bytes;
+
+    // One strip per worker, but keep the strips at least 64 scanlines tall,
+    // small images degrade to a single strip.
+    size_t nstrips = std::max(size_t(1),
+        std::min(execution::max_concurrency(ex_tbb), (height + 63) / 64));
+    const size_t rows_per_strip = (height + nstrips - 1) / nstrips;
+    nstrips = (height + rows_per_strip - 1) / rows_per_strip;
+
+    struct Strip {
+        std::vector<uint8_t> deflated;
+        uLong                adler = 0;
+        size_t               filtered_size = 0;
+        bool                 ok = false;
+    };
+    std::vector<Strip> strips(nstrips);
+
+    execution::for_each(ex_tbb, size_t(0), nstrips, [&](size_t i) {
+        const size_t row_begin = i * rows_per_strip;
+        const size_t row_end   = std::min(height, row_begin + rows_per_strip);
+
+        // Prepend the per scanline filter byte. Filter type None keeps the
+        // strips self contained and is cheap, the concurrency more than
+        // makes up for the slightly weaker compression.
+        std::vector<uint8_t> filtered((line_width + 1) * (row_end - row_begin));
+        uint8_t *dst = filtered.data();
+        for (size_t r = row_begin; r < row_end; ++ r) {
+            *dst ++ = 0;
+            memcpy(dst, data + r * line_width, line_width);
+            dst += line_width;
+        }
+
+        Strip &strip = strips[i];
+        strip.filtered_size = filtered.size();
+        strip.adler = adler32(adler32(0L, Z_NULL, 0), filtered.data(), uInt(filtered.size()));
+
+        // Raw deflate without the zlib wrapper, the wrapper is emitted by the
+        // writer below around the concatenated strips.
+        z_stream zs;
+        memset(&zs, 0, sizeof(zs));
+        if (deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+            return;
+        strip.deflated.resize(size_t(deflateBound(&zs, uLong(filtered.size()))) + 16);
+        zs.next_in   = filtered.data();
+        zs.avail_in  = uInt(filtered.size());
+        zs.next_out  = strip.deflated.data();
+        zs.avail_out = uInt(strip.deflated.size());
+        const bool last   = i + 1 == strips.size();
+        int        status = deflate(&zs, last ? Z_FINISH : Z_FULL_FLUSH);
+        strip.ok = last ? status == Z_STREAM_END : status == Z_OK;
+        strip.deflated.resize(zs.total_out);
+        deflateEnd(&zs);
+    });
+
+    for (const Strip &strip : strips)
+        if (! strip.ok) {
+            BOOST_LOG_TRIVIAL(error) << "write_png_file: deflating an image strip failed";
+            return false;
+        }
+
+    FILE *fp = boost::nowide::fopen(file_name_utf8, "wb");
+    if (! fp) {
+        BOOST_LOG_TRIVIAL(error) << "write_png_file: File could not be opened for writing: " << file_name_utf8;
+        return false;
+    }
+
+    static const uint8_t png_signature[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    fwrite(png_signature, 1, sizeof(png_signature), fp);
+
+    uint8_t ihdr[13] = {};
+    store_be32(ihdr, uint32_t(width));
+    store_be32(ihdr + 4, uint32_t(height));
+    ihdr[8] = 8; // bit depth
+    ihdr[9] = uint8_t(png_color_type);
+    // compression method, filter method and interlacing stay zero.
+    write_png_chunk(fp, "IHDR", ihdr, sizeof(ihdr));
+
+    // Decoders concatenate the data of consecutive IDAT chunks, thus the
+    // zlib header, the strips and the Adler-32 trailer may each ship in a
+    // chunk of their own.
+    static const uint8_t zlib_header[] = { 0x78, 0x9c };
+    write_png_chunk(fp, "IDAT", zlib_header, sizeof(zlib_header));
+
+    uLong adler = adler32(0L, Z_NULL, 0);
+    for (const Strip &strip : strips) {
+        write_png_chunk(fp, "IDAT", strip.deflated.data(), strip.deflated.size());
+        adler = adler32_combine(adler, strip.adler, z_off_t(strip.filtered_size));
+    }
+
+    uint8_t adler_be[4];
+    store_be32(adler_be, uint32_t(adler));
+    write_png_chunk(fp, "IDAT", adler_be, sizeof(adler_be));
+
+    write_png_chunk(fp, "IEND", nullptr, 0);
+
+    bool result = ferror(fp) == 0;
+    ::fclose(fp);
+    return result;
+}
+
+bool write_rgb_to_file_parallel(const char *file_name_utf8, size_t width, size_t height, const uint8_t *data_rgb)
+{
+    return write_rgb_or_gray_to_file_parallel(file_name_utf8, width, height, PNG_COLOR_TYPE_RGB, data_rgb);
+}
+
+bool write_rgb_to_file_parallel(const std::string &file_name_utf8, size_t width, size_t height, const uint8_t *data_rgb)
+{
+    return write_rgb_to_file_parallel(file_name_utf8.c_str(), width, height, data_rgb);
+}
+
+bool write_gray_to_file_parallel(const char *file_name_utf8, size_t width, size_t height, const uint8_t *data_gray)
+{
+    return write_rgb_or_gray_to_file_parallel(file_name_utf8, width, height, PNG_COLOR_TYPE_GRAY, data_gray);
+}
+
+bool write_gray_to_file_parallel(const std::string &file_name_utf8, size_t width, size_t height, const uint8_t *data_gray)
+{
+    return write_gray_to_file_parallel(file_name_utf8.c_str(), width, height, data_gray);
+}
+
 // Scaled variants are mostly useful for debugging purposes, for example to export images of low resolution distance fileds.
 // Scaling is done by multiplying rows and columns without any smoothing to emphasise the original pixels.
 // png_color_type is PNG_COLOR_TYPE_RGB or PNG_COLOR_TYPE_GRAY
@@ -82,6 +82,18 @@ bool write_gray_to_file(const char *file_name_utf8, size_t width, size_t height,
 bool write_gray_to_file(const std::string &file_name_utf8, size_t width, size_t height, const uint8_t *data_gray);
 bool write_gray_to_file(const std::string &file_name_utf8, size_t width, size_t height, const std::vector<uint8_t> &data_gray);
 
+// Parallel variants: the image is cut into horizontal strips which are
+// filtered and deflated concurrently, each strip flushed to a byte aligned
+// deflate block boundary so the pieces concatenate into one valid zlib stream
+// (emitted as one IDAT chunk per strip). The output is a standard PNG
+// readable by any decoder. Meant for callers writing many large images per
+// job, small images degrade to a single strip.
+bool write_rgb_to_file_parallel(const char *file_name_utf8, size_t width, size_t height, const uint8_t *data_rgb);
+bool write_rgb_to_file_parallel(const std::string &file_name_utf8, size_t width, size_t height, const uint8_t *data_rgb);
+// Grayscale variants
+bool write_gray_to_file_parallel(const char *file_name_utf8, size_t width, size_t height, const uint8_t *data_gray);
+bool write_gray_to_file_parallel(const std::string &file_name_utf8, size_t width, size_t height, const uint8_t *data_gray);
+
 // Scaled variants are mostly useful for debugging purposes, for example to export images of low resolution distance fileds.
 // Scaling is done by multiplying rows and columns without any smoothing to emphasise the original pixels.
 bool write_rgb_to_file_scaled(const char *file_name_utf8, size_t width, size_t height, const uint8_t *data_rgb, size_t scale);
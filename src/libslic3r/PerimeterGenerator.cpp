@@ -38,6 +38,8 @@
 #include <limits>
 #include <stack>
 #include <unordered_map>
+
+#include <tbb/parallel_for.h>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -1378,8 +1380,16 @@ void PerimeterGenerator::process_classic(
                         diff_ex(last, offset(offsets, float(ext_perimeter_width / 2.) + ClipperSafetyOffset)),
                         float(min_width / 2.));
                     // the maximum thickness of our thin wall area is equal to the minimum thickness of a single loop
-                    for (ExPolygon &ex : expp)
-                        ex.medial_axis(min_width, ext_perimeter_width + ext_perimeter_spacing2, &thin_walls);
+                    // the regions are independent, so each Voronoi diagram is computed in parallel,
+                    // results are appended in region order to keep the output deterministic
+                    std::vector<ThickPolylines> thin_walls_per_region(expp.size());
+                    tbb::parallel_for(tbb::blocked_range<size_t>(0, expp.size()),
+                        [&expp, &thin_walls_per_region, min_width, ext_perimeter_width, ext_perimeter_spacing2](const tbb::blocked_range<size_t> &range) {
+                            for (size_t i = range.begin(); i < range.end(); ++ i)
+                                expp[i].medial_axis(min_width, ext_perimeter_width + ext_perimeter_spacing2, &thin_walls_per_region[i]);
+                        });
+                    for (ThickPolylines &tw : thin_walls_per_region)
+                        append(thin_walls, std::move(tw));
                 }
                 if (params.spiral_vase && offsets.size() > 1) {
                 	// Remove all but the largest area polygon.
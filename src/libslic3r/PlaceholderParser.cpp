@@ -2352,6 +2352,12 @@ static std::string process_macro(const std::string &templ, client::MyContext &co
 
 std::string PlaceholderParser::process(const std::string &templ, unsigned int current_extruder_id, const DynamicConfig *config_override, DynamicConfig *config_outputs, ContextData *context_data) const
 {
+    // A template containing neither '{' nor '[' has no macros and no legacy variable expansions,
+    // therefore the grammar would just pass it through unmodified. Skip the spirit parser for such
+    // templates: plain custom G-code snippets are re-evaluated for every tool change and layer change.
+    if (templ.find_first_of("{[") == std::string::npos)
+        return templ;
+
     client::MyContext context;
     context.external_config 	= this->external_config();
     context.config              = &this->config();
@@ -16,6 +16,7 @@
 #include "Polyline.hpp"
 
 #include <ankerl/unordered_dense.h>
+#include <tbb/parallel_for.h>
 
 namespace Slic3r {
 
@@ -23,9 +24,10 @@ double Polygon::length() const
 {
     double l = 0;
     if (this->points.size() > 1) {
-        l = (this->points.back() - this->points.front()).cast<double>().norm();
-        for (size_t i = 1; i < this->points.size(); ++ i)
-            l += (this->points[i] - this->points[i - 1]).cast<double>().norm();
+        // Open contour length by the blocked kernel with a vectorizable deferred sqrt pass,
+        // plus the closing segment.
+        l = Slic3r::length(this->points);
+        l += (this->points.back() - this->points.front()).cast<double>().norm();
     }
     return l;
 }
@@ -106,10 +108,14 @@ bool Polygon::make_clockwise()
 
 void Polygon::douglas_peucker(double tolerance)
 {
+    // Close the polygon, simplify in place (the kernel supports reducing into
+    // its own input buffer), then drop the closing point again.
     this->points.push_back(this->points.front());
-    Points p = MultiPoint::douglas_peucker(this->points, tolerance);
-    p.pop_back();
-    this->points = std::move(p);
+    auto out_end = Slic3r::douglas_peucker<int64_t>(
+        this->points.begin(), this->points.end(), this->points.begin(), tolerance,
+        [](const Point &p) { return p; });
+    assert(out_end != this->points.begin());
+    this->points.erase(std::prev(out_end), this->points.end());
 }
 
 Polygons Polygon::simplify(double tolerance) const
@@ -658,6 +664,16 @@ Polygons polygons_simplify(const Polygons &source_polygons, double tolerance, bo
     return out;
 }
 
+void polygons_douglas_peucker(Polygons &polys, double tolerance)
+{
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, polys.size()),
+        [&polys, tolerance](const tbb::blocked_range<size_t> &range) {
+            for (size_t i = range.begin(); i < range.end(); ++ i)
+                if (! polys[i].points.empty())
+                    polys[i].douglas_peucker(tolerance);
+        });
+}
+
 // Do polygons match? If they match, they must have the same topology,
 // however their contours may be rotated.
 bool polygons_match(const Polygon &l, const Polygon &r)
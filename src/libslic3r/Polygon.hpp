@@ -166,6 +166,10 @@ inline void polygons_append(Polygons &dst, Polygons &&src)
 Polygons polygons_simplify(Polygons &&polys, double tolerance, bool strictly_simple = true);
 Polygons polygons_simplify(const Polygons &polys, double tolerance, bool strictly_simple = true);
 
+// Apply Douglas-Peucker simplification to each polygon of the batch in place,
+// parallelized over the polygons.
+void polygons_douglas_peucker(Polygons &polys, double tolerance);
+
 inline void polygons_rotate(Polygons &polys, double angle)
 {
     const double cos_angle = cos(angle);
@@ -33,10 +33,8 @@ const Point& Polyline::leftmost_point() const
 
 double Polyline::length() const
 {
-    double l = 0;
-    for (size_t i = 1; i < this->points.size(); ++ i)
-        l += (this->points[i] - this->points[i - 1]).cast<double>().norm();
-    return l;
+    // Blocked kernel with a vectorizable deferred sqrt pass.
+    return Slic3r::length(this->points);
 }
 
 Lines Polyline::lines() const
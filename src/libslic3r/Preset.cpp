@@ -977,6 +977,8 @@ Preset& PresetCollection::load_preset(const std::string &path, const std::string
 bool PresetCollection::save_current_preset(const std::string &new_name, bool detach)
 {
     bool is_saved_as_new{ false };
+    // The selected preset changes, the cached diffs are no more valid.
+    m_dirty_options_cache.invalidate();
     // 1) Find the preset with a new_name or create a new one,
     // initialize it with the edited config.
     auto it = this->find_preset_internal(new_name);
@@ -1354,7 +1356,13 @@ size_t PresetCollection::update_compatible_internal(const PresetWithVendorProfil
 bool PresetCollection::update_dirty()
 {
     bool was_dirty = this->get_selected_preset().is_dirty;
-    bool is_dirty  = current_is_dirty();
+    // Recalculate the full diff against the selected preset and keep it cached for the
+    // incremental update_dirty(opt_key) and for cached_dirty_options().
+    m_dirty_options_cache.selected = dirty_options(&this->get_edited_preset(), &this->get_selected_preset(), this->m_type != Preset::TYPE_FILAMENT);
+    m_dirty_options_cache.selected_valid = true;
+    // The diff against the system parent is only needed by the UI, recalculate it lazily.
+    m_dirty_options_cache.parent_valid = false;
+    bool is_dirty  = ! m_dirty_options_cache.selected.empty();
     this->get_selected_preset().is_dirty = is_dirty;
     this->get_edited_preset().is_dirty = is_dirty;
 
@@ -1390,11 +1398,10 @@ bool PresetCollection::is_independent_from_extruder_number_option(const std::str
     return independent_from_extruder_number_options.find(opt_key) != independent_from_extruder_number_options.end();
 }
 
-// Use deep_diff to correct return of changed options, considering individual options for each extruder.
-inline t_config_option_keys deep_diff(const ConfigBase &config_this, const ConfigBase &config_other)
+// Compare a single option of the two configs the way deep_diff() does, appending the changed
+// (sub)keys to diff, considering individual options for each extruder.
+static void deep_diff_option(const t_config_option_key &opt_key, const ConfigBase &config_this, const ConfigBase &config_other, t_config_option_keys &diff)
 {
-    t_config_option_keys diff;
-    for (const t_config_option_key &opt_key : config_this.keys()) {
         const ConfigOption *this_opt  = config_this.option(opt_key);
         const ConfigOption *other_opt = config_other.option(opt_key);
         if (this_opt != nullptr && other_opt != nullptr && *this_opt != *other_opt)
@@ -1435,7 +1442,14 @@ inline t_config_option_keys deep_diff(const ConfigBase &config_this, const Confi
                     diff.emplace_back(opt_key);
             }
         }
-    }
+}
+
+// Use deep_diff to correct return of changed options, considering individual options for each extruder.
+inline t_config_option_keys deep_diff(const ConfigBase &config_this, const ConfigBase &config_other)
+{
+    t_config_option_keys diff;
+    for (const t_config_option_key &opt_key : config_this.keys())
+        deep_diff_option(opt_key, config_this, config_other, diff);
     return diff;
 }
 
@@ -1482,6 +1496,65 @@ std::vector<std::string> PresetCollection::dirty_options(const Preset *edited, c
     return changed;
 }
 
+void PresetCollection::update_dirty_options_cache_for(const std::string &opt_key, std::vector<std::string> &cache, const Preset *reference)
+{
+    // Drop the stale records of the option, including the "opt_key#N" sub keys of a vector option.
+    cache.erase(std::remove_if(cache.begin(), cache.end(), [&opt_key](const std::string &key) {
+        return key.compare(0, opt_key.size(), opt_key) == 0 && (key.size() == opt_key.size() || key[opt_key.size()] == '#');
+    }), cache.end());
+    if (reference == nullptr)
+        return;
+    const Preset &edited = this->get_edited_preset();
+    if (this->m_type == Preset::TYPE_FILAMENT) {
+        // Plain comparison, following dirty_options(deep_compare = false).
+        const ConfigOption *reference_opt = reference->config.option(opt_key);
+        const ConfigOption *edited_opt    = edited.config.option(opt_key);
+        if (reference_opt != nullptr && edited_opt != nullptr && *reference_opt != *edited_opt)
+            cache.emplace_back(opt_key);
+    } else
+        deep_diff_option(opt_key, edited.config, reference->config, cache);
+    for (auto &optional_key : optional_keys)
+        if (opt_key == optional_key && reference->config.has(opt_key) != edited.config.has(opt_key))
+            cache.emplace_back(opt_key);
+}
+
+// Variant of update_dirty() recomparing just a single possibly changed option against
+// the cached diffs, see the comment in Preset.hpp.
+bool PresetCollection::update_dirty(const std::string &opt_key)
+{
+    if (! m_dirty_options_cache.selected_valid)
+        return this->update_dirty();
+    // Strip the "#index" suffix of a vector sub field, the whole option is recompared.
+    const std::string base_key = opt_key.substr(0, opt_key.find('#'));
+    this->update_dirty_options_cache_for(base_key, m_dirty_options_cache.selected, &this->get_selected_preset());
+    if (m_dirty_options_cache.parent_valid)
+        this->update_dirty_options_cache_for(base_key, m_dirty_options_cache.parent, this->get_selected_preset_parent());
+    bool was_dirty = this->get_selected_preset().is_dirty;
+    bool is_dirty  = ! m_dirty_options_cache.selected.empty();
+    this->get_selected_preset().is_dirty = is_dirty;
+    this->get_edited_preset().is_dirty = is_dirty;
+
+    return was_dirty != is_dirty;
+}
+
+const std::vector<std::string>& PresetCollection::cached_dirty_options()
+{
+    if (! m_dirty_options_cache.selected_valid) {
+        m_dirty_options_cache.selected = dirty_options(&this->get_edited_preset(), &this->get_selected_preset(), this->m_type != Preset::TYPE_FILAMENT);
+        m_dirty_options_cache.selected_valid = true;
+    }
+    return m_dirty_options_cache.selected;
+}
+
+const std::vector<std::string>& PresetCollection::cached_different_from_parent_options()
+{
+    if (! m_dirty_options_cache.parent_valid) {
+        m_dirty_options_cache.parent = dirty_options(&this->get_edited_preset(), this->get_selected_preset_parent(), this->m_type != Preset::TYPE_FILAMENT);
+        m_dirty_options_cache.parent_valid = true;
+    }
+    return m_dirty_options_cache.parent;
+}
+
 // Select a new preset. This resets all the edits done to the currently selected preset.
 // If the preset with index idx does not exist, a first visible preset is selected.
 Preset& PresetCollection::select_preset(size_t idx)
@@ -1496,6 +1569,7 @@ Preset& PresetCollection::select_preset(size_t idx)
         m_presets[idx].is_visible = true;
 
     m_edited_preset = m_presets[idx];
+    m_dirty_options_cache.invalidate();
     bool default_visible = ! m_default_suppressed || m_idx_selected < m_num_default_presets;
     for (size_t i = 0; i < m_num_default_presets; ++i)
         m_presets[i].is_visible = default_visible;
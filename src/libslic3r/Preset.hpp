@@ -429,6 +429,7 @@ public:
     void            discard_current_changes() {
         m_presets[m_idx_selected].reset_dirty();
         m_edited_preset = m_presets[m_idx_selected];
+        m_dirty_options_cache.invalidate();
         // Don't save the resetted preset state as a "saved into project" state.
 //        update_saved_preset_from_current_preset();
     }
@@ -526,7 +527,20 @@ public:
     // Update a dirty flag of the current preset
     // Return true if the dirty flag changed.
     bool            update_dirty();
-    
+    // Variant of update_dirty() to be called when it is known that only opt_key (possibly
+    // with a "#index" suffix of a vector sub field) may have changed in the edited preset
+    // since the last update_dirty(): only that single option is recompared and the cached
+    // lists of dirty options are updated incrementally, which keeps the cost of an edit
+    // field change independent of the size of the profile. Callers modifying the edited
+    // preset in bulk have to call the full update_dirty() instead.
+    bool            update_dirty(const std::string &opt_key);
+    // Cached result of current_dirty_options(m_type != TYPE_FILAMENT), maintained by
+    // update_dirty() and recalculated lazily when invalid.
+    const std::vector<std::string>& cached_dirty_options();
+    // Cached result of current_different_from_parent_options(m_type != TYPE_FILAMENT),
+    // maintained by update_dirty(opt_key) and recalculated lazily when invalid.
+    const std::vector<std::string>& cached_different_from_parent_options();
+
     // Select a profile by its name. Return true if the selection changed.
     // Without force, the selection is only updated if the index changes.
     // With force, the changes are reverted if the new index is the same as the old index.
@@ -610,6 +624,21 @@ private:
     std::map<std::string, std::string> m_map_system_profile_renamed;
     // Initially this preset contains a copy of the selected preset. Later on, this copy may be modified by the user.
     Preset                  m_edited_preset;
+    // Caches of the option diffs of the edited preset against the selected preset and against
+    // its system parent, so that repeated queries while editing do not rescan the full option
+    // set. Maintained by update_dirty() / update_dirty(opt_key), invalidated whenever the
+    // edited preset or the selection change in bulk.
+    struct DirtyOptionsCache {
+        std::vector<std::string> selected;
+        std::vector<std::string> parent;
+        bool                     selected_valid{ false };
+        bool                     parent_valid{ false };
+        void invalidate() { selected_valid = false; parent_valid = false; }
+    };
+    DirtyOptionsCache       m_dirty_options_cache;
+    // Recompare a single option of the edited preset against the reference preset and
+    // update one cached list of dirty options accordingly.
+    void update_dirty_options_cache_for(const std::string &opt_key, std::vector<std::string> &cache, const Preset *reference);
     // Contains a copy of the last saved selected preset.
     Preset                  m_saved_preset;
 
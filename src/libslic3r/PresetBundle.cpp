@@ -11,6 +11,7 @@
 #include "Utils.hpp"
 #include "Model.hpp"
 #include "format.hpp"
+#include "Execution/ExecutionTBB.hpp"
 
 #include <algorithm>
 #include <set>
@@ -353,42 +354,58 @@ std::pair<PresetsConfigSubstitutions, std::string> PresetBundle::load_system_pre
     boost::filesystem::path     dir = (boost::filesystem::path(data_dir()) / "vendor").make_preferred();
     PresetsConfigSubstitutions  substitutions;
     std::string                 errors_cummulative;
-    bool                        first = true;
+
+    // Sort the vendor bundles by their file names, so that the merge order (and thus the duplicates
+    // reported) does not depend on the order the file system enumerates the directory entries.
+    std::vector<boost::filesystem::path> bundle_paths;
     for (auto &dir_entry : boost::filesystem::directory_iterator(dir))
-        if (Slic3r::is_ini_file(dir_entry)) {
-            std::string name = dir_entry.path().filename().string();
+        if (Slic3r::is_ini_file(dir_entry))
+            bundle_paths.emplace_back(dir_entry.path());
+    std::sort(bundle_paths.begin(), bundle_paths.end());
+
+    // Parse the vendor bundles in parallel, each into its own temporary PresetBundle.
+    // Parsing a config bundle only touches the target bundle, thus the jobs are independent.
+    struct LoadedBundle {
+        std::unique_ptr<PresetBundle> bundle;
+        PresetsConfigSubstitutions    substitutions;
+        std::string                   error;
+    };
+    std::vector<LoadedBundle> loaded(bundle_paths.size());
+    execution::for_each(ex_tbb, size_t(0), bundle_paths.size(), [&bundle_paths, &loaded, compatibility_rule](size_t i) {
+        LoadedBundle &out = loaded[i];
+        try {
+            // Load the config bundle, flatten it.
+            out.bundle = std::make_unique<PresetBundle>();
+            out.substitutions = out.bundle->load_configbundle(bundle_paths[i].string(), PresetBundle::LoadSystem, compatibility_rule).first;
+        } catch (const std::runtime_error &err) {
+            out.error = err.what();
+            out.bundle.reset();
+        }
+    });
+
+    // Reset this PresetBundle and merge the vendor bundles into it one by one. Report duplicate profiles.
+    this->reset(false);
+    for (size_t i = 0; i < loaded.size(); ++ i) {
+        LoadedBundle &in = loaded[i];
+        if (! in.error.empty()) {
+            errors_cummulative += in.error;
+            errors_cummulative += "\n";
+            continue;
+        }
+        append(substitutions, std::move(in.substitutions));
+        std::vector<std::string> duplicates = this->merge_presets(std::move(*in.bundle));
+        if (! duplicates.empty()) {
+            std::string name = bundle_paths[i].filename().string();
             // Remove the .ini suffix.
             name.erase(name.size() - 4);
-            try {
-                // Load the config bundle, flatten it.
-                if (first) {
-                    // Reset this PresetBundle and load the first vendor config.
-                    append(substitutions, this->load_configbundle(dir_entry.path().string(), PresetBundle::LoadSystem, compatibility_rule).first);
-                    first = false;
-                } else {
-                    // Load the other vendor configs, merge them with this PresetBundle.
-                    // Report duplicate profiles.
-                    PresetBundle other;
-                    append(substitutions, other.load_configbundle(dir_entry.path().string(), PresetBundle::LoadSystem, compatibility_rule).first);
-                    std::vector<std::string> duplicates = this->merge_presets(std::move(other));
-                    if (! duplicates.empty()) {
-                        errors_cummulative += "Vendor configuration file " + name + " contains the following presets with names used by other vendors: ";
-                        for (size_t i = 0; i < duplicates.size(); ++ i) {
-                            if (i > 0)
-                                errors_cummulative += ", ";
-                            errors_cummulative += duplicates[i];
-                        }
-                    }
-                }
-            } catch (const std::runtime_error &err) {
-                errors_cummulative += err.what();
-                errors_cummulative += "\n";
+            errors_cummulative += "Vendor configuration file " + name + " contains the following presets with names used by other vendors: ";
+            for (size_t j = 0; j < duplicates.size(); ++ j) {
+                if (j > 0)
+                    errors_cummulative += ", ";
+                errors_cummulative += duplicates[j];
             }
         }
-    if (first) {
-		// No config bundle loaded, reset.
-		this->reset(false);
-	}
+    }
 
 	this->update_system_maps();
     return std::make_pair(std::move(substitutions), errors_cummulative);
@@ -29,8 +29,10 @@
 #include "Flow.hpp"
 #include "Geometry/ConvexHull.hpp"
 #include "I18N.hpp"
+#include "LayerDataSpill.hpp"
 #include "ShortestPath.hpp"
 #include "Thread.hpp"
+#include "Tracing.hpp"
 #include "GCode.hpp"
 #include "GCode/WipeTower.hpp"
 #include "GCode/ConflictChecker.hpp"
@@ -41,9 +43,14 @@
 #include <float.h>
 
 #include <algorithm>
+#include <deque>
 #include <limits>
+#include <numeric>
 #include <string>
 #include <unordered_set>
+
+#include <tbb/flow_graph.h>
+#include <tbb/parallel_for.h>
 #include <boost/filesystem/path.hpp>
 #include <boost/format.hpp>
 #include <boost/log/trivial.hpp>
@@ -467,28 +474,42 @@ bool Print::sequential_print_horizontal_clearance_valid(const Print& print, Poly
             const double z_diff = Geometry::rotation_diff_z(model_instance0->get_matrix(), print_object->instances().front().model_instance->get_matrix());
             if (std::abs(z_diff) > EPSILON)
                 convex_hull0.rotate(z_diff);
-            // Now we check that no instance of convex_hull intersects any of the previously checked object instances.
+            // Collect the inflated hull of every instance, the overlap test runs below.
             for (const PrintInstance& instance : print_object->instances()) {
                 Polygon convex_hull = convex_hull0;
                 // instance.shift is a position of a centered object, while model object may not be centered.
                 // Convert the shift from the PrintObject's coordinates into ModelObject's coordinates by removing the centering offset.
                 convex_hull.translate(instance.shift - print_object->center_offset());
-                // if output needed, collect indices (inside convex_hulls_other) of intersecting hulls
-                for (size_t i = 0; i < convex_hulls_other.size(); ++i) {
-                    if (!intersection(convex_hulls_other[i], convex_hull).empty()) {
-                        if (polygons == nullptr)
-                            return false;
-                        else {
-                            intersecting_idxs.emplace_back(i);
-                            intersecting_idxs.emplace_back(convex_hulls_other.size());
-                        }
-                    }
-                }
                 convex_hulls_other.emplace_back(std::move(convex_hull));
             }
         }
     }
 
+    // Sweep and prune broad phase over the X axis: only pairs whose X intervals overlap
+    // are tested, thus a plate of non-colliding objects costs O(n log n) instead of
+    // testing all pairs with a full polygon intersection.
+    std::vector<BoundingBox> bboxes;
+    bboxes.reserve(convex_hulls_other.size());
+    for (const Polygon &hull : convex_hulls_other)
+        bboxes.emplace_back(get_extents(hull));
+    std::vector<size_t> order(convex_hulls_other.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&bboxes](size_t l, size_t r) { return bboxes[l].min.x() < bboxes[r].min.x(); });
+    for (size_t i = 0; i < order.size(); ++ i) {
+        size_t             idx_i  = order[i];
+        const BoundingBox &bbox_i = bboxes[idx_i];
+        for (size_t j = i + 1; j < order.size() && bboxes[order[j]].min.x() <= bbox_i.max.x(); ++ j) {
+            size_t idx_j = order[j];
+            // Narrow phase only after the bounding boxes overlap.
+            if (bbox_i.overlap(bboxes[idx_j]) && ! intersection(convex_hulls_other[idx_i], convex_hulls_other[idx_j]).empty()) {
+                if (polygons == nullptr)
+                    return false;
+                intersecting_idxs.emplace_back(idx_i);
+                intersecting_idxs.emplace_back(idx_j);
+            }
+        }
+    }
+
     if (!intersecting_idxs.empty()) {
         // use collected indices (inside convex_hulls_other) to update output
         std::sort(intersecting_idxs.begin(), intersecting_idxs.end());
@@ -586,11 +607,25 @@ std::string Print::validate(std::vector<std::string>* warnings) const
         return profile;
     };
 
+    // The max print height check below needs the layer height profile and the object
+    // layers of every object. Both are derived independently per object from data
+    // that is constant during validation, so compute them in parallel up front.
+    // The layer_height_profile lambda above then just serves the cached profiles.
+    layer_height_profiles.assign(m_objects.size(), std::vector<coordf_t>());
+    std::vector<std::vector<coordf_t>> object_layers(m_objects.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, m_objects.size()),
+        [this, &layer_height_profiles, &object_layers](const tbb::blocked_range<size_t> &range) {
+            for (size_t i = range.begin(); i < range.end(); ++ i) {
+                const PrintObject &print_object = *m_objects[i];
+                PrintObject::update_layer_height_profile(*print_object.model_object(), print_object.slicing_parameters(), layer_height_profiles[i]);
+                object_layers[i] = generate_object_layers(print_object.slicing_parameters(), layer_height_profiles[i]);
+            }
+        });
+
     // Checks that the print does not exceed the max print height
     for (size_t print_object_idx = 0; print_object_idx < m_objects.size(); ++ print_object_idx) {
         const PrintObject &print_object = *m_objects[print_object_idx];
-        //FIXME It is quite expensive to generate object layers just to get the print height!
-        if (auto layers = generate_object_layers(print_object.slicing_parameters(), layer_height_profile(print_object_idx));
+        if (const std::vector<coordf_t> &layers = object_layers[print_object_idx];
             ! layers.empty() && layers.back() > this->config().max_print_height + EPSILON) {
 
             const double shrinkage_compensation_z = this->shrinkage_compensation().z();
@@ -967,35 +1002,70 @@ void Print::auto_assign_extruders(ModelObject* model_object) const
 // Slicing process, running at a background thread.
 void Print::process()
 {
+    Tracing::Span span("Print::process");
+
+    // Serve the fine-grained cancellation checkpoints polled by the deep computational kernels.
+    CancellationCheckpointScope cancellation_checkpoint_scope(this);
+
     name_tbb_thread_pool_threads_set_locale();
 
     BOOST_LOG_TRIVIAL(info) << "Starting the slicing process." << log_memory_info();
 
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, m_objects.size(), 1), [this](const tbb::blocked_range<size_t> &range) {
-        for (size_t idx = range.begin(); idx < range.end(); ++idx) {
-            m_objects[idx]->make_perimeters();
-            m_objects[idx]->infill();
-            m_objects[idx]->ironing();
-        }
-    }, tbb::simple_partitioner());
-
-    // The following step writes to m_shared_regions, it should not run in parallel.
-    for (PrintObject *obj : m_objects)
-        obj->generate_support_spots();
-    // check data from previous step, format the error message(s) and send alert to ui
-    // this also has to be done sequentially.
-    alert_when_supports_needed();
-
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, m_objects.size(), 1), [this](const tbb::blocked_range<size_t> &range) {
-        for (size_t idx = range.begin(); idx < range.end(); ++idx) {
-            PrintObject &obj = *m_objects[idx];
-            obj.generate_support_material();
-            obj.estimate_curled_extrusions();
-            obj.calculate_overhanging_perimeters();
+    // Load back the per-layer data spilled under a memory budget by a previous slicing pass.
+    LayerDataSpill::restore(*this);
+
+    if (m_objects.empty()) {
+        alert_when_supports_needed();
+    } else {
+        // The per-object steps are scheduled as a dependency graph instead of per-milestone
+        // parallel loops, so that a plate mixing one huge and many small objects does not
+        // synchronize on the huge one at every milestone: a small object may already search
+        // its support spots while the big one is still generating infill. The edges mirror
+        // the dependencies of the former sequential code: perimeters / infill / ironing form
+        // a chain per object, support spot search writes to m_shared_regions and therefore
+        // runs serialized in object order, the support related alert aggregates all objects,
+        // and the steps following the alert are independent per object again.
+        tbb::flow::graph graph;
+        using ContinueNode = tbb::flow::continue_node<tbb::flow::continue_msg>;
+        std::deque<ContinueNode> nodes;
+        auto add_node = [&graph, &nodes](auto &&body) -> ContinueNode& {
+            nodes.emplace_back(graph, [body](const tbb::flow::continue_msg &) { body(); });
+            return nodes.back();
+        };
+
+        // check data from the support spots search, format the error message(s) and send alert to ui
+        ContinueNode &alert = add_node([this]() { this->alert_when_supports_needed(); });
+        ContinueNode *prev_support_spots = nullptr;
+        std::vector<ContinueNode*> sources;
+        sources.reserve(m_objects.size());
+        for (PrintObject *obj : m_objects) {
+            ContinueNode &perimeters    = add_node([obj]() { obj->make_perimeters(); });
+            ContinueNode &infill        = add_node([obj]() { obj->infill(); });
+            ContinueNode &ironing       = add_node([obj]() { obj->ironing(); });
+            ContinueNode &support_spots = add_node([obj]() { obj->generate_support_spots(); });
+            ContinueNode &supports      = add_node([obj]() {
+                obj->generate_support_material();
+                obj->estimate_curled_extrusions();
+                obj->calculate_overhanging_perimeters();
+            });
+            tbb::flow::make_edge(perimeters, infill);
+            tbb::flow::make_edge(infill, ironing);
+            tbb::flow::make_edge(ironing, support_spots);
+            if (prev_support_spots != nullptr)
+                tbb::flow::make_edge(*prev_support_spots, support_spots);
+            prev_support_spots = &support_spots;
+            tbb::flow::make_edge(support_spots, alert);
+            tbb::flow::make_edge(alert, supports);
+            sources.emplace_back(&perimeters);
         }
-    }, tbb::simple_partitioner());
+        for (ContinueNode *source : sources)
+            source->try_put(tbb::flow::continue_msg{});
+        // Exceptions (cancellation, slicing errors) thrown inside the nodes are rethrown here.
+        graph.wait_for_all();
+    }
 
     if (this->set_started(psWipeTower)) {
+        Tracing::Span span_wipe_tower("Print::wipe_tower");
         m_wipe_tower_data.clear();
         m_tool_ordering.clear();
         if (this->has_wipe_tower()) {
@@ -1010,6 +1080,7 @@ void Print::process()
         this->set_done(psWipeTower);
     }
     if (this->set_started(psSkirtBrim)) {
+        Tracing::Span span_skirt_brim("Print::skirt_brim");
         this->set_status(88, _u8L("Generating skirt and brim"));
 
         m_skirt.clear();
@@ -1056,6 +1127,10 @@ void Print::process()
     if (conflictRes.has_value())
         BOOST_LOG_TRIVIAL(error) << boost::format("gcode path conflicts found between %1% and %2%") % conflictRes->_objName1 % conflictRes->_objName2;
 
+    // If a memory budget is configured and exceeded, spill the cold per-layer intermediates
+    // that the G-code export does not read to temporary files.
+    LayerDataSpill::spill_if_over_budget(*this);
+
     BOOST_LOG_TRIVIAL(info) << "Slicing process finished." << log_memory_info();
 }
 
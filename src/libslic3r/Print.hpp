@@ -55,6 +55,12 @@ class ModelObject;
 class Print;
 class PrintObject;
 class SupportLayer;
+struct SupportAnalysis;
+
+namespace ModelInfo {
+    struct Visibility;
+    struct VisibilityParams;
+} // namespace ModelInfo
 
 namespace FillAdaptive {
     struct Octree;
@@ -112,6 +118,9 @@ public:
 	// 1-based extruder identifier for this region and role.
 	unsigned int 				extruder(FlowRole role) const;
     Flow                        flow(const PrintObject &object, FlowRole role, double layer_height, bool first_layer = false) const;
+    // Flows of this region for all roles resolvable by PrintRegion::flow(), indexed by FlowRole.
+    // To be resolved once by algorithms which would otherwise compute an identical flow for each extrusion path processed.
+    std::array<Flow, num_region_flow_roles> flows(const PrintObject &object, double layer_height, bool first_layer = false) const;
     // Average diameter of nozzles participating on extruding this region.
     coordf_t                    nozzle_dmr_avg(const PrintConfig &print_config) const;
     // Average diameter of nozzles participating on extruding this region.
@@ -335,6 +344,16 @@ public:
     std::vector<std::reference_wrapper<const PrintRegion>> all_regions() const;
     const PrintObjectRegions*   shared_regions() const throw() { return m_shared_regions; }
 
+    // Shared per-layer overhang analysis derived from the slices, computed once on demand
+    // and consumed read-only by the support generators. Invalidated together with the slices.
+    std::shared_ptr<const SupportAnalysis> support_analysis(std::function<void()> throw_on_cancel = nullptr) const;
+
+    // Shared raycasted visibility of the object's model volumes, computed once on demand for
+    // the given sampling parameters and consumed read-only by the seam placer and other
+    // surface quality heuristics. Invalidated together with the slices, thus with any change
+    // of the object's meshes or transformation.
+    std::shared_ptr<const ModelInfo::Visibility> model_visibility(const ModelInfo::VisibilityParams &params, std::function<void()> throw_on_cancel = nullptr) const;
+
     bool                        has_support()           const { return m_config.support_material || m_config.support_material_enforce_layers > 0; }
     bool                        has_raft()              const { return m_config.raft_layers > 0; }
     bool                        has_support_material()  const { return this->has_support() || this->has_raft(); }
@@ -431,12 +450,32 @@ private:
     LayerPtrs                               m_layers;
     SupportLayerPtrs                        m_support_layers;
 
+    // Lazily computed by support_analysis() from the layer slices.
+    mutable std::shared_ptr<const SupportAnalysis> m_support_analysis;
+
+    // Lazily computed by model_visibility() from the model volumes, together with the
+    // sampling parameters it was computed for.
+    mutable std::shared_ptr<const ModelInfo::Visibility>       m_model_visibility;
+    mutable std::shared_ptr<const ModelInfo::VisibilityParams> m_model_visibility_params;
+
     // this is set to true when LayerRegion->slices is split in top/internal/bottom
     // so that next call to make_perimeters() performs a union() before computing loops
     bool                    				m_typed_slices = false;
 
     std::pair<FillAdaptive::OctreePtr, FillAdaptive::OctreePtr> m_adaptive_fill_octrees;
     FillLightning::GeneratorPtr m_lightning_generator;
+
+    // Cache of the raw slicing contours of one model volume, surviving the invalidation of posSlice.
+    // When the variable layer height profile is edited, most slicing planes stay intact and the next
+    // slicing pass only slices the planes with no cached contour. The mesh pointer detects a replaced
+    // mesh of a volume keeping its ObjectID.
+    struct VolumeSlicingCache
+    {
+        ObjectID                            volume_id;
+        std::shared_ptr<const TriangleMesh> mesh;
+        MeshSlicingCache                    cache;
+    };
+    std::vector<VolumeSlicingCache>         m_volume_slicing_caches;
 };
 
 
@@ -582,7 +621,7 @@ public:
     // List of existing PrintObject IDs, to remove notifications for non-existent IDs.
     std::vector<ObjectID> print_object_ids() const override;
 
-    ApplyStatus         apply(const Model &model, DynamicPrintConfig config) override;
+    ApplyStatus         apply(const Model &model, const DynamicPrintConfig &config) override;
     void                set_task(const TaskParams &params) override { PrintBaseWithState<PrintStep, psCount>::set_task_impl(params, m_objects); }
     void                process() override;
     void                finalize() override { PrintBaseWithState<PrintStep, psCount>::finalize_impl(m_objects); }
@@ -697,6 +736,9 @@ private:
     PrintConfig                             m_config;
     PrintObjectConfig                       m_default_object_config;
     PrintRegionConfig                       m_default_region_config;
+    // Raw (not normalized) config snapshot handed to the last apply() call.
+    // If a new snapshot compares equal, apply() skips the config clone and diffing.
+    DynamicPrintConfig                      m_last_applied_config_raw;
     PrintObjectPtrs                         m_objects;
     PrintRegionPtrs                         m_print_regions;
 
@@ -87,6 +87,27 @@ static inline void model_volume_list_copy_configs(ModelObject &model_object_dst,
     }
 }
 
+static inline void model_volume_list_copy_trafos(ModelObject &model_object_dst, const ModelObject &model_object_src, const ModelVolumeType type)
+{
+    size_t i_src, i_dst;
+    for (i_src = 0, i_dst = 0; i_src < model_object_src.volumes.size() && i_dst < model_object_dst.volumes.size();) {
+        const ModelVolume &mv_src = *model_object_src.volumes[i_src];
+        ModelVolume       &mv_dst = *model_object_dst.volumes[i_dst];
+        if (mv_src.type() != type) {
+            ++ i_src;
+            continue;
+        }
+        if (mv_dst.type() != type) {
+            ++ i_dst;
+            continue;
+        }
+        assert(mv_src.id() == mv_dst.id());
+        mv_dst.set_transformation(mv_src.get_transformation());
+        ++ i_src;
+        ++ i_dst;
+    }
+}
+
 static inline void layer_height_ranges_copy_configs(t_layer_config_ranges &lr_dst, const t_layer_config_ranges &lr_src)
 {
     assert(lr_dst.size() == lr_src.size());
@@ -612,6 +633,123 @@ void print_objects_regions_invalidate_keep_some_volumes(PrintObjectRegions &prin
     print_object_regions.cached_volume_ids.erase(print_object_regions.cached_volume_ids.begin() + last_cached_volume, print_object_regions.cached_volume_ids.end());
 }
 
+// Moving a parameter modifier cannot influence the sliced result as long as the modifier overlaps
+// no model part at either its old or its new position: a modifier carries no geometry of its own
+// and it is only ever applied to the regions of overlapping printable volumes
+// (see generate_print_object_regions()). Checks whether the solid / modifier volume lists of the
+// two ModelObjects differ by such ineffective modifier transformations only. The bounding boxes
+// are constructed the same way as the cached bounding boxes of the regions (in the frame of
+// trafo_bboxes, inflated by bbox_offset), thus the test is consistent with the region assignment.
+// On success, the moved modifiers (pointing into model_object_new) are output in moved_modifiers.
+static bool model_volume_list_changed_by_ineffective_modifier_trafos_only(
+    const ModelObject               &model_object_old,
+    const ModelObject               &model_object_new,
+    const Transform3d               &trafo_bboxes,
+    const float                      bbox_offset,
+    std::vector<const ModelVolume*> &moved_modifiers)
+{
+    moved_modifiers.clear();
+    // Pairs of (old, new) modifier ModelVolumes with modified transformation.
+    std::vector<std::pair<const ModelVolume*, const ModelVolume*>> moved;
+    size_t i_old = 0;
+    size_t i_new = 0;
+    for (;;) {
+        // Skip volumes not participating in the sliced geometry (supports, seams).
+        while (i_old < model_object_old.volumes.size() && ! model_volume_solid_or_modifier(*model_object_old.volumes[i_old]))
+            ++ i_old;
+        while (i_new < model_object_new.volumes.size() && ! model_volume_solid_or_modifier(*model_object_new.volumes[i_new]))
+            ++ i_new;
+        if (i_old == model_object_old.volumes.size() || i_new == model_object_new.volumes.size())
+            break;
+        const ModelVolume &mv_old = *model_object_old.volumes[i_old ++];
+        const ModelVolume &mv_new = *model_object_new.volumes[i_new ++];
+        if (mv_old.id() != mv_new.id() || mv_old.type() != mv_new.type())
+            // A volume was added, removed, reordered or changed its type.
+            return false;
+        if (! mv_old.get_matrix().isApprox(mv_new.get_matrix())) {
+            if (! mv_new.is_modifier())
+                // A printable or negative volume moved, the sliced geometry changed.
+                return false;
+            moved.emplace_back(&mv_old, &mv_new);
+        }
+    }
+    if (i_old != model_object_old.volumes.size() || i_new != model_object_new.volumes.size())
+        // A volume was added or removed.
+        return false;
+    if (moved.empty())
+        // The lists differ in some other aspect. Should not happen, be conservative.
+        return false;
+    // Check the moved modifiers against all model parts at both their old and new positions.
+    std::vector<PrintObjectRegions::BoundingBox> part_bboxes;
+    for (const ModelVolume *model_volume : model_object_new.volumes)
+        if (model_volume->is_model_part() && ! model_volume->mesh().its.indices.empty())
+            part_bboxes.emplace_back(transformed_its_bbox2d(model_volume->mesh().its, trafo_for_bbox(trafo_bboxes, model_volume->get_matrix()), bbox_offset));
+    auto overlaps_some_part = [&part_bboxes, &trafo_bboxes, bbox_offset](const ModelVolume &mv) {
+        if (mv.mesh().its.indices.empty())
+            return false;
+        const PrintObjectRegions::BoundingBox bbox = transformed_its_bbox2d(mv.mesh().its, trafo_for_bbox(trafo_bboxes, mv.get_matrix()), bbox_offset);
+        return std::any_of(part_bboxes.begin(), part_bboxes.end(), [&bbox](const PrintObjectRegions::BoundingBox &part_bbox) { return part_bbox.intersects(bbox); });
+    };
+    for (const std::pair<const ModelVolume*, const ModelVolume*> &mv : moved)
+        if (overlaps_some_part(*mv.first) || overlaps_some_part(*mv.second))
+            // The modifier overlaps some model part at its old or new position, thus it may modify regions.
+            return false;
+    for (const std::pair<const ModelVolume*, const ModelVolume*> &mv : moved)
+        moved_modifiers.emplace_back(mv.second);
+    return true;
+}
+
+// Refresh the cached bounding boxes of the listed moved volumes in place after their transformation
+// changed. The bounding box pointers held by VolumeRegions stay valid as no VolumeExtents are
+// inserted or erased. Returns false if some moved volume entered or left a layer range, in which
+// case the caches cannot be refreshed in place and the caller shall invalidate the regions instead.
+static bool print_object_regions_refresh_volume_bboxes_in_place(
+    PrintObjectRegions                    &print_object_regions,
+    const std::vector<const ModelVolume*> &moved_volumes,
+    const float                            bbox_offset)
+{
+    if (print_object_regions.layer_ranges.size() == 1) {
+        PrintObjectRegions::LayerRangeRegions &layer_range = print_object_regions.layer_ranges.front();
+        for (const ModelVolume *model_volume : moved_volumes) {
+            if (model_volume->mesh().its.indices.empty())
+                continue;
+            auto it = lower_bound_by_predicate(layer_range.volumes.begin(), layer_range.volumes.end(),
+                [model_volume](const PrintObjectRegions::VolumeExtents &l) { return l.volume_id < model_volume->id(); });
+            if (it == layer_range.volumes.end() || it->volume_id != model_volume->id())
+                // The bounding box was not cached for this volume.
+                return false;
+            it->bbox = transformed_its_bbox2d(model_volume->mesh().its, trafo_for_bbox(print_object_regions.trafo_bboxes, model_volume->get_matrix()), bbox_offset);
+        }
+    } else {
+        std::vector<t_layer_height_range> ranges;
+        ranges.reserve(print_object_regions.layer_ranges.size());
+        for (const PrintObjectRegions::LayerRangeRegions &layer_range : print_object_regions.layer_ranges) {
+            t_layer_height_range r = layer_range.layer_height_range;
+            r.first  -= EPSILON;
+            r.second += EPSILON;
+            ranges.emplace_back(r);
+        }
+        std::vector<std::pair<PrintObjectRegions::BoundingBox, bool>> bboxes;
+        for (const ModelVolume *model_volume : moved_volumes) {
+            if (model_volume->mesh().its.indices.empty())
+                continue;
+            transformed_its_bboxes_in_z_ranges(model_volume->mesh().its, trafo_for_bbox(print_object_regions.trafo_bboxes, model_volume->get_matrix()), ranges, bboxes, bbox_offset);
+            for (PrintObjectRegions::LayerRangeRegions &layer_range : print_object_regions.layer_ranges) {
+                const std::pair<PrintObjectRegions::BoundingBox, bool> &bbox = bboxes[&layer_range - print_object_regions.layer_ranges.data()];
+                auto it = lower_bound_by_predicate(layer_range.volumes.begin(), layer_range.volumes.end(),
+                    [model_volume](const PrintObjectRegions::VolumeExtents &l) { return l.volume_id < model_volume->id(); });
+                const bool cached = it != layer_range.volumes.end() && it->volume_id == model_volume->id();
+                if (cached != bbox.second)
+                    // The volume entered or left this layer range.
+                    return false;
+                if (cached)
+                    it->bbox = bbox.first;
+            }
+        }
+    }
+    return true;
+}
+
 // Find a bounding box of a volume's part intersecting layer_range. Such a bounding box will likely be smaller in XY than the full bounding box,
 // thus it will intersect with lower number of other volumes.
 const PrintObjectRegions::BoundingBox* find_volume_extents(const PrintObjectRegions::LayerRangeRegions &layer_range, const ModelVolume &volume)
@@ -970,31 +1108,44 @@ static PrintObjectRegions* generate_print_object_regions(
     return out.release();
 }
 
-Print::ApplyStatus Print::apply(const Model &model, DynamicPrintConfig new_full_config)
+Print::ApplyStatus Print::apply(const Model &model, const DynamicPrintConfig &new_full_config_in)
 {
 #ifdef _DEBUG
     check_model_ids_validity(model);
 #endif /* _DEBUG */
 
-    // Normalize the config.
-	new_full_config.option("print_settings_id",            true);
-	new_full_config.option("filament_settings_id",         true);
-	new_full_config.option("printer_settings_id",          true);
-    new_full_config.option("physical_printer_settings_id", true);
-    new_full_config.normalize_fdm();
-
-    // Find modified keys of the various configs. Resolve overrides extruder retract values by filament profiles.
+    // The GUI publishes its full config snapshot on every edit. If it equals the raw
+    // snapshot seen by the previous apply(), no config diff is possible and the clone,
+    // the normalization and the diffing of the full config are all skipped. Most edits
+    // only touch the Model, for those this branch reduces the config handoff to one
+    // equality test.
+    const bool           config_changed = new_full_config_in != m_last_applied_config_raw;
+    DynamicPrintConfig   new_full_config;
     DynamicPrintConfig   filament_overrides;
-    t_config_option_keys print_diff       = print_config_diffs(m_config, new_full_config, filament_overrides);
-    t_config_option_keys full_config_diff = full_print_config_diffs(m_full_print_config, new_full_config);
-    // If just a physical printer was changed, but printer preset is the same, then there is no need to apply whole print
-    // see https://github.com/prusa3d/PrusaSlicer/issues/8800
-    if (full_config_diff.size() == 1 && full_config_diff[0] == "physical_printer_settings_id")
-        full_config_diff.clear();
-
-    // Collect changes to object and region configs.
-    t_config_option_keys object_diff      = m_default_object_config.diff(new_full_config);
-    t_config_option_keys region_diff      = m_default_region_config.diff(new_full_config);
+    t_config_option_keys print_diff, full_config_diff, object_diff, region_diff;
+    if (config_changed) {
+        m_last_applied_config_raw = new_full_config_in;
+        new_full_config = new_full_config_in;
+
+        // Normalize the config.
+        new_full_config.option("print_settings_id",            true);
+        new_full_config.option("filament_settings_id",         true);
+        new_full_config.option("printer_settings_id",          true);
+        new_full_config.option("physical_printer_settings_id", true);
+        new_full_config.normalize_fdm();
+
+        // Find modified keys of the various configs. Resolve overrides extruder retract values by filament profiles.
+        print_diff       = print_config_diffs(m_config, new_full_config, filament_overrides);
+        full_config_diff = full_print_config_diffs(m_full_print_config, new_full_config);
+        // If just a physical printer was changed, but printer preset is the same, then there is no need to apply whole print
+        // see https://github.com/prusa3d/PrusaSlicer/issues/8800
+        if (full_config_diff.size() == 1 && full_config_diff[0] == "physical_printer_settings_id")
+            full_config_diff.clear();
+
+        // Collect changes to object and region configs.
+        object_diff      = m_default_object_config.diff(new_full_config);
+        region_diff      = m_default_region_config.diff(new_full_config);
+    }
 
     // Do not use the ApplyStatus as we will use the max function when updating apply_status.
     unsigned int apply_status = APPLY_STATUS_UNCHANGED;
@@ -1164,9 +1315,10 @@ Print::ApplyStatus Print::apply(const Model &model, DynamicPrintConfig new_full_
         assert(model_object_status.status == ModelObjectStatus::Old || model_object_status.status == ModelObjectStatus::Moved);
         // Check whether a model part volume was added or removed, their transformations or order changed.
         // Only volume IDs, volume types, transformation matrices and their order are checked, configuration and other parameters are NOT checked.
-        bool solid_or_modifier_differ   = model_volume_list_changed(model_object, model_object_new, solid_or_modifier_types) ||
-                                          model_mmu_segmentation_data_changed(model_object, model_object_new) ||
+        bool mmu_segmentation_differ    = model_mmu_segmentation_data_changed(model_object, model_object_new) ||
                                           (model_object_new.is_mm_painted() && num_extruders_changed);
+        bool solid_or_modifier_differ   = model_volume_list_changed(model_object, model_object_new, solid_or_modifier_types) ||
+                                          mmu_segmentation_differ;
         bool supports_differ            = model_volume_list_changed(model_object, model_object_new, ModelVolumeType::SUPPORT_BLOCKER) ||
                                           model_volume_list_changed(model_object, model_object_new, ModelVolumeType::SUPPORT_ENFORCER);
         bool layer_height_ranges_differ = ! layer_height_ranges_equal(model_object.layer_config_ranges, model_object_new.layer_config_ranges, model_object_new.layer_height_profile.empty());
@@ -1179,6 +1331,26 @@ Print::ApplyStatus Print::apply(const Model &model, DynamicPrintConfig new_full_
             model_object_status.print_object_regions = print_objects_range.begin()->print_object->m_shared_regions;
             model_object_status.print_object_regions->ref_cnt_inc();
         }
+        // Finer grained invalidation for modifier mesh edits: moving a parameter modifier where it
+        // overlaps no model part at either the old or the new position (typically an operator
+        // parking a modifier mesh aside) does not change the sliced result. Keep all milestones
+        // valid in that case, just refresh the cached bounding boxes of the moved modifiers here
+        // and synchronize their transformations below.
+        bool ineffective_modifier_trafos_only = false;
+        if (solid_or_modifier_differ && ! mmu_segmentation_differ &&
+            ! model_origin_translation_differ && ! layer_height_ranges_differ &&
+            model_object.layer_height_profile.timestamp_matches(model_object_new.layer_height_profile) &&
+            model_object_status.print_object_regions != nullptr) {
+            const PrintObject &print_object_front = *print_objects_range.begin()->print_object;
+            const float        bbox_offset        = print_object_front.is_mm_painted() ? 0.f : std::max(0.f, float(print_object_front.config().xy_size_compensation.value));
+            std::vector<const ModelVolume*> moved_modifiers;
+            ineffective_modifier_trafos_only =
+                model_volume_list_changed_by_ineffective_modifier_trafos_only(model_object, model_object_new,
+                    model_object_status.print_object_regions->trafo_bboxes, bbox_offset, moved_modifiers) &&
+                print_object_regions_refresh_volume_bboxes_in_place(*model_object_status.print_object_regions, moved_modifiers, bbox_offset);
+            if (ineffective_modifier_trafos_only)
+                solid_or_modifier_differ = false;
+        }
         if (solid_or_modifier_differ || model_origin_translation_differ || layer_height_ranges_differ ||
             ! model_object.layer_height_profile.timestamp_matches(model_object_new.layer_height_profile)) {
             // The very first step (the slicing step) is invalidated. One may freely remove all associated PrintObjects.
@@ -1238,6 +1410,9 @@ Print::ApplyStatus Print::apply(const Model &model, DynamicPrintConfig new_full_
             //FIXME What to do with m_material_id?
 			model_volume_list_copy_configs(model_object /* dst */, model_object_new /* src */, ModelVolumeType::MODEL_PART);
 			model_volume_list_copy_configs(model_object /* dst */, model_object_new /* src */, ModelVolumeType::PARAMETER_MODIFIER);
+            if (ineffective_modifier_trafos_only)
+                // The modifiers moved, but they were verified above to not modify the sliced result.
+                model_volume_list_copy_trafos(model_object /* dst */, model_object_new /* src */, ModelVolumeType::PARAMETER_MODIFIER);
             layer_height_ranges_copy_configs(model_object.layer_config_ranges /* dst */, model_object_new.layer_config_ranges /* src */);
             // Copy the ModelObject name, input_file and instances. The instances will be compared against PrintObject instances in the next step.
             if (model_object.name != model_object_new.name) {
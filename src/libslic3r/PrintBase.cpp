@@ -4,9 +4,16 @@
 ///|/
 #include "Exception.hpp"
 #include "PrintBase.hpp"
+#include "Utils.hpp"
+
+#include <clipper/clipper_z.hpp>
+#include "clipper.hpp"
+
+#include <cstdlib>
 
 #include <boost/filesystem.hpp>
 #include <boost/lexical_cast.hpp>
+#include <boost/log/trivial.hpp>
 
 #include "I18N.hpp"
 
@@ -18,8 +25,101 @@ void PrintTryCancel::operator()() const
     m_print->throw_if_canceled();
 }
 
+std::atomic<const PrintBase*> PrintBase::s_process_active_print { nullptr };
+
+void PrintBase::cancellation_checkpoint()
+{
+    if (const PrintBase *print = s_process_active_print.load(std::memory_order_acquire); print != nullptr && print->canceled())
+        throw CanceledException();
+}
+
+// Route the periodic progress hooks of the Clipper instantiations to the cancellation checkpoint,
+// so that a cancel request interrupts even a single long Clipper::Execute() with a bounded latency.
+static const bool clipper_cancellation_hooks_registered = []() {
+    Slic3r::ClipperLib::progress_callback = PrintBase::cancellation_checkpoint;
+    ClipperLib_Z::progress_callback       = PrintBase::cancellation_checkpoint;
+    return true;
+}();
+
 size_t PrintStateBase::g_last_timestamp = 0;
 
+bool StepMemoryLogger::enabled()
+{
+    static const bool out = std::getenv("SLIC3R_LOG_STEP_MEMORY") != nullptr;
+    return out;
+}
+
+// Peak resident set size sampled by any StepMemoryLogger of this process.
+static std::atomic<size_t> g_step_memory_peak { 0 };
+
+void StepMemoryLogger::started(int step)
+{
+    if (m_rss_start.size() <= size_t(step))
+        m_rss_start.resize(step + 1, 0);
+    m_rss_start[step] = resident_memory();
+}
+
+void StepMemoryLogger::done(int step, const char *step_kind)
+{
+    size_t rss = resident_memory();
+    if (size_t peak = g_step_memory_peak.load(std::memory_order_relaxed); rss > peak)
+        g_step_memory_peak.compare_exchange_strong(peak, rss, std::memory_order_relaxed);
+    size_t rss_start = size_t(step) < m_rss_start.size() ? m_rss_start[step] : 0;
+    long long delta = (long long)rss - (long long)rss_start;
+    BOOST_LOG_TRIVIAL(info) << step_kind << " step " << step << " memory: resident "
+        << format_memsize_MB(rss) << ", " << (delta >= 0 ? "+" : "-") << format_memsize_MB(size_t(delta >= 0 ? delta : - delta))
+        << " over the step, session peak " << format_memsize_MB(g_step_memory_peak.load(std::memory_order_relaxed));
+}
+
+double SlicingProgressEstimator::learned_elapsed(int percent) const
+{
+    assert(! m_learned.empty());
+    // First learned checkpoint at or after the queried percentage.
+    auto it = std::lower_bound(m_learned.begin(), m_learned.end(), percent,
+        [](const Checkpoint &l, int r) { return l.first < r; });
+    if (it == m_learned.begin())
+        return percent >= it->first ? it->second : 0.;
+    if (it == m_learned.end())
+        return m_learned.back().second;
+    auto prev = std::prev(it);
+    if (it->first == prev->first)
+        return it->second;
+    double t = double(percent - prev->first) / double(it->first - prev->first);
+    return prev->second + t * (it->second - prev->second);
+}
+
+double SlicingProgressEstimator::seconds_remaining(int percent)
+{
+    std::scoped_lock<std::mutex> lock(m_mutex);
+    Clock::time_point now = Clock::now();
+    if (! m_running || percent < m_last_percent) {
+        // A new slicing run is starting, either the first one or the reported
+        // percentage dropped after a reslice or a canceled run.
+        m_running = true;
+        m_start   = now;
+        m_current.clear();
+    }
+    m_last_percent = percent;
+    double elapsed = std::chrono::duration<double>(now - m_start).count();
+    m_current.emplace_back(percent, elapsed);
+    if (percent >= 100) {
+        // Run complete, adopt its progress curve for predicting the next runs.
+        m_learned = std::move(m_current);
+        m_current.clear();
+        m_running = false;
+        return 0.;
+    }
+    if (m_learned.empty() || m_learned.back().second <= 0.)
+        // Nothing was learned yet, no prediction for the first slice of a project.
+        return -1.;
+    // Fraction of the total learned run time spent up to the current percentage.
+    double fraction = this->learned_elapsed(percent) / m_learned.back().second;
+    if (fraction <= 0.)
+        return -1.;
+    // Scale the learned total by the measured speed of the current run.
+    return std::max(0., elapsed * (1. - fraction) / fraction);
+}
+
 // Update "scale", "input_filename", "input_filename_base" placeholders from the current m_objects.
 void PrintBase::update_object_placeholders(DynamicConfig &config, const std::string & /* default_output_ext */) const
 {
@@ -11,6 +11,7 @@
 #include <string>
 #include <functional>
 #include <atomic>
+#include <chrono>
 #include <mutex>
 
 #include "ObjectID.hpp"
@@ -112,6 +113,29 @@ protected:
     static size_t g_last_timestamp;
 };
 
+// Opt-in instrumentation of per-milestone memory usage, enabled by setting the
+// SLIC3R_LOG_STEP_MEMORY environment variable. The process resident set size (RSS)
+// is sampled at the start and the end of every Print / PrintObject milestone and
+// the step delta, the end RSS and the session peak are written to the log, so a
+// memory spike can be attributed to the milestone that produced it. Milestones of
+// multiple objects may execute in parallel, in that case the deltas are indicative.
+class StepMemoryLogger
+{
+public:
+    // Cached check of the environment switch.
+    static bool enabled();
+
+    // To be called when the milestone was started / finished, step is the numeric
+    // value of the PrintStep / PrintObjectStep enum.
+    void started(int step);
+    void done(int step, const char *step_kind);
+
+private:
+    // RSS sampled by started(), indexed by the step enum. Steps of one state
+    // container never run concurrently.
+    std::vector<size_t> m_rss_start;
+};
+
 // To be instantiated over PrintStep or PrintObjectStep enums.
 template <class StepType, size_t COUNT>
 class PrintState : public PrintStateBase
@@ -394,6 +418,37 @@ private:
     const PrintBase *m_print;
 };
 
+// Learns the mapping of the reported progress percentage to elapsed wall clock time
+// from a finished slicing run of this project and predicts the remaining time of
+// the subsequent runs. The estimate scales with the measured speed of the current
+// run, thus it adapts to configuration changes that make the job faster or slower.
+// Thread safe, set_status() may be called from worker threads.
+class SlicingProgressEstimator
+{
+public:
+    // Record a progress checkpoint of the running slicing job and return the
+    // predicted remaining wall clock time in seconds, negative if unknown
+    // (no finished run was observed yet).
+    double seconds_remaining(int percent);
+
+private:
+    using Clock = std::chrono::steady_clock;
+    // Progress checkpoint: percentage reported and seconds elapsed from the start of the run.
+    using Checkpoint = std::pair<int, double>;
+
+    // Elapsed seconds of the learned curve at the given percentage, linearly interpolated.
+    double learned_elapsed(int percent) const;
+
+    std::mutex              m_mutex;
+    Clock::time_point       m_start;
+    bool                    m_running { false };
+    int                     m_last_percent { -1 };
+    // Checkpoints of the current run.
+    std::vector<Checkpoint> m_current;
+    // Checkpoints of the last complete run, used for the prediction.
+    std::vector<Checkpoint> m_learned;
+};
+
 /**
  * @brief Printing involves slicing and export of device dependent instructions.
  *
@@ -433,7 +488,7 @@ public:
         // Some data was changed, which in turn invalidated already calculated steps.
         APPLY_STATUS_INVALIDATED,
     };
-    virtual ApplyStatus     apply(const Model &model, DynamicPrintConfig config) = 0;
+    virtual ApplyStatus     apply(const Model &model, const DynamicPrintConfig &config) = 0;
     const Model&            model() const { return m_model; }
 
     struct TaskParams {
@@ -467,6 +522,10 @@ public:
             flags(UPDATE_PRINT_OBJECT_STEP_WARNINGS), warning_object_id(print_object.id()), warning_step(warning_step) {}
         int             percent { -1 };
         std::string     text;
+        // Predicted remaining wall clock time in seconds, learned from the previous
+        // slicing run of this project by SlicingProgressEstimator. Negative if unknown,
+        // e.g. during the first slice of a project.
+        double          secs_remaining { -1. };
         // Bitmap of flags.
         enum FlagBits {
             DEFAULT                             = 0,
@@ -494,7 +553,10 @@ public:
     void                    set_status_callback(status_callback_type cb) { m_status_callback = cb; }
     // Calls a registered callback to update the status, or print out the default message.
     void                    set_status(int percent, const std::string &message, unsigned int flags = SlicingStatus::DEFAULT) {
-		if (m_status_callback) m_status_callback(SlicingStatus(percent, message, flags));
+        SlicingStatus status(percent, message, flags);
+        status.secs_remaining = m_progress_estimator.seconds_remaining(percent);
+        if (m_status_callback) m_status_callback(status);
+        else if (status.secs_remaining >= 0.) printf("%d => %s (remaining %d s)\n", percent, message.c_str(), int(status.secs_remaining + 0.5));
         else printf("%d => %s\n", percent, message.c_str());
     }
 
@@ -520,6 +582,21 @@ public:
 	void                       cancel_internal() { m_cancel_status = CANCELED_INTERNAL; }
     // Cancel the running computation. Stop execution of all the background threads.
 	void                       restart() { m_cancel_status = NOT_CANCELED; }
+
+    // Cooperative cancellation checkpoint for deep computational kernels (Clipper, Arachne)
+    // that cannot be handed an explicit cancel callback without excessive plumbing.
+    // Throws CanceledException if the print currently being processed was canceled.
+    // When no print is being processed, the checkpoint is a cheap no-op, thus it is safe
+    // to call from code shared with non-slicing contexts.
+    static void                cancellation_checkpoint();
+    // RAII registration of the print served by cancellation_checkpoint(), to be instantiated
+    // at the top of process() for the duration of the calculation.
+    class CancellationCheckpointScope
+    {
+    public:
+        explicit CancellationCheckpointScope(const PrintBase *print) { s_process_active_print.store(print, std::memory_order_release); }
+        ~CancellationCheckpointScope() { s_process_active_print.store(nullptr, std::memory_order_release); }
+    };
     // Returns true if the last step was finished with success.
     virtual bool               finished() const = 0;
 
@@ -561,9 +638,16 @@ protected:
     // Callback to be evoked regularly to update state of the UI thread.
     status_callback_type                    m_status_callback;
 
+    // Predicts the remaining slicing time from the progress curve of the previous run.
+    SlicingProgressEstimator                m_progress_estimator;
+
 private:
     std::atomic<CancelStatus>               m_cancel_status;
 
+    // The print currently inside process(), polled by cancellation_checkpoint().
+    // There is at most one, as the background processing runs prints one at a time.
+    static std::atomic<const PrintBase*>    s_process_active_print;
+
     // Callback to be evoked to stop the background processing before a state is updated.
     cancel_callback_type                    m_cancel_callback = [](){};
 
@@ -589,9 +673,16 @@ public:
     PrintStateBase::StateWithWarnings  step_state_with_warnings(PrintStepEnum step) const { return m_state.state_with_warnings(step, this->state_mutex()); }
 
 protected:
-    bool            set_started(PrintStepEnum step) { return m_state.set_started(step, this->state_mutex(), [this](){ this->throw_if_canceled(); }); }
+    bool            set_started(PrintStepEnum step) {
+        bool started = m_state.set_started(step, this->state_mutex(), [this](){ this->throw_if_canceled(); });
+        if (started && StepMemoryLogger::enabled())
+            m_step_memory.started(static_cast<int>(step));
+        return started;
+    }
 	PrintStateBase::TimeStamp set_done(PrintStepEnum step) { 
 		std::pair<PrintStateBase::TimeStamp, bool> status = m_state.set_done(step, this->state_mutex(), [this](){ this->throw_if_canceled(); });
+        if (StepMemoryLogger::enabled())
+            m_step_memory.done(static_cast<int>(step), "Print");
         if (status.second)
             this->status_update_warnings(static_cast<int>(step), PrintStateBase::WarningLevel::NON_CRITICAL, std::string());
         return status.first;
@@ -727,6 +818,7 @@ protected:
 
 private:
     PrintState<PrintStepEnum, COUNT>    m_state;
+    StepMemoryLogger                    m_step_memory;
 };
 
 template<typename PrintType, typename PrintObjectStepEnumType, const size_t COUNT>
@@ -762,10 +854,16 @@ public:
 protected:
 	PrintObjectBaseWithState(PrintType *print, ModelObject *model_object) : PrintObjectBase(model_object), m_print(print) {}
 
-    bool            set_started(PrintObjectStepEnum step) 
-        { return m_state.set_started(step, PrintObjectBase::state_mutex(m_print), [this](){ this->throw_if_canceled(); }); }
+    bool            set_started(PrintObjectStepEnum step) {
+        bool started = m_state.set_started(step, PrintObjectBase::state_mutex(m_print), [this](){ this->throw_if_canceled(); });
+        if (started && StepMemoryLogger::enabled())
+            m_step_memory.started(static_cast<int>(step));
+        return started;
+    }
 	PrintStateBase::TimeStamp set_done(PrintObjectStepEnum step) { 
 		std::pair<PrintStateBase::TimeStamp, bool> status = m_state.set_done(step, PrintObjectBase::state_mutex(m_print), [this](){ this->throw_if_canceled(); });
+        if (StepMemoryLogger::enabled())
+            m_step_memory.done(static_cast<int>(step), "PrintObject");
         if (status.second)
             this->status_update_warnings(m_print, static_cast<int>(step), PrintStateBase::WarningLevel::NON_CRITICAL, std::string());
         return status.first;
@@ -811,6 +909,7 @@ protected:
 
 private:
     PrintState<PrintObjectStepEnum, COUNT>    m_state;
+    StepMemoryLogger                          m_step_memory;
 };
 
 } // namespace Slic3r
@@ -22,12 +22,14 @@
 #include "PrintConfig.hpp"
 #include "Config.hpp"
 #include "I18N.hpp"
+#include "StaticMap.hpp"
 #include "format.hpp"
 
 #include "SLA/SupportTree.hpp"
 #include "GCode/Thumbnails.hpp"
 
 #include <set>
+#include <string_view>
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/algorithm/string/case_conv.hpp>
 #include <boost/format.hpp>
@@ -52,10 +54,15 @@ static t_config_enum_names enum_names_from_keys_map(const t_config_enum_values &
     return names;
 }
 
+// The list of enum names is only needed by the UI and by the config exporters, thus it is built
+// lazily on first use instead of spending a heap-allocated vector of strings per enum on every
+// process start (function local statics are initialized in a thread safe manner since C++11).
 #define CONFIG_OPTION_ENUM_DEFINE_STATIC_MAPS(NAME) \
-    static t_config_enum_names s_keys_names_##NAME = enum_names_from_keys_map(s_keys_map_##NAME); \
     template<> const t_config_enum_values& ConfigOptionEnum<NAME>::get_enum_values() { return s_keys_map_##NAME; } \
-    template<> const t_config_enum_names& ConfigOptionEnum<NAME>::get_enum_names() { return s_keys_names_##NAME; }
+    template<> const t_config_enum_names& ConfigOptionEnum<NAME>::get_enum_names() { \
+        static const t_config_enum_names s_keys_names = enum_names_from_keys_map(s_keys_map_##NAME); \
+        return s_keys_names; \
+    }
 
 static const t_config_enum_values s_keys_map_ArcFittingType {
     { "disabled",       int(ArcFittingType::Disabled) },
@@ -4714,25 +4721,27 @@ void PrintConfigDef::init_sla_tilt_params()
 
 
 // Ignore the following obsolete configuration keys:
-static std::set<std::string> PrintConfigDef_ignore = {
-    "clip_multipart_objects",
-    "duplicate_x", "duplicate_y", "gcode_arcs", "multiply_x", "multiply_y",
-    "support_material_tool", "acceleration", "adjust_overhang_flow",
-    "standby_temperature", "scale", "rotate", "duplicate", "duplicate_grid",
-    "start_perimeters_at_concave_points", "start_perimeters_at_non_overhang", "randomize_start",
-    "seal_position", "vibration_limit", "bed_size",
-    "print_center", "g0", "threads", "pressure_advance", "wipe_tower_per_color_wipe",
-    "serial_port", "serial_speed",
+// Sorted at compile time, no heap allocation and no initialization at process start.
+using namespace std::string_view_literals;
+static constexpr StaticSet PrintConfigDef_ignore = {
+    "clip_multipart_objects"sv,
+    "duplicate_x"sv, "duplicate_y"sv, "gcode_arcs"sv, "multiply_x"sv, "multiply_y"sv,
+    "support_material_tool"sv, "acceleration"sv, "adjust_overhang_flow"sv,
+    "standby_temperature"sv, "scale"sv, "rotate"sv, "duplicate"sv, "duplicate_grid"sv,
+    "start_perimeters_at_concave_points"sv, "start_perimeters_at_non_overhang"sv, "randomize_start"sv,
+    "seal_position"sv, "vibration_limit"sv, "bed_size"sv,
+    "print_center"sv, "g0"sv, "threads"sv, "pressure_advance"sv, "wipe_tower_per_color_wipe"sv,
+    "serial_port"sv, "serial_speed"sv,
     // Introduced in some PrusaSlicer 2.3.1 alpha, later renamed or removed.
-    "fuzzy_skin_perimeter_mode", "fuzzy_skin_shape",
+    "fuzzy_skin_perimeter_mode"sv, "fuzzy_skin_shape"sv,
     // Introduced in PrusaSlicer 2.3.0-alpha2, later replaced by automatic calculation based on extrusion width.
-    "wall_add_middle_threshold", "wall_split_middle_threshold",
+    "wall_add_middle_threshold"sv, "wall_split_middle_threshold"sv,
     // Replaced by new concentric ensuring in 2.6.0-alpha5
-    "ensure_vertical_shell_thickness",
+    "ensure_vertical_shell_thickness"sv,
     // Disabled in 2.6.0-alpha6, this option is problematic
-    "infill_only_where_needed",
-    "gcode_binary", // Introduced in 2.7.0-alpha1, removed in 2.7.1 (replaced by binary_gcode).
-    "wiping_volumes_extruders" // Removed in 2.7.3-alpha1.
+    "infill_only_where_needed"sv,
+    "gcode_binary"sv, // Introduced in 2.7.0-alpha1, removed in 2.7.1 (replaced by binary_gcode).
+    "wiping_volumes_extruders"sv // Removed in 2.7.3-alpha1.
 };
 
 void PrintConfigDef::handle_legacy(t_config_option_key &opt_key, std::string &value)
@@ -4819,7 +4828,7 @@ void PrintConfigDef::handle_legacy(t_config_option_key &opt_key, std::string &va
     if (value == "monotonous" && (opt_key == "top_fill_pattern" || opt_key == "bottom_fill_pattern" || opt_key == "fill_pattern"))
         value = "monotonic";
 
-    if (PrintConfigDef_ignore.find(opt_key) != PrintConfigDef_ignore.end()) {
+    if (contains(PrintConfigDef_ignore, std::string_view(opt_key))) {
         opt_key = {};
         return;
     }
@@ -5448,6 +5457,13 @@ CLIActionsConfigDef::CLIActionsConfigDef()
     def->cli = "export-gcode|gcode|g";
     def->set_default_value(new ConfigOptionBool(false));
 
+    def = this->add("calibrate_parallelism", coBool);
+    def->label = L("Calibrate parallelism");
+    def->tooltip = L("Benchmark the parallel computational kernels on this machine and store tuned "
+                     "grain sizes to be used by subsequent slicing runs.");
+    def->cli = "calibrate-parallelism";
+    def->set_default_value(new ConfigOptionBool(false));
+
     def = this->add("gcodeviewer", coBool);
     def->label = L("G-code viewer");
     def->tooltip = L("Visualize an already sliced and saved G-code");
@@ -5486,6 +5502,14 @@ CLIActionsConfigDef::CLIActionsConfigDef()
     def->cli = "slice|s";
     def->set_default_value(new ConfigOptionBool(false));
 
+    def = this->add("batch", coBool);
+    def->label = L("Batch server");
+    def->tooltip = L("Keep the process alive and read further command lines from the standard input, "
+                     "one job per line, amortizing the startup cost across many jobs. "
+                     "Each line must contain an action such as --export-gcode.");
+    def->cli = "batch|daemon";
+    def->set_default_value(new ConfigOptionBool(false));
+
     def = this->add("help", coBool);
     def->label = L("Help");
     def->tooltip = L("Show this help.");
@@ -5655,6 +5679,28 @@ CLIMiscConfigDef::CLIMiscConfigDef()
     def->tooltip = L("Sets the maximum number of threads the slicing process will use. If not defined, it will be decided automatically.");
     def->min = 1;
 
+    def = this->add("jobs", coInt);
+    def->label = L("Number of concurrent slicing jobs");
+    def->tooltip = L("Slice up to the given number of input files concurrently, each in its own print instance "
+                     "with a proportional share of the available threads. Only applies when multiple model files "
+                     "are supplied together with a slicing action. Defaults to 1 (sequential processing).");
+    def->min = 1;
+    def->cli = "jobs|j";
+
+    def = this->add("numa_node", coInt);
+    def->label = L("Bind to NUMA node");
+    def->tooltip = L("Bind the slicing threads to the processors of the given NUMA node (starting at 0). "
+                     "On multi-socket machines this avoids cross-socket memory traffic during slicing. "
+                     "If not defined, the operating system is free to schedule the threads on any processor.");
+    def->min = 0;
+
+    def = this->add("memory_budget", coInt);
+    def->label = L("Memory budget");
+    def->tooltip = L("Memory budget for the slicing process in MB. If the resident memory of the process exceeds "
+                     "the budget after slicing, cold per-layer intermediate data is spilled to temporary files "
+                     "and loaded back on demand. Zero or undefined disables spilling.");
+    def->min = 0;
+
     def = this->add("loglevel", coInt);
     def->label = L("Logging level");
     def->tooltip = L("Sets logging sensitivity. 0:fatal, 1:error, 2:warning, 3:info, 4:debug, 5:trace\n"
@@ -5989,20 +6035,20 @@ OtherPresetsConfigDef::OtherPresetsConfigDef()
 }
 
 
-static std::map<t_custom_gcode_key, t_config_option_keys> s_CustomGcodeSpecificPlaceholders{
-    {"start_filament_gcode",    {"layer_num", "layer_z", "max_layer_z", "filament_extruder_id"}},
-    {"end_filament_gcode",      {"layer_num", "layer_z", "max_layer_z", "filament_extruder_id"}},
-    {"end_gcode",               {"layer_num", "layer_z", "max_layer_z", "filament_extruder_id"}},
-    {"before_layer_gcode",      {"layer_num", "layer_z", "max_layer_z"}},
-    {"layer_gcode",             {"layer_num", "layer_z", "max_layer_z"}},
-    {"toolchange_gcode",        {"layer_num", "layer_z", "max_layer_z", "previous_extruder", "next_extruder", "toolchange_z"}},
-    {"color_change_gcode",      {"color_change_extruder"}},
-    {"pause_print_gcode",       {"color_change_extruder"}},
-};
-
 const std::map<t_custom_gcode_key, t_config_option_keys>& custom_gcode_specific_placeholders()
 {
-    return s_CustomGcodeSpecificPlaceholders;
+    // Only queried by the custom G-code editing UI, thus built lazily on first use.
+    static const std::map<t_custom_gcode_key, t_config_option_keys> placeholders {
+        {"start_filament_gcode",    {"layer_num", "layer_z", "max_layer_z", "filament_extruder_id"}},
+        {"end_filament_gcode",      {"layer_num", "layer_z", "max_layer_z", "filament_extruder_id"}},
+        {"end_gcode",               {"layer_num", "layer_z", "max_layer_z", "filament_extruder_id"}},
+        {"before_layer_gcode",      {"layer_num", "layer_z", "max_layer_z"}},
+        {"layer_gcode",             {"layer_num", "layer_z", "max_layer_z"}},
+        {"toolchange_gcode",        {"layer_num", "layer_z", "max_layer_z", "previous_extruder", "next_extruder", "toolchange_z"}},
+        {"color_change_gcode",      {"color_change_extruder"}},
+        {"pause_print_gcode",       {"color_change_extruder"}},
+    };
+    return placeholders;
 }
 
 CustomGcodeSpecificConfigDef::CustomGcodeSpecificConfigDef()
@@ -11,8 +11,11 @@
 #include "BridgeDetector.hpp"
 #include "ExPolygon.hpp"
 #include "Exception.hpp"
+#include "Execution/ExecutionTBB.hpp"
+#include "Execution/GrainCalibration.hpp"
 #include "Flow.hpp"
 #include "GCode/ExtrusionProcessor.hpp"
+#include "GCode/ModelVisibility.hpp"
 #include "KDTreeIndirect.hpp"
 #include "Line.hpp"
 #include "Point.hpp"
@@ -28,12 +31,14 @@
 #include "MutablePolygon.hpp"
 #include "PrintBase.hpp"
 #include "PrintConfig.hpp"
+#include "Support/SupportAnalysis.hpp"
 #include "Support/SupportMaterial.hpp"
 #include "Support/TreeSupport.hpp"
 #include "Surface.hpp"
 #include "Slicing.hpp"
 #include "SurfaceCollection.hpp"
 #include "Tesselate.hpp"
+#include "Tracing.hpp"
 #include "TriangleMeshSlicer.hpp"
 #include "Utils.hpp"
 #include "Fill/FillAdaptive.hpp"
@@ -177,6 +182,8 @@ void PrintObject::make_perimeters()
     if (! this->set_started(posPerimeters))
         return;
 
+    Tracing::Span span("PrintObject::make_perimeters");
+
     m_print->set_status(20, _u8L("Generating perimeters"));
     BOOST_LOG_TRIVIAL(info) << "Generating perimeters..." << log_memory_info();
     
@@ -197,80 +204,92 @@ void PrintObject::make_perimeters()
     // but we don't generate any extra perimeter if fill density is zero, as they would be floating
     // inside the object - infill_only_where_needed should be the method of choice for printing
     // hollow objects
+    // Equivalence classes of regions producing identical perimeters, computed once per object
+    // instead of re-deciding the pairwise config compatibility on every layer.
+    const std::vector<uint32_t> perimeter_compat_classes = perimeter_compatibility_classes(*this);
+
+    // Regions for which the extra perimeter analysis is to be run.
+    std::vector<size_t> extra_perimeter_region_ids;
     for (size_t region_id = 0; region_id < this->num_printing_regions(); ++ region_id) {
         const PrintRegion &region = this->printing_region(region_id);
-        if (! region.config().extra_perimeters || region.config().perimeters == 0 || region.config().fill_density == 0 || this->layer_count() < 2)
-            continue;
-
-        BOOST_LOG_TRIVIAL(debug) << "Generating extra perimeters for region " << region_id << " in parallel - start";
-        tbb::parallel_for(
-            tbb::blocked_range<size_t>(0, m_layers.size() - 1),
-            [this, &region, region_id](const tbb::blocked_range<size_t>& range) {
-                PRINT_OBJECT_TIME_LIMIT_MILLIS(PRINT_OBJECT_TIME_LIMIT_DEFAULT);
-                for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx) {
-                    m_print->throw_if_canceled();
-                    LayerRegion &layerm                     = *m_layers[layer_idx]->get_region(region_id);
-                    const LayerRegion &upper_layerm         = *m_layers[layer_idx+1]->get_region(region_id);
-                    const Polygons upper_layerm_polygons    = to_polygons(upper_layerm.slices().surfaces);
-                    // Filter upper layer polygons in intersection_ppl by their bounding boxes?
-                    // my $upper_layerm_poly_bboxes= [ map $_->bounding_box, @{$upper_layerm_polygons} ];
-                    const double total_loop_length      = total_length(upper_layerm_polygons);
-                    const coord_t perimeter_spacing     = layerm.flow(frPerimeter).scaled_spacing();
-                    const Flow ext_perimeter_flow       = layerm.flow(frExternalPerimeter);
-                    const coord_t ext_perimeter_width   = ext_perimeter_flow.scaled_width();
-                    const coord_t ext_perimeter_spacing = ext_perimeter_flow.scaled_spacing();
-
-                    // slice is not const because slice.extra_perimeters is being incremented.
-                    for (Surface &slice : layerm.m_slices.surfaces) {
-                        for (;;) {
-                            // compute the total thickness of perimeters
-                            const coord_t perimeters_thickness = ext_perimeter_width/2 + ext_perimeter_spacing/2
-                                + (region.config().perimeters-1 + slice.extra_perimeters) * perimeter_spacing;
-                            // define a critical area where we don't want the upper slice to fall into
-                            // (it should either lay over our perimeters or outside this area)
-                            const coord_t critical_area_depth = coord_t(perimeter_spacing * 1.5);
-                            const Polygons critical_area = diff(
-                                offset(slice.expolygon, float(- perimeters_thickness)),
-                                offset(slice.expolygon, float(- perimeters_thickness - critical_area_depth))
-                            );
-                            // check whether a portion of the upper slices falls inside the critical area
-                            const Polylines intersection = intersection_pl(to_polylines(upper_layerm_polygons), critical_area);
-                            // only add an additional loop if at least 30% of the slice loop would benefit from it
-                            if (total_length(intersection) <=  total_loop_length*0.3)
-                                break;
-                            /*
-                            if (0) {
-                                require "Slic3r/SVG.pm";
-                                Slic3r::SVG::output(
-                                    "extra.svg",
-                                    no_arrows   => 1,
-                                    expolygons  => union_ex($critical_area),
-                                    polylines   => [ map $_->split_at_first_point, map $_->p, @{$upper_layerm->slices} ],
-                                );
-                            }
-                            */
-                            ++ slice.extra_perimeters;
-                        }
-                        #ifdef DEBUG
-                            if (slice.extra_perimeters > 0)
-                                printf("  adding %d more perimeter(s) at layer %zu\n", slice.extra_perimeters, layer_idx);
-                        #endif
-                    }
-                }
-            });
-        m_print->throw_if_canceled();
-        BOOST_LOG_TRIVIAL(debug) << "Generating extra perimeters for region " << region_id << " in parallel - end";
+        if (region.config().extra_perimeters && region.config().perimeters > 0 && region.config().fill_density > 0 && this->layer_count() >= 2)
+            extra_perimeter_region_ids.emplace_back(region_id);
     }
 
+    // The extra perimeter analysis of a layer only reads the slices of the layer above (immutable since slicing)
+    // and the perimeter generator only consumes its own layer, thus both are fused into a single parallel sweep:
+    // each layer flows from the analysis directly into perimeter generation without a whole object barrier
+    // per region in between.
+    // Per-layer perimeter cost is heavily skewed (dense bottom layers vs. tiny top layers), thus the layers
+    // are distributed by an estimated cost (slice contour points) instead of by equal counts.
     BOOST_LOG_TRIVIAL(debug) << "Generating perimeters in parallel - start";
-    tbb::parallel_for(
-        tbb::blocked_range<size_t>(0, m_layers.size()),
-        [this](const tbb::blocked_range<size_t>& range) {
+    execution::for_each_weighted(ex_tbb, size_t(0), m_layers.size(),
+        [this, &extra_perimeter_region_ids, &perimeter_compat_classes](size_t layer_idx) {
             PRINT_OBJECT_TIME_LIMIT_MILLIS(PRINT_OBJECT_TIME_LIMIT_DEFAULT);
-            for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx) {
+            {
                 m_print->throw_if_canceled();
-                m_layers[layer_idx]->make_perimeters();
+                // compare each layer to the one above, and mark those slices needing one additional inner perimeter,
+                // like the top of domed objects. There is no layer above the last layer, nothing to compare to.
+                if (layer_idx + 1 < m_layers.size())
+                    for (size_t region_id : extra_perimeter_region_ids) {
+                        const PrintRegion &region               = this->printing_region(region_id);
+                        LayerRegion &layerm                     = *m_layers[layer_idx]->get_region(region_id);
+                        const LayerRegion &upper_layerm         = *m_layers[layer_idx+1]->get_region(region_id);
+                        const Polygons upper_layerm_polygons    = to_polygons(upper_layerm.slices().surfaces);
+                        // Filter upper layer polygons in intersection_ppl by their bounding boxes?
+                        // my $upper_layerm_poly_bboxes= [ map $_->bounding_box, @{$upper_layerm_polygons} ];
+                        const double total_loop_length      = total_length(upper_layerm_polygons);
+                        const coord_t perimeter_spacing     = layerm.flow(frPerimeter).scaled_spacing();
+                        const Flow ext_perimeter_flow       = layerm.flow(frExternalPerimeter);
+                        const coord_t ext_perimeter_width   = ext_perimeter_flow.scaled_width();
+                        const coord_t ext_perimeter_spacing = ext_perimeter_flow.scaled_spacing();
+
+                        // slice is not const because slice.extra_perimeters is being incremented.
+                        for (Surface &slice : layerm.m_slices.surfaces) {
+                            for (;;) {
+                                // compute the total thickness of perimeters
+                                const coord_t perimeters_thickness = ext_perimeter_width/2 + ext_perimeter_spacing/2
+                                    + (region.config().perimeters-1 + slice.extra_perimeters) * perimeter_spacing;
+                                // define a critical area where we don't want the upper slice to fall into
+                                // (it should either lay over our perimeters or outside this area)
+                                const coord_t critical_area_depth = coord_t(perimeter_spacing * 1.5);
+                                const Polygons critical_area = diff(
+                                    offset(slice.expolygon, float(- perimeters_thickness)),
+                                    offset(slice.expolygon, float(- perimeters_thickness - critical_area_depth))
+                                );
+                                // check whether a portion of the upper slices falls inside the critical area
+                                const Polylines intersection = intersection_pl(to_polylines(upper_layerm_polygons), critical_area);
+                                // only add an additional loop if at least 30% of the slice loop would benefit from it
+                                if (total_length(intersection) <=  total_loop_length*0.3)
+                                    break;
+                                /*
+                                if (0) {
+                                    require "Slic3r/SVG.pm";
+                                    Slic3r::SVG::output(
+                                        "extra.svg",
+                                        no_arrows   => 1,
+                                        expolygons  => union_ex($critical_area),
+                                        polylines   => [ map $_->split_at_first_point, map $_->p, @{$upper_layerm->slices} ],
+                                    );
+                                }
+                                */
+                                ++ slice.extra_perimeters;
+                            }
+                            #ifdef DEBUG
+                                if (slice.extra_perimeters > 0)
+                                    printf("  adding %d more perimeter(s) at layer %zu\n", slice.extra_perimeters, layer_idx);
+                            #endif
+                        }
+                    }
+                m_layers[layer_idx]->make_perimeters(perimeter_compat_classes);
             }
+        },
+        [this](size_t layer_idx) {
+            size_t cost = 0;
+            for (const LayerRegion *layerm : m_layers[layer_idx]->regions())
+                for (const Surface &surface : layerm->slices().surfaces)
+                    cost += count_points(surface.expolygon);
+            return cost;
         }
     );
     m_print->throw_if_canceled();
@@ -429,6 +448,7 @@ void PrintObject::infill()
     this->prepare_infill();
 
     if (this->set_started(posInfill)) {
+        Tracing::Span span("PrintObject::infill");
         // TRN Status for the Print calculation 
         m_print->set_status(45, _u8L("Making infill"));
         const auto& adaptive_fill_octree = this->m_adaptive_fill_octrees.first;
@@ -436,7 +456,7 @@ void PrintObject::infill()
 
         BOOST_LOG_TRIVIAL(debug) << "Filling layers in parallel - start";
         tbb::parallel_for(
-            tbb::blocked_range<size_t>(0, m_layers.size()),
+            tbb::blocked_range<size_t>(0, m_layers.size(), execution::calibrated_granularity(execution::CalibratedKernel::Fill, 1)),
             [this, &adaptive_fill_octree = adaptive_fill_octree, &support_fill_octree = support_fill_octree](const tbb::blocked_range<size_t>& range) {
                 PRINT_OBJECT_TIME_LIMIT_MILLIS(PRINT_OBJECT_TIME_LIMIT_DEFAULT);
                 for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx) {
@@ -502,6 +522,7 @@ void PrintObject::generate_support_spots()
 void PrintObject::generate_support_material()
 {
     if (this->set_started(posSupportMaterial)) {
+        Tracing::Span span("PrintObject::generate_support_material");
         this->clear_support_layers();
         if ((this->has_support() && m_layers.size() > 1) || (this->has_raft() && ! m_layers.empty())) {
             m_print->set_status(70, _u8L("Generating support material"));    
@@ -656,7 +677,8 @@ FillLightning::GeneratorPtr PrintObject::prepare_lightning_infill_data()
     if (has_lightning_infill)
         lightning_density /= coordf_t(lightning_cnt);
 
-    return has_lightning_infill ? FillLightning::build_generator(std::as_const(*this), lightning_density, [this]() -> void { this->throw_if_canceled(); }) : FillLightning::GeneratorPtr();
+    // Pass the previous generator, it is reused if the infill surfaces and parameters did not change since the last run.
+    return has_lightning_infill ? FillLightning::build_generator(std::move(m_lightning_generator), std::as_const(*this), lightning_density, [this]() -> void { this->throw_if_canceled(); }) : FillLightning::GeneratorPtr();
 }
 
 void PrintObject::clear_layers()
@@ -930,6 +952,8 @@ bool PrintObject::invalidate_step(PrintObjectStep step)
                                                posSupportMaterial, posEstimateCurledExtrusions, posCalculateOverhangingPerimeters});
         invalidated |= m_print->invalidate_steps({ psSkirtBrim });
         m_slicing_params.valid = false;
+        m_support_analysis.reset();
+        m_model_visibility.reset();
     } else if (step == posSupportMaterial) {
         invalidated |= m_print->invalidate_steps({ psSkirtBrim,  });
         invalidated |= this->invalidate_steps({ posEstimateCurledExtrusions });
@@ -953,9 +977,30 @@ bool PrintObject::invalidate_all_steps()
     bool result = Inherited::invalidate_all_steps() | m_print->invalidate_all_steps();
 	// Then reset some of the depending values.
 	m_slicing_params.valid = false;
+    m_support_analysis.reset();
+    m_model_visibility.reset();
 	return result;
 }
 
+std::shared_ptr<const SupportAnalysis> PrintObject::support_analysis(std::function<void()> throw_on_cancel) const
+{
+    if (! m_support_analysis)
+        m_support_analysis = SupportAnalysis::create(*this, std::move(throw_on_cancel));
+    return m_support_analysis;
+}
+
+std::shared_ptr<const ModelInfo::Visibility> PrintObject::model_visibility(const ModelInfo::VisibilityParams &params, std::function<void()> throw_on_cancel) const
+{
+    if (! m_model_visibility || ! (*m_model_visibility_params == params)) {
+        if (! throw_on_cancel)
+            throw_on_cancel = [](){};
+        m_model_visibility = std::make_shared<const ModelInfo::Visibility>(
+            this->trafo_centered(), this->model_object()->volumes, params, throw_on_cancel);
+        m_model_visibility_params = std::make_shared<const ModelInfo::VisibilityParams>(params);
+    }
+    return m_model_visibility;
+}
+
 // Called on main thread with stopped or paused background processing to let PrintObject release data for its milestones that were invalidated or canceled.
 void PrintObject::cleanup()
 {
@@ -1674,9 +1719,9 @@ void PrintObject::discover_vertical_shells()
 
                     // Assign resulting internal surfaces to layer.
                     layerm->m_fill_surfaces.keep_types({ stTop, stBottom, stBottomBridge });
-                    layerm->m_fill_surfaces.append(new_internal,       stInternal);
-                    layerm->m_fill_surfaces.append(new_internal_void,  stInternalVoid);
-                    layerm->m_fill_surfaces.append(new_internal_solid, stInternalSolid);
+                    layerm->m_fill_surfaces.append(std::move(new_internal),       stInternal);
+                    layerm->m_fill_surfaces.append(std::move(new_internal_void),  stInternalVoid);
+                    layerm->m_fill_surfaces.append(std::move(new_internal_solid), stInternalSolid);
                 } // for each layer
             });
         m_print->throw_if_canceled();
@@ -2529,7 +2574,7 @@ void PrintObject::bridge_over_infill()
 #endif
 
                 region->m_fill_surfaces.remove_types({stInternalSolid, stInternal});
-                region->m_fill_surfaces.append(new_surfaces);
+                region->m_fill_surfaces.append(std::move(new_surfaces));
             }
         }
     });
@@ -2938,7 +2983,8 @@ void PrintObject::combine_infill()
                     for (LayerRegion *layerm2 : layerms)
                         templ.thickness += layerm2->layer()->height;
                     templ.thickness_layers = (unsigned short)layerms.size();
-                    layerm->m_fill_surfaces.append(intersection, templ);
+                    // layerms.back() is the last layer region iterated, intersection is not needed anymore.
+                    layerm->m_fill_surfaces.append(std::move(intersection), templ);
                 } else {
                     // Save void surfaces.
                     layerm->m_fill_surfaces.append(
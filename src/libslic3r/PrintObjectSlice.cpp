@@ -9,6 +9,7 @@
 #include "MultiMaterialSegmentation.hpp"
 #include "Print.hpp"
 #include "ShortestPath.hpp"
+#include "Tracing.hpp"
 
 #include <boost/log/trivial.hpp>
 
@@ -43,10 +44,13 @@ LayerPtrs new_layers(
 }
 
 // Slice single triangle mesh.
+// If a cache is provided, the raw contours of the slicing planes already stored in the cache are reused
+// and only the missing planes are sliced, see MeshSlicingCache.
 static std::vector<ExPolygons> slice_volume(
     const ModelVolume             &volume,
-    const std::vector<float>      &zs, 
+    const std::vector<float>      &zs,
     const MeshSlicingParamsEx     &params,
+    MeshSlicingCache              *cache,
     const std::function<void()>   &throw_on_cancel_callback)
 {
     std::vector<ExPolygons> layers;
@@ -57,7 +61,9 @@ static std::vector<ExPolygons> slice_volume(
             params2.trafo = params2.trafo * volume.get_matrix();
             if (params2.trafo.rotation().determinant() < 0.)
                 its_flip_triangles(its);
-            layers = slice_mesh_ex(its, zs, params2, throw_on_cancel_callback);
+            layers = cache ?
+                slice_mesh_ex(its, zs, params2, volume.id(), *cache, throw_on_cancel_callback) :
+                slice_mesh_ex(its, zs, params2, throw_on_cancel_callback);
             throw_on_cancel_callback();
         }
     }
@@ -71,13 +77,14 @@ static std::vector<ExPolygons> slice_volume(
     const std::vector<float>                    &z,
     const std::vector<t_layer_height_range>     &ranges,
     const MeshSlicingParamsEx                   &params,
+    MeshSlicingCache                            *cache,
     const std::function<void()>                 &throw_on_cancel_callback)
 {
     std::vector<ExPolygons> out;
     if (! z.empty() && ! ranges.empty()) {
         if (ranges.size() == 1 && z.front() >= ranges.front().first && z.back() < ranges.front().second) {
             // All layers fit into a single range.
-            out = slice_volume(volume, z, params, throw_on_cancel_callback);
+            out = slice_volume(volume, z, params, cache, throw_on_cancel_callback);
         } else {
             std::vector<float>                     z_filtered;
             std::vector<std::pair<size_t, size_t>> n_filtered;
@@ -93,7 +100,7 @@ static std::vector<ExPolygons> slice_volume(
                     n_filtered.emplace_back(std::make_pair(first, i));
             }
             if (! n_filtered.empty()) {
-                std::vector<ExPolygons> layers = slice_volume(volume, z_filtered, params, throw_on_cancel_callback);
+                std::vector<ExPolygons> layers = slice_volume(volume, z_filtered, params, cache, throw_on_cancel_callback);
                 out.assign(z.size(), ExPolygons());
                 i = 0;
                 for (const std::pair<size_t, size_t> &span : n_filtered)
@@ -128,6 +135,8 @@ static std::vector<VolumeSlices> slice_volumes_inner(
     ModelVolumePtrs                                           model_volumes,
     const std::vector<PrintObjectRegions::LayerRangeRegions> &layer_ranges,
     const std::vector<float>                                 &zs,
+    // Returns the incremental re-slicing cache of a volume, nullptr to slice without a cache.
+    const std::function<MeshSlicingCache*(const ModelVolume&)> &get_slicing_cache,
     const std::function<void()>                              &throw_on_cancel_callback)
 {
     model_volumes_sort_by_id(model_volumes);
@@ -159,6 +168,7 @@ static std::vector<VolumeSlices> slice_volumes_inner(
 
     for (const ModelVolume *model_volume : model_volumes)
         if (model_volume_needs_slicing(*model_volume)) {
+            MeshSlicingCache   *cache = get_slicing_cache ? get_slicing_cache(*model_volume) : nullptr;
             MeshSlicingParamsEx params { params_base };
             if (! model_volume->is_negative_volume())
                 params.extra_offset = extra_offset;
@@ -176,8 +186,8 @@ static std::vector<VolumeSlices> slice_volumes_inner(
                             ++ params.slicing_mode_normal_below_layer);
                     }
                     out.push_back({
-                        model_volume->id(), 
-                        slice_volume(*model_volume, zs, params, throw_on_cancel_callback)
+                        model_volume->id(),
+                        slice_volume(*model_volume, zs, params, cache, throw_on_cancel_callback)
                     });
                 }
             } else {
@@ -187,9 +197,9 @@ static std::vector<VolumeSlices> slice_volumes_inner(
                     if (layer_range.has_volume(model_volume->id()))
                         slicing_ranges.emplace_back(layer_range.layer_height_range);
                 if (! slicing_ranges.empty())
-                    out.push_back({ 
-                        model_volume->id(), 
-                        slice_volume(*model_volume, zs, slicing_ranges, params, throw_on_cancel_callback)
+                    out.push_back({
+                        model_volume->id(),
+                        slice_volume(*model_volume, zs, slicing_ranges, params, cache, throw_on_cancel_callback)
                     });
             }
             if (! out.empty() && out.back().slices.empty())
@@ -235,16 +245,20 @@ static std::vector<PrintObjectRegions::LayerRangeRegions>::const_iterator layer_
     return it;
 }
 
-static std::vector<std::vector<ExPolygons>> slices_to_regions(
-    ModelVolumePtrs                                           model_volumes,
-    const PrintObjectRegions                                 &print_object_regions,
+// Distribute the volume slices into the slice storage owned by the LayerRegions of layers.
+// The polygons are moved (not copied) from the slicing output all the way into the regions,
+// without a per object staging table in between. The layers have to be freshly allocated
+// with empty LayerRegions when entering this function.
+void slices_to_regions(
+    const PrintObject                                        &print_object,
     const std::vector<float>                                 &zs,
     std::vector<VolumeSlices>                               &&volume_slices,
+    LayerPtrs                                                &layers,
     const std::function<void()>                              &throw_on_cancel_callback)
 {
+    ModelVolumePtrs model_volumes = print_object.model_object()->volumes;
     model_volumes_sort_by_id(model_volumes);
-
-    std::vector<std::vector<ExPolygons>> slices_by_region(print_object_regions.all_regions.size(), std::vector<ExPolygons>(zs.size(), ExPolygons()));
+    const PrintObjectRegions &print_object_regions = *print_object.shared_regions();
 
     // First shuffle slices into regions if there is no overlap with another region possible, collect zs of the complex cases.
     std::vector<std::pair<size_t, float>> zs_complex;
@@ -258,9 +272,9 @@ static std::vector<std::vector<ExPolygons>> slices_to_regions(
                 assert(model_volume != nullptr);
                 if (model_volume->is_model_part()) {
                     VolumeSlices &slices_src = volume_slices_find_by_id(volume_slices, model_volume->id());
-                    auto         &slices_dst = slices_by_region[layer_range.volume_regions.front().region->print_object_region_id()];
+                    const int     region_id  = layer_range.volume_regions.front().region->print_object_region_id();
                     for (; z_idx < zs.size() && zs[z_idx] < layer_range.layer_height_range.second; ++ z_idx)
-                        slices_dst[z_idx] = std::move(slices_src.slices[z_idx]);
+                        layers[z_idx]->get_region(region_id)->m_slices.append(std::move(slices_src.slices[z_idx]), stInternal);
                 }
             } else {
                 zs_complex.reserve(zs.size());
@@ -289,7 +303,8 @@ static std::vector<std::vector<ExPolygons>> slices_to_regions(
                         zs_complex.push_back({ z_idx, z });
                     else if (idx_first_printable_region >= 0) {
                         const PrintObjectRegions::VolumeRegion &region = layer_range.volume_regions[idx_first_printable_region];
-                        slices_by_region[region.region->print_object_region_id()][z_idx] = std::move(volume_slices_find_by_id(volume_slices, region.model_volume->id()).slices[z_idx]);
+                        layers[z_idx]->get_region(region.region->print_object_region_id())->m_slices.append(
+                            std::move(volume_slices_find_by_id(volume_slices, region.model_volume->id()).slices[z_idx]), stInternal);
                     }
                 }
             }
@@ -308,7 +323,7 @@ static std::vector<std::vector<ExPolygons>> slices_to_regions(
         }
         tbb::parallel_for(
             tbb::blocked_range<size_t>(0, zs_complex.size()),
-            [&slices_by_region, &print_object_regions, &zs_complex, &layer_ranges_regions_to_slices, &throw_on_cancel_callback]
+            [&layers, &print_object_regions, &zs_complex, &layer_ranges_regions_to_slices, &throw_on_cancel_callback]
                 (const tbb::blocked_range<size_t> &range) {
                 float z              = zs_complex[range.begin()].second;
                 auto  it_layer_range = layer_range_first(print_object_regions.layer_ranges, z);
@@ -390,15 +405,13 @@ static std::vector<std::vector<ExPolygons>> slices_to_regions(
                             }
                         if (merged)
                             expolygons = closing_ex(expolygons, float(scale_(EPSILON)));
-                        slices_by_region[temp_slices[i].region_id][z_idx] = std::move(expolygons);
+                        layers[z_idx]->get_region(temp_slices[i].region_id)->m_slices.append(std::move(expolygons), stInternal);
                         i = j;
                     }
                     throw_on_cancel_callback();
                 }
             });
     }
-
-    return slices_by_region;
 }
 
 // Layer::slicing_errors is no more set since 1.41.1 or possibly earlier, thus this code
@@ -501,6 +514,7 @@ void PrintObject::slice()
 {
     if (! this->set_started(posSlice))
         return;
+    Tracing::Span span("PrintObject::slice");
     m_print->set_status(10, _u8L("Processing triangulated mesh"));
     std::vector<coordf_t> layer_height_profile;
     this->update_layer_height_profile(*this->model_object(), m_slicing_params, layer_height_profile);
@@ -529,6 +543,9 @@ void PrintObject::slice()
             for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx) {
                 m_print->throw_if_canceled();
                 Layer &layer = *m_layers[layer_idx];
+                // The lslices were assembled by the Clipper unions above, which grow their outputs
+                // incrementally. Slicing is done, give the spare capacity back to the allocator.
+                layer.lslices.shrink_to_fit();
                 layer.lslices_ex.clear();
                 layer.lslices_ex.reserve(layer.lslices.size());
                 for (const ExPolygon &expoly : layer.lslices)
@@ -699,20 +716,41 @@ void PrintObject::slice_volumes()
             layer->m_regions.emplace_back(new LayerRegion(layer, pr.get()));
     }
 
-    std::vector<float>                   slice_zs      = zs_from_layers(m_layers);
-    std::vector<std::vector<ExPolygons>> region_slices = slices_to_regions(this->model_object()->volumes, *m_shared_regions, slice_zs,
+    // Drop the incremental re-slicing caches of volumes that no longer exist in the model object.
+    const ModelVolumePtrs &model_volumes = this->model_object()->volumes;
+    m_volume_slicing_caches.erase(
+        std::remove_if(m_volume_slicing_caches.begin(), m_volume_slicing_caches.end(),
+            [&model_volumes](const VolumeSlicingCache &cache) {
+                return std::none_of(model_volumes.begin(), model_volumes.end(),
+                    [&cache](const ModelVolume *mv) { return mv->id() == cache.volume_id; });
+            }),
+        m_volume_slicing_caches.end());
+    // Look up (or create) the incremental re-slicing cache of a volume. When the variable layer height
+    // profile is edited, most slicing planes stay intact and only the missing planes are sliced again.
+    auto get_slicing_cache = [this](const ModelVolume &mv) -> MeshSlicingCache* {
+        auto it = std::find_if(m_volume_slicing_caches.begin(), m_volume_slicing_caches.end(),
+            [&mv](const VolumeSlicingCache &cache) { return cache.volume_id == mv.id(); });
+        if (it == m_volume_slicing_caches.end()) {
+            m_volume_slicing_caches.push_back({ mv.id(), mv.get_mesh_shared_ptr(), MeshSlicingCache{} });
+            it = std::prev(m_volume_slicing_caches.end());
+        } else if (it->mesh != mv.get_mesh_shared_ptr()) {
+            // The mesh of the volume was replaced while the volume kept its ObjectID. The cached contours are stale.
+            it->mesh = mv.get_mesh_shared_ptr();
+            it->cache.clear();
+        }
+        return &it->cache;
+    };
+
+    std::vector<float> slice_zs = zs_from_layers(m_layers);
+    // The region slices are moved from the slicing output directly into the slice storage
+    // owned by the LayerRegions allocated above.
+    slices_to_regions(*this, slice_zs,
         slice_volumes_inner(
             print->config(), this->config(), this->trafo_centered(),
-            this->model_object()->volumes, m_shared_regions->layer_ranges, slice_zs, throw_on_cancel_callback),
-        throw_on_cancel_callback);
+            this->model_object()->volumes, m_shared_regions->layer_ranges, slice_zs, get_slicing_cache, throw_on_cancel_callback),
+        m_layers, throw_on_cancel_callback);
+
 
-    for (size_t region_id = 0; region_id < region_slices.size(); ++ region_id) {
-        std::vector<ExPolygons> &by_layer = region_slices[region_id];
-        for (size_t layer_id = 0; layer_id < by_layer.size(); ++ layer_id)
-            m_layers[layer_id]->regions()[region_id]->m_slices.append(std::move(by_layer[layer_id]), stInternal);
-    }
-    region_slices.clear();
-    
     BOOST_LOG_TRIVIAL(debug) << "Slicing volumes - removing top empty layers";
     while (! m_layers.empty()) {
         const Layer *layer = m_layers.back();
@@ -818,6 +856,7 @@ void PrintObject::slice_volumes()
             Layer &layer = *m_layers.front();
 	    	assert(layer.id() == 0);
 			layer.lslices = std::move(lslices_1st_layer);
+            layer.invalidate_lslices_index();
             layer.lslice_indices_sorted_by_print_order = chain_expolygons(layer.lslices);
 		}
 	}
@@ -843,7 +882,7 @@ std::vector<Polygons> PrintObject::slice_support_volumes(const ModelVolumeType m
         params.trafo = this->trafo_centered();
         for (; it_volume != it_volume_end; ++ it_volume)
             if ((*it_volume)->type() == model_volume_type) {
-                std::vector<ExPolygons> slices2 = slice_volume(*(*it_volume), zs, params, throw_on_cancel_callback);
+                std::vector<ExPolygons> slices2 = slice_volume(*(*it_volume), zs, params, nullptr, throw_on_cancel_callback);
                 if (slices.empty()) {
                     slices.reserve(slices2.size());
                     for (ExPolygons &src : slices2)
@@ -55,6 +55,14 @@ Flow PrintRegion::flow(const PrintObject &object, FlowRole role, double layer_he
     return Flow::new_from_config_width(role, config_width, nozzle_diameter, float(layer_height));
 }
 
+std::array<Flow, num_region_flow_roles> PrintRegion::flows(const PrintObject &object, double layer_height, bool first_layer) const
+{
+    std::array<Flow, num_region_flow_roles> flows;
+    for (size_t role = 0; role < num_region_flow_roles; ++ role)
+        flows[role] = this->flow(object, FlowRole(role), layer_height, first_layer);
+    return flows;
+}
+
 coordf_t PrintRegion::nozzle_dmr_avg(const PrintConfig &print_config) const
 {
     return (print_config.nozzle_diameter.get_at(m_config.perimeter_extruder.value    - 1) + 
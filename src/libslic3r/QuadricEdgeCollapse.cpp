@@ -5,8 +5,11 @@
 #include "QuadricEdgeCollapse.hpp"
 #include <tuple>
 #include <optional>
+#include <atomic>
+#include <mutex>
 #include "MutablePriorityQueue.hpp"
 #include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
 
 using namespace Slic3r;
 
@@ -146,9 +149,16 @@ namespace QuadricEdgeCollapse {
                          const VertexInfos &v_infos, const EdgeInfos &e_infos);
 #endif /* EXPENSIVE_DEBUG_CHECKS */
 
+    // single threaded reduction of mesh, allows to lock vertices (on partition borders)
+    void collapse(indexed_triangle_set &its, uint32_t triangle_count, float *max_error,
+        ThrowOnCancel throw_on_cancel, StatusFn status_fn,
+        const std::vector<bool> *locked_vertices);
+
     // constants --> may be move to config
     const uint32_t check_cancel_period = 16; // how many edge to reduce before call throw_on_cancel
     const size_t max_triangle_count_for_one_vertex = 50;
+    // minimal amount of triangles for mesh partitioning - could be processed concurrently
+    const size_t min_triangle_count_per_partition = 250000;
     // change speed of progress bargraph
     const int status_init_size = 10; // in percents
     // parts of init size
@@ -175,6 +185,163 @@ void Slic3r::its_quadric_edge_collapse(
     if (throw_on_cancel == nullptr) throw_on_cancel = []() {};
     if (status_fn == nullptr) status_fn = [](int) {};
 
+    // Big meshes are decimated concurrently: partitioned into spatial slabs
+    // which are reduced independently while the slab border vertices stay
+    // locked, then welded back together and finished by a sequential pass.
+    size_t region_count = std::min(size_t(tbb::this_task_arena::max_concurrency()),
+                                   its.indices.size() / min_triangle_count_per_partition);
+    if (region_count < 2) {
+        collapse(its, triangle_count, max_error, throw_on_cancel, status_fn, nullptr);
+        return;
+    }
+
+    // partition along the longest bounding box axis
+    Vec3f bb_min = its.vertices.front(), bb_max = bb_min;
+    for (const Vec3f &vertex : its.vertices) {
+        bb_min = bb_min.cwiseMin(vertex);
+        bb_max = bb_max.cwiseMax(vertex);
+    }
+    int axis;
+    float axis_size = (bb_max - bb_min).maxCoeff(&axis);
+    if (axis_size <= 0.f) { // degenerated mesh
+        collapse(its, triangle_count, max_error, throw_on_cancel, status_fn, nullptr);
+        return;
+    }
+    float axis_min = bb_min[axis];
+
+    // assign triangles to slabs, detect vertices shared by more than one slab
+    const int16_t vertex_unassigned = -1;
+    const int16_t vertex_shared     = -2;
+    std::vector<int16_t>  vertex_region(its.vertices.size(), vertex_unassigned);
+    std::vector<uint16_t> triangle_region(its.indices.size());
+    std::vector<uint32_t> region_sizes(region_count, 0);
+    for (size_t ti = 0; ti < its.indices.size(); ++ti) {
+        const Triangle &t = its.indices[ti];
+        float center = (its.vertices[t[0]][axis] + its.vertices[t[1]][axis] +
+                        its.vertices[t[2]][axis]) / 3.f;
+        size_t r = std::min(region_count - 1,
+            size_t((center - axis_min) / axis_size * region_count));
+        triangle_region[ti] = static_cast<uint16_t>(r);
+        ++region_sizes[r];
+        for (size_t j = 0; j < 3; ++j) {
+            int16_t &vr = vertex_region[t[j]];
+            if (vr == vertex_unassigned) vr = static_cast<int16_t>(r);
+            else if (vr != static_cast<int16_t>(r)) vr = vertex_shared;
+        }
+    }
+
+    // order triangle indices by their region
+    std::vector<uint32_t> region_offsets(region_count + 1, 0);
+    for (size_t r = 0; r < region_count; ++r)
+        region_offsets[r + 1] = region_offsets[r] + region_sizes[r];
+    std::vector<uint32_t> ordered_triangles(its.indices.size());
+    {
+        std::vector<uint32_t> fill_offsets(region_offsets.begin(), region_offsets.end() - 1);
+        for (size_t ti = 0; ti < its.indices.size(); ++ti)
+            ordered_triangles[fill_offsets[triangle_region[ti]]++] = ti;
+    }
+
+    struct Region
+    {
+        indexed_triangle_set its;
+        std::vector<bool>    locked; // vertices on the slab border
+        uint32_t             triangle_count = 0; // wanted
+        float                last_error     = 0.f;
+    };
+    std::vector<Region> regions(region_count);
+    { // split mesh into regions with locally indexed vertices
+        const uint32_t no_index = std::numeric_limits<uint32_t>::max();
+        std::vector<uint32_t> global_to_local(its.vertices.size(), no_index);
+        std::vector<uint32_t> local_to_global;
+        for (size_t r = 0; r < region_count; ++r) {
+            Region &region = regions[r];
+            region.its.indices.reserve(region_sizes[r]);
+            local_to_global.clear();
+            for (uint32_t oi = region_offsets[r]; oi < region_offsets[r + 1]; ++oi) {
+                Triangle t = its.indices[ordered_triangles[oi]];
+                for (size_t j = 0; j < 3; ++j) {
+                    uint32_t &local = global_to_local[t[j]];
+                    if (local == no_index) {
+                        local = static_cast<uint32_t>(region.its.vertices.size());
+                        region.its.vertices.emplace_back(its.vertices[t[j]]);
+                        region.locked.emplace_back(vertex_region[t[j]] == vertex_shared);
+                        local_to_global.emplace_back(t[j]);
+                    }
+                    t[j] = local;
+                }
+                region.its.indices.emplace_back(t);
+            }
+            // clean the shared map for next region
+            for (uint32_t vi : local_to_global) global_to_local[vi] = no_index;
+            region.triangle_count = static_cast<uint32_t>(std::round(
+                double(triangle_count) * region_sizes[r] / its.indices.size()));
+            region.last_error = maximal_error;
+        }
+        throw_on_cancel();
+        status_fn(status_init_size);
+    }
+
+    // decimate regions concurrently, status is increased per finished region
+    std::atomic<uint32_t> finished_count{0};
+    std::mutex status_mutex;
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, region_count, 1),
+    [&](const tbb::blocked_range<size_t> &range) {
+        for (size_t r = range.begin(); r < range.end(); ++r) {
+            Region &region = regions[r];
+            collapse(region.its, region.triangle_count, &region.last_error,
+                     throw_on_cancel, [](int) {}, &region.locked);
+            uint32_t finished = ++finished_count;
+            std::lock_guard<std::mutex> lock(status_mutex);
+            status_fn(status_init_size +
+                      (finished * (90 - status_init_size)) / int(region_count));
+        }
+    }); // END parallel for
+
+    float regions_error = 0.f;
+    for (const Region &region : regions)
+        regions_error = std::max(regions_error, region.last_error);
+
+    // weld regions together, locked vertices were not moved so the seam
+    // duplicates are exact and merged by its_merge_vertices
+    indexed_triangle_set merged;
+    size_t count_vertices = 0, count_indices = 0;
+    for (const Region &region : regions) {
+        count_vertices += region.its.vertices.size();
+        count_indices  += region.its.indices.size();
+    }
+    merged.vertices.reserve(count_vertices);
+    merged.indices.reserve(count_indices);
+    for (Region &region : regions)
+        its_merge(merged, std::move(region.its));
+    its_merge_vertices(merged);
+
+    // final sequential pass collapses the formerly locked seams
+    // and reaches the exact wanted triangle count
+    float final_error = maximal_error;
+    StatusFn final_status_fn = [&status_fn](int percent) {
+        status_fn(90 + percent / 10);
+    };
+    collapse(merged, triangle_count, &final_error, throw_on_cancel, final_status_fn, nullptr);
+    its = std::move(merged);
+
+    if (max_error != nullptr)
+        *max_error = std::max(final_error, regions_error);
+    status_fn(100);
+}
+
+void QuadricEdgeCollapse::collapse(
+    indexed_triangle_set &    its,
+    uint32_t                  triangle_count,
+    float *                   max_error,
+    ThrowOnCancel             throw_on_cancel,
+    StatusFn                  status_fn,
+    const std::vector<bool> * locked_vertices)
+{
+    // check input
+    if (triangle_count >= its.indices.size()) return;
+    float maximal_error = (max_error == nullptr)? std::numeric_limits<float>::max() : *max_error;
+    if (maximal_error <= 0.f) return;
+
     StatusFn init_status_fn = [&](int percent) {
         float n_percent = percent * status_init_size / 100.f;
         status_fn(static_cast<int>(std::round(n_percent)));
@@ -249,17 +416,24 @@ void Slic3r::its_quadric_edge_collapse(
         SymMat q(v_info0.q);
         q += v_info1.q;
         Vec3f new_vertex0 = calculate_vertex(vi0, vi1, q, its.vertices);
+        // vertices on partition borders must not move nor be removed
+        bool edge_locked = locked_vertices != nullptr &&
+            ((*locked_vertices)[vi0] || (*locked_vertices)[vi1]);
         // set of triangle indices that change quadric
         uint32_t ti1 = -1; // triangle 1 index
-        auto ti1_opt = (v_info0.count < v_info1.count)?
-            find_triangle_index1(vi1, v_info0, ti0, e_infos, its.indices) :
-            find_triangle_index1(vi0, v_info1, ti0, e_infos, its.indices) ;
-        if (ti1_opt.has_value()) { 
-            ti1 = *ti1_opt;
-            reorder_edges(e_infos, v_info0, ti0, ti1);
-            reorder_edges(e_infos, v_info1, ti0, ti1);
+        std::optional<uint32_t> ti1_opt;
+        if (!edge_locked) {
+            ti1_opt = (v_info0.count < v_info1.count)?
+                find_triangle_index1(vi1, v_info0, ti0, e_infos, its.indices) :
+                find_triangle_index1(vi0, v_info1, ti0, e_infos, its.indices) ;
+            if (ti1_opt.has_value()) {
+                ti1 = *ti1_opt;
+                reorder_edges(e_infos, v_info0, ti0, ti1);
+                reorder_edges(e_infos, v_info1, ti0, ti1);
+            }
         }
-        if (!ti1_opt.has_value() || // edge has only one triangle
+        if (edge_locked ||
+            !ti1_opt.has_value() || // edge has only one triangle
             degenerate(vi0, ti0, ti1, v_info1, e_infos, its.indices) ||
             degenerate(vi1, ti0, ti1, v_info0, e_infos, its.indices) ||
             create_no_volume(vi0, vi1, ti0, ti1, v_info0, v_info1, e_infos, its.indices) ||
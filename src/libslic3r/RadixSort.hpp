@@ -0,0 +1,114 @@
+///|/ Copyright (c) Prusa Research 2023 Vojtěch Bubník @bubnikv
+///|/
+///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
+///|/
+#ifndef slic3r_RadixSort_hpp_
+#define slic3r_RadixSort_hpp_
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "Point.hpp"
+
+namespace Slic3r {
+
+// Stable LSD radix sort of data by a 64 bit key extracted by keyfn, parallelized over chunks:
+// each chunk builds its own digit histogram and scatters into a bin major / chunk minor layout,
+// which keeps the sort stable. Digits shared by all keys (e.g. the high bytes of small vertex
+// indices) are detected from the histograms and their passes are skipped. Small inputs fall
+// back to std::stable_sort, where the radix machinery does not pay off.
+template<typename T, typename Alloc, typename KeyFn>
+void radix_sort_by_key64(std::vector<T, Alloc> &data, KeyFn &&keyfn)
+{
+    static constexpr const size_t small_input_threshold = 4096;
+    const size_t n = data.size();
+    if (n <= small_input_threshold) {
+        std::stable_sort(data.begin(), data.end(),
+            [&keyfn](const T &l, const T &r) { return keyfn(l) < keyfn(r); });
+        return;
+    }
+
+    // Cap the number of chunks so that the per chunk histograms stay small, while each chunk
+    // remains large enough to amortize the scatter pass bookkeeping.
+    const size_t num_chunks = std::min(size_t(256), (n + 0xFFFF) / 0x10000 * 4);
+    const size_t chunk_size = (n + num_chunks - 1) / num_chunks;
+    std::vector<std::array<size_t, 256>> histograms(num_chunks);
+
+    std::vector<T, Alloc> buffer(n);
+    T *src = data.data();
+    T *dst = buffer.data();
+    for (int pass = 0; pass < 8; ++ pass) {
+        const int shift = pass * 8;
+        tbb::parallel_for(size_t(0), num_chunks, [src, n, chunk_size, shift, &histograms, &keyfn](size_t chunk) {
+            std::array<size_t, 256> &hist = histograms[chunk];
+            hist.fill(0);
+            for (size_t i = chunk * chunk_size, end = std::min(n, (chunk + 1) * chunk_size); i < end; ++ i)
+                ++ hist[(uint64_t(keyfn(src[i])) >> shift) & 0xFF];
+        });
+        // Skip the pass if all keys share this digit.
+        {
+            size_t num_occupied_bins = 0;
+            for (size_t bin = 0; bin < 256 && num_occupied_bins < 2; ++ bin)
+                for (size_t chunk = 0; chunk < num_chunks; ++ chunk)
+                    if (histograms[chunk][bin] != 0) {
+                        ++ num_occupied_bins;
+                        break;
+                    }
+            if (num_occupied_bins < 2)
+                continue;
+        }
+        // Exclusive prefix sum over the histograms in a bin major, chunk minor order,
+        // producing the stable scatter offsets of each chunk.
+        size_t sum = 0;
+        for (size_t bin = 0; bin < 256; ++ bin)
+            for (size_t chunk = 0; chunk < num_chunks; ++ chunk) {
+                size_t count = histograms[chunk][bin];
+                histograms[chunk][bin] = sum;
+                sum += count;
+            }
+        tbb::parallel_for(size_t(0), num_chunks, [src, dst, n, chunk_size, shift, &histograms, &keyfn](size_t chunk) {
+            std::array<size_t, 256> &offsets = histograms[chunk];
+            for (size_t i = chunk * chunk_size, end = std::min(n, (chunk + 1) * chunk_size); i < end; ++ i)
+                dst[offsets[(uint64_t(keyfn(src[i])) >> shift) & 0xFF] ++] = std::move(src[i]);
+        });
+        std::swap(src, dst);
+    }
+    if (src != data.data())
+        std::move(src, src + n, data.data());
+}
+
+// Sort data by a 64 bit key and remove the elements with duplicate keys, keeping the first
+// occurrence of each key (the sort is stable, thus "first" respects the input order).
+template<typename T, typename Alloc, typename KeyFn>
+void radix_sort_unique_by_key64(std::vector<T, Alloc> &data, KeyFn &&keyfn)
+{
+    radix_sort_by_key64(data, keyfn);
+    data.erase(std::unique(data.begin(), data.end(),
+        [&keyfn](const T &l, const T &r) { return keyfn(l) == keyfn(r); }), data.end());
+}
+
+// Pack a point of two 32 bit coordinates into a radix sort key whose unsigned ordering matches
+// the lexicographic (x, y) ordering of the point: the sign bits are flipped to map the signed
+// coordinate range monotonically onto the unsigned one.
+inline uint64_t radix_sort_point_key(const Point &pt)
+{
+    static_assert(sizeof(coord_t) == 4, "radix_sort_point_key packs a pair of 32 bit coordinates");
+    return (uint64_t(uint32_t(pt.x()) ^ 0x80000000u) << 32) | uint64_t(uint32_t(pt.y()) ^ 0x80000000u);
+}
+
+// Stable parallel lexicographic sort of points by (x, y).
+inline void radix_sort_points(Points &points)
+    { radix_sort_by_key64(points, radix_sort_point_key); }
+
+// Lexicographic sort of points by (x, y) with duplicates removed.
+inline void radix_sort_remove_duplicate_points(Points &points)
+    { radix_sort_unique_by_key64(points, radix_sort_point_key); }
+
+} // namespace Slic3r
+
+#endif // slic3r_RadixSort_hpp_
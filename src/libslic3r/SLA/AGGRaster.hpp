@@ -20,6 +20,11 @@
 #include <agg/agg_rasterizer_scanline_aa.h>
 #include <agg/agg_path_storage.h>
 
+#include <cmath>
+
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
 namespace Slic3r {
 
 inline const Polygon& contour(const ExPolygon& p) { return p.contour; }
@@ -114,14 +119,52 @@ protected:
         return path;
     }
     
+    // Lowest band height in pixels for which splitting the rasterization of a polygon
+    // into bands processed in parallel pays off.
+    static constexpr size_t BandHeightMin = 128;
+
     template<class P> void _draw(const P &poly)
     {
-        m_rasterizer.reset();
-        
-        m_rasterizer.add_path(to_path(contour(poly)));
-        for(auto& h : holes(poly)) m_rasterizer.add_path(to_path(h));
-        
-        agg::render_scanlines(m_rasterizer, m_scanlines, m_renderer);
+        size_t num_bands = std::min(size_t(tbb::this_task_arena::max_concurrency()),
+                                    m_resolution.height_px / BandHeightMin);
+        if (num_bands <= 1) {
+            m_rasterizer.reset();
+
+            m_rasterizer.add_path(to_path(contour(poly)));
+            for(auto& h : holes(poly)) m_rasterizer.add_path(to_path(h));
+
+            agg::render_scanlines(m_rasterizer, m_scanlines, m_renderer);
+        } else {
+            // Rasterize the polygon into horizontal bands concurrently. Each band owns its
+            // rasterizer, scanline container and renderer chain clipped to a disjoint range of
+            // rows of the shared frame buffer, so no synchronization on the buffer is needed.
+            // The band boundaries lie on integer pixel rows, thus the geometric clipping leaves
+            // no seams in the anti-aliased output.
+            tbb::parallel_for(size_t(0), num_bands, [this, &poly, num_bands](size_t band) {
+                const size_t band_begin = m_resolution.height_px * band / num_bands;
+                const size_t band_end   = m_resolution.height_px * (band + 1) / num_bands;
+
+                Rasterizer rasterizer;
+                // Replicate the gamma table of the main rasterizer configured in the constructor.
+                rasterizer.gamma([this](double x) {
+                    return double(m_rasterizer.apply_gamma(unsigned(std::lround(x * Rasterizer::aa_mask)))) / Rasterizer::aa_mask;
+                });
+                rasterizer.clip_box(0., double(band_begin), double(m_resolution.width_px), double(band_end));
+                rasterizer.add_path(to_path(contour(poly)));
+                for(auto& h : holes(poly)) rasterizer.add_path(to_path(h));
+
+                PixelRenderer                               pixrenderer(m_rbuf);
+                agg::renderer_base<PixelRenderer>           raw_renderer(pixrenderer);
+                Renderer<agg::renderer_base<PixelRenderer>> renderer(raw_renderer);
+                renderer.color(m_renderer.color());
+                // Guard the band rows also on the renderer side, so that degenerate scanlines
+                // emitted right at a band boundary can not touch the rows of the next band.
+                raw_renderer.clip_box(0, int(band_begin), int(m_resolution.width_px) - 1, int(band_end) - 1);
+
+                Scanline scanlines;
+                agg::render_scanlines(rasterizer, scanlines, renderer);
+            });
+        }
     }
     
 public:
@@ -514,25 +514,34 @@ void DefaultSupportTree::classify()
     ground_head_indices.reserve(m_iheads.size());
     m_iheads_onmodel.reserve(m_iheads.size());
 
+    // The ground route scans only read the mesh, batch them on all cores.
+    std::vector<AABBMesh::hit_result> hits(m_iheads.size());
+    execution::for_each(
+        suptree_ex_policy, size_t(0), m_iheads.size(),
+        [this, &hits](size_t i) {
+            m_thr();
+
+            Head &head = m_builder.head(m_iheads[i]);
+
+            // collision check
+            hits[i] = bridge_mesh_intersect(head.junction_point(), DOWN,
+                                            head.r_back_mm);
+        },
+        execution::max_concurrency(suptree_ex_policy));
+
     // First we decide which heads reach the ground and can be full
     // pillars and which shall be connected to the model surface (or
     // search a suitable path around the surface that leads to the
     // ground -- TODO)
-    for(unsigned i : m_iheads) {
-        m_thr();
+    for (size_t i = 0; i < m_iheads.size(); ++ i) {
+        unsigned hid = m_iheads[i];
+        const AABBMesh::hit_result &hit = hits[i];
 
-        Head &head = m_builder.head(i);
-        double r = head.r_back_mm;
-        Vec3d headjp = head.junction_point();
+        if(std::isinf(hit.distance())) ground_head_indices.emplace_back(hid);
+        else if(m_sm.cfg.ground_facing_only)  m_builder.head(hid).invalidate();
+        else m_iheads_onmodel.emplace_back(hid);
 
-           // collision check
-        auto hit = bridge_mesh_intersect(headjp, DOWN, r);
-
-        if(std::isinf(hit.distance())) ground_head_indices.emplace_back(i);
-        else if(m_sm.cfg.ground_facing_only)  head.invalidate();
-        else m_iheads_onmodel.emplace_back(i);
-
-        m_head_to_ground_scans[i] = hit;
+        m_head_to_ground_scans[hid] = hit;
     }
 
     // We want to search for clusters of points that are far enough
@@ -558,6 +567,15 @@ void DefaultSupportTree::classify()
 
 void DefaultSupportTree::routing_to_ground()
 {
+    // Drop empty clusters, the centroid list below is indexed by the cluster
+    // position.
+    m_pillar_clusters.erase(std::remove_if(m_pillar_clusters.begin(),
+                                           m_pillar_clusters.end(),
+                                           [](const PtIndices &cl) {
+                                               return cl.empty();
+                                           }),
+                            m_pillar_clusters.end());
+
     ClusterEl cl_centroids;
     cl_centroids.reserve(m_pillar_clusters.size());
 
@@ -572,8 +590,6 @@ void DefaultSupportTree::routing_to_ground()
         // sidehead is allowed to connect to a nearby pillar to
         // increase structural stability.
 
-        if (cl.empty()) continue;
-
            // get the current cluster centroid
         auto &      thr    = m_thr;
         const auto &points = m_points;
@@ -589,44 +605,64 @@ void DefaultSupportTree::routing_to_ground()
         unsigned hid = cl[size_t(lcid)]; // Head ID
 
         cl_centroids.emplace_back(hid);
+    }
+
+    // Route the centroid heads to the ground concurrently. The builder and
+    // the pillar index are guarded and the mesh queries are read-only, just
+    // like in routing_to_model().
+    std::vector<unsigned char> failed(cl_centroids.size(), false);
+    execution::for_each(
+        suptree_ex_policy, size_t(0), cl_centroids.size(),
+        [this, &cl_centroids, &failed](size_t i) {
+            m_thr();
+
+            Head &h = m_builder.head(cl_centroids[i]);
 
-        Head &h = m_builder.head(hid);
+            if (!create_ground_pillar(h.junction(), h.dir, h.id))
+                failed[i] = true;
+        },
+        execution::max_concurrency(suptree_ex_policy));
 
-        if (!create_ground_pillar(h.junction(), h.dir, h.id)) {
+    for (size_t i = 0; i < cl_centroids.size(); ++ i)
+        if (failed[i]) {
             BOOST_LOG_TRIVIAL(warning)
-                << "Pillar cannot be created for support point id: " << hid;
-            m_iheads_onmodel.emplace_back(h.id);
-            continue;
+                << "Pillar cannot be created for support point id: "
+                << cl_centroids[i];
+            m_iheads_onmodel.emplace_back(m_builder.head(cl_centroids[i]).id);
         }
-    }
 
     // now we will go through the clusters ones again and connect the
     // sidepoints with the cluster centroid (which is a ground pillar)
-    // or a nearby pillar if the centroid is unreachable.
-    size_t ci = 0;
-    for (const std::vector<unsigned> &cl : m_pillar_clusters) {
-        m_thr();
-
-        auto cidx = cl_centroids[ci++];
-
-        auto q = m_pillar_index.query(m_builder.head(cidx).junction_point(), 1);
-        if (!q.empty()) {
-            long centerpillarID = q.front().second;
-            for (auto c : cl) {
-                m_thr();
-                if (c == cidx) continue;
-
-                auto &sidehead = m_builder.head(c);
+    // or a nearby pillar if the centroid is unreachable. The clusters are
+    // independent, they only meet at the guarded builder and pillar index.
+    execution::for_each(
+        suptree_ex_policy, size_t(0), m_pillar_clusters.size(),
+        [this, &cl_centroids](size_t ci) {
+            m_thr();
 
-                if (!connect_to_nearpillar(sidehead, centerpillarID) &&
-                    !search_pillar_and_connect(sidehead)) {
-                    // Vec3d pend = Vec3d{pstart.x(), pstart.y(), gndlvl};
-                    // Could not find a pillar, create one
-                    create_ground_pillar(sidehead.junction(), sidehead.dir, sidehead.id);
+            const std::vector<unsigned> &cl = m_pillar_clusters[ci];
+            auto cidx = cl_centroids[ci];
+
+            auto q = m_pillar_index.guarded_query(
+                m_builder.head(cidx).junction_point(), unsigned(1));
+            if (!q.empty()) {
+                long centerpillarID = q.front().second;
+                for (auto c : cl) {
+                    m_thr();
+                    if (c == cidx) continue;
+
+                    auto &sidehead = m_builder.head(c);
+
+                    if (!connect_to_nearpillar(sidehead, centerpillarID) &&
+                        !search_pillar_and_connect(sidehead)) {
+                        // Vec3d pend = Vec3d{pstart.x(), pstart.y(), gndlvl};
+                        // Could not find a pillar, create one
+                        create_ground_pillar(sidehead.junction(), sidehead.dir, sidehead.id);
+                    }
                 }
             }
-        }
-    }
+        },
+        execution::max_concurrency(suptree_ex_policy));
 }
 
 bool DefaultSupportTree::connect_to_ground(Head &head)
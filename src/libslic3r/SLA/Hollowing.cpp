@@ -721,7 +721,7 @@ std::vector<bool> create_exclude_mask(const indexed_triangle_set   &its,
 DrainHoles transformed_drainhole_points(const ModelObject &mo,
                                         const Transform3d &trafo)
 {
-    auto pts = mo.sla_drain_holes;
+    auto pts = mo.sla_drain_holes.get();
 //    const Transform3d& vol_trafo = mo.volumes.front()->get_transformation().get_matrix();
     const Geometry::Transformation trans(trafo /** vol_trafo*/);
     const Transform3d& tr = trans.get_matrix();
@@ -7,6 +7,7 @@
 #include <libslic3r/BoostAdapter.hpp>
 //#include <libslic3r/SLA/Contour3D.hpp>
 #include <libslic3r/TriangleMeshSlicer.hpp>
+#include <libslic3r/Execution/ExecutionTBB.hpp>
 
 #include "ConcaveHull.hpp"
 
@@ -483,18 +484,31 @@ void pad_blueprint(const indexed_triangle_set &mesh,
 
     std::vector<ExPolygons> out = slice_mesh_ex(mesh, heights, thrfn);
 
-    size_t count = 0;
-    for(auto& o : out) count += o.size();
+    // Unification is expensive, a simplify also speeds up the pad generation.
+    // Do it as a parallel tree reduction: each layer is simplified and
+    // unified on its own, then the partial unions are merged pairwise.
+    auto simplifyfn = [&out, thrfn](size_t idx) {
+        thrfn();
 
-    // Unification is expensive, a simplify also speeds up the pad generation
-    auto tmp = reserve_vector<ExPolygon>(count);
-    for(ExPolygons& o : out)
-        for(ExPolygon& e : o) {
-            auto&& exss = e.simplify(scaled<double>(0.1));
-            for(ExPolygon& ep : exss) tmp.emplace_back(std::move(ep));
+        auto tmp = reserve_vector<ExPolygon>(out[idx].size());
+        for (ExPolygon &e : out[idx]) {
+            auto &&exss = e.simplify(scaled<double>(0.1));
+            for (ExPolygon &ep : exss) tmp.emplace_back(std::move(ep));
         }
 
-    ExPolygons utmp = union_ex(tmp);
+        return union_ex(tmp);
+    };
+
+    auto mergefn = [](const ExPolygons &a, const ExPolygons &b) {
+        auto ab = reserve_vector<ExPolygon>(a.size() + b.size());
+        ab.insert(ab.end(), a.begin(), a.end());
+        ab.insert(ab.end(), b.begin(), b.end());
+
+        return union_ex(ab);
+    };
+
+    ExPolygons utmp = execution::reduce(ex_tbb, size_t(0), out.size(),
+                                        ExPolygons{}, mergefn, simplifyfn);
 
     for(auto& o : utmp) {
         auto&& smp = o.simplify(scaled<double>(0.1));
@@ -6,11 +6,25 @@
 
 #include "AGGRaster.hpp"
 #include "libslic3r/MarchingSquares.hpp"
+#include "libslic3r/Execution/ExecutionTBB.hpp"
 #include "MTUtils.hpp"
 #include "ClipperUtils.hpp"
 
 namespace marchsq {
 
+// Run the per-cell tagging and the per-ring interpolation loops of the
+// Marching squares alg on multiple threads. The contour tracing in between
+// stays serial, it only walks the boundary cells.
+template<> struct _Loop<Slic3r::ExecutionTBB> {
+    template<class It, class Fn> static void for_each(It from, It to, Fn &&fn)
+    {
+        Slic3r::execution::for_each(
+            Slic3r::ex_tbb, size_t(0), size_t(to - from),
+            [from, &fn](size_t idx) { fn(*(from + idx), idx); },
+            Slic3r::execution::max_concurrency(Slic3r::ex_tbb));
+    }
+};
+
 // Specialize this struct to register a raster type for the Marching squares alg
 template<> struct _RasterTraits<Slic3r::sla::RasterGrayscaleAA> {
     using Rst = Slic3r::sla::RasterGrayscaleAA;
@@ -48,7 +62,7 @@ ExPolygons raster_to_polygons(const RasterGrayscaleAA &rst, Vec2i windowsize)
     long w_cols = std::max(2l, long(windowsize.x()));
     
     std::vector<marchsq::Ring> rings =
-        marchsq::execute(rst, 128, {w_rows, w_cols});
+        marchsq::execute_with_policy(ex_tbb, rst, 128, {w_rows, w_cols});
     
     polys.reserve(rings.size());
     
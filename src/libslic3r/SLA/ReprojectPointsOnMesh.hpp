@@ -40,10 +40,10 @@ inline void reproject_points_and_holes(ModelObject *object)
     AABBMesh emesh{rmsh};
 
     if (has_sppoints)
-        reproject_support_points(emesh, object->sla_support_points);
+        reproject_support_points(emesh, object->sla_support_points.modify());
 
     if (has_holes)
-        reproject_support_points(emesh, object->sla_drain_holes);
+        reproject_support_points(emesh, object->sla_drain_holes.modify());
 }
 
 }}
@@ -14,9 +14,11 @@
 
 #include "libslic3r/SLAPrint.hpp"
 #include "libslic3r/PrintConfig.hpp"
+#include "libslic3r/QuadricEdgeCollapse.hpp"
 
 #include <libslic3r/Geometry.hpp>
 
+#include <numeric>
 #include <thread>
 
 namespace Slic3r { namespace sla {
@@ -284,6 +286,14 @@ std::array<double, N> find_min_score(Fn &&fn, It from, It to, StopCond &&stopfn)
     return ret;
 }
 
+// Above this face count the candidate rotations are evaluated on a decimated
+// proxy of the mesh first and only the best fraction of them is re-scored on
+// the full geometry. Scan meshes with millions of faces make the full
+// evaluation of every candidate prohibitively slow.
+constexpr size_t   ProxyFaceCountThreshold = 100000;
+constexpr uint32_t ProxyFaceCount          = 25000;
+constexpr double   RefineRatio             = 0.05;
+
 } // namespace
 
 
@@ -335,8 +345,58 @@ Vec2d find_best_misalignment_rotation(const ModelObject &      mo,
 {
     RotfinderBoilerplate<1000> bp{mo, params};
 
-    // Preparing the optimizer.
     size_t gridsize = std::sqrt(bp.max_tries);
+
+    if (bp.mesh.its.indices.size() > ProxyFaceCountThreshold && gridsize >= 2) {
+        // Coarse-to-fine: score the whole candidate grid on a decimated proxy
+        // of the mesh, then re-score only the most promising candidates on the
+        // full geometry.
+        indexed_triangle_set proxy_its = bp.mesh.its;
+        its_quadric_edge_collapse(proxy_its, ProxyFaceCount);
+        TriangleMesh proxy{std::move(proxy_its)};
+
+        // The same equidistant sampling of the search interval the brute
+        // force optimizer would use.
+        auto candidates = reserve_vector<XYRotation>(gridsize * gridsize);
+        double step = 2 * PI / (gridsize - 1);
+        for (size_t i = 0; i < gridsize; ++ i)
+            for (size_t j = 0; j < gridsize; ++ j)
+                candidates.emplace_back(XYRotation{-PI + i * step, -PI + j * step});
+
+        size_t refine_cnt = std::max(size_t(1),
+                                     size_t(candidates.size() * RefineRatio));
+        bp.max_tries = candidates.size() + refine_cnt;
+
+        std::vector<double> scores(candidates.size(),
+                                   std::numeric_limits<double>::lowest());
+        for (size_t i = 0; i < candidates.size() && !bp.stopcond(); ++ i) {
+            bp.statusfn();
+            scores[i] = get_misalginment_score(proxy, to_transform3f(candidates[i]));
+        }
+
+        std::vector<size_t> order(candidates.size());
+        std::iota(order.begin(), order.end(), size_t(0));
+        std::partial_sort(order.begin(), order.begin() + refine_cnt, order.end(),
+                          [&scores](size_t a, size_t b) {
+                              return scores[a] > scores[b];
+                          });
+
+        XYRotation best_rot   = candidates[order.front()];
+        double     best_score = std::numeric_limits<double>::lowest();
+        for (size_t k = 0; k < refine_cnt && !bp.stopcond(); ++ k) {
+            bp.statusfn();
+            double score = get_misalginment_score(bp.mesh,
+                                                  to_transform3f(candidates[order[k]]));
+            if (score > best_score) {
+                best_score = score;
+                best_rot   = candidates[order[k]];
+            }
+        }
+
+        return {best_rot[0], best_rot[1]};
+    }
+
+    // Preparing the optimizer.
     opt::Optimizer<opt::AlgBruteForce> solver(
         opt::StopCriteria{}.max_iterations(bp.max_tries)
                            .stop_condition([&bp] { return bp.stopcond(); }),
@@ -273,11 +273,40 @@ void SupportPointGenerator::process(const std::vector<ExPolygons>& slices, const
             }
         }
         // Now iterate over all polygons and append new points if needed.
-        for (Structure &s : layer_top->islands) {
+        for (Structure &s : layer_top->islands)
             // Penalization resulting from large diff from the last layer:
             s.supports_force_inherited /= std::max(1.f, 0.17f * (s.overhangs_area) / s.area);
 
-            add_support_points(s, point_grid);
+        // Sample the islands in parallel against the grid state frozen at the
+        // start of this layer. Each island draws from its own generator seeded
+        // serially from m_rng and the results are committed in island order
+        // below, so the output does not depend on thread timing.
+        std::vector<std::mt19937::result_type> seeds(layer_top->islands.size());
+        for (std::mt19937::result_type &s : seeds)
+            s = m_rng();
+        std::vector<std::vector<CandidatePoint>> candidates(layer_top->islands.size());
+        execution::for_each(ex_tbb, size_t(0), layer_top->islands.size(),
+            [this, layer_top, &point_grid, &seeds, &candidates](size_t island_id) {
+                std::mt19937 rng(seeds[island_id]);
+                add_support_points(layer_top->islands[island_id], point_grid,
+                                   candidates[island_id], rng);
+            }, 1 /* gransize */);
+
+        // Commit the candidates in island order. Points of neighboring islands
+        // sampled in the same parallel pass may land closer together than their
+        // spacing allows, thus recheck against the grid which now also holds
+        // the points committed for this layer.
+        for (size_t island_id = 0; island_id < layer_top->islands.size(); ++ island_id) {
+            Structure &s = layer_top->islands[island_id];
+            for (const CandidatePoint &cp : candidates[island_id]) {
+                if (point_grid.collides_with(cp.pos, float(s.layer->print_z), cp.spacing)) {
+                    s.supports_force_this_layer -= m_config.support_force();
+                    continue;
+                }
+                m_output.emplace_back(float(cp.pos.x()), float(cp.pos.y()), s.zlevel,
+                                      m_config.head_diameter / 2.f, cp.is_new_island);
+                point_grid.insert(cp.pos, &s);
+            }
         }
 
         m_throw_on_cancel();
@@ -295,7 +324,8 @@ void SupportPointGenerator::process(const std::vector<ExPolygons>& slices, const
     }
 }
 
-void SupportPointGenerator::add_support_points(SupportPointGenerator::Structure &s, SupportPointGenerator::PointGrid3D &grid3d)
+void SupportPointGenerator::add_support_points(SupportPointGenerator::Structure &s, SupportPointGenerator::PointGrid3D &grid3d,
+                                               std::vector<CandidatePoint> &out, std::mt19937 &rng)
 {
     // Select each type of surface (overrhang, dangling, slope), derive the support
     // force deficit for it and call uniformly conver with the right params
@@ -306,12 +336,12 @@ void SupportPointGenerator::add_support_points(SupportPointGenerator::Structure
     if (s.islands_below.empty()) {
         // completely new island - needs support no doubt
         // deficit is full, there is nothing below that would hold this island
-        uniformly_cover({ *s.polygon }, s, s.area * tp, grid3d, IslandCoverageFlags(icfIsNew | icfWithBoundary) );
+        uniformly_cover({ *s.polygon }, s, s.area * tp, grid3d, out, rng, IslandCoverageFlags(icfIsNew | icfWithBoundary) );
         return;
     }
 
     if (! s.overhangs.empty()) {
-        uniformly_cover(s.overhangs, s, s.overhangs_area * tp, grid3d);
+        uniformly_cover(s.overhangs, s, s.overhangs_area * tp, grid3d, out, rng);
     }
 
     auto areafn = [](double sum, auto &p) { return sum + p.area() * SCALING_FACTOR * SCALING_FACTOR; };
@@ -322,13 +352,13 @@ void SupportPointGenerator::add_support_points(SupportPointGenerator::Structure
         // What we now have in polygons needs support, regardless of what the forces are, so we can add them.
 
         double a = std::accumulate(s.dangling_areas.begin(), s.dangling_areas.end(), 0., areafn);
-        uniformly_cover(s.dangling_areas, s, a * tp - a * current * s.area, grid3d, icfWithBoundary);
+        uniformly_cover(s.dangling_areas, s, a * tp - a * current * s.area, grid3d, out, rng, icfWithBoundary);
     }
 
     current = s.supports_force_total();
     if (! s.overhangs_slopes.empty()) {
         double a = std::accumulate(s.overhangs_slopes.begin(), s.overhangs_slopes.end(), 0., areafn);
-        uniformly_cover(s.overhangs_slopes, s, a * tp - a * current / s.area, grid3d, icfWithBoundary);
+        uniformly_cover(s.overhangs_slopes, s, a * tp - a * current / s.area, grid3d, out, rng, icfWithBoundary);
     }
 }
 
@@ -543,7 +573,8 @@ static inline std::vector<Vec2f> poisson_disk_from_samples(const std::vector<Vec
 }
 
 
-void SupportPointGenerator::uniformly_cover(const ExPolygons& islands, Structure& structure, float deficit, PointGrid3D &grid3d, IslandCoverageFlags flags)
+void SupportPointGenerator::uniformly_cover(const ExPolygons& islands, Structure& structure, float deficit, PointGrid3D &grid3d,
+                                            std::vector<CandidatePoint> &out, std::mt19937 &rng, IslandCoverageFlags flags)
 {
     //int num_of_points = std::max(1, (int)((island.area()*pow(SCALING_FACTOR, 2) * m_config.tear_pressure)/m_config.support_force));
 
@@ -576,19 +607,24 @@ void SupportPointGenerator::uniformly_cover(const ExPolygons& islands, Structure
 //    float min_spacing			= poisson_radius / 3.f;
     float min_spacing			= poisson_radius;
 
-    //FIXME share the random generator. The random generator may be not so cheap to initialize, also we don't want the random generator to be restarted for each polygon.
-
     std::vector<Vec2f> raw_samples =
         flags & icfWithBoundary ?
             sample_expolygon_with_boundary(islands, samples_per_mm2,
-                                           5.f / poisson_radius, m_rng) :
-            sample_expolygon(islands, samples_per_mm2, m_rng);
+                                           5.f / poisson_radius, rng) :
+            sample_expolygon(islands, samples_per_mm2, rng);
 
     std::vector<Vec2f>  poisson_samples;
     for (size_t iter = 0; iter < 4; ++ iter) {
         poisson_samples = poisson_disk_from_samples(raw_samples, poisson_radius,
-            [&structure, &grid3d, min_spacing](const Vec2f &pos) {
-                return grid3d.collides_with(pos, structure.layer->print_z, min_spacing);
+            [&structure, &grid3d, &out, min_spacing](const Vec2f &pos) {
+                if (grid3d.collides_with(pos, structure.layer->print_z, min_spacing))
+                    return true;
+                // The candidates accepted for this island in the previous
+                // stages are not in the grid yet, check them separately.
+                for (const CandidatePoint &cp : out)
+                    if ((cp.pos - pos).squaredNorm() < min_spacing * min_spacing)
+                        return true;
+                return false;
             });
         if (poisson_samples.size() >= poisson_samples_target || m_config.minimal_distance > poisson_radius-EPSILON)
             break;
@@ -614,13 +650,12 @@ void SupportPointGenerator::uniformly_cover(const ExPolygons& islands, Structure
 
 //    assert(! poisson_samples.empty());
     if (poisson_samples_target < poisson_samples.size()) {
-        std::shuffle(poisson_samples.begin(), poisson_samples.end(), m_rng);
+        std::shuffle(poisson_samples.begin(), poisson_samples.end(), rng);
         poisson_samples.erase(poisson_samples.begin() + poisson_samples_target, poisson_samples.end());
     }
     for (const Vec2f &pt : poisson_samples) {
-        m_output.emplace_back(float(pt(0)), float(pt(1)), structure.zlevel, m_config.head_diameter/2.f, flags & icfIsNew);
         structure.supports_force_this_layer += m_config.support_force();
-        grid3d.insert(pt, &structure);
+        out.push_back({pt, min_spacing, bool(flags & icfIsNew)});
     }
 }
 
@@ -668,7 +703,7 @@ void SupportPointGenerator::output_expolygons(const ExPolygons& expolys, const s
 SupportPoints transformed_support_points(const ModelObject &mo,
                                          const Transform3d &trafo)
 {
-    auto spts = mo.sla_support_points;
+    auto spts = mo.sla_support_points.get();
     Transform3f tr = trafo.cast<float>();
     for (sla::SupportPoint& suppt : spts) {
         suppt.pos = tr * suppt.pos;
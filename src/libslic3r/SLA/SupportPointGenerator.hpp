@@ -209,9 +209,19 @@ public:
 
 private:
 
-    void uniformly_cover(const ExPolygons& islands, Structure& structure, float deficit, PointGrid3D &grid3d, IslandCoverageFlags flags = icfNone);
+    // A support point sampled for an island, not yet committed to the output.
+    struct CandidatePoint {
+        Vec2f pos;
+        // Minimal distance the point was accepted with, to be rechecked when
+        // committing the point into the shared grid.
+        float spacing;
+        bool  is_new_island;
+    };
+
+    void uniformly_cover(const ExPolygons& islands, Structure& structure, float deficit, PointGrid3D &grid3d,
+                         std::vector<CandidatePoint> &out, std::mt19937 &rng, IslandCoverageFlags flags = icfNone);
 
-    void add_support_points(Structure& structure, PointGrid3D &grid3d);
+    void add_support_points(Structure& structure, PointGrid3D &grid3d, std::vector<CandidatePoint> &out, std::mt19937 &rng);
 
     void project_onto_mesh(std::vector<SupportPoint>& points) const;
 
@@ -66,7 +66,8 @@ indexed_triangle_set create_support_tree(const SupportableMesh &sm,
 
 indexed_triangle_set create_pad(const SupportableMesh      &sm,
                                 const indexed_triangle_set &support_mesh,
-                                const JobController        &ctl)
+                                const JobController        &ctl,
+                                PadModelBlueprintCache     *cache)
 {
     constexpr float PadSamplingLH = 0.1f;
 
@@ -82,8 +83,22 @@ indexed_triangle_set create_pad(const SupportableMesh      &sm,
         // we sometimes call it "builtin pad" is enabled so we will
         // get a sample from the bottom of the mesh and use it for pad
         // creation.
-        sla::pad_blueprint(*sm.emesh.get_triangle_mesh(), model_contours,
-                           heights, ctl.cancelfn);
+        if (cache && cache->valid && cache->zstart == zstart &&
+            cache->zend == zend) {
+            // The sampling range is determined by the model mesh and the pad
+            // config, so a matching range means the cached contours are valid.
+            model_contours = cache->contours;
+        } else {
+            sla::pad_blueprint(*sm.emesh.get_triangle_mesh(), model_contours,
+                               heights, ctl.cancelfn);
+
+            if (cache) {
+                cache->contours = model_contours;
+                cache->zstart   = zstart;
+                cache->zend     = zend;
+                cache->valid    = true;
+            }
+        }
     }
 
     ExPolygons sup_contours;
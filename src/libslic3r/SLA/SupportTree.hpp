@@ -147,9 +147,22 @@ inline double ground_level(const SupportableMesh &sm)
 indexed_triangle_set create_support_tree(const SupportableMesh &mesh,
                                          const JobController   &ctl);
 
+// Cache for the model dependent part of the pad blueprint. The model contours
+// sampled by create_pad() depend only on the model mesh, the ground level and
+// the pad config -- not on the support points -- so they can be reused when
+// the pad is regenerated after a support point edit. The cache is only valid
+// for the model mesh it was sampled from and has to be discarded with it.
+struct PadModelBlueprintCache
+{
+    ExPolygons contours;
+    float      zstart = 0.f, zend = 0.f;
+    bool       valid = false;
+};
+
 indexed_triangle_set create_pad(const SupportableMesh      &model_mesh,
                                 const indexed_triangle_set &support_mesh,
-                                const JobController        &ctl);
+                                const JobController        &ctl,
+                                PadModelBlueprintCache     *cache = nullptr);
 
 std::vector<ExPolygons> slice(const indexed_triangle_set &support_mesh,
                               const indexed_triangle_set &pad_mesh,
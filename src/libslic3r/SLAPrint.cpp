@@ -7,6 +7,7 @@
 #include "SLAPrintSteps.hpp"
 #include "CSGMesh/CSGMeshCopy.hpp"
 #include "CSGMesh/PerformCSGMeshBooleans.hpp"
+#include "CSGMesh/VoxelizeCSGMesh.hpp"
 #include "format.hpp"
 #include "StaticMap.hpp"
 
@@ -258,12 +259,15 @@ static t_config_option_keys print_config_diffs(const StaticPrintConfig     &curr
 }
 
 
-SLAPrint::ApplyStatus SLAPrint::apply(const Model &model, DynamicPrintConfig config)
+SLAPrint::ApplyStatus SLAPrint::apply(const Model &model, const DynamicPrintConfig &config_in)
 {
 #ifdef _DEBUG
     check_model_ids_validity(model);
 #endif /* _DEBUG */
 
+    // Mutable copy for normalization and the overrides below.
+    DynamicPrintConfig config = config_in;
+
     // Normalize the config.
     config.option("sla_print_settings_id",        true);
     config.option("sla_material_settings_id",     true);
@@ -507,18 +511,18 @@ SLAPrint::ApplyStatus SLAPrint::apply(const Model &model, DynamicPrintConfig con
                 bool new_user_modified = model_object_new.sla_points_status == sla::PointsStatus::UserModified;
                 if ((old_user_modified && ! new_user_modified) || // switching to automatic supports from manual supports
                     (! old_user_modified && new_user_modified) || // switching to manual supports from automatic supports
-                    (new_user_modified && model_object.sla_support_points != model_object_new.sla_support_points)) {
+                    (new_user_modified && model_object.sla_support_points.get() != model_object_new.sla_support_points.get())) {
                     if (it_print_object_status != print_object_status.end())
                         update_apply_status(it_print_object_status->print_object->invalidate_step(slaposSupportPoints));
 
-                    model_object.sla_support_points = model_object_new.sla_support_points;
+                    model_object.sla_support_points.assign(model_object_new.sla_support_points);
                 }
                 model_object.sla_points_status = model_object_new.sla_points_status;
-                
+
                 // Invalidate hollowing if drain holes have changed
-                if (model_object.sla_drain_holes != model_object_new.sla_drain_holes)
+                if (model_object.sla_drain_holes.get() != model_object_new.sla_drain_holes.get())
                 {
-                    model_object.sla_drain_holes = model_object_new.sla_drain_holes;
+                    model_object.sla_drain_holes.assign(model_object_new.sla_drain_holes);
                     update_apply_status(it_print_object_status->print_object->invalidate_step(slaposDrillHoles));
                 }
 
@@ -718,6 +722,9 @@ void SLAPrint::process()
     if (m_objects.empty())
         return;
 
+    // Serve the fine-grained cancellation checkpoints polled by the deep computational kernels.
+    CancellationCheckpointScope cancellation_checkpoint_scope(this);
+
     name_tbb_thread_pool_threads_set_locale();
 
     // Assumption: at this point the print objects should be populated only with
@@ -1309,6 +1316,22 @@ MeshBoolean::cgal::CGALMeshPtr get_cgalmesh(const CSGPartForStep &part)
     return part.cgalcache? clone(*part.cgalcache) : nullptr;
 }
 
+VoxelGridPtr get_voxelgrid(const CSGPartForStep &part, MeshToGridParams params)
+{
+    // The cached grid is only reusable if it was rasterized with the same
+    // voxel scale. The remaining parameters (trafo, bandwidths) are fixed
+    // for the preview pipeline which is the only consumer of this overload.
+    if (part.gridcache && part.gridcache_voxel_scale != params.voxel_scale())
+        part.gridcache.reset();
+
+    if (!part.gridcache && csg::get_mesh(part)) {
+        part.gridcache = csg::get_voxelgrid(static_cast<const csg::CSGPart&>(part), params);
+        part.gridcache_voxel_scale = params.voxel_scale();
+    }
+
+    return part.gridcache ? clone(*part.gridcache) : nullptr;
+}
+
 } // namespace csg
 
 } // namespace Slic3r
@@ -67,6 +67,8 @@ struct CSGPartForStep : public csg::CSGPart
 {
     SLAPrintObjectStep key;
     mutable MeshBoolean::cgal::CGALMeshPtr cgalcache;
+    mutable VoxelGridPtr gridcache;
+    mutable float gridcache_voxel_scale = 0.f;
 
     CSGPartForStep(SLAPrintObjectStep k, CSGPart &&p = {})
         : key{k}, CSGPart{std::move(p)}
@@ -87,6 +89,8 @@ namespace csg {
 
 MeshBoolean::cgal::CGALMeshPtr get_cgalmesh(const CSGPartForStep &part);
 
+VoxelGridPtr get_voxelgrid(const CSGPartForStep &part, MeshToGridParams params);
+
 } // namespace csg
 
 class SLAPrintObject : public _SLAPrintObjectBase
@@ -346,7 +350,14 @@ private:
         sla::SupportableMesh    input; // the input
         std::vector<ExPolygons> support_slices;   // sliced supports
         TriangleMesh tree_mesh, pad_mesh, full_mesh; // cached artifacts
-        
+
+        // Model contours of the pad blueprint, reused between pad
+        // regenerations while the support points are being edited. This
+        // object is reset whenever the model mesh changes, which keeps the
+        // cache consistent.
+        sla::PadModelBlueprintCache pad_blueprint_cache;
+
+
         inline SupportData(const TriangleMesh &t)
             : input{t.its, {}, {}}
         {}
@@ -362,7 +373,8 @@ private:
 
         void create_pad(const sla::JobController &ctl)
         {
-            pad_mesh = TriangleMesh{sla::create_pad(input, tree_mesh.its, ctl)};
+            pad_mesh = TriangleMesh{sla::create_pad(input, tree_mesh.its, ctl,
+                                                    &pad_blueprint_cache)};
         }
     };
 
@@ -464,7 +476,7 @@ public:
     bool                empty() const override { return m_objects.empty(); }
     // List of existing PrintObject IDs, to remove notifications for non-existent IDs.
     std::vector<ObjectID> print_object_ids() const override;
-    ApplyStatus         apply(const Model &model, DynamicPrintConfig config) override;
+    ApplyStatus         apply(const Model &model, const DynamicPrintConfig &config) override;
     void                set_task(const TaskParams &params) override { PrintBaseWithState<SLAPrintStep, slapsCount>::set_task_impl(params, m_objects); }
     void                process() override;
     void                finalize() override { PrintBaseWithState<SLAPrintStep, slapsCount>::finalize_impl(m_objects); }
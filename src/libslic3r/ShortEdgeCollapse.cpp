@@ -13,6 +13,9 @@
 
 #include <ankerl/unordered_dense.h>
 
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_invoke.h>
+
 namespace Slic3r {
 
 /**
@@ -66,15 +69,31 @@ void its_short_edge_collpase(indexed_triangle_set &mesh, size_t target_triangle_
     // NOTE: This score is not updated, even though the decimation does change the mesh. It saves computation time, and there are no strong reasons to update.
     std::vector<float> min_vertex_dot_product(mesh.vertices.size(), 1);
     {
-        std::vector<Vec3f> face_normals = its_face_normals(mesh);
-        std::vector<Vec3f> vertex_normals = NormalUtils::create_normals(mesh);
+        std::vector<Vec3f> face_normals;
+        std::vector<Vec3f> vertex_normals;
+        tbb::parallel_invoke(
+            [&mesh, &face_normals]() { face_normals = its_face_normals(mesh); },
+            [&mesh, &vertex_normals]() { vertex_normals = NormalUtils::create_normals(mesh); });
+
+        // compute the three per-corner dot products in parallel, the cheap min reduction below stays serial
+        std::vector<Vec3f> corner_dot_products(mesh.indices.size());
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, mesh.indices.size()),
+        [&mesh, &face_normals, &vertex_normals, &corner_dot_products](const tbb::blocked_range<size_t> &range) {
+            for (size_t face_idx = range.begin(); face_idx < range.end(); ++face_idx) {
+                Vec3i t = mesh.indices[face_idx];
+                Vec3f n = face_normals[face_idx];
+                corner_dot_products[face_idx] = Vec3f(n.dot(vertex_normals[t[0]]),
+                                                      n.dot(vertex_normals[t[1]]),
+                                                      n.dot(vertex_normals[t[2]]));
+            }
+        });
 
         for (size_t face_idx = 0; face_idx < mesh.indices.size(); ++face_idx) {
-            Vec3i t = mesh.indices[face_idx];
-            Vec3f n = face_normals[face_idx];
-            min_vertex_dot_product[t[0]] = std::min(min_vertex_dot_product[t[0]], n.dot(vertex_normals[t[0]]));
-            min_vertex_dot_product[t[1]] = std::min(min_vertex_dot_product[t[1]], n.dot(vertex_normals[t[1]]));
-            min_vertex_dot_product[t[2]] = std::min(min_vertex_dot_product[t[2]], n.dot(vertex_normals[t[2]]));
+            Vec3i        t = mesh.indices[face_idx];
+            const Vec3f &d = corner_dot_products[face_idx];
+            min_vertex_dot_product[t[0]] = std::min(min_vertex_dot_product[t[0]], d[0]);
+            min_vertex_dot_product[t[1]] = std::min(min_vertex_dot_product[t[1]], d[1]);
+            min_vertex_dot_product[t[2]] = std::min(min_vertex_dot_product[t[2]], d[2]);
         }
     }
 
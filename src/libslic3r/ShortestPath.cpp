@@ -16,6 +16,7 @@
 
 #include <cmath>
 #include <cassert>
+#include <numeric>
 
 namespace Slic3r {
 
@@ -253,6 +254,12 @@ std::vector<std::pair<size_t, bool>> chain_segments_greedy_constrained_reversals
 
 	    // Chain the end points: find (num_segments - 1) shortest links not forming bifurcations or loops.
 		assert(num_segments >= 2);
+		// Number of points stored inside the KD tree and the number of those, which were already connected into the output path.
+		// The KD tree does not support incremental removal, therefore the connected points are purged in batches:
+		// Once more than a half of the points inside the KD tree is connected (and thus rejected by all the search filters),
+		// the tree is rebuilt from the unconnected points only.
+		size_t kdtree_size = end_points.size();
+		size_t kdtree_dead = (first_point == nullptr) ? 0 : 1;
 #ifndef NDEBUG
 		double distance_taken_last = 0.;
 #endif /* NDEBUG */
@@ -316,6 +323,20 @@ std::vector<std::pair<size_t, bool>> chain_segments_greedy_constrained_reversals
 					assert(queue.empty());
 					break;
 				}
+				kdtree_dead += 2;
+				if (kdtree_dead * 2 > kdtree_size && kdtree_size > 512) {
+					// More than a half of the points inside the KD tree was connected into the output path.
+					// Rebuild the tree from the unconnected points only, so that the following closest point
+					// queries don't spend most of their time visiting filtered out points.
+					std::vector<size_t> indices;
+					indices.reserve(kdtree_size - kdtree_dead);
+					for (const EndPoint &ep : end_points)
+						if (ep.chain_id == 0)
+							indices.emplace_back(&ep - &end_points.front());
+					kdtree_size = indices.size();
+					kdtree_dead = 0;
+					kdtree.build(indices);
+				}
 	    	} else {
 				// This edge forms a loop. Update end_point1 and try another one.
 				++ iter;
@@ -328,7 +349,7 @@ std::vector<std::pair<size_t, bool>> chain_segments_greedy_constrained_reversals
 			    	assert(end_points[this_idx].chain_id == 0);
 					if ((idx ^ this_idx) <= 1 || end_points[idx].chain_id != 0)
 						// Points of the same segment shall not be connected,
-						// cannot connect to an already connected point (ideally those would be removed from the KD tree, but the update is difficult).
+						// cannot connect to an already connected point (those are purged from the KD tree in batches, but some may linger between rebuilds).
 						return false;
 			    	size_t chain1 = equivalent_chain(end_points[this_idx ^ 1].chain_id);
 			    	size_t chain2 = equivalent_chain(end_points[idx      ^ 1].chain_id);
@@ -343,8 +364,6 @@ std::vector<std::pair<size_t, bool>> chain_segments_greedy_constrained_reversals
 #endif /* NDEBUG */
 				// Update position of this end point in the queue based on the distance calculated at the line above.
 				queue.update(end_point1.heap_idx);
-		    	//FIXME Remove the other end point from the KD tree.
-		    	// As the KD tree update is expensive, do it only after some larger number of points is removed from the queue.
 				assert(validate_graph_and_queue());
 	    	}
 		}
@@ -393,9 +412,16 @@ std::vector<std::pair<size_t, bool>> chain_segments_greedy_constrained_reversals
 					} while (first_point != nullptr);
 				}
 			}
-			if (failed)
+			if (failed) {
 				// As a last resort, try a dumb algorithm, which is not sensitive to edge reversal constraints.
+				if (kdtree_size != end_points.size()) {
+					// The KD tree was rebuilt over the unconnected points only during chaining, while the fallback needs all of them.
+					std::vector<size_t> indices(end_points.size());
+					std::iota(indices.begin(), indices.end(), size_t(0));
+					kdtree.build(indices);
+				}
 				out = chain_segments_closest_point<EndPoint, decltype(kdtree), CouldReverseFunc>(end_points, kdtree, could_reverse_func, (initial_point != nullptr) ? *initial_point : end_points.front());
+			}
 		} else {
 			assert(! failed);
 		}
@@ -439,7 +465,7 @@ void update_end_point_in_queue(QueueType &queue, const KDTreeType &kdtree, Chain
 			size_t chain2b = end_points[idx ^ 1].chain_id;
 			if (chain2a > 0 && chain2b > 0)
 				// Only unconnected end point or a point next to an unconnected end point may be connected to.
-				// Ideally those would be removed from the KD tree, but the update is difficult.
+				// Those are purged from the KD tree in batches, but some may linger between rebuilds.
 				return false;
 	    	assert(chain2a == 0 || chain2b == 0);
 	    	size_t chain2 = chains.equivalent(std::max(chain2a, chain2b));
@@ -760,6 +786,11 @@ std::vector<std::pair<size_t, bool>> chain_segments_greedy_constrained_reversals
 		// required is higher than expected (it would be the number of links, num_segments - 1).
 		// The limit here may not be necessary, but it guards us against an endless loop if something goes wrong.
 		size_t num_iter = num_segments * 16;
+		// Number of points stored inside the KD tree and an estimate of the number of those, which were already connected
+		// on both sides of their segments and thus rejected by all the search filters. The KD tree does not support
+		// incremental removal, therefore the dead points are purged in batches by rebuilding the tree from the live points only.
+		size_t kdtree_size = end_points.size();
+		size_t kdtree_dead = 0;
 		for (size_t num_connections_to_end = num_segments - 1; num_iter > 0; -- num_iter) {
 			assert(validate_graph_and_queue());
 	    	// Take the first end point, for which the link points to the currently closest valid neighbor.
@@ -911,6 +942,20 @@ std::vector<std::pair<size_t, bool>> chain_segments_greedy_constrained_reversals
 					assert(&chain.end  ->opposite(end_points) != first_point &&
 						(chain.end   == first_point ? chain.end  ->opposite(end_points).heap_idx_invalid() : chain.end  ->opposite(end_points).heap_idx < queue.size()));
 
+					kdtree_dead += 2;
+					if (kdtree_dead * 2 > kdtree_size && kdtree_size > 512) {
+						// More than a half of the points inside the KD tree is likely connected on both sides of their segments.
+						// Rebuild the tree from the live points only, so that the following closest point queries don't spend
+						// most of their time visiting filtered out points.
+						std::vector<size_t> indices;
+						indices.reserve(end_points.size());
+						for (size_t idx = 0; idx < end_points.size(); ++ idx)
+							if (idx != first_point_idx && (end_points[idx].chain_id == 0 || end_points[idx ^ 1].chain_id == 0))
+								indices.emplace_back(idx);
+						kdtree_size = indices.size();
+						kdtree_dead = 0;
+						kdtree.build(indices);
+					}
 				}
 			} else {
 				// This edge forms a loop. Update end_point1 and try another one.
@@ -922,8 +967,6 @@ std::vector<std::pair<size_t, bool>> chain_segments_greedy_constrained_reversals
 //					printf("Warning: taking shorter length than previously is suspicious\n");
 				}
 #endif /* NDEBUG */
-		    	//FIXME Remove the other end point from the KD tree.
-		    	// As the KD tree update is expensive, do it only after some larger number of points is removed from the queue.
 		    }
 			assert(validate_graph_and_queue());
 		}
@@ -972,9 +1015,16 @@ std::vector<std::pair<size_t, bool>> chain_segments_greedy_constrained_reversals
 					} while (first_point != nullptr);
 				}
 			}
-			if (failed)
+			if (failed) {
 				// As a last resort, try a dumb algorithm, which is not sensitive to edge reversal constraints.
+				if (kdtree_size != end_points.size()) {
+					// The KD tree was rebuilt over the live points only during chaining, while the fallback needs all of them.
+					std::vector<size_t> indices(end_points.size());
+					std::iota(indices.begin(), indices.end(), size_t(0));
+					kdtree.build(indices);
+				}
 				out = chain_segments_closest_point<EndPoint, decltype(kdtree), CouldReverseFunc>(end_points, kdtree, could_reverse_func, (initial_point != nullptr) ? *initial_point : end_points.front());
+			}
 		} else {
 			assert(! failed);
 		}
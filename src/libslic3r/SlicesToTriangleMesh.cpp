@@ -73,17 +73,33 @@ indexed_triangle_set slices_to_mesh(
         its_merge(layers[i], straight_walls(upper, grid[i], grid[i + 1]));
         }, threads_cnt);
 
-    auto merge_fn = []( const indexed_triangle_set &a, const indexed_triangle_set &b ) {
-        indexed_triangle_set res{a}; its_merge(res, b); return res;
-    };
+    indexed_triangle_set bottom;
+    its_merge(bottom, triangulate_expolygons_3d(slices.front(), zmin, NORMALS_DOWN));
+    its_merge(bottom, straight_walls(slices.front(), zmin, grid.front()));
+    indexed_triangle_set top;
+    its_merge(top, triangulate_expolygons_3d(slices.back(), grid.back(), NORMALS_UP));
+
+    // its_merge is a plain offset-append, so a parallel reduction only recopies
+    // the growing buffer over and over. Reserve the exact final size once and
+    // append the layers in order, releasing each of them right away to keep the
+    // peak memory at the result plus a single layer.
+    size_t num_vertices = bottom.vertices.size() + top.vertices.size();
+    size_t num_faces    = bottom.indices.size() + top.indices.size();
+    for (const indexed_triangle_set &layer : layers) {
+        num_vertices += layer.vertices.size();
+        num_faces    += layer.indices.size();
+    }
 
-    auto ret = execution::reduce(ex_tbb, layers.begin(), layers.end(),
-                                 indexed_triangle_set{}, merge_fn,
-                                 threads_cnt);
-
-    its_merge(ret, triangulate_expolygons_3d(slices.front(), zmin, NORMALS_DOWN));
-    its_merge(ret, straight_walls(slices.front(), zmin, grid.front()));
-    its_merge(ret, triangulate_expolygons_3d(slices.back(), grid.back(), NORMALS_UP));
+    indexed_triangle_set ret;
+    ret.vertices.reserve(num_vertices);
+    ret.indices.reserve(num_faces);
+    for (indexed_triangle_set &layer : layers) {
+        its_merge(ret, layer);
+        layer = {};
+    }
+
+    its_merge(ret, bottom);
+    its_merge(ret, top);
 
     // FIXME: these repairs do not fix the mesh entirely. There will be cracks
     // in the output. It is very hard to do the meshing in a way that does not
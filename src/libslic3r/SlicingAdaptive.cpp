@@ -10,6 +10,9 @@
 #include <boost/log/trivial.hpp>
 #include <cfloat>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 // Based on the work of Florens Waserfall (@platch on github)
 // and his paper
 // Florens Wasserfall, Norman Hendrich, Jianwei Zhang:
@@ -74,6 +77,10 @@ static inline float layer_height_from_slope(const SlicingAdaptive::FaceZ &face,
 void SlicingAdaptive::clear()
 {
 	m_faces.clear();
+	m_active_faces.clear();
+	m_sweep_begin   = 0;
+	m_first_alive   = 0;
+	m_sweep_print_z = - FLT_MAX;
 }
 
 void SlicingAdaptive::prepare(const ModelObject &object)
@@ -84,17 +91,21 @@ void SlicingAdaptive::prepare(const ModelObject &object)
     const ModelInstance &first_instance = *object.instances.front();
     mesh.transform(first_instance.get_matrix(), first_instance.is_left_handed());
 
-    // 1) Collect faces from mesh.
-    m_faces.reserve(mesh.facets_count());
-	for (stl_triangle_vertex_indices face : mesh.its.indices) {
-		stl_vertex vertex[3] = { mesh.its.vertices[face[0]], mesh.its.vertices[face[1]], mesh.its.vertices[face[2]] };
-		stl_vertex n         = face_normal_normalized(vertex);
-		std::pair<float, float> face_z_span {
-			std::min(std::min(vertex[0].z(), vertex[1].z()), vertex[2].z()),
-			std::max(std::max(vertex[0].z(), vertex[1].z()), vertex[2].z())
-		};
-		m_faces.emplace_back(FaceZ({ face_z_span, std::abs(n.z()), std::sqrt(n.x() * n.x() + n.y() * n.y()) }));
-    }
+    // 1) Collect faces from mesh, in parallel.
+    m_faces.resize(mesh.its.indices.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, mesh.its.indices.size()),
+        [&mesh, this](const tbb::blocked_range<size_t> &range) {
+            for (size_t face_idx = range.begin(); face_idx < range.end(); ++ face_idx) {
+                const stl_triangle_vertex_indices &face = mesh.its.indices[face_idx];
+                stl_vertex vertex[3] = { mesh.its.vertices[face[0]], mesh.its.vertices[face[1]], mesh.its.vertices[face[2]] };
+                stl_vertex n         = face_normal_normalized(vertex);
+                std::pair<float, float> face_z_span {
+                    std::min(std::min(vertex[0].z(), vertex[1].z()), vertex[2].z()),
+                    std::max(std::max(vertex[0].z(), vertex[1].z()), vertex[2].z())
+                };
+                m_faces[face_idx] = FaceZ({ face_z_span, std::abs(n.z()), std::sqrt(n.x() * n.x() + n.y() * n.y()) });
+            }
+        });
 
 	// 2) Sort faces lexicographically by their Z span.
 	std::sort(m_faces.begin(), m_faces.end(), [](const FaceZ &f1, const FaceZ &f2) { return f1.z_span < f2.z_span; });
@@ -127,31 +138,63 @@ float SlicingAdaptive::next_layer_height(const float print_z, float quality_fact
 	    	lerp(delta_max, delta_mid, 2. * (1. - quality_factor));
 	}
 	
-	// find all facets intersecting the slice-layer
-	size_t ordered_id = current_facet;
+	// Comparator of the min-heap of the active faces, moving the lowest slope to the front.
+	auto active_face_after = [](const ActiveFace &l, const ActiveFace &r) { return l.slope > r.slope; };
+
+	// Rebuild the sweep state when queried below the last print_z. The only in tree caller queries
+	// with a monotonically increasing print_z, thus the sweep is incremental there.
+	if (print_z < m_sweep_print_z) {
+		m_active_faces.clear();
+		m_sweep_begin = 0;
+		m_first_alive = 0;
+	}
+	m_sweep_print_z = print_z;
+
+	// Activate all facets starting below the slice-layer. layer_height_from_slope() is monotone in the
+	// face slope, therefore the minimum of the heights over the active faces is the height of the face
+	// at the front of the min-heap.
+	for (; m_sweep_begin < m_faces.size() && m_faces[m_sweep_begin].z_span.first < print_z; ++ m_sweep_begin) {
+		const FaceZ &face = m_faces[m_sweep_begin];
+		m_active_faces.push_back({ face.n_cos > 1e-5 ? face.n_sin / face.n_cos : FLT_MAX, uint32_t(m_sweep_begin) });
+		std::push_heap(m_active_faces.begin(), m_active_faces.end(), active_face_after);
+	}
+	// Track the first facet ending above the slice-layer, to store the first event for the next
+	// cusp_height call to begin at this point.
+	while (m_first_alive < m_faces.size() && ! (m_faces[m_first_alive].z_span.second > print_z))
+		++ m_first_alive;
+	if (m_first_alive < m_sweep_begin)
+		current_facet = m_first_alive;
+
+	// Query the minimum layer height over the active faces intersecting the slice-layer.
 	{
-		bool first_hit = false;
-		for (; ordered_id < m_faces.size(); ++ ordered_id) {
-	        const std::pair<float, float> &zspan = m_faces[ordered_id].z_span;
-	        // facet's minimum is higher than slice_z -> end loop
-			if (zspan.first >= print_z)
+		// End of the heap inside m_active_faces. The set aside touching faces are kept behind it.
+		auto heap_end = m_active_faces.end();
+		while (m_active_faces.begin() != heap_end) {
+			const FaceZ &face = m_faces[m_active_faces.front().face_idx];
+			if (face.z_span.second > print_z && ! (face.z_span.second < print_z + EPSILON)) {
+				// Compute cusp-height for the face of the lowest slope, being the minimum of all the heights.
+				height = std::min(height, layer_height_from_slope(face, max_surface_deviation));
 				break;
-			// facet's maximum is higher than slice_z -> store the first event for next cusp_height call to begin at this point
-			if (zspan.second > print_z) {
-				// first event?
-				if (! first_hit) {
-					first_hit = true;
-					current_facet = ordered_id;
-	            }
-				// skip touching facets which could otherwise cause small cusp values
-				if (zspan.second < print_z + EPSILON)
-					continue;
-				// compute cusp-height for this facet and store minimum of all heights
-				height = std::min(height, layer_height_from_slope(m_faces[ordered_id], max_surface_deviation));
-	        }
+			}
+			bool passed = ! (face.z_span.second > print_z);
+			std::pop_heap(m_active_faces.begin(), heap_end, active_face_after);
+			-- heap_end;
+			if (passed) {
+				// The face ends below the slice-layer, remove it for good, keeping the set aside faces compact.
+				*heap_end = m_active_faces.back();
+				m_active_faces.pop_back();
+			}
+			// otherwise the face is touching the slice-layer, which could otherwise cause small cusp values.
+			// It was set aside behind heap_end and will be returned to the heap below.
 		}
+		// Return the set aside touching faces to the heap. They die out within an EPSILON of further sweep progress.
+		for (; heap_end != m_active_faces.end(); ++ heap_end)
+			std::push_heap(m_active_faces.begin(), heap_end + 1, active_face_after);
 	}
 
+	// The second pass below continues at the first facet starting at or above the slice-layer.
+	size_t ordered_id = m_sweep_begin;
+
 	// lower height limit due to printer capabilities
 	height = std::max(height, float(m_slicing_params.min_layer_height));
 
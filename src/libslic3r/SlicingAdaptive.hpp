@@ -10,6 +10,8 @@
 #include "Slicing.hpp"
 #include "admesh/stl.h"
 
+#include <cfloat>
+
 namespace Slic3r
 {
 
@@ -39,6 +41,27 @@ protected:
 	SlicingParameters 		m_slicing_params;
 
 	std::vector<FaceZ>		m_faces;
+
+private:
+	// Face activated by the sweep of next_layer_height(), stored inside a min-heap ordered by the face slope.
+	struct ActiveFace {
+		// Slope of the face (n_sin / n_cos), FLT_MAX for faces close to horizontal.
+		float					slope;
+		// Index of the face inside m_faces.
+		uint32_t				face_idx;
+	};
+	// State of the incremental sweep performed by next_layer_height(), valid for monotonically increasing print_z
+	// queries, rebuilt from scratch when queried below the last print_z.
+	// Min-heap of the faces starting below the query plane, ordered by their slope, with the faces
+	// ending below the query plane removed lazily.
+	std::vector<ActiveFace>	m_active_faces;
+	// First face of m_faces (sorted by z_span) starting at or above the last query plane.
+	size_t					m_sweep_begin { 0 };
+	// First face of m_faces ending above the last query plane, tracking the current_facet in / out parameter
+	// of next_layer_height().
+	size_t					m_first_alive { 0 };
+	// The last query plane of next_layer_height().
+	float					m_sweep_print_z { - FLT_MAX };
 };
 
 }; // namespace Slic3r
@@ -5,6 +5,8 @@
 #include "Subdivide.hpp"
 #include "Point.hpp"
 
+#include <tbb/parallel_for.h>
+
 namespace Slic3r{
 
 indexed_triangle_set its_subdivide(
@@ -190,16 +192,29 @@ indexed_triangle_set its_subdivide(
     result.vertices = vertices; // copy
     std::queue<TriangleLengths> tls;
 
+    // Screen all triangles in parallel, most of them are small and will be copied unchanged.
+    // Only the sequential division below has to share the edge split map.
+    std::vector<char>  dividable(its.indices.size());
+    std::vector<Vec3f> edge_lengths(its.indices.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, its.indices.size()),
+    [&its, &vertices, &dividable, &edge_lengths, max_length](const tbb::blocked_range<size_t> &range) {
+        for (size_t i = range.begin(); i < range.end(); ++i) {
+            Edges edges(its.indices[i], vertices);
+            // speed up only sum not sqrt is apply
+            dividable[i]    = edges.is_dividable(max_length);
+            edge_lengths[i] = edges.lengths;
+        }
+    });
+
     EdgeDivides edge_divides;
-    for (const Vec3crd &indices : its.indices) {
-        Edges edges(indices, vertices);
-        // speed up only sum not sqrt is apply
-        if (!edges.is_dividable(max_length)) {
+    for (size_t face_idx = 0; face_idx < its.indices.size(); ++face_idx) {
+        const Vec3crd &indices = its.indices[face_idx];
+        if (!dividable[face_idx]) {
              // small triangle
             result.indices.push_back(indices);
             continue;
         }
-        TriangleLengths tl(indices, edges.lengths);
+        TriangleLengths tl(indices, edge_lengths[face_idx]);
         do {
             int divide_index = tl.get_divide_index(max_length);
             if (divide_index < 0) {
@@ -0,0 +1,40 @@
+///|/ Copyright (c) Prusa Research 2023 Vojtěch Bubník @bubnikv
+///|/
+///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
+///|/
+#include "SupportAnalysis.hpp"
+
+#include "../ClipperUtils.hpp"
+#include "../Layer.hpp"
+#include "../Print.hpp"
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+namespace Slic3r {
+
+std::shared_ptr<const SupportAnalysis> SupportAnalysis::create(const PrintObject &object, std::function<void()> throw_on_cancel)
+{
+    auto out = std::make_shared<SupportAnalysis>();
+    size_t num_layers = object.layer_count();
+    out->raw_overhangs.assign(num_layers, Polygons{});
+    out->unsupported_areas.assign(num_layers, 0.);
+    tbb::parallel_for(tbb::blocked_range<size_t>(1, num_layers),
+        [&object, &out, &throw_on_cancel](const tbb::blocked_range<size_t> &range) {
+            for (size_t layer_id = range.begin(); layer_id < range.end(); ++ layer_id) {
+                if (throw_on_cancel)
+                    throw_on_cancel();
+                const Layer &layer       = *object.get_layer(int(layer_id));
+                const Layer &lower_layer = *layer.lower_layer;
+                Polygons overhangs = diff(layer.lslices, lower_layer.lslices);
+                double   area_sum  = 0.;
+                for (const Polygon &polygon : overhangs)
+                    area_sum += polygon.area();
+                out->unsupported_areas[layer_id] = unscaled<double>(unscaled<double>(area_sum));
+                out->raw_overhangs[layer_id]     = std::move(overhangs);
+            }
+        });
+    return out;
+}
+
+} // namespace Slic3r
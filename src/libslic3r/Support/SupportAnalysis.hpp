@@ -0,0 +1,38 @@
+///|/ Copyright (c) Prusa Research 2023 Vojtěch Bubník @bubnikv
+///|/
+///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
+///|/
+#ifndef slic3r_SupportAnalysis_hpp_
+#define slic3r_SupportAnalysis_hpp_
+
+#include "../Polygon.hpp"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace Slic3r {
+
+class PrintObject;
+
+// Per object analysis of the sliced geometry, derived once from the layer slices and shared
+// read-only by the support generators (classic and tree supports), so that each of them does
+// not have to re-derive the same geometry. Created on demand by PrintObject::support_analysis(),
+// invalidated together with the slices.
+struct SupportAnalysis
+{
+    // Raw overhangs per object layer: difference of the layer slices against the lower layer
+    // slices with no offset applied, thus independent of any support threshold angle.
+    // The first layer entry is empty as there is nothing below to overhang.
+    std::vector<Polygons> raw_overhangs;
+    // Unscaled area of the raw overhangs per layer, a cheap measure of how much of each layer
+    // hangs in the air without being supported by the layer below.
+    std::vector<double>   unsupported_areas;
+
+    // Compute the analysis over all object layers in parallel.
+    static std::shared_ptr<const SupportAnalysis> create(const PrintObject &object, std::function<void()> throw_on_cancel = nullptr);
+};
+
+} // namespace Slic3r
+
+#endif // slic3r_SupportAnalysis_hpp_
@@ -30,6 +30,7 @@
 #include <boost/container/static_vector.hpp>
 
 #include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
 #include <tbb/task_group.h>
 
 #define SUPPORT_USE_AGG_RASTERIZER
@@ -1079,19 +1080,57 @@ std::vector<Polygons> PrintObjectSupportMaterial::buildplate_covered(const Print
     std::vector<Polygons> buildplate_covered;
     if (buildplate_only) {
         BOOST_LOG_TRIVIAL(debug) << "PrintObjectSupportMaterial::buildplate_covered() - start";
-        buildplate_covered.assign(object.layers().size(), Polygons());
-        //FIXME prefix sum algorithm, parallelize it! Parallelization will also likely be more numerically stable.
-        for (size_t layer_id = 1; layer_id < object.layers().size(); ++ layer_id) {
-            const Layer &lower_layer = *object.layers()[layer_id-1];
-            // Merge the new slices with the preceding slices.
-            // Apply the safety offset to the newly added polygons, so they will connect
-            // with the polygons collected before,
-            // but don't apply the safety offset during the union operation as it would
-            // inflate the polygons over and over.
-            Polygons &covered = buildplate_covered[layer_id];
-            covered = buildplate_covered[layer_id - 1];
-            polygons_append(covered, offset(lower_layer.lslices, scale_(0.01)));
-            covered = union_(covered);
+        const size_t num_layers = object.layers().size();
+        buildplate_covered.assign(num_layers, Polygons());
+        // Apply the safety offset to the newly added polygons, so they will connect
+        // with the polygons collected before,
+        // but don't apply the safety offset during the union operation as it would
+        // inflate the polygons over and over.
+        auto covered_by_layer = [&object](size_t layer_id) { return offset(object.layers()[layer_id]->lslices, scale_(0.01)); };
+        // Prefix union over the layers, parallelized as a two pass scan: Each chunk of layers accumulates
+        // its local running union in parallel, then the chunk totals are chained serially and finally the
+        // carry-in of each chunk is merged back over its layers in parallel.
+        const size_t grain      = 8;
+        const size_t num_chunks = num_layers <= 1 ? 0 :
+            std::min((num_layers - 1 + grain - 1) / grain, size_t(4 * tbb::this_task_arena::max_concurrency()));
+        if (num_chunks <= 1) {
+            for (size_t layer_id = 1; layer_id < num_layers; ++ layer_id) {
+                // Merge the new slices with the preceding slices.
+                Polygons &covered = buildplate_covered[layer_id];
+                covered = buildplate_covered[layer_id - 1];
+                polygons_append(covered, covered_by_layer(layer_id - 1));
+                covered = union_(covered);
+            }
+        } else {
+            // Boundaries of the chunks of layers, chunk i covering layer range <bounds[i], bounds[i + 1]).
+            std::vector<size_t> bounds(num_chunks + 1, 1);
+            for (size_t i = 1; i <= num_chunks; ++ i)
+                bounds[i] = 1 + (num_layers - 1) * i / num_chunks;
+            // 1) Running union inside each chunk, not yet accounting for the preceding chunks.
+            std::vector<Polygons> chunk_totals(num_chunks, Polygons());
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, num_chunks, 1),
+                [&bounds, &buildplate_covered, &chunk_totals, &covered_by_layer](const tbb::blocked_range<size_t> &range) {
+                for (size_t chunk_id = range.begin(); chunk_id < range.end(); ++ chunk_id) {
+                    Polygons acc;
+                    for (size_t layer_id = bounds[chunk_id]; layer_id < bounds[chunk_id + 1]; ++ layer_id) {
+                        polygons_append(acc, covered_by_layer(layer_id - 1));
+                        acc = union_(acc);
+                        buildplate_covered[layer_id] = acc;
+                    }
+                    chunk_totals[chunk_id] = std::move(acc);
+                }
+            });
+            // 2) Chain the chunk totals into carry-ins, cheap serial pass over the chunks only.
+            std::vector<Polygons> carry(num_chunks, Polygons());
+            for (size_t chunk_id = 1; chunk_id < num_chunks; ++ chunk_id)
+                carry[chunk_id] = union_(carry[chunk_id - 1], chunk_totals[chunk_id - 1]);
+            // 3) Merge the carry-in of each chunk over its layers.
+            tbb::parallel_for(tbb::blocked_range<size_t>(1, num_chunks, 1),
+                [&bounds, &buildplate_covered, &carry](const tbb::blocked_range<size_t> &range) {
+                for (size_t chunk_id = range.begin(); chunk_id < range.end(); ++ chunk_id)
+                    for (size_t layer_id = bounds[chunk_id]; layer_id < bounds[chunk_id + 1]; ++ layer_id)
+                        buildplate_covered[layer_id] = union_(buildplate_covered[layer_id], carry[chunk_id]);
+            });
         }
         BOOST_LOG_TRIVIAL(debug) << "PrintObjectSupportMaterial::buildplate_covered() - end";
     }
@@ -14,6 +14,7 @@
 #define slic3r_TreeModelVolumes_hpp
 
 #include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 
 #include <boost/functional/hash.hpp>
@@ -214,24 +215,24 @@ private:
         RadiusLayerPolygonCache& operator=(const RadiusLayerPolygonCache&) = delete;
 
         void insert(std::vector<std::pair<RadiusLayerPair, Polygons>> &&in) {
-            std::lock_guard<std::mutex> guard(m_mutex);
+            std::lock_guard<std::shared_mutex> guard(m_mutex);
             for (auto &d : in)
                 this->get_allocate_layer_data(d.first.second).emplace(d.first.first, std::move(d.second));
         }
         // by layer
         void insert(std::vector<std::pair<coord_t, Polygons>> &&in, coord_t radius) {
-            std::lock_guard<std::mutex> guard(m_mutex);
+            std::lock_guard<std::shared_mutex> guard(m_mutex);
             for (auto &d : in)
                 this->get_allocate_layer_data(d.first).emplace(radius, std::move(d.second));
         }
         void insert(std::vector<Polygons> &&in, coord_t first_layer_idx, coord_t radius) {
-            std::lock_guard<std::mutex> guard(m_mutex);
+            std::lock_guard<std::shared_mutex> guard(m_mutex);
             allocate_layers(first_layer_idx + in.size());
             for (auto &d : in)
                 m_data[first_layer_idx ++].emplace(radius, std::move(d));
         }
         void insert(LayerPolygonCache &&in, coord_t radius) {
-            std::lock_guard<std::mutex> guard(m_mutex);
+            std::lock_guard<std::shared_mutex> guard(m_mutex);
             LayerIndex i = in.begin();
             allocate_layers(i + LayerIndex(in.size()));
             for (auto &d : in.polygons_mutable())
@@ -243,7 +244,9 @@ private:
          * \return A wrapped optional reference of the requested area (if it was found, an empty optional if nothing was found)
          */
         std::optional<std::reference_wrapper<const Polygons>> getArea(const TreeModelVolumes::RadiusLayerPair &key) const {
-            std::lock_guard<std::mutex> guard(m_mutex);
+            // After precalculation the caches are read-mostly: the shared lock lets the tree propagation
+            // threads query concurrently, only the rare lazy calculation takes the cache exclusively.
+            std::shared_lock<std::shared_mutex> guard(m_mutex);
 
             if (key.second >= LayerIndex(m_data.size()))
                 return std::nullopt;
@@ -257,7 +260,7 @@ private:
         }
         // Get a collision area at a given layer for a radius that is a lower or equial to the key radius.
         std::optional<std::pair<coord_t, std::reference_wrapper<const Polygons>>> get_lower_bound_area(const TreeModelVolumes::RadiusLayerPair &key) const {
-            std::lock_guard<std::mutex> guard(m_mutex);
+            std::shared_lock<std::shared_mutex> guard(m_mutex);
             if (key.second >= LayerIndex(m_data.size()))
                 return {};
             const auto &layer = m_data[key.second];
@@ -279,7 +282,7 @@ private:
          * \return A wrapped optional reference of the requested area (if it was found, an empty optional if nothing was found)
          */
         LayerIndex getMaxCalculatedLayer(coord_t radius) const {
-            std::lock_guard<std::mutex> guard(m_mutex);
+            std::shared_lock<std::shared_mutex> guard(m_mutex);
             auto layer_idx = LayerIndex(m_data.size()) - 1;
             for (; layer_idx > 0; -- layer_idx)
                 if (const auto &layer = m_data[layer_idx]; layer.find(radius) != layer.end())
@@ -308,8 +311,11 @@ private:
         }
         void                allocate_layers(size_t num_layers);
 
-        Layers              m_data;
-        mutable std::mutex  m_mutex;
+        Layers                      m_data;
+        // Guards m_data. Taken shared by the lookups, exclusively by the batch inserts.
+        // References to Polygons handed out by the lookups stay valid without holding the lock,
+        // as the inserts never overwrite an existing (radius, layer) entry.
+        mutable std::shared_mutex   m_mutex;
     };
 
 
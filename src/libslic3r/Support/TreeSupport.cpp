@@ -12,6 +12,7 @@
 
 #include "TreeSupport.hpp"
 #include "TreeSupportCommon.hpp"
+#include "SupportAnalysis.hpp"
 #include "SupportCommon.hpp"
 #include "OrganicSupport.hpp"
 
@@ -120,7 +121,7 @@ static inline void check_self_intersections(const ExPolygon &expoly, const std::
 #endif // TREE_SUPPORT_SHOW_ERRORS_WIN32
 }
 
-static std::vector<std::pair<TreeSupportSettings, std::vector<size_t>>> group_meshes(const Print &print, const std::vector<size_t> &print_object_ids)
+static std::vector<std::pair<TreeSupportSettings, std::vector<size_t>>> group_meshes(const Print &print, const std::vector<size_t> &print_object_ids, TreeSupportQuality quality)
 {
     std::vector<std::pair<TreeSupportSettings, std::vector<size_t>>> grouped_meshes;
 
@@ -147,7 +148,7 @@ static std::vector<std::pair<TreeSupportSettings, std::vector<size_t>>> group_me
         assert(object_config.support_material_style == smsTree || object_config.support_material_style == smsOrganic);
 
         bool found_existing_group = false;
-        TreeSupportSettings next_settings{ TreeSupportMeshGroupSettings{ print_object }, print_object.slicing_parameters() };
+        TreeSupportSettings next_settings{ TreeSupportMeshGroupSettings{ print_object, quality }, print_object.slicing_parameters() };
         //FIXME for now only a single object per group is enabled.
 #if 0
         for (size_t idx = 0; idx < grouped_meshes.size(); ++ idx)
@@ -216,17 +217,19 @@ static std::vector<std::pair<TreeSupportSettings, std::vector<size_t>>> group_me
     //FIXME this is a fudge constant!
     auto                     enforcer_overhang_offset = scaled<double>(config.support_tree_tip_diameter.value);
 
+    // Shared analysis of the slices, provides the raw overhangs (no threshold offset applied).
+    std::shared_ptr<const SupportAnalysis> analysis = print_object.support_analysis(throw_on_cancel);
+
     size_t num_overhang_layers = support_auto ? num_object_layers : std::min(num_object_layers, std::max(size_t(support_enforce_layers), enforcers_layers.size()));
     tbb::parallel_for(tbb::blocked_range<LayerIndex>(1, num_overhang_layers),
-        [&print_object, &config, &print_config, &enforcers_layers, &blockers_layers, 
+        [&print_object, &config, &print_config, &enforcers_layers, &blockers_layers, &analysis,
          support_auto, support_enforce_layers, support_threshold_auto, tan_threshold, enforcer_overhang_offset, num_raft_layers, &throw_on_cancel, &out]
         (const tbb::blocked_range<LayerIndex> &range) {
         for (LayerIndex layer_id = range.begin(); layer_id < range.end(); ++ layer_id) {
             const Layer   &current_layer  = *print_object.get_layer(layer_id);
             const Layer   &lower_layer    = *print_object.get_layer(layer_id - 1);
             // Full overhangs with zero lower_layer_offset and no blockers applied.
-            Polygons       raw_overhangs;
-            bool           raw_overhangs_calculated = false;
+            const Polygons &raw_overhangs = analysis->raw_overhangs[layer_id];
             // Final overhangs.
             Polygons       overhangs;
             // For how many layers full overhangs shall be supported.
@@ -244,12 +247,8 @@ static std::vector<std::pair<TreeSupportSettings, std::vector<size_t>>> group_me
                 } else
                     lower_layer_offset = scaled<float>(lower_layer.height / tan_threshold);
                 overhangs = lower_layer_offset == 0 ?
-                    diff(current_layer.lslices, lower_layer.lslices) :
+                    raw_overhangs :
                     diff(current_layer.lslices, offset(lower_layer.lslices, lower_layer_offset));
-                if (lower_layer_offset == 0) {
-                    raw_overhangs = overhangs;
-                    raw_overhangs_calculated = true;
-                }
                 if (! (enforced_layer || blockers_layers.empty() || blockers_layers[layer_id].empty()))
                     overhangs = diff(overhangs, blockers_layers[layer_id], ApplySafetyOffset::Yes);
                 if (config.dont_support_bridges) {
@@ -264,7 +263,7 @@ static std::vector<std::pair<TreeSupportSettings, std::vector<size_t>>> group_me
                 //enforcers_layers[layer_id] = union_(enforcers_layers[layer_id]);
                 //check_self_intersections(enforcers_layers[layer_id], "generate_overhangs - enforcers");
                 //check_self_intersections(to_polygons(lower_layer.lslices), "generate_overhangs - lowerlayers");
-                if (Polygons enforced_overhangs = intersection(raw_overhangs_calculated ? raw_overhangs : diff(current_layer.lslices, lower_layer.lslices), enforcers_layers[layer_id] /*, ApplySafetyOffset::Yes */);
+                if (Polygons enforced_overhangs = intersection(raw_overhangs, enforcers_layers[layer_id] /*, ApplySafetyOffset::Yes */);
                     ! enforced_overhangs.empty()) {
                     //FIXME this is a hack to make enforcers work on steep overhangs.
                     //check_self_intersections(enforced_overhangs, "generate_overhangs - enforced overhangs1");
@@ -1221,7 +1220,8 @@ static void generate_initial_areas(
     std::function<void()>            throw_on_cancel)
 {
     using                           AvoidanceType = TreeModelVolumes::AvoidanceType;
-    TreeSupportMeshGroupSettings    mesh_group_settings(print_object);
+    // Use the settings the mesh group was created with, so that a possible draft quality is honored.
+    const TreeSupportMeshGroupSettings &mesh_group_settings = config.settings;
 
     // To ensure z_distance_top_layers are left empty between the overhang (zeroth empty layer), the support has to be added z_distance_top_layers+1 layers below
     const size_t z_distance_delta = config.z_distance_top_layers + 1;
@@ -3401,13 +3401,13 @@ extern bool g_showed_performance_warning;
  * \param storage The data storage where the mesh data is gotten from and
  * where the resulting support areas are stored.
  */
-static void generate_support_areas(Print &print, const BuildVolume &build_volume, const std::vector<size_t> &print_object_ids, std::function<void()> throw_on_cancel)
+static void generate_support_areas(Print &print, const BuildVolume &build_volume, const std::vector<size_t> &print_object_ids, TreeSupportQuality quality, std::function<void()> throw_on_cancel)
 {
     g_showed_critical_error = false;
     g_showed_performance_warning = false;
 
     // Settings with the indexes of meshes that use these settings.
-    std::vector<std::pair<TreeSupportSettings, std::vector<size_t>>> grouped_meshes = group_meshes(print, print_object_ids);
+    std::vector<std::pair<TreeSupportSettings, std::vector<size_t>>> grouped_meshes = group_meshes(print, print_object_ids, quality);
     if (grouped_meshes.empty())
         return;
 
@@ -3622,7 +3622,7 @@ static void generate_support_areas(Print &print, const BuildVolume &build_volume
 
 } // namespace FFFTreeSupport
 
-void fff_tree_support_generate(PrintObject &print_object, std::function<void()> throw_on_cancel)
+void fff_tree_support_generate(PrintObject &print_object, std::function<void()> throw_on_cancel, FFFTreeSupport::TreeSupportQuality quality)
 {
     size_t idx = 0;
     for (const PrintObject *po : print_object.print()->objects()) {
@@ -3630,9 +3630,9 @@ void fff_tree_support_generate(PrintObject &print_object, std::function<void()>
             break;
         ++idx;
     }
-    FFFTreeSupport::generate_support_areas(*print_object.print(), 
-        BuildVolume(Pointfs{ Vec2d{ -300., -300. }, Vec2d{ -300., +300. }, Vec2d{ +300., +300. }, Vec2d{ +300., -300. } }, 0.), { idx }, 
-        throw_on_cancel);
+    FFFTreeSupport::generate_support_areas(*print_object.print(),
+        BuildVolume(Pointfs{ Vec2d{ -300., -300. }, Vec2d{ -300., +300. }, Vec2d{ +300., +300. }, Vec2d{ +300., -300. } }, 0.), { idx },
+        quality, throw_on_cancel);
 }
 
 } // namespace Slic3r
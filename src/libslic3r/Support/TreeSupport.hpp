@@ -296,7 +296,10 @@ using SupportElements = std::deque<SupportElement>;
 
 } // namespace FFFTreeSupport
 
-void fff_tree_support_generate(PrintObject &print_object, std::function<void()> throw_on_cancel = []{});
+// Generate tree supports for the print object. Draft quality produces coarse supports quickly,
+// intended for previewing the support placement only, see FFFTreeSupport::TreeSupportQuality.
+void fff_tree_support_generate(PrintObject &print_object, std::function<void()> throw_on_cancel = []{},
+    FFFTreeSupport::TreeSupportQuality quality = FFFTreeSupport::TreeSupportQuality::Full);
 
 } // namespace Slic3r
 
@@ -14,7 +14,7 @@
 
 namespace Slic3r::FFFTreeSupport {
 
-TreeSupportMeshGroupSettings::TreeSupportMeshGroupSettings(const PrintObject &print_object)
+TreeSupportMeshGroupSettings::TreeSupportMeshGroupSettings(const PrintObject &print_object, TreeSupportQuality quality)
 {
     const PrintConfig       &print_config       = print_object.print()->config();
     const PrintObjectConfig &config             = print_object.config();
@@ -79,6 +79,19 @@ TreeSupportMeshGroupSettings::TreeSupportMeshGroupSettings(const PrintObject &pr
     this->support_tree_top_rate       = config.support_tree_top_rate.value; // percent
 //    this->support_tree_tip_diameter = this->support_line_width;
     this->support_tree_tip_diameter = std::clamp(scaled<coord_t>(config.support_tree_tip_diameter.value), 0, this->support_tree_branch_diameter);
+
+    if (quality == TreeSupportQuality::Draft) {
+        // Preview quality: The resolution drives the decimation of the layer outlines and of all derived
+        // collision / avoidance volumes, thus coarsening it speeds up the whole pipeline. The dense
+        // interfaces are skipped, the placement of the branches stays roughly the same.
+        this->resolution            *= 4;
+        this->support_roof_enable    = false;
+        this->support_roof_layers    = 0;
+        this->support_bottom_enable  = false;
+        this->support_bottom_height  = 0;
+        this->support_floor_enable   = false;
+        this->support_floor_layers   = 0;
+    }
 }
 
 TreeSupportSettings::TreeSupportSettings(const TreeSupportMeshGroupSettings &mesh_group_settings, const SlicingParameters &slicing_params)
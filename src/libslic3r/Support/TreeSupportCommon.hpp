@@ -38,9 +38,18 @@ enum class InterfacePreference
     Nothing
 };
 
+// Quality of the generated supports. Draft coarsens the resolution of the collision / avoidance
+// volumes and drops the dense interfaces, producing supports several times faster for previewing
+// where they will land. The final G-code shall always be produced with Full quality.
+enum class TreeSupportQuality
+{
+    Full,
+    Draft
+};
+
 struct TreeSupportMeshGroupSettings {
     TreeSupportMeshGroupSettings() = default;
-    explicit TreeSupportMeshGroupSettings(const PrintObject &print_object);
+    explicit TreeSupportMeshGroupSettings(const PrintObject &print_object, TreeSupportQuality quality = TreeSupportQuality::Full);
 
 /*********************************************************************/
 /* Print parameters, not support specific:                           */
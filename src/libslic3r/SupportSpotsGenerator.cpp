@@ -24,6 +24,7 @@
 #include "tbb/blocked_range.h"
 #include "tbb/blocked_range2d.h"
 #include "tbb/parallel_reduce.h"
+#include "tbb/task_group.h"
 #include <algorithm>
 #include <boost/log/trivial.hpp>
 #include <cmath>
@@ -273,17 +274,21 @@ PrecomputedSliceConnections precompute_slices_connections(const PrintObject *po)
     return result;
 };
 
-float get_flow_width(const LayerRegion *region, ExtrusionRole role)
+// Flows of a LayerRegion indexed by FlowRole, resolved once per layer region by LayerRegion::flows(),
+// so looking up the flow width per extrusion path does not re-resolve the flow configuration.
+using RegionFlows = std::array<Flow, num_region_flow_roles>;
+
+float get_flow_width(const RegionFlows &region_flows, ExtrusionRole role)
 {
-    if (role == ExtrusionRole::BridgeInfill) return region->flow(FlowRole::frExternalPerimeter).width();
-    if (role == ExtrusionRole::ExternalPerimeter) return region->flow(FlowRole::frExternalPerimeter).width();
-    if (role == ExtrusionRole::GapFill) return region->flow(FlowRole::frInfill).width();
-    if (role == ExtrusionRole::Perimeter) return region->flow(FlowRole::frPerimeter).width();
-    if (role == ExtrusionRole::SolidInfill) return region->flow(FlowRole::frSolidInfill).width();
-    if (role == ExtrusionRole::InternalInfill) return region->flow(FlowRole::frInfill).width();
-    if (role == ExtrusionRole::TopSolidInfill) return region->flow(FlowRole::frTopSolidInfill).width();
+    if (role == ExtrusionRole::BridgeInfill) return region_flows[FlowRole::frExternalPerimeter].width();
+    if (role == ExtrusionRole::ExternalPerimeter) return region_flows[FlowRole::frExternalPerimeter].width();
+    if (role == ExtrusionRole::GapFill) return region_flows[FlowRole::frInfill].width();
+    if (role == ExtrusionRole::Perimeter) return region_flows[FlowRole::frPerimeter].width();
+    if (role == ExtrusionRole::SolidInfill) return region_flows[FlowRole::frSolidInfill].width();
+    if (role == ExtrusionRole::InternalInfill) return region_flows[FlowRole::frInfill].width();
+    if (role == ExtrusionRole::TopSolidInfill) return region_flows[FlowRole::frTopSolidInfill].width();
     // default
-    return region->flow(FlowRole::frPerimeter).width();
+    return region_flows[FlowRole::frPerimeter].width();
 }
 
 float estimate_curled_up_height(
@@ -327,6 +332,7 @@ float estimate_curled_up_height(
 
 std::vector<ExtrusionLine> check_extrusion_entity_stability(const ExtrusionEntity                      *entity,
                                                             const LayerRegion                          *layer_region,
+                                                            const RegionFlows                          &region_flows,
                                                             const LD                                   &prev_layer_lines,
                                                             const AABBTreeLines::LinesDistancer<Linef> &prev_layer_boundary,
                                                             const Params                               &params)
@@ -337,7 +343,7 @@ std::vector<ExtrusionLine> check_extrusion_entity_stability(const ExtrusionEntit
         if (entity->length() < scale_(params.min_distance_to_allow_local_supports)) {
             return {};
         }
-        const float                                    flow_width = get_flow_width(layer_region, entity->role());
+        const float                                    flow_width = get_flow_width(region_flows, entity->role());
         std::vector<ExtrusionProcessor::ExtendedPoint> annotated_points =
             ExtrusionProcessor::estimate_points_properties<true, true, true, true>(entity->as_polyline().points, prev_layer_boundary,
                                                                                    flow_width, params.bridge_distance);
@@ -390,7 +396,7 @@ std::vector<ExtrusionLine> check_extrusion_entity_stability(const ExtrusionEntit
             return {};
         }
 
-        const float flow_width = get_flow_width(layer_region, entity->role());
+        const float flow_width = get_flow_width(region_flows, entity->role());
         // Compute only unsigned distance - prev_layer_lines can contain unconnected paths, thus the sign of the distance is unreliable
         std::vector<ExtrusionProcessor::ExtendedPoint> annotated_points =
             ExtrusionProcessor::estimate_points_properties<true, true, false, false>(entity->as_polyline().points, prev_layer_lines,
@@ -516,7 +522,7 @@ ObjectPart::ObjectPart(
             continue;
         }
 
-        for (const ExtrusionEntity* entity: collection->flatten()) {
+        for (const ExtrusionEntity* entity: collection->collect_entities()) {
             Polylines polylines;
             std::vector<float> widths;
 
@@ -941,9 +947,17 @@ LocalSupports compute_local_supports(
     AABBTreeLines::LinesDistancer<Linef> prev_layer_boundary_distancer =
         (previous_layer_boundary ? AABBTreeLines::LinesDistancer<Linef>{*previous_layer_boundary} : AABBTreeLines::LinesDistancer<Linef>{});
 
+    // Resolve the flows of the layer regions once, the stability checks below would otherwise
+    // resolve an identical flow for each extrusion entity processed.
+    std::unordered_map<const LayerRegion *, RegionFlows> flows_per_region;
+    for (const EnitityToCheck &e_to_check : entities_to_check)
+        if (auto it = flows_per_region.find(e_to_check.region); it == flows_per_region.end())
+            flows_per_region.emplace_hint(it, e_to_check.region, e_to_check.region->flows());
+
     if constexpr (debug_files) {
         for (const auto &e_to_check : entities_to_check) {
-            for (const auto &line : check_extrusion_entity_stability(e_to_check.e, e_to_check.region, prev_layer_ext_perim_lines,
+            for (const auto &line : check_extrusion_entity_stability(e_to_check.e, e_to_check.region,
+                                                                     flows_per_region.at(e_to_check.region), prev_layer_ext_perim_lines,
                                                                      prev_layer_boundary_distancer, params)) {
                 if (line.support_point_generated.has_value()) {
                     unstable_lines_per_slice[e_to_check.slice_idx].push_back(line);
@@ -955,12 +969,13 @@ LocalSupports compute_local_supports(
         }
     } else {
         tbb::parallel_for(tbb::blocked_range<size_t>(0, entities_to_check.size()),
-                          [&entities_to_check, &prev_layer_ext_perim_lines, &prev_layer_boundary_distancer, &unstable_lines_per_slice,
-                           &ext_perim_lines_per_slice, &params](tbb::blocked_range<size_t> r) {
+                          [&entities_to_check, &flows_per_region, &prev_layer_ext_perim_lines, &prev_layer_boundary_distancer,
+                           &unstable_lines_per_slice, &ext_perim_lines_per_slice, &params](tbb::blocked_range<size_t> r) {
                               for (size_t entity_idx = r.begin(); entity_idx < r.end(); ++entity_idx) {
                                   const auto &e_to_check = entities_to_check[entity_idx];
                                   for (const auto &line :
-                                       check_extrusion_entity_stability(e_to_check.e, e_to_check.region, prev_layer_ext_perim_lines,
+                                       check_extrusion_entity_stability(e_to_check.e, e_to_check.region,
+                                                                        flows_per_region.at(e_to_check.region), prev_layer_ext_perim_lines,
                                                                         prev_layer_boundary_distancer, params)) {
                                       if (line.support_point_generated.has_value()) {
                                           unstable_lines_per_slice[e_to_check.slice_idx].push_back(line);
@@ -1127,23 +1142,57 @@ std::tuple<SupportPoints, PartialObjects> check_stability(const PrintObject
 
     SliceMappings slice_mappings;
 
+    // Local supports of a layer depend only on the layer geometry and the external perimeter lines of the layer
+    // below, not on the serial stability bookkeeping. Detect the local supports of the next layer in the
+    // background while the current layer is being integrated into the object parts.
+    auto compute_layer_local_supports = [po, &params](size_t layer_idx, const LD &prev_lines) -> LocalSupports {
+        const Layer          *layer               = po->get_layer(layer_idx);
+        std::optional<Linesf> prev_layer_boundary = layer->lower_layer != nullptr ?
+                                                        std::optional{to_unscaled_linesf(layer->lower_layer->lslices)} :
+                                                        std::nullopt;
+        return compute_local_supports(gather_entities_to_check(layer), prev_layer_boundary, prev_lines, layer->lslices_ex.size(), params);
+    };
+
+    tbb::task_group prefetch_group;
+    LocalSupports   prefetched_local_supports;
+    bool            prefetch_running = false;
+    // Make sure the background task is finished before the task group is destructed, even when cancelled.
+    struct PrefetchGuard {
+        tbb::task_group &group;
+        ~PrefetchGuard() { try { group.wait(); } catch (...) {} }
+    } prefetch_guard{prefetch_group};
 
     for (size_t layer_idx = 0; layer_idx < po->layer_count(); ++layer_idx) {
+        LocalSupports local_supports;
+        if (prefetch_running) {
+            prefetch_group.wait();
+            prefetch_running = false;
+            local_supports   = std::move(prefetched_local_supports);
+        } else
+            local_supports = compute_layer_local_supports(layer_idx, prev_layer_ext_perim_lines);
         cancel_func();
+
         const Layer *layer                 = po->get_layer(layer_idx);
         float        bottom_z              = layer->bottom_z();
 
-        slice_mappings = update_active_object_parts(layer, params, precomputed_slices_connections[layer_idx], slice_mappings, active_object_parts, partial_objects);
-
-        std::optional<Linesf> prev_layer_boundary = layer->lower_layer != nullptr ?
-                                                        std::optional{to_unscaled_linesf(layer->lower_layer->lslices)} :
-                                                        std::nullopt;
-
-        LocalSupports local_supports{
-            compute_local_supports(gather_entities_to_check(layer), prev_layer_boundary, prev_layer_ext_perim_lines, layer->lslices_ex.size(), params)};
-
+        // Collect the external perimeter lines of this layer and hand them over to the background detection
+        // of the layer above before integrating this layer.
         std::vector<ExtrusionLine> current_layer_ext_perims_lines{};
         current_layer_ext_perims_lines.reserve(prev_layer_ext_perim_lines.get_lines().size());
+        for (size_t slice_idx = 0; slice_idx < layer->lslices_ex.size(); ++slice_idx) {
+            const tbb::concurrent_vector<ExtrusionLine> &external_perimeter_lines = local_supports.ext_perim_lines_per_slice[slice_idx];
+            current_layer_ext_perims_lines.insert(current_layer_ext_perims_lines.end(), external_perimeter_lines.begin(), external_perimeter_lines.end());
+        }
+        prev_layer_ext_perim_lines = LD(current_layer_ext_perims_lines);
+        if (layer_idx + 1 < po->layer_count()) {
+            prefetch_group.run([&compute_layer_local_supports, &prefetched_local_supports, &prev_layer_ext_perim_lines, next_layer_idx = layer_idx + 1] {
+                prefetched_local_supports = compute_layer_local_supports(next_layer_idx, prev_layer_ext_perim_lines);
+            });
+            prefetch_running = true;
+        }
+
+        slice_mappings = update_active_object_parts(layer, params, precomputed_slices_connections[layer_idx], slice_mappings, active_object_parts, partial_objects);
+
         // All object parts updated, and for each slice we have coresponding weakest connection.
         // We can now check each slice and its corresponding weakest connection and object part for stability.
         for (size_t slice_idx = 0; slice_idx < layer->lslices_ex.size(); ++slice_idx) {
@@ -1157,16 +1206,10 @@ std::tuple<SupportPoints, PartialObjects> check_stability(const PrintObject
                                                params.support_points_interface_radius};
                     reckon_new_support_point(part, weakest_conn, supp_points, supports_presence_grid, support_point);
                 }
-            }
 
-            const tbb::concurrent_vector<ExtrusionLine> &external_perimeter_lines = local_supports.ext_perim_lines_per_slice[slice_idx];
-            if (layer_idx > 1) {
-                reckon_global_supports(external_perimeter_lines, bottom_z, params, part, weakest_conn, supp_points, supports_presence_grid);
+                reckon_global_supports(local_supports.ext_perim_lines_per_slice[slice_idx], bottom_z, params, part, weakest_conn, supp_points, supports_presence_grid);
             }
-
-            current_layer_ext_perims_lines.insert(current_layer_ext_perims_lines.end(), external_perimeter_lines.begin(), external_perimeter_lines.end());
         } // slice iterations
-        prev_layer_ext_perim_lines = LD(current_layer_ext_perims_lines);
     } // layer iterations
 
     for (const auto& active_obj_pair : slice_mappings.index_to_object_part_mapping) {
@@ -1244,7 +1287,7 @@ void estimate_supports_malformations(SupportLayerPtrs &layers, float flow_width,
         l->curled_lines.clear();
         std::vector<ExtrusionLine> current_layer_lines;
 
-        for (const ExtrusionEntity *extrusion : l->support_fills.flatten().entities) {
+        for (const ExtrusionEntity *extrusion : l->support_fills.collect_entities()) {
             Polyline pl = extrusion->as_polyline();
             Polygon  pol(pl.points);
             pol.make_counter_clockwise();
@@ -1318,13 +1361,14 @@ void estimate_malformations(LayerPtrs &layers, const Params &params)
         AABBTreeLines::LinesDistancer<Linef> prev_layer_boundary{std::move(boundary_lines)};
         std::vector<ExtrusionLine>           current_layer_lines;
         for (const LayerRegion *layer_region : l->regions()) {
-            for (const ExtrusionEntity *extrusion : layer_region->perimeters().flatten().entities) {
+            const RegionFlows region_flows = layer_region->flows();
+            for (const ExtrusionEntity *extrusion : layer_region->perimeters().collect_entities()) {
                 if (!extrusion->role().is_external_perimeter())
                     continue;
 
                 Points extrusion_pts;
                 extrusion->collect_points(extrusion_pts);
-                float flow_width       = get_flow_width(layer_region, extrusion->role());
+                float flow_width       = get_flow_width(region_flows, extrusion->role());
                 auto  annotated_points = ExtrusionProcessor::estimate_points_properties<true, true, false, false>(extrusion_pts,
                                                                                                                  prev_layer_lines,
                                                                                                                  flow_width,
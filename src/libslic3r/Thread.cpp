@@ -11,12 +11,17 @@
 	#ifdef __APPLE__
 		#include <pthread/qos.h>
 	#endif // __APPLE__
+	#ifdef __linux__
+		#include <sched.h>
+	#endif // __linux__
 #endif
 
 #include <atomic>
 #include <condition_variable>
+#include <fstream>
 #include <mutex>
 #include <thread>
+#include <boost/log/trivial.hpp>
 #include <tbb/parallel_for.h>
 #include <tbb/task_arena.h>
 
@@ -195,6 +200,57 @@ std::optional<std::string> get_current_thread_name()
 
 #endif // _WIN32
 
+// Bind the calling thread to the processors of the given NUMA node. Threads spawned afterwards
+// (in particular the TBB worker pool) inherit the affinity mask, thus this has to be called before
+// the worker threads are spinned for the first time. With all workers running on a single node,
+// the first-touch policy of the operating system also allocates the large per-layer structures
+// in the memory attached to that node, as they are first written by the workers producing them.
+bool bind_to_numa_node(std::size_t numa_node)
+{
+#ifdef _WIN32
+	// Limited to the first processor group, thus to 64 logical processors.
+	ULONGLONG mask = 0;
+	if (! ::GetNumaNodeProcessorMask(UCHAR(numa_node), &mask) || mask == 0)
+		return false;
+	return ::SetProcessAffinityMask(::GetCurrentProcess(), DWORD_PTR(mask)) != 0;
+#elif defined(__linux__)
+	// Parse the kernel's list of logical processors of this node, for example "0-23,48-71".
+	std::ifstream cpulist("/sys/devices/system/node/node" + std::to_string(numa_node) + "/cpulist");
+	std::string   line;
+	if (! std::getline(cpulist, line) || line.empty())
+		return false;
+	cpu_set_t cpuset;
+	CPU_ZERO(&cpuset);
+	size_t num_cpus = 0;
+	const char *c = line.c_str();
+	while (*c != 0 && *c != '\n') {
+		char *end  = nullptr;
+		long  low  = strtol(c, &end, 10);
+		long  high = low;
+		if (end == c)
+			return false;
+		c = end;
+		if (*c == '-') {
+			high = strtol(++ c, &end, 10);
+			if (end == c)
+				return false;
+			c = end;
+		}
+		for (long cpu = low; cpu <= high; ++ cpu)
+			if (cpu >= 0 && cpu < CPU_SETSIZE) {
+				CPU_SET(cpu, &cpuset);
+				++ num_cpus;
+			}
+		if (*c == ',')
+			++ c;
+	}
+	return num_cpus > 0 && sched_setaffinity(0, sizeof(cpu_set_t), &cpuset) == 0;
+#else
+	// Not supported (macOS provides no thread to core binding API).
+	return false;
+#endif
+}
+
 // To be called at the start of the application to save the current thread ID as the main (UI) thread ID.
 static boost::thread::id g_main_thread_id;
 
@@ -230,6 +286,17 @@ void name_tbb_thread_pool_threads_set_locale()
 		return;
 	initialized = true;
 
+	if (numa_node) {
+		// Bind the process to the requested NUMA node before the TBB worker pool is spawned:
+		// TBB sizes the pool from and respects the affinity mask (see GH issue #5661), and the
+		// first-touch policy of the operating system then keeps the slicing data in the memory
+		// attached to that node.
+		if (bind_to_numa_node(*numa_node))
+			BOOST_LOG_TRIVIAL(info) << "Worker threads bound to NUMA node " << *numa_node;
+		else
+			BOOST_LOG_TRIVIAL(warning) << "Failed to bind worker threads to NUMA node " << *numa_node;
+	}
+
 	// see GH issue #5661 PrusaSlicer hangs on Linux when run with non standard task affinity
 	// TBB will respect the task affinity mask on Linux and spawn less threads than std::thread::hardware_concurrency().
 //	const size_t nthreads_hw = std::thread::hardware_concurrency();
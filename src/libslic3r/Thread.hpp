@@ -53,8 +53,17 @@ std::optional<std::string> get_current_thread_name();
 // To be called somewhere before the TBB threads are spinned for the first time, to
 // give them names recognizible in the debugger.
 // Also it sets locale of the worker threads to "C" for the G-code generator to produce "." as a decimal separator.
+// If Slic3r::numa_node is set (--numa-node on the command line), the worker threads are bound
+// to the processors of that NUMA node before they are spawned.
 void name_tbb_thread_pool_threads_set_locale();
 
+// Bind the calling thread and the threads it spawns later (in particular the TBB worker pool)
+// to the processors of the given NUMA node, to avoid cross-socket memory traffic during slicing
+// on multi-socket machines. To be called before the TBB worker threads are spinned for the first time.
+// Returns false if the platform does not support it or the node does not exist.
+// On Windows limited to the first processor group (64 logical processors), not supported on macOS.
+bool bind_to_numa_node(std::size_t numa_node);
+
 template<class Fn>
 inline boost::thread create_thread(boost::thread::attributes &attrs, Fn &&fn)
 {
@@ -0,0 +1,156 @@
+///|/ Copyright (c) Prusa Research 2026
+///|/
+///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
+///|/
+#include "Tracing.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include <boost/log/trivial.hpp>
+#include <boost/nowide/cstdlib.hpp>
+#include <boost/nowide/fstream.hpp>
+
+namespace Slic3r {
+
+namespace Tracing {
+
+namespace detail {
+
+std::atomic<bool> g_enabled { false };
+
+namespace {
+
+// Number of spans retained per thread. When the buffer overflows, the oldest
+// spans of that thread are overwritten, thus the dump always contains the most
+// recent history of every thread.
+constexpr size_t EventsPerThread = 16384;
+
+struct ThreadBuffer
+{
+    // Sequential ID assigned at registration, reported as "tid" in the dump.
+    size_t                thread_id { 0 };
+    // Total number of spans recorded by this thread. Slot of the next span
+    // is m_count % EventsPerThread. Stored with release ordering after the
+    // slot has been filled, so a concurrent dump sees completed slots.
+    std::atomic<uint64_t> count { 0 };
+    std::vector<Event>    events { EventsPerThread };
+
+    void push(const char *name, uint64_t start_ns, uint64_t duration_ns) {
+        uint64_t cnt = count.load(std::memory_order_relaxed);
+        events[cnt % EventsPerThread] = { name, start_ns, duration_ns };
+        count.store(cnt + 1, std::memory_order_release);
+    }
+};
+
+struct Registry
+{
+    std::mutex                mutex;
+    // Buffers are owned by the registry and never freed, so that spans of
+    // threads which already terminated are still part of the dump.
+    std::deque<ThreadBuffer>  buffers;
+
+    static Registry& get() {
+        static Registry instance;
+        return instance;
+    }
+
+    ThreadBuffer& register_thread() {
+        std::lock_guard<std::mutex> lock(mutex);
+        buffers.emplace_back();
+        buffers.back().thread_id = buffers.size();
+        return buffers.back();
+    }
+};
+
+ThreadBuffer& thread_buffer()
+{
+    static thread_local ThreadBuffer *buffer = &Registry::get().register_thread();
+    return *buffer;
+}
+
+// If the SLIC3R_TRACE environment variable is set to an output path, tracing is
+// enabled for the whole process run and the trace is saved to that path on exit.
+struct EnvironmentTrace
+{
+    EnvironmentTrace() {
+        if (const char *path = boost::nowide::getenv("SLIC3R_TRACE"); path != nullptr && *path != 0) {
+            m_path = path;
+            enable();
+        }
+    }
+    ~EnvironmentTrace() {
+        if (! m_path.empty())
+            save(m_path);
+    }
+    std::string m_path;
+};
+
+static EnvironmentTrace s_environment_trace;
+
+} // namespace
+
+void record(const char *name, uint64_t start_ns, uint64_t duration_ns)
+{
+    thread_buffer().push(name, start_ns, duration_ns);
+}
+
+} // namespace detail
+
+void enable()
+{
+    detail::g_enabled.store(true, std::memory_order_relaxed);
+}
+
+void disable()
+{
+    detail::g_enabled.store(false, std::memory_order_relaxed);
+}
+
+bool save(const std::string &path)
+{
+    using detail::Event;
+
+    boost::nowide::ofstream out(path.c_str(), std::ios::binary | std::ios::trunc);
+    if (! out.good()) {
+        BOOST_LOG_TRIVIAL(error) << "Tracing: Cannot open trace output file " << path;
+        return false;
+    }
+
+    auto &registry = detail::Registry::get();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    // Threads recording while the dump runs may overwrite the oldest slots of
+    // their live buffers. Such a span may come out garbled, which is acceptable
+    // for a profiling aid; dumps are expected to be taken when slicing finished.
+    out << "{\"traceEvents\":[";
+    size_t emitted = 0;
+    for (auto &buffer : registry.buffers) {
+        const uint64_t count = buffer.count.load(std::memory_order_acquire);
+        const uint64_t n     = std::min<uint64_t>(count, buffer.events.size());
+        for (uint64_t i = count - n; i < count; ++ i) {
+            const Event &evt = buffer.events[i % buffer.events.size()];
+            if (evt.name == nullptr)
+                continue;
+            if (emitted ++ > 0)
+                out << ",";
+            out << "\n{\"name\":\"" << evt.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer.thread_id
+                << ",\"ts\":" << (evt.start_ns / 1000) << ",\"dur\":" << (evt.duration_ns / 1000) << "}";
+        }
+    }
+    out << "\n]}\n";
+
+    if (! out.good()) {
+        BOOST_LOG_TRIVIAL(error) << "Tracing: Failed writing trace output file " << path;
+        return false;
+    }
+    BOOST_LOG_TRIVIAL(info) << "Tracing: Saved " << emitted << " spans to " << path;
+    return true;
+}
+
+} // namespace Tracing
+
+} // namespace Slic3r
@@ -0,0 +1,92 @@
+///|/ Copyright (c) Prusa Research 2026
+///|/
+///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
+///|/
+#ifndef libslic3r_Tracing_hpp_
+#define libslic3r_Tracing_hpp_
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+namespace Slic3r {
+
+// Lightweight always-compiled-in tracing profiler.
+//
+// Scoped spans (see Tracing::Span below) are recorded into per-thread ring buffers.
+// Recording is lock free and costs two clock reads and a couple of relaxed atomic
+// operations per span, nothing at all when tracing is disabled, thus the permanent
+// annotations in the slicing pipeline are safe to ship in release builds.
+//
+// Tracing is armed either programmatically with Tracing::enable() / Tracing::save(),
+// or externally by setting the SLIC3R_TRACE environment variable to an output path:
+// the trace of the whole process run is then written to that path on exit, so a
+// customer-reported slow model can be profiled without a rebuild.
+//
+// The dump is a Chrome trace_event JSON file ("complete" events with per-thread
+// timelines), loadable by chrome://tracing or https://ui.perfetto.dev. Nesting of
+// spans is reconstructed by the viewer from the time stamps.
+namespace Tracing {
+
+namespace detail {
+
+struct Event
+{
+    // Name of the span, must point to a string with static storage duration.
+    const char *name;
+    uint64_t    start_ns;
+    uint64_t    duration_ns;
+};
+
+extern std::atomic<bool> g_enabled;
+
+// Records a finished span into the ring buffer of the calling thread.
+void record(const char *name, uint64_t start_ns, uint64_t duration_ns);
+
+inline uint64_t now_ns()
+{
+    return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+} // namespace detail
+
+inline bool enabled() { return detail::g_enabled.load(std::memory_order_relaxed); }
+
+// Start / stop recording of spans. Enabling tracing does not clear spans recorded before.
+void enable();
+void disable();
+
+// Write all spans recorded so far into a Chrome trace_event JSON file.
+// Returns false and logs an error if the file cannot be written.
+bool save(const std::string &path);
+
+// Scoped span: records the life time of this object under the given name.
+// The name must be a string literal or otherwise outlive the tracing registry.
+class Span
+{
+public:
+    explicit Span(const char *name) {
+        if (enabled()) {
+            m_name  = name;
+            m_start = detail::now_ns();
+        }
+    }
+    ~Span() {
+        if (m_name != nullptr)
+            detail::record(m_name, m_start, detail::now_ns() - m_start);
+    }
+
+    Span(const Span &) = delete;
+    Span& operator=(const Span &) = delete;
+
+private:
+    const char *m_name  { nullptr };
+    uint64_t    m_start { 0 };
+};
+
+} // namespace Tracing
+
+} // namespace Slic3r
+
+#endif // libslic3r_Tracing_hpp_
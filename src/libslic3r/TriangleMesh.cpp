@@ -21,6 +21,7 @@
 #include "Geometry.hpp"
 #include "Geometry/ConvexHull.hpp"
 #include "Point.hpp"
+#include "RadixSort.hpp"
 #include "Execution/ExecutionTBB.hpp"
 #include "Execution/ExecutionSeq.hpp"
 #include "Utils.hpp"
@@ -222,6 +223,7 @@ bool TriangleMesh::ReadSTLFile(const char* input_file, bool repair)
     m_stats.number_of_parts         = stl.stats.number_of_parts;
 
     stl_generate_shared_vertices(&stl, this->its);
+    m_face_neighbors.reset();
     return true;
 }
 
@@ -336,6 +338,7 @@ void TriangleMesh::mirror(const Axis axis)
         return;
     };
     its_flip_triangles(this->its);
+    m_face_neighbors.reset();
     int iaxis = int(axis);
     std::swap(m_stats.min[iaxis], m_stats.max[iaxis]);
     m_stats.min[iaxis] *= -1.0;
@@ -348,6 +351,7 @@ void TriangleMesh::transform(const Transform3d& t, bool fix_left_handed)
     double det = t.matrix().block(0, 0, 3, 3).determinant();
     if (fix_left_handed && det < 0.) {
         its_flip_triangles(its);
+        m_face_neighbors.reset();
         det = -det;
     }
     m_stats.volume *= det;
@@ -360,6 +364,7 @@ void TriangleMesh::transform(const Matrix3d& m, bool fix_left_handed)
     double det = m.block(0, 0, 3, 3).determinant();
     if (fix_left_handed && det < 0.) {
         its_flip_triangles(its);
+        m_face_neighbors.reset();
         det = -det;
     }
     m_stats.volume *= det;
@@ -369,6 +374,7 @@ void TriangleMesh::transform(const Matrix3d& m, bool fix_left_handed)
 void TriangleMesh::flip_triangles()
 {
     its_flip_triangles(its);
+    m_face_neighbors.reset();
     m_stats.volume = - m_stats.volume;
 }
 
@@ -422,9 +428,32 @@ std::vector<TriangleMesh> TriangleMesh::split() const
 void TriangleMesh::merge(const TriangleMesh &mesh)
 {
     its_merge(this->its, mesh.its);
+    m_face_neighbors.reset();
     m_stats = m_stats.merge(mesh.m_stats);
 }
 
+std::shared_ptr<const std::vector<Vec3i>> TriangleMesh::face_neighbors() const
+{
+    std::shared_ptr<const std::vector<Vec3i>> index = std::atomic_load(&m_face_neighbors);
+    if (index == nullptr) {
+        index = std::make_shared<const std::vector<Vec3i>>(its_face_neighbors_par(this->its));
+        // Another thread may have stored its own table in the meanwhile, the results are identical.
+        std::atomic_store(&m_face_neighbors, index);
+    }
+    return index;
+}
+
+size_t TriangleMesh::release_optional()
+{
+    size_t memsize = 0;
+    if (m_face_neighbors != nullptr) {
+        if (m_face_neighbors.use_count() == 1)
+            memsize = m_face_neighbors->capacity() * sizeof(Vec3i);
+        m_face_neighbors.reset();
+    }
+    return memsize;
+}
+
 // Calculate projection of the mesh into the XY plane, in scaled coordinates.
 //FIXME This could be extremely slow! Use it for tiny meshes only!
 ExPolygons TriangleMesh::horizontal_projection() const
@@ -571,7 +600,11 @@ static std::vector<EdgeToFace> create_edge_map(
                 }
             }
     throw_on_cancel();
-    std::sort(edges_map.begin(), edges_map.end());
+    // Sort the edges lexicographically by their vertex pair, bringing the edges shared by
+    // neighboring faces together. The vertex indices are non-negative, thus the pair packs
+    // into a 64 bit radix sort key.
+    radix_sort_by_key64(edges_map, [](const EdgeToFace &e2f) {
+        return (uint64_t(uint32_t(e2f.vertex_low)) << 32) | uint64_t(uint32_t(e2f.vertex_high)); });
 
     return edges_map;
 }
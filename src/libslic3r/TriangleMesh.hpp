@@ -15,6 +15,7 @@
 #include "libslic3r.h"
 #include <admesh/stl.h>
 #include <functional>
+#include <memory>
 #include <vector>
 #include "BoundingBox.hpp"
 #include "Line.hpp"
@@ -103,7 +104,7 @@ public:
     TriangleMesh(std::vector<Vec3f> &&vertices, const std::vector<Vec3i> &&faces);
     explicit TriangleMesh(const indexed_triangle_set &M);
     explicit TriangleMesh(indexed_triangle_set &&M, const RepairedMeshErrors& repaired_errors = RepairedMeshErrors());
-    void clear() { this->its.clear(); m_stats.clear(); }
+    void clear() { this->its.clear(); m_stats.clear(); m_face_neighbors.reset(); }
     bool ReadSTLFile(const char* input_file, bool repair = true);
     bool write_ascii(const char* output_file);
     bool write_binary(const char* output_file);
@@ -154,18 +155,29 @@ public:
     // Estimate of the memory occupied by this structure, important for keeping an eye on the Undo / Redo stack allocation.
     size_t memsize() const;
 
-    // Used by the Undo / Redo stack, legacy interface. As of now there is nothing cached at TriangleMesh,
-    // but we may decide to cache some data in the future (for example normals), thus we keep the interface in place.
+    // Neighbor topology index: for each face the three faces sharing its edges in the edge order
+    // of the face, -1 if there is no neighbor at an edge. Computed in parallel on first use and
+    // cached. The cache is shared between copies of this TriangleMesh and released by the methods
+    // modifying the triangle indices, thus the returned table shall stay valid as long as the
+    // caller holds the returned shared pointer. May be called from multiple threads.
+    std::shared_ptr<const std::vector<Vec3i>> face_neighbors() const;
+
+    // Used by the Undo / Redo stack, legacy interface.
     // Release optional data from the mesh if the object is on the Undo / Redo stack only. Returns the amount of memory released.
-    size_t release_optional() { return 0; }
+    size_t release_optional();
     // Restore optional data possibly released by release_optional().
+    // The neighbor topology cache is recalculated lazily by face_neighbors(), thus nothing to do.
     void   restore_optional() {}
 
     const TriangleMeshStats& stats() const { return m_stats; }
-    
+
     indexed_triangle_set its;
 
 private:
+    // Lazily computed neighbor topology of this->its, shared between copies of this TriangleMesh.
+    // Accessed atomically by face_neighbors(), reset by the methods modifying this->its.indices.
+    mutable std::shared_ptr<const std::vector<Vec3i>> m_face_neighbors;
+
     TriangleMeshStats m_stats;
 };
 
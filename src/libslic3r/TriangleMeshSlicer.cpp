@@ -3,8 +3,10 @@
 ///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
 ///|/
 #include "ClipperUtils.hpp"
+#include "Execution/GrainCalibration.hpp"
 #include "Geometry.hpp"
 #include "Tesselate.hpp"
+#include "Tracing.hpp"
 #include "TriangleMesh.hpp"
 #include "TriangleMeshSlicer.hpp"
 #include "Utils.hpp"
@@ -381,41 +383,6 @@ private:
     std::array<CacheLineAlignedMutex, 64> m_mutexes;
 };
 
-template<typename TransformVertex>
-void slice_facet_at_zs(
-    // Scaled or unscaled vertices. transform_vertex_fn may scale zs.
-    const std::vector<Vec3f>                         &mesh_vertices,
-    const TransformVertex                            &transform_vertex_fn,
-    const stl_triangle_vertex_indices                &indices,
-    const Vec3i                                      &edge_ids,
-    // Scaled or unscaled zs. If vertices have their zs scaled or transform_vertex_fn scales them, then zs have to be scaled as well.
-    const std::vector<float>                         &zs,
-    std::vector<IntersectionLines>                   &lines,
-    LinesMutexes                                     &lines_mutex)
-{
-    stl_vertex vertices[3] { transform_vertex_fn(mesh_vertices[indices(0)]), transform_vertex_fn(mesh_vertices[indices(1)]), transform_vertex_fn(mesh_vertices[indices(2)]) };
-
-    // find facet extents
-    const float min_z = fminf(vertices[0].z(), fminf(vertices[1].z(), vertices[2].z()));
-    const float max_z = fmaxf(vertices[0].z(), fmaxf(vertices[1].z(), vertices[2].z()));
-    
-    // find layer extents
-    auto min_layer = std::lower_bound(zs.begin(), zs.end(), min_z); // first layer whose slice_z is >= min_z
-    auto max_layer = std::upper_bound(min_layer, zs.end(), max_z); // first layer whose slice_z is > max_z
-    int  idx_vertex_lowest = (vertices[1].z() == min_z) ? 1 : ((vertices[2].z() == min_z) ? 2 : 0);
-    
-    for (auto it = min_layer; it != max_layer; ++ it) {
-        IntersectionLine il;
-        // Ignore horizontal triangles. Any valid horizontal triangle must have a vertical triangle connected, otherwise the part has zero volume.
-        if (min_z != max_z && slice_facet(*it, vertices, indices, edge_ids, idx_vertex_lowest, false, il) == FacetSliceType::Slicing) {
-            assert(il.edge_type != IntersectionLine::FacetEdgeType::Horizontal);
-            size_t slice_id = it - zs.begin();
-            boost::lock_guard<std::mutex> l(lines_mutex(slice_id));
-            lines[slice_id].emplace_back(il);
-        }
-    }
-}
-
 template<typename TransformVertex, typename ThrowOnCancel>
 static inline std::vector<IntersectionLines> slice_make_lines(
     const std::vector<stl_vertex>                   &vertices,
@@ -427,13 +394,51 @@ static inline std::vector<IntersectionLines> slice_make_lines(
 {
     std::vector<IntersectionLines>  lines(zs.size(), IntersectionLines{});
     LinesMutexes                    lines_mutex;
+
+    // Transform the Z coordinate of each vertex just once into a flat buffer. Without the buffer each vertex
+    // would be transformed once for every facet sharing it, and the min / max reduction below would be interleaved
+    // with the scalar line construction code, defeating vectorization of this hot loop.
+    std::vector<float> zs_vertices(vertices.size());
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, vertices.size(), execution::calibrated_granularity(execution::CalibratedKernel::Geometry, 4096)),
+        [&vertices, &transform_vertex_fn, &zs_vertices](const tbb::blocked_range<size_t> &range) {
+            for (size_t i = range.begin(); i < range.end(); ++ i)
+                zs_vertices[i] = transform_vertex_fn(vertices[i]).z();
+        });
+
     tbb::parallel_for(
         tbb::blocked_range<int>(0, int(indices.size())),
-        [&vertices, &transform_vertex_fn, &indices, &face_edge_ids, &zs, &lines, &lines_mutex, throw_on_cancel_fn](const tbb::blocked_range<int> &range) {
+        [&vertices, &transform_vertex_fn, &indices, &face_edge_ids, &zs, &zs_vertices, &lines, &lines_mutex, throw_on_cancel_fn](const tbb::blocked_range<int> &range) {
             for (int face_idx = range.begin(); face_idx < range.end(); ++ face_idx) {
                 if ((face_idx & 0x0ffff) == 0)
                     throw_on_cancel_fn();
-                slice_facet_at_zs(vertices, transform_vertex_fn, indices[face_idx], face_edge_ids[face_idx], zs, lines, lines_mutex);
+                // Gather the precomputed facet extents. This cheap batch test rejects the facets not intersecting
+                // any slicing plane (and the horizontal facets, see below) before their vertices are fully transformed.
+                const stl_triangle_vertex_indices &face = indices[face_idx];
+                const float z0    = zs_vertices[face(0)];
+                const float z1    = zs_vertices[face(1)];
+                const float z2    = zs_vertices[face(2)];
+                const float min_z = fminf(z0, fminf(z1, z2));
+                const float max_z = fmaxf(z0, fmaxf(z1, z2));
+                // Ignore horizontal triangles. Any valid horizontal triangle must have a vertical triangle connected, otherwise the part has zero volume.
+                if (min_z == max_z)
+                    continue;
+                // find layer extents
+                auto min_layer = std::lower_bound(zs.begin(), zs.end(), min_z); // first layer whose slice_z is >= min_z
+                if (min_layer == zs.end() || *min_layer > max_z)
+                    continue;
+                auto max_layer = std::upper_bound(min_layer, zs.end(), max_z); // first layer whose slice_z is > max_z
+                stl_vertex tri[3] { transform_vertex_fn(vertices[face(0)]), transform_vertex_fn(vertices[face(1)]), transform_vertex_fn(vertices[face(2)]) };
+                const int idx_vertex_lowest = (z1 == min_z) ? 1 : ((z2 == min_z) ? 2 : 0);
+                for (auto it = min_layer; it != max_layer; ++ it) {
+                    IntersectionLine il;
+                    if (slice_facet(*it, tri, face, face_edge_ids[face_idx], idx_vertex_lowest, false, il) == FacetSliceType::Slicing) {
+                        assert(il.edge_type != IntersectionLine::FacetEdgeType::Horizontal);
+                        size_t slice_id = it - zs.begin();
+                        boost::lock_guard<std::mutex> l(lines_mutex(slice_id));
+                        lines[slice_id].emplace_back(il);
+                    }
+                }
             }
         }
     );
@@ -1770,15 +1775,72 @@ static std::vector<stl_vertex> transform_mesh_vertices_for_slicing(const indexed
     return out;
 }
 
+void MeshSlicingSession::clear()
+{
+    m_face_edge_ids.clear();
+    m_face_edge_ids_valid = false;
+    m_face_neighbors.clear();
+    m_face_neighbors_valid = false;
+    m_face_edge_ids_slabs.clear();
+    m_num_edges_slabs = -1;
+    m_vertices_transformed.clear();
+    m_vertices_trafo = Transform3d::Identity();
+    m_vertices_valid = false;
+}
+
+const std::vector<Vec3i>& MeshSlicingSession::face_edge_ids(const indexed_triangle_set &mesh)
+{
+    if (! m_face_edge_ids_valid) {
+        m_face_edge_ids = its_face_edge_ids(mesh);
+        m_face_edge_ids_valid = true;
+    }
+    assert(m_face_edge_ids.size() == mesh.indices.size());
+    return m_face_edge_ids;
+}
+
+const std::vector<Vec3i>& MeshSlicingSession::face_neighbors(const indexed_triangle_set &mesh)
+{
+    if (! m_face_neighbors_valid) {
+        m_face_neighbors = its_face_neighbors_par(mesh);
+        m_face_neighbors_valid = true;
+    }
+    assert(m_face_neighbors.size() == mesh.indices.size());
+    return m_face_neighbors;
+}
+
+const std::vector<Vec3i>& MeshSlicingSession::face_edge_ids_slabs(const indexed_triangle_set &mesh, int &num_edges)
+{
+    if (m_num_edges_slabs < 0) {
+        this->face_neighbors(mesh);
+        m_face_edge_ids_slabs = its_face_edge_ids(mesh, m_face_neighbors, true, &m_num_edges_slabs);
+    }
+    assert(m_face_edge_ids_slabs.size() == mesh.indices.size());
+    num_edges = m_num_edges_slabs;
+    return m_face_edge_ids_slabs;
+}
+
+const std::vector<Vec3f>& MeshSlicingSession::vertices_transformed(const indexed_triangle_set &mesh, const Transform3d &trafo)
+{
+    if (! m_vertices_valid || m_vertices_trafo.matrix() != trafo.matrix()) {
+        m_vertices_transformed = transform_mesh_vertices_for_slicing(mesh, trafo);
+        m_vertices_trafo       = trafo;
+        m_vertices_valid       = true;
+    }
+    assert(m_vertices_transformed.size() == mesh.vertices.size());
+    return m_vertices_transformed;
+}
+
 std::vector<Polygons> slice_mesh(
     const indexed_triangle_set       &mesh,
     // Unscaled Zs
     const std::vector<float>         &zs,
     const MeshSlicingParams          &params,
+    MeshSlicingSession               &session,
     std::function<void()>             throw_on_cancel)
 {
     BOOST_LOG_TRIVIAL(debug) << "slice_mesh to polygons";
-       
+    Tracing::Span span("slice_mesh");
+
     std::vector<IntersectionLines> lines;
 
     {
@@ -1786,12 +1848,12 @@ std::vector<Polygons> slice_mesh(
         // Instead of edge identifiers, one shall use a sorted pair of edge vertex indices.
         // However facets_edges assigns a single edge ID to two triangles only, thus when factoring facets_edges out, one will have
         // to make sure that no code relies on it.
-        std::vector<Vec3i> face_edge_ids = its_face_edge_ids(mesh);
+        const std::vector<Vec3i> &face_edge_ids = session.face_edge_ids(mesh);
         if (zs.size() <= 1) {
             // It likely is not worthwile to copy the vertices. Apply the transformation in place.
             if (is_identity(params.trafo)) {
                 lines = slice_make_lines(
-                    mesh.vertices, [](const Vec3f &p) { return Vec3f(scaled<float>(p.x()), scaled<float>(p.y()), p.z()); }, 
+                    mesh.vertices, [](const Vec3f &p) { return Vec3f(scaled<float>(p.x()), scaled<float>(p.y()), p.z()); },
                     mesh.indices, face_edge_ids, zs, throw_on_cancel);
             } else {
                 // Transform the vertices, scale up in XY, not in Z.
@@ -1801,7 +1863,7 @@ std::vector<Polygons> slice_mesh(
         } else {
             // Copy and scale vertices in XY, don't scale in Z. Possibly apply the transformation.
             lines = slice_make_lines(
-                transform_mesh_vertices_for_slicing(mesh, params.trafo), 
+                session.vertices_transformed(mesh, params.trafo),
                 [](const Vec3f &p) { return p; },  mesh.indices, face_edge_ids, zs, throw_on_cancel);
         }
     }
@@ -1846,6 +1908,77 @@ std::vector<Polygons> slice_mesh(
     return layers;
 }
 
+std::vector<Polygons> slice_mesh(
+    const indexed_triangle_set       &mesh,
+    // Unscaled Zs
+    const std::vector<float>         &zs,
+    const MeshSlicingParams          &params,
+    std::function<void()>             throw_on_cancel)
+{
+    MeshSlicingSession session;
+    return slice_mesh(mesh, zs, params, session, throw_on_cancel);
+}
+
+std::vector<Polygons> slice_mesh(
+    const indexed_triangle_set       &mesh,
+    // Unscaled Zs
+    const std::vector<float>         &zs,
+    const MeshSlicingParams          &params,
+    const ObjectID                   &mesh_id,
+    MeshSlicingCache                 &cache,
+    std::function<void()>             throw_on_cancel)
+{
+    if (mesh_id.invalid() || params.slicing_mode_normal_below_layer != 0)
+        // Without a valid mesh identity there is nothing to key the cache with.
+        // With slicing_mode_normal_below_layer active the slicing mode is a function of the layer index,
+        // not of the slicing plane, thus the layers cannot be keyed by Z.
+        return slice_mesh(mesh, zs, params, throw_on_cancel);
+
+    if (cache.m_mesh_id != mesh_id || cache.m_mode != params.mode || cache.m_trafo.matrix() != params.trafo.matrix()) {
+        // The connectivity tables of the session only depend on the mesh, thus they survive
+        // a change of the slicing transformation or mode.
+        if (cache.m_mesh_id != mesh_id)
+            cache.m_session.clear();
+        cache.m_layers.clear();
+        cache.m_mesh_id = mesh_id;
+        cache.m_trafo   = params.trafo;
+        cache.m_mode    = params.mode;
+    }
+
+    // Split the requested planes into those stored in the cache and those that need to be sliced.
+    // Both zs and the cached layers are sorted by Z, thus a single linear merge pass suffices.
+    std::vector<Polygons> layers(zs.size(), Polygons{});
+    std::vector<char>     cached(zs.size(), 0);
+    std::vector<float>    zs_missing;
+    auto it_cached = cache.m_layers.begin();
+    for (size_t i = 0; i < zs.size(); ++ i) {
+        it_cached = std::lower_bound(it_cached, cache.m_layers.end(), zs[i],
+            [](const std::pair<float, Polygons> &l, float z) { return l.first < z; });
+        if (it_cached != cache.m_layers.end() && it_cached->first == zs[i]) {
+            layers[i] = it_cached->second;
+            cached[i] = 1;
+        } else
+            zs_missing.emplace_back(zs[i]);
+    }
+
+    if (! zs_missing.empty()) {
+        std::vector<Polygons> layers_missing = slice_mesh(mesh, zs_missing, params, cache.m_session, throw_on_cancel);
+        for (size_t i = 0, j = 0; i < zs.size(); ++ i)
+            if (! cached[i])
+                layers[i] = std::move(layers_missing[j ++]);
+        BOOST_LOG_TRIVIAL(debug) << "slice_mesh cached: " << zs_missing.size() << " of " << zs.size() << " layers sliced, the rest reused";
+    }
+
+    // Replace the cache content with the planes of the current slicing session to bound the cache memory footprint.
+    std::vector<std::pair<float, Polygons>> layers_cached;
+    layers_cached.reserve(zs.size());
+    for (size_t i = 0; i < zs.size(); ++ i)
+        layers_cached.emplace_back(zs[i], layers[i]);
+    cache.m_layers = std::move(layers_cached);
+
+    return layers;
+}
+
 // Specialized version for a single slicing plane only, running on a single thread.
 Polygons slice_mesh(
     const indexed_triangle_set       &mesh,
@@ -1909,22 +2042,24 @@ Polygons slice_mesh(
     return layers.front();
 }
 
-std::vector<ExPolygons> slice_mesh_ex(
-    const indexed_triangle_set       &mesh,
-    const std::vector<float>         &zs,
+// Strip the modes not supported by the raw polygon slicing from MeshSlicingParamsEx.
+static inline MeshSlicingParams slicing_params_for_expolygons(const MeshSlicingParamsEx &params)
+{
+    MeshSlicingParams slicing_params(params);
+    if (params.mode == MeshSlicingParams::SlicingMode::PositiveLargestContour)
+        slicing_params.mode = MeshSlicingParams::SlicingMode::Positive;
+    if (params.mode_below == MeshSlicingParams::SlicingMode::PositiveLargestContour)
+        slicing_params.mode_below = MeshSlicingParams::SlicingMode::Positive;
+    return slicing_params;
+}
+
+// Convert the raw slice contours into ExPolygons, applying the morphological post-processing
+// controlled by MeshSlicingParamsEx. Shared by the cached and the uncached slice_mesh_ex().
+static std::vector<ExPolygons> make_expolygons_layers(
+    const std::vector<Polygons>      &layers_p,
     const MeshSlicingParamsEx        &params,
     std::function<void()>             throw_on_cancel)
 {
-    std::vector<Polygons> layers_p;
-    {
-        MeshSlicingParams slicing_params(params);
-        if (params.mode == MeshSlicingParams::SlicingMode::PositiveLargestContour)
-            slicing_params.mode = MeshSlicingParams::SlicingMode::Positive;
-        if (params.mode_below == MeshSlicingParams::SlicingMode::PositiveLargestContour)
-            slicing_params.mode_below = MeshSlicingParams::SlicingMode::Positive;
-        layers_p = slice_mesh(mesh, zs, slicing_params, throw_on_cancel);
-    }
-    
 //    BOOST_LOG_TRIVIAL(debug) << "slice_mesh make_expolygons in parallel - start";
     std::vector<ExPolygons> layers(layers_p.size(), ExPolygons{});
     tbb::parallel_for(
@@ -1971,6 +2106,9 @@ std::vector<ExPolygons> slice_mesh_ex(
                         append(simplified, ex.simplify(resolution));
                     expolygons = std::move(simplified);
                 }
+                // The layer is final, drop the spare capacity left over by the incremental
+                // growth of the Clipper outputs above.
+                expolygons.shrink_to_fit();
 #if 0
 //#ifndef NDEBUG
                 for (const ExPolygon &ex : expolygons) {
@@ -1988,6 +2126,26 @@ std::vector<ExPolygons> slice_mesh_ex(
     return layers;
 }
 
+std::vector<ExPolygons> slice_mesh_ex(
+    const indexed_triangle_set       &mesh,
+    const std::vector<float>         &zs,
+    const MeshSlicingParamsEx        &params,
+    std::function<void()>             throw_on_cancel)
+{
+    return make_expolygons_layers(slice_mesh(mesh, zs, slicing_params_for_expolygons(params), throw_on_cancel), params, throw_on_cancel);
+}
+
+std::vector<ExPolygons> slice_mesh_ex(
+    const indexed_triangle_set       &mesh,
+    const std::vector<float>         &zs,
+    const MeshSlicingParamsEx        &params,
+    const ObjectID                   &mesh_id,
+    MeshSlicingCache                 &cache,
+    std::function<void()>             throw_on_cancel)
+{
+    return make_expolygons_layers(slice_mesh(mesh, zs, slicing_params_for_expolygons(params), mesh_id, cache, throw_on_cancel), params, throw_on_cancel);
+}
+
 // Slice a triangle set with a set of Z slabs (thick layers).
 // The effect is similar to producing the usual top / bottom layers from a sliced mesh by 
 // subtracting layer[i] from layer[i - 1] for the top surfaces resp.
@@ -2001,6 +2159,7 @@ void slice_mesh_slabs(
     const Transform3d                &trafo,
     std::vector<Polygons>            *out_top,
     std::vector<Polygons>            *out_bottom,
+    MeshSlicingSession               &session,
     std::function<void()>             throw_on_cancel)
 {
     BOOST_LOG_TRIVIAL(debug) << "slice_mesh_slabs to polygons";
@@ -2049,7 +2208,7 @@ void slice_mesh_slabs(
     }
 #endif // EXPENSIVE_DEBUG_CHECKS
 
-    std::vector<stl_vertex> vertices_transformed = transform_mesh_vertices_for_slicing(mesh, trafo);
+    const std::vector<stl_vertex> &vertices_transformed = session.vertices_transformed(mesh, trafo);
     const auto mirrored_sign = int64_t(trafo.matrix().block(0, 0, 3, 3).determinant() < 0 ? -1 : 1);
 
     std::vector<FaceOrientation> face_orientation(mesh.indices.size(), FaceOrientation::Up);
@@ -2075,9 +2234,9 @@ void slice_mesh_slabs(
         face_orientation[&tri - mesh.indices.data()] = fo;
     }
 
-    std::vector<Vec3i> face_neighbors = its_face_neighbors_par(mesh);
-    int                num_edges;
-    std::vector<Vec3i> face_edge_ids  = its_face_edge_ids(mesh, face_neighbors, true, &num_edges);
+    const std::vector<Vec3i> &face_neighbors = session.face_neighbors(mesh);
+    int                       num_edges;
+    const std::vector<Vec3i> &face_edge_ids  = session.face_edge_ids_slabs(mesh, num_edges);
     std::pair<SlabLines, SlabLines> lines = slice_slabs_make_lines(
         vertices_transformed, mesh.indices, face_neighbors, face_edge_ids, num_edges, face_orientation, zs, 
         out_top != nullptr, out_bottom != nullptr, throw_on_cancel);
@@ -2090,6 +2249,19 @@ void slice_mesh_slabs(
         *out_bottom = make_slab_loops<false>(lines.second, num_edges, throw_on_cancel);
 }
 
+void slice_mesh_slabs(
+    const indexed_triangle_set       &mesh,
+    // Unscaled Zs
+    const std::vector<float>         &zs,
+    const Transform3d                &trafo,
+    std::vector<Polygons>            *out_top,
+    std::vector<Polygons>            *out_bottom,
+    std::function<void()>             throw_on_cancel)
+{
+    MeshSlicingSession session;
+    slice_mesh_slabs(mesh, zs, trafo, out_top, out_bottom, session, throw_on_cancel);
+}
+
 // Remove duplicates of slice_vertices, optionally triangulate the cut.
 static void triangulate_slice(
     indexed_triangle_set    &its, 
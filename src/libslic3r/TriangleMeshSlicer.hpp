@@ -6,7 +6,9 @@
 #define slic3r_TriangleMeshSlicer_hpp_
 
 #include <functional>
+#include <utility>
 #include <vector>
+#include "ObjectID.hpp"
 #include "Polygon.hpp"
 #include "ExPolygon.hpp"
 
@@ -50,6 +52,68 @@ struct MeshSlicingParamsEx : public MeshSlicingParams
     double        resolution { 0 };
 };
 
+// Lazily calculated connectivity tables of a single mesh, shared by the slicing functions below.
+// When the same mesh is sliced repeatedly (for example an incremental re-slice through MeshSlicingCache,
+// or slice_mesh() followed by slice_mesh_slabs()), the tables are calculated just once and served
+// to all the slicing calls. The session does not store the mesh, the caller is responsible for passing
+// the same mesh to all accessors and for clearing the session when switching to another mesh.
+// A session instance shall not be shared by concurrently running slicing sessions.
+class MeshSlicingSession
+{
+public:
+    MeshSlicingSession() = default;
+    void clear();
+
+    // Edge identifiers of mesh faces, the variant consumed by slice_mesh().
+    const std::vector<Vec3i>& face_edge_ids(const indexed_triangle_set &mesh);
+    // Face neighbor table consumed by slice_mesh_slabs().
+    const std::vector<Vec3i>& face_neighbors(const indexed_triangle_set &mesh);
+    // Edge identifiers derived from the face neighbor table, consumed by slice_mesh_slabs().
+    // The identifiers are assigned differently from face_edge_ids(), thus the two tables are cached separately.
+    const std::vector<Vec3i>& face_edge_ids_slabs(const indexed_triangle_set &mesh, int &num_edges);
+    // Mesh vertices transformed for slicing: scaled in XY, not in Z. Cached for a single transformation only.
+    const std::vector<Vec3f>& vertices_transformed(const indexed_triangle_set &mesh, const Transform3d &trafo);
+
+private:
+    std::vector<Vec3i>  m_face_edge_ids;
+    bool                m_face_edge_ids_valid { false };
+    std::vector<Vec3i>  m_face_neighbors;
+    bool                m_face_neighbors_valid { false };
+    std::vector<Vec3i>  m_face_edge_ids_slabs;
+    // Number of edges of m_face_edge_ids_slabs, -1 if not calculated yet.
+    int                 m_num_edges_slabs { -1 };
+    std::vector<Vec3f>  m_vertices_transformed;
+    Transform3d         m_vertices_trafo { Transform3d::Identity() };
+    bool                m_vertices_valid { false };
+};
+
+// Optional cache for incremental re-slicing of the same mesh.
+// The cache is keyed by the mesh ObjectID, the slicing transformation and the slicing mode,
+// per-layer contours are stored by their slicing plane Z. When the same mesh is sliced again
+// with a modified set of slicing planes (for example after a layer height tweak), only the planes
+// not found in the cache are sliced, the rest is reused.
+// A cache instance shall not be shared by concurrently running slicing sessions.
+class MeshSlicingCache
+{
+public:
+    MeshSlicingCache() = default;
+    void clear() { m_mesh_id = ObjectID(); m_layers.clear(); m_session.clear(); }
+
+private:
+    friend std::vector<Polygons> slice_mesh(
+        const indexed_triangle_set &mesh, const std::vector<float> &zs, const MeshSlicingParams &params,
+        const ObjectID &mesh_id, MeshSlicingCache &cache, std::function<void()> throw_on_cancel);
+
+    // Identity of the cached slicing session. Invalid mesh_id means the cache is empty.
+    ObjectID                        m_mesh_id;
+    Transform3d                     m_trafo { Transform3d::Identity() };
+    MeshSlicingParams::SlicingMode  m_mode { MeshSlicingParams::SlicingMode::Regular };
+    // Contours of the cached slices, sorted by the slicing plane Z.
+    std::vector<std::pair<float, Polygons>> m_layers;
+    // Connectivity tables of the cached mesh, shared by the slicing calls of the incremental re-slices.
+    MeshSlicingSession              m_session;
+};
+
 // All the following slicing functions shall produce consistent results with the same mesh, same transformation matrix and slicing parameters.
 // Namely, slice_mesh_slabs() shall produce consistent results with slice_mesh() and slice_mesh_ex() in the sense, that projections made by 
 // slice_mesh_slabs() shall fall onto slicing planes produced by slice_mesh().
@@ -67,6 +131,25 @@ std::vector<Polygons>           slice_mesh(
     const MeshSlicingParams          &params,
     std::function<void()>             throw_on_cancel = []{});
 
+// Variant reusing the mesh connectivity tables of a session shared with other slicing calls on the same mesh.
+std::vector<Polygons>           slice_mesh(
+    const indexed_triangle_set       &mesh,
+    const std::vector<float>         &zs,
+    const MeshSlicingParams          &params,
+    MeshSlicingSession               &session,
+    std::function<void()>             throw_on_cancel = []{});
+
+// Incremental version: slicing planes already stored in the cache for this (mesh_id, params.trafo, params.mode)
+// are reused, only the missing planes are sliced. Falls back to the uncached path for an invalid mesh_id
+// or when params.slicing_mode_normal_below_layer is active (the mode is then keyed by the layer index, not by Z).
+std::vector<Polygons>           slice_mesh(
+    const indexed_triangle_set       &mesh,
+    const std::vector<float>         &zs,
+    const MeshSlicingParams          &params,
+    const ObjectID                   &mesh_id,
+    MeshSlicingCache                 &cache,
+    std::function<void()>             throw_on_cancel = []{});
+
 // Specialized version for a single slicing plane only, running on a single thread.
 Polygons                        slice_mesh(
     const indexed_triangle_set       &mesh,
@@ -79,6 +162,16 @@ std::vector<ExPolygons>         slice_mesh_ex(
     const MeshSlicingParamsEx        &params,
     std::function<void()>             throw_on_cancel = []{});
 
+// Incremental version, see the cached slice_mesh() overload. The cache stores the raw slice contours,
+// the morphological post-processing controlled by MeshSlicingParamsEx is reapplied to cached layers as well.
+std::vector<ExPolygons>         slice_mesh_ex(
+    const indexed_triangle_set       &mesh,
+    const std::vector<float>         &zs,
+    const MeshSlicingParamsEx        &params,
+    const ObjectID                   &mesh_id,
+    MeshSlicingCache                 &cache,
+    std::function<void()>             throw_on_cancel = []{});
+
 inline std::vector<ExPolygons>  slice_mesh_ex(
     const indexed_triangle_set       &mesh,
     const std::vector<float>         &zs,
@@ -113,6 +206,17 @@ void slice_mesh_slabs(
     std::vector<Polygons>            *out_bottom,
     std::function<void()>             throw_on_cancel);
 
+// Variant reusing the mesh connectivity tables of a session shared with other slicing calls on the same mesh.
+void slice_mesh_slabs(
+    const indexed_triangle_set       &mesh,
+    // Unscaled Zs
+    const std::vector<float>         &zs,
+    const Transform3d                &trafo,
+    std::vector<Polygons>            *out_top,
+    std::vector<Polygons>            *out_bottom,
+    MeshSlicingSession               &session,
+    std::function<void()>             throw_on_cancel);
+
 // Project mesh upwards pointing surfaces / downwards pointing surfaces into 2D polygons.
 void project_mesh(
     const indexed_triangle_set       &mesh,
@@ -258,22 +258,23 @@ void TriangleSelector::select_patch(int facet_start, std::unique_ptr<Cursor> &&c
     facets_to_check.reserve(16);
     facets_to_check.emplace_back(facet_start);
     // Keep track of facets of the original mesh we already processed.
-    std::vector<bool> visited(m_orig_size_indices, false);
+    this->begin_visit_round(m_orig_size_indices);
     // Breadth-first search around the hit point. facets_to_check may grow significantly large.
     // Head of the bread-first facets_to_check FIFO.
     int facet_idx = 0;
     while (facet_idx < int(facets_to_check.size())) {
         int          facet        = facets_to_check[facet_idx];
         const Vec3f &facet_normal = m_face_normals[m_triangles[facet].source_triangle];
-        if (!visited[facet] && (highlight_by_angle_deg == 0.f || vec_down.dot(facet_normal) >= highlight_angle_limit)) {
+        if (!this->is_visited(facet) && (highlight_by_angle_deg == 0.f || vec_down.dot(facet_normal) >= highlight_angle_limit)) {
             if (select_triangle(facet, new_state, triangle_splitting)) {
+                this->mark_serialized_dirty(facet);
                 // add neighboring facets to list to be processed later
                 for (int neighbor_idx : m_neighbors[facet])
                     if (neighbor_idx >= 0 && m_cursor->is_facet_visible(neighbor_idx, m_face_normals))
                         facets_to_check.push_back(neighbor_idx);
             }
         }
-        visited[facet] = true;
+        this->mark_visited(facet);
         ++facet_idx;
     }
 }
@@ -299,7 +300,7 @@ void TriangleSelector::seed_fill_select_triangles(const Vec3f &hit, int facet_st
 
     this->seed_fill_unselect_all_triangles();
 
-    std::vector<bool> visited(m_triangles.size(), false);
+    this->begin_visit_round(m_triangles.size());
     std::queue<int>   facet_queue;
     facet_queue.push(facet_start);
 
@@ -313,12 +314,12 @@ void TriangleSelector::seed_fill_select_triangles(const Vec3f &hit, int facet_st
         facet_queue.pop();
 
         const Vec3f &facet_normal = m_face_normals[m_triangles[current_facet].source_triangle];
-        if (!visited[current_facet] && (highlight_by_angle_deg == 0.f || vec_down.dot(facet_normal) >= highlight_angle_limit)) {
+        if (!this->is_visited(current_facet) && (highlight_by_angle_deg == 0.f || vec_down.dot(facet_normal) >= highlight_angle_limit)) {
             if (m_triangles[current_facet].is_split()) {
                 for (int split_triangle_idx = 0; split_triangle_idx <= m_triangles[current_facet].number_of_split_sides(); ++split_triangle_idx) {
                     assert(split_triangle_idx < int(m_triangles[current_facet].children.size()));
                     assert(m_triangles[current_facet].children[split_triangle_idx] < int(m_triangles.size()));
-                    if (int child = m_triangles[current_facet].children[split_triangle_idx]; !visited[child])
+                    if (int child = m_triangles[current_facet].children[split_triangle_idx]; !this->is_visited(child))
                         // Child triangle shares normal with its parent. Select it.
                         facet_queue.push(child);
                 }
@@ -329,7 +330,7 @@ void TriangleSelector::seed_fill_select_triangles(const Vec3f &hit, int facet_st
                 // Propagate over the original triangles.
                 for (int neighbor_idx : m_neighbors[current_facet]) {
                     assert(neighbor_idx >= -1);
-                    if (neighbor_idx >= 0 && !visited[neighbor_idx] && !is_facet_clipped(neighbor_idx, clp)) {
+                    if (neighbor_idx >= 0 && !this->is_visited(neighbor_idx) && !is_facet_clipped(neighbor_idx, clp)) {
                         // Check if neighbour_facet_idx is satisfies angle in seed_fill_angle and append it to facet_queue if it do.
                         const Vec3f &n1 = m_face_normals[m_triangles[neighbor_idx].source_triangle];
                         const Vec3f &n2 = m_face_normals[m_triangles[current_facet].source_triangle];
@@ -338,7 +339,7 @@ void TriangleSelector::seed_fill_select_triangles(const Vec3f &hit, int facet_st
                     }
                 }
         }
-        visited[current_facet] = true;
+        this->mark_visited(current_facet);
     }
 }
 
@@ -480,7 +481,7 @@ void TriangleSelector::bucket_fill_select_triangles(const Vec3f& hit, int facet_
     };
 
     auto [neighbors, neighbors_propagated] = this->precompute_all_neighbors();
-    std::vector<bool>  visited(m_triangles.size(), false);
+    this->begin_visit_round(m_triangles.size());
     std::queue<int>    facet_queue;
 
     facet_queue.push(start_facet_idx);
@@ -489,12 +490,12 @@ void TriangleSelector::bucket_fill_select_triangles(const Vec3f& hit, int facet_
         facet_queue.pop();
         assert(!m_triangles[current_facet].is_split());
 
-        if (!visited[current_facet]) {
+        if (!this->is_visited(current_facet)) {
             m_triangles[current_facet].select_by_seed_fill();
 
             std::vector<int> touching_triangles = get_all_touching_triangles(current_facet, neighbors[current_facet], neighbors_propagated[current_facet]);
             for(const int tr_idx : touching_triangles) {
-                if (tr_idx < 0 || visited[tr_idx] || m_triangles[tr_idx].get_state() != start_facet_state || is_facet_clipped(tr_idx, clp))
+                if (tr_idx < 0 || this->is_visited(tr_idx) || m_triangles[tr_idx].get_state() != start_facet_state || is_facet_clipped(tr_idx, clp))
                     continue;
 
                 assert(!m_triangles[tr_idx].is_split());
@@ -502,7 +503,7 @@ void TriangleSelector::bucket_fill_select_triangles(const Vec3f& hit, int facet_
             }
         }
 
-        visited[current_facet] = true;
+        this->mark_visited(current_facet);
     }
 }
 
@@ -917,6 +918,42 @@ void TriangleSelector::set_facet(int facet_idx, TriangleStateType state) {
     undivide_triangle(facet_idx);
     assert(! m_triangles[facet_idx].is_split());
     m_triangles[facet_idx].set_state(state);
+    this->mark_serialized_dirty(facet_idx);
+}
+
+void TriangleSelector::begin_visit_round(size_t num_triangles)
+{
+    ++ m_visit_generation;
+    if (m_visit_generation == 0) {
+        // The generation counter wrapped around, invalidate all stale marks.
+        std::fill(m_visited.begin(), m_visited.end(), 0u);
+        m_visit_generation = 1;
+    }
+    if (m_visited.size() < num_triangles)
+        m_visited.resize(num_triangles, 0u);
+}
+
+void TriangleSelector::mark_serialized_dirty(int source_facet_idx)
+{
+    assert(source_facet_idx < m_orig_size_indices);
+    if (! m_serialized_cache_valid)
+        // There is nothing to update incrementally, the next serialize() will encode everything anyway.
+        return;
+    if (int(m_serialized_dirty.size()) < m_orig_size_indices)
+        m_serialized_dirty.resize(m_orig_size_indices, false);
+    if (! m_serialized_dirty[source_facet_idx]) {
+        m_serialized_dirty[source_facet_idx] = true;
+        m_serialized_dirty_list.emplace_back(source_facet_idx);
+    }
+}
+
+void TriangleSelector::invalidate_serialized_cache()
+{
+    m_serialized_cache_valid = false;
+    m_serialized_cache = TriangleSplittingData();
+    for (int facet_idx : m_serialized_dirty_list)
+        m_serialized_dirty[facet_idx] = false;
+    m_serialized_dirty_list.clear();
 }
 
 // called by select_patch()->select_triangle()...select_triangle()
@@ -1184,7 +1221,7 @@ void TriangleSelector::garbage_collect()
 }
 
 TriangleSelector::TriangleSelector(const TriangleMesh& mesh)
-    : m_mesh{mesh}, m_neighbors(its_face_neighbors(mesh.its)), m_face_normals(its_face_normals(mesh.its))
+    : m_mesh{mesh}, m_neighbors_ptr(mesh.face_neighbors()), m_neighbors(*m_neighbors_ptr), m_face_normals(its_face_normals(mesh.its))
 {
     reset();
 }
@@ -1207,6 +1244,7 @@ void TriangleSelector::reset()
     m_orig_size_vertices = int(m_vertices.size());
     m_orig_size_indices  = int(m_triangles.size());
 
+    this->invalidate_serialized_cache();
 }
 
 void TriangleSelector::set_edge_limit(float edge_limit)
@@ -1533,7 +1571,7 @@ TriangleSelector::TriangleSplittingData TriangleSelector::serialize() const {
     // (std::function calls using a pointer, while this implementation calls directly).
     struct Serializer {
         const TriangleSelector* triangle_selector;
-        TriangleSplittingData data;
+        TriangleSplittingData &data;
 
         void serialize(int facet_idx) {
             const Triangle& tr = triangle_selector->m_triangles[facet_idx];
@@ -1580,26 +1618,80 @@ TriangleSelector::TriangleSplittingData TriangleSelector::serialize() const {
                 }
             }
         }
-    } out { this };
+    };
+
+    TriangleSplittingData data;
+    Serializer out { this, data };
 
-    out.data.triangles_to_split.reserve(m_orig_size_indices);
-    for (int i=0; i<m_orig_size_indices; ++i)
+    // Serialize a single source mesh triangle if it carries any state worth storing.
+    auto serialize_source_triangle = [this, &out, &data](int i) {
         if (const Triangle& tr = m_triangles[i]; tr.is_split() || tr.get_state() != TriangleStateType::NONE) {
             // Store index of the first bit assigned to ith triangle.
-            out.data.triangles_to_split.emplace_back(i, int(out.data.bitstream.size()));
+            data.triangles_to_split.emplace_back(i, int(data.bitstream.size()));
             // out the triangle bits.
             out.serialize(i);
         }
+    };
+
+    if (m_serialized_cache_valid) {
+        // Incremental path: the painting gizmos serialize the complete selection state after
+        // every brush stroke. Re-encode only the subtrees of the source triangles modified
+        // since the previous call and copy the bit spans of the unmodified ones verbatim,
+        // instead of re-walking all triangles of the mesh.
+        std::sort(m_serialized_dirty_list.begin(), m_serialized_dirty_list.end());
+        const TriangleSplittingData &cached = m_serialized_cache;
+        data.triangles_to_split.reserve(cached.triangles_to_split.size() + m_serialized_dirty_list.size());
+        data.bitstream.reserve(cached.bitstream.size());
+        auto dirty_it = m_serialized_dirty_list.begin();
+        for (size_t entry_idx = 0; entry_idx < cached.triangles_to_split.size(); ++ entry_idx) {
+            const TriangleBitStreamMapping &entry = cached.triangles_to_split[entry_idx];
+            // Emit modified triangles preceding the cached entry.
+            for (; dirty_it != m_serialized_dirty_list.end() && *dirty_it < entry.triangle_idx; ++ dirty_it)
+                serialize_source_triangle(*dirty_it);
+            if (dirty_it != m_serialized_dirty_list.end() && *dirty_it == entry.triangle_idx) {
+                serialize_source_triangle(*dirty_it);
+                ++ dirty_it;
+            } else {
+                // Unmodified since the last serialization, copy the cached bit span.
+                auto span_begin = cached.bitstream.begin() + entry.bitstream_start_idx;
+                auto span_end   = entry_idx + 1 < cached.triangles_to_split.size() ?
+                    cached.bitstream.begin() + cached.triangles_to_split[entry_idx + 1].bitstream_start_idx : cached.bitstream.end();
+                data.triangles_to_split.emplace_back(entry.triangle_idx, int(data.bitstream.size()));
+                data.bitstream.insert(data.bitstream.end(), span_begin, span_end);
+            }
+        }
+        // Emit modified triangles past the last cached entry.
+        for (; dirty_it != m_serialized_dirty_list.end(); ++ dirty_it)
+            serialize_source_triangle(*dirty_it);
+        // The states used by the copied bit spans were not visited by the Serializer,
+        // recompute the used states from the complete bitstream.
+        data.reset_used_states();
+        if (! data.bitstream.empty())
+            data.update_used_states(0);
+    } else {
+        data.triangles_to_split.reserve(m_orig_size_indices);
+        for (int i=0; i<m_orig_size_indices; ++i)
+            serialize_source_triangle(i);
+    }
 
     // May be stored onto Undo / Redo stack, thus conserve memory.
-    out.data.triangles_to_split.shrink_to_fit();
-    out.data.bitstream.shrink_to_fit();
-    return out.data;
+    data.triangles_to_split.shrink_to_fit();
+    data.bitstream.shrink_to_fit();
+
+    // Remember the result to serve as the base of the next incremental serialization.
+    for (int facet_idx : m_serialized_dirty_list)
+        m_serialized_dirty[facet_idx] = false;
+    m_serialized_dirty_list.clear();
+    m_serialized_cache       = data;
+    m_serialized_cache_valid = true;
+    return data;
 }
 
 void TriangleSelector::deserialize(const TriangleSplittingData &data, bool needs_reset) {
     if (needs_reset)
         reset(); // dump any current state
+    else
+        this->invalidate_serialized_cache();
 
     // Reserve number of triangles as if each triangle was saved with 4 bits.
     // With MMU painting this estimate may be somehow low, but better than nothing.
@@ -1790,8 +1882,10 @@ void TriangleSelector::seed_fill_unselect_all_triangles()
 
 void TriangleSelector::seed_fill_apply_on_triangles(TriangleStateType new_state) {
     for (Triangle &triangle : m_triangles)
-        if (!triangle.is_split() && triangle.is_selected_by_seed_fill())
+        if (!triangle.is_split() && triangle.is_selected_by_seed_fill()) {
             triangle.set_state(new_state);
+            this->mark_serialized_dirty(triangle.source_triangle);
+        }
 
     for (Triangle &triangle : m_triangles)
         if (triangle.is_split() && triangle.valid()) {
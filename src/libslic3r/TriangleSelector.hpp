@@ -400,7 +400,9 @@ protected:
     std::vector<Vertex> m_vertices;
     std::vector<Triangle> m_triangles;
     const TriangleMesh &m_mesh;
-    const std::vector<Vec3i> m_neighbors;
+    // Neighbor topology of m_mesh, shared with the mesh by TriangleMesh::face_neighbors().
+    const std::shared_ptr<const std::vector<Vec3i>> m_neighbors_ptr;
+    const std::vector<Vec3i> &m_neighbors;
     const std::vector<Vec3f> m_face_normals;
 
     // Number of invalid triangles (to trigger garbage collection).
@@ -417,8 +419,32 @@ protected:
     // Zero indicates an uninitialized state.
     float m_old_cursor_radius_sqr = 0;
 
+    // Visited marks for the flood-fill traversals in select_patch(), seed_fill_select_triangles()
+    // and bucket_fill_select_triangles(). The buffer is kept persistent and the marks are tagged
+    // by a generation counter, so a brush stroke does not allocate and clear a buffer
+    // proportional to the mesh size for every sampled cursor position.
+    std::vector<unsigned int> m_visited;
+    unsigned int              m_visit_generation = 0;
+
+    // Result of the last serialize() call together with dirty marks at the granularity of the
+    // source mesh triangles, allowing serialize() to re-encode the modified subtrees only
+    // and to copy the bitstream of the unmodified ones. The painting gizmos serialize
+    // the complete selection state after every brush stroke.
+    mutable TriangleSplittingData m_serialized_cache;
+    mutable bool                  m_serialized_cache_valid = false;
+    mutable std::vector<bool>     m_serialized_dirty;
+    mutable std::vector<int>      m_serialized_dirty_list;
+
     // Private functions:
 private:
+    // Start a new flood-fill traversal round covering num_triangles triangles.
+    void begin_visit_round(size_t num_triangles);
+    bool is_visited(int facet_idx) const { return m_visited[facet_idx] == m_visit_generation; }
+    void mark_visited(int facet_idx) { m_visited[facet_idx] = m_visit_generation; }
+    // Mark the subtree of a source mesh triangle as modified since the last serialize() call.
+    void mark_serialized_dirty(int source_facet_idx);
+    // Drop the cached serialization result, called when the selection state is rebuilt from scratch.
+    void invalidate_serialized_cache();
     bool select_triangle(int facet_idx, TriangleStateType type, bool triangle_splitting);
     bool select_triangle_recursive(int facet_idx, const Vec3i &neighbors, TriangleStateType type, bool triangle_splitting);
     void undivide_triangle(int facet_idx);
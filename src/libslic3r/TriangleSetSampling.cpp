@@ -3,7 +3,7 @@
 ///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
 ///|/
 #include "TriangleSetSampling.hpp"
-#include <map>
+#include <algorithm>
 #include <random>
 #include <tbb/parallel_for.h>
 #include <tbb/blocked_range.h>
@@ -26,11 +26,13 @@ TriangleSetSamples sample_its_uniform_parallel(size_t samples_count, const index
                 }
             });
 
-    std::map<double, size_t> area_sum_to_triangle_idx;
+    // Inclusive prefix sum of triangle areas. A flat array is searched by the sampling loop
+    // below with a cache friendly binary search instead of hopping over tree nodes.
+    std::vector<double> area_cumsum(triangles_area.size());
     float area_sum = 0;
     for (size_t t_idx = 0; t_idx < triangles_area.size(); ++t_idx) {
         area_sum += triangles_area[t_idx];
-        area_sum_to_triangle_idx[area_sum] = t_idx;
+        area_cumsum[t_idx] = area_sum;
     }
 
     std::mt19937_64 mersenne_engine { 27644437 };
@@ -52,11 +54,13 @@ TriangleSetSamples sample_its_uniform_parallel(size_t samples_count, const index
     result.triangle_indices.resize(samples_count);
 
     tbb::parallel_for(tbb::blocked_range<size_t>(0, samples_count),
-            [&triangle_set, &area_sum_to_triangle_idx, &area_sum, &random_samples, &result](
+            [&triangle_set, &area_cumsum, &area_sum, &random_samples, &result](
                     tbb::blocked_range<size_t> r) {
                 for (size_t s_idx = r.begin(); s_idx < r.end(); ++s_idx) {
                     double t_sample = random_samples[s_idx].x() * area_sum;
-                    size_t t_idx = area_sum_to_triangle_idx.upper_bound(t_sample)->second;
+                    size_t t_idx = std::min<size_t>(
+                        std::upper_bound(area_cumsum.begin(), area_cumsum.end(), t_sample) - area_cumsum.begin(),
+                        area_cumsum.size() - 1);
 
                     double sq_u = std::sqrt(random_samples[s_idx].y());
                     double v = random_samples[s_idx].z();
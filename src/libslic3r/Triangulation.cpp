@@ -8,6 +8,7 @@
 #include <CGAL/Constrained_Delaunay_triangulation_2.h>
 #include <CGAL/Triangulation_vertex_base_with_info_2.h>
 #include <CGAL/spatial_sort.h>
+#include <tbb/parallel_for.h>
 
 using namespace Slic3r;
 namespace priv{
@@ -268,6 +269,46 @@ Triangulation::Indices Triangulation::triangulate(const ExPolygons &expolygons,
     // when contain duplicit coordinate in points will not work properly
     assert(collect_duplicates(points).empty());
 
+    if (expolygons.size() > 1) {
+        // Expolygons are independent islands: constraints never cross from one to
+        // another, so each may be fed to its own constrained Delaunay triangulation
+        // and processed in parallel. Local triangle indices are shifted to the
+        // expolygon's offset within the concatenated points afterwards.
+        std::vector<size_t> offsets;
+        offsets.reserve(expolygons.size() + 1);
+        offsets.emplace_back(0);
+        for (const ExPolygon &expolygon : expolygons)
+            offsets.emplace_back(offsets.back() + count_points(expolygon));
+        std::vector<Indices> indices_per_expolygon(expolygons.size());
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, expolygons.size()),
+            [&expolygons, &points, &offsets, &indices_per_expolygon](const tbb::blocked_range<size_t> &range) {
+                for (size_t i = range.begin(); i < range.end(); ++ i) {
+                    const ExPolygon &expolygon = expolygons[i];
+                    Points local_points(points.begin() + offsets[i], points.begin() + offsets[i + 1]);
+                    HalfEdges edges;
+                    edges.reserve(local_points.size());
+                    uint32_t offset = 0;
+                    priv::insert_edges(edges, offset, expolygon.contour);
+                    for (const Polygon &hole : expolygon.holes)
+                        priv::insert_edges(edges, offset, hole);
+                    std::sort(edges.begin(), edges.end());
+                    Indices &indices = indices_per_expolygon[i];
+                    indices = triangulate(local_points, edges);
+                    const int index_offset = int(offsets[i]);
+                    for (Vec3i &t : indices)
+                        t += Vec3i(index_offset, index_offset, index_offset);
+                }
+            });
+        size_t count = 0;
+        for (const Indices &indices : indices_per_expolygon)
+            count += indices.size();
+        Indices merged;
+        merged.reserve(count);
+        for (const Indices &indices : indices_per_expolygon)
+            Slic3r::append(merged, indices);
+        return merged;
+    }
+
     HalfEdges edges;
     edges.reserve(points.size());
     uint32_t offset = 0;
@@ -22,6 +22,10 @@ namespace boost { namespace filesystem { class directory_entry; }}
 namespace Slic3r {
 
 inline std::optional<std::size_t> thread_count;
+// NUMA node to bind the TBB worker threads to, see bind_to_numa_node() in Thread.hpp.
+inline std::optional<std::size_t> numa_node;
+// Memory budget in MB for the slicing process, see LayerDataSpill.hpp. Zero or unset disables spilling.
+inline std::optional<std::size_t> memory_budget;
 extern void set_logging_level(unsigned int level);
 extern unsigned get_logging_level();
 // Format memory allocated, separate thousands by comma.
@@ -34,6 +38,8 @@ extern std::string log_memory_info(bool ignore_loglevel = false);
 extern void enforce_thread_count(std::size_t count);
 // Returns the size of physical memory (RAM) in bytes.
 extern size_t total_physical_memory();
+// Returns the resident set size of this process in bytes, zero if not supported on this platform.
+extern size_t resident_memory();
 
 // Set a path with GUI resource files.
 void set_var_dir(const std::string &path);
@@ -2,6 +2,7 @@
 ///|/
 ///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
 ///|/
+#include <cctype>
 #include <exception>
 
 #include "Exception.hpp"
@@ -18,6 +19,38 @@
 
 namespace Slic3r {
 
+namespace {
+
+mz_uint to_mz_compression(Zipper::e_compression compression)
+{
+    switch (compression) {
+    case Zipper::NO_COMPRESSION: return MZ_NO_COMPRESSION;
+    case Zipper::FAST_COMPRESSION: return MZ_BEST_SPEED;
+    case Zipper::TIGHT_COMPRESSION: return MZ_BEST_COMPRESSION;
+    }
+    return MZ_NO_COMPRESSION;
+}
+
+// Entries holding an already compressed payload are stored as is, deflating
+// them again costs a full pass over the data for sub-percent gains. This is
+// where the bulk of an SLA or project archive spends its time: the layer and
+// thumbnail images.
+bool is_precompressed_entry(const std::string &name)
+{
+    size_t dot = name.find_last_of('.');
+    if (dot == std::string::npos)
+        return false;
+
+    std::string ext = name.substr(dot + 1);
+    for (char &c : ext)
+        c = char(std::tolower(c));
+
+    return ext == "png" || ext == "jpg" || ext == "jpeg" || ext == "qoi" ||
+           ext == "zip" || ext == "gz";
+}
+
+} // namespace
+
 class Zipper::Impl: public MZ_Archive {
 public:
     std::string m_zipname;
@@ -93,18 +126,20 @@ void Zipper::add_entry(const std::string &name)
 }
 
 void Zipper::add_entry(const std::string &name, const void *data, size_t l)
+{
+    add_entry(name, data, l,
+              is_precompressed_entry(name) ? NO_COMPRESSION : m_compression);
+}
+
+void Zipper::add_entry(const std::string &name, const void *data, size_t l,
+                       e_compression compression)
 {
     if(!m_impl->is_alive()) return;
 
     finish_entry();
-    mz_uint cmpr = MZ_NO_COMPRESSION;
-    switch (m_compression) {
-    case NO_COMPRESSION: cmpr = MZ_NO_COMPRESSION; break;
-    case FAST_COMPRESSION: cmpr = MZ_BEST_SPEED; break;
-    case TIGHT_COMPRESSION: cmpr = MZ_BEST_COMPRESSION; break;
-    }
 
-    if(!mz_zip_writer_add_mem(&m_impl->arch, name.c_str(), data, l, cmpr))
+    if(!mz_zip_writer_add_mem(&m_impl->arch, name.c_str(), data, l,
+                              to_mz_compression(compression)))
         m_impl->blow_up();
 
     m_entry.clear();
@@ -116,13 +151,8 @@ void Zipper::finish_entry()
     if(!m_impl->is_alive()) return;
 
     if(!m_data.empty() && !m_entry.empty()) {
-        mz_uint compression = MZ_NO_COMPRESSION;
-
-        switch (m_compression) {
-        case NO_COMPRESSION: compression = MZ_NO_COMPRESSION; break;
-        case FAST_COMPRESSION: compression = MZ_BEST_SPEED; break;
-        case TIGHT_COMPRESSION: compression = MZ_BEST_COMPRESSION; break;
-        }
+        mz_uint compression = is_precompressed_entry(m_entry) ?
+            MZ_NO_COMPRESSION : to_mz_compression(m_compression);
 
         if(!mz_zip_writer_add_mem(&m_impl->arch, m_entry.c_str(),
                                   m_data.c_str(),
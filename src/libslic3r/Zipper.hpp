@@ -53,8 +53,16 @@ public:
 
     /// Add a new binary file entry with an instantly given byte buffer.
     /// This method throws exactly like finish_entry() does.
+    /// Entries with an already compressed payload (recognized by the file
+    /// name extension, e.g. png) are stored without recompression, deflating
+    /// them again would cost a full pass over the data for sub-percent gains.
     void add_entry(const std::string& name, const void* data, size_t bytes);
 
+    /// Same as above with an explicit per entry compression level overriding
+    /// both the archive wide level and the stored-extension heuristics.
+    void add_entry(const std::string& name, const void* data, size_t bytes,
+                   e_compression compression);
+
     // Writing data to the archive works like with standard streams. The target
     // within the zip file is the entry created with the add_entry method.
 
@@ -3,6 +3,8 @@
 ///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
 ///|/
 #include <exception>
+#include <map>
+#include <mutex>
 
 #include "miniz_extension.hpp"
 
@@ -10,14 +12,57 @@
 #include "boost/nowide/cstdio.hpp"
 #endif
 
+#include <boost/filesystem/path.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <boost/nowide/convert.hpp>
+
 #include "libslic3r/I18N.hpp"
 
 namespace Slic3r {
 
 namespace {
+
+// File mappings backing the readers opened with mz_zip_reader_init_mem.
+// mz_zip_archive has no user data slot, so the association is kept here,
+// keyed by the archive address and released in close_zip().
+std::map<mz_zip_archive *, boost::iostreams::mapped_file_source> mapped_zips;
+std::mutex mapped_zips_mutex;
+
+// Memory map the archive and hand it to miniz as an in-memory zip. Central
+// directory lookups and entry decompression then read straight from the page
+// cache without buffered stdio roundtrips.
+bool open_zip_reader_mapped(mz_zip_archive *zip, const char *fname)
+{
+    boost::iostreams::mapped_file_source map;
+    try {
+#ifdef _WIN32
+        map.open(boost::filesystem::path(boost::nowide::widen(fname)));
+#else
+        map.open(std::string(fname));
+#endif
+    } catch (const std::exception &) { return false; }
+
+    if (!map.is_open())
+        return false;
+
+    if (!mz_zip_reader_init_mem(zip, map.data(), map.size(), 0))
+        return false;
+
+    std::lock_guard lk{mapped_zips_mutex};
+    mapped_zips[zip] = std::move(map);
+
+    return true;
+}
+
 bool open_zip(mz_zip_archive *zip, const char *fname, bool isread)
 {
     if (!zip) return false;
+
+    // Readers prefer the memory mapped route, empty files or exotic
+    // filesystems fall through to the buffered stdio route below.
+    if (isread && open_zip_reader_mapped(zip, fname))
+        return true;
+
     const char *mode = isread ? "rb" : "wb";
 
     FILE *f = nullptr;
@@ -58,6 +103,10 @@ bool close_zip(mz_zip_archive *zip, bool isread)
         ret     = bool(isread ? mz_zip_reader_end(zip)
                           : mz_zip_writer_end(zip));
         if (f) fclose(f);
+        if (isread) {
+            std::lock_guard lk{mapped_zips_mutex};
+            mapped_zips.erase(zip);
+        }
     }
     return ret;
 }
@@ -36,6 +36,8 @@
        	#include <sys/stat.h>
        	#include <fcntl.h>
 		#include <sys/sendfile.h>
+		#include <sys/ioctl.h>
+		#include <linux/fs.h>
 	#endif
 #endif
 
@@ -617,6 +619,13 @@ bool copy_file_linux(const boost::filesystem::path &from, const boost::filesyste
 		goto fail;
 	}
 
+#ifdef FICLONE
+	// Try to clone the file first (copy-on-write reflink). On file systems supporting it (Btrfs, XFS, bcachefs)
+	// this shares the data blocks with the source instead of copying them, which matters for the temporary copies
+	// of large G-code files made before running post-processing scripts. Unsupported configurations fail fast
+	// (typically with EOPNOTSUPP or EXDEV) and fall through to the copy loop below.
+	if (::ioctl(outfile.fd, FICLONE, infile.fd) != 0)
+#endif // FICLONE
 	//! copy_file implementation that uses sendfile loop. Requires sendfile to support file descriptors.
 	//FIXME Vojtech: This is a copy loop valid for Linux 2.6.33 and newer.
 	// copy_file_data_copy_file_range() supports cross-filesystem copying since 5.3, but Vojtech did not want to polute this
@@ -1261,4 +1270,30 @@ size_t total_physical_memory()
 #endif
 }
 
+// Returns the resident set size (physical memory currently mapped) of this process in bytes,
+// zero if not supported on this platform.
+size_t resident_memory()
+{
+#ifdef WIN32
+    PROCESS_MEMORY_COUNTERS pmc;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+        return (size_t)pmc.WorkingSetSize;
+    return 0;
+#elif defined(__APPLE__)
+    struct mach_task_basic_info info;
+    mach_msg_type_number_t infoCount = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&info, &infoCount) == KERN_SUCCESS)
+        return (size_t)info.resident_size;
+    return 0;
+#elif defined(__linux__)
+    size_t tSize = 0, resident = 0;
+    std::ifstream buffer("/proc/self/statm");
+    if (buffer && (buffer >> tSize >> resident))
+        return resident * (size_t)sysconf(_SC_PAGE_SIZE);
+    return 0;
+#else
+    return 0;
+#endif
+}
+
 }; // namespace Slic3r
@@ -82,4 +82,19 @@ void SegmentTemplate::render(size_t count)
     glsafe(glBindVertexArray(curr_vertex_array));
 }
 
+void SegmentTemplate::render_lines(size_t count)
+{
+    if (m_vao_id == 0 || m_vbo_id == 0 || count == 0)
+        return;
+
+    int curr_vertex_array;
+    glsafe(glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &curr_vertex_array));
+
+    // The first two template vertices carry the ids 0 and 1, which is exactly what the
+    // line level of detail shader expects for the two endpoints of a segment.
+    glsafe(glBindVertexArray(m_vao_id));
+    glsafe(glDrawArraysInstanced(GL_LINES, 0, 2, static_cast<GLsizei>(count)));
+    glsafe(glBindVertexArray(curr_vertex_array));
+}
+
 } // namespace libvgcode
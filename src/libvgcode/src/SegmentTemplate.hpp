@@ -28,6 +28,8 @@ public:
     //
     void shutdown();
     void render(size_t count);
+    // Render the segments as line primitives connecting the endpoints (level of detail variant).
+    void render_lines(size_t count);
 
     //
     // Return the size of the data sent to gpu, in bytes.
@@ -30,6 +30,7 @@ static const char* Segments_Vertex_Shader =
 "uniform samplerBuffer height_width_angle_tex;\n"
 "uniform samplerBuffer color_tex;\n"
 "uniform usamplerBuffer segment_index_tex;\n"
+"uniform int base_id;\n"
 "in int vertex_id;\n"
 "out vec3 color;\n"
 "vec3 decode_color(float color) {\n"
@@ -47,7 +48,7 @@ static const char* Segments_Vertex_Shader =
 "  return ambient + top_diffuse + front_diffuse + top_specular + emission;\n"
 "}\n"
 "void main() {\n"
-"  int id_a = int(texelFetch(segment_index_tex, gl_InstanceID).r);\n"
+"  int id_a = int(texelFetch(segment_index_tex, gl_InstanceID + base_id).r);\n"
 "  int id_b = id_a + 1;\n"
 "  vec3 pos_a = texelFetch(position_tex, id_a).xyz;\n"
 "  vec3 pos_b = texelFetch(position_tex, id_b).xyz;\n"
@@ -145,6 +146,37 @@ static const char* Segments_Fragment_Shader =
 "  fragment_color = vec4(color, 1.0);\n"
 "}\n";
 
+// Level of detail variant of the segments shader: renders a segment as a single line primitive
+// connecting the two endpoints. Used when the projected cross section of the extrusions is so
+// small on screen that the full half-box geometry would shade to the same pixels anyway.
+// The shading is a constant approximation of the average half-box lighting.
+static const char* Segments_Line_Vertex_Shader =
+"#version 150\n"
+"const float lighting = 0.85;\n"
+"uniform mat4 view_matrix;\n"
+"uniform mat4 projection_matrix;\n"
+"uniform samplerBuffer position_tex;\n"
+"uniform samplerBuffer color_tex;\n"
+"uniform usamplerBuffer segment_index_tex;\n"
+"uniform int base_id;\n"
+"in int vertex_id;\n"
+"out vec3 color;\n"
+"vec3 decode_color(float color) {\n"
+"  int c = int(round(color));\n"
+"  int r = (c >> 16) & 0xFF;\n"
+"  int g = (c >> 8) & 0xFF;\n"
+"  int b = (c >> 0) & 0xFF;\n"
+"  float f = 1.0 / 255.0f;\n"
+"  return f * vec3(r, g, b);\n"
+"}\n"
+"void main() {\n"
+"  int id_a = int(texelFetch(segment_index_tex, gl_InstanceID + base_id).r);\n"
+"  int id = (vertex_id == 0) ? id_a : id_a + 1;\n"
+"  vec3 pos = texelFetch(position_tex, id).xyz;\n"
+"  color = lighting * decode_color(texelFetch(color_tex, id).r);\n"
+"  gl_Position = projection_matrix * view_matrix * vec4(pos, 1.0);\n"
+"}\n";
+
 static const char* Options_Vertex_Shader =
 "#version 150\n"
 "const vec3  light_top_dir = vec3(-0.4574957, 0.4574957, 0.7624929);\n"
@@ -162,6 +194,7 @@ static const char* Options_Vertex_Shader =
 "uniform samplerBuffer height_width_angle_tex;\n"
 "uniform samplerBuffer color_tex;\n"
 "uniform usamplerBuffer segment_index_tex;\n"
+"uniform int base_id;\n"
 "in vec3 in_position;\n"
 "in vec3 in_normal;\n"
 "out vec3 color;\n"
@@ -180,7 +213,7 @@ static const char* Options_Vertex_Shader =
 "  return ambient + top_diffuse + front_diffuse + top_specular + emission;\n"
 "}\n"
 "void main() {\n"
-"  int id = int(texelFetch(segment_index_tex, gl_InstanceID).r);\n"
+"  int id = int(texelFetch(segment_index_tex, gl_InstanceID + base_id).r);\n"
 "  vec2 height_width = texelFetch(height_width_angle_tex, id).xy;\n"
 "  vec3 offset = texelFetch(position_tex, id).xyz - vec3(0.0, 0.0, 0.5 * height_width.x);\n"
 "  height_width *= scaling_factor;\n"
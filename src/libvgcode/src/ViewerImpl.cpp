@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <cmath>
 #include <numeric>
+#include <thread>
 
 namespace libvgcode {
 
@@ -757,6 +758,9 @@ void ViewerImpl::init(const std::string& opengl_context_version)
     m_uni_segments_height_width_angle_tex_id = glGetUniformLocation(m_segments_shader_id, "height_width_angle_tex");
     m_uni_segments_colors_tex_id             = glGetUniformLocation(m_segments_shader_id, "color_tex");
     m_uni_segments_segment_index_tex_id      = glGetUniformLocation(m_segments_shader_id, "segment_index_tex");
+#ifndef ENABLE_OPENGL_ES
+    m_uni_segments_base_id                   = glGetUniformLocation(m_segments_shader_id, "base_id");
+#endif // ENABLE_OPENGL_ES
     glcheck();
     assert(m_uni_segments_view_matrix_id != -1 &&
            m_uni_segments_projection_matrix_id != -1 &&
@@ -766,6 +770,24 @@ void ViewerImpl::init(const std::string& opengl_context_version)
            m_uni_segments_colors_tex_id != -1 &&
            m_uni_segments_segment_index_tex_id != -1);
 
+#ifndef ENABLE_OPENGL_ES
+    // line level of detail segments shader
+    m_segments_line_shader_id = init_shader("segments_line", Segments_Line_Vertex_Shader, Segments_Fragment_Shader);
+
+    m_uni_segments_line_view_matrix_id       = glGetUniformLocation(m_segments_line_shader_id, "view_matrix");
+    m_uni_segments_line_projection_matrix_id = glGetUniformLocation(m_segments_line_shader_id, "projection_matrix");
+    m_uni_segments_line_positions_tex_id     = glGetUniformLocation(m_segments_line_shader_id, "position_tex");
+    m_uni_segments_line_colors_tex_id        = glGetUniformLocation(m_segments_line_shader_id, "color_tex");
+    m_uni_segments_line_segment_index_tex_id = glGetUniformLocation(m_segments_line_shader_id, "segment_index_tex");
+    m_uni_segments_line_base_id              = glGetUniformLocation(m_segments_line_shader_id, "base_id");
+    glcheck();
+    assert(m_uni_segments_line_view_matrix_id != -1 &&
+           m_uni_segments_line_projection_matrix_id != -1 &&
+           m_uni_segments_line_positions_tex_id != -1 &&
+           m_uni_segments_line_colors_tex_id != -1 &&
+           m_uni_segments_line_segment_index_tex_id != -1);
+#endif // ENABLE_OPENGL_ES
+
     m_segment_template.init();
 
     // options shader
@@ -781,6 +803,9 @@ void ViewerImpl::init(const std::string& opengl_context_version)
     m_uni_options_height_width_angle_tex_id = glGetUniformLocation(m_options_shader_id, "height_width_angle_tex");
     m_uni_options_colors_tex_id             = glGetUniformLocation(m_options_shader_id, "color_tex");
     m_uni_options_segment_index_tex_id      = glGetUniformLocation(m_options_shader_id, "segment_index_tex");
+#ifndef ENABLE_OPENGL_ES
+    m_uni_options_base_id                   = glGetUniformLocation(m_options_shader_id, "base_id");
+#endif // ENABLE_OPENGL_ES
     glcheck();
     assert(m_uni_options_view_matrix_id != -1 &&
            m_uni_options_projection_matrix_id != -1 &&
@@ -854,6 +879,12 @@ void ViewerImpl::shutdown()
         glsafe(glDeleteProgram(m_segments_shader_id));
         m_segments_shader_id = 0;
     }
+#ifndef ENABLE_OPENGL_ES
+    if (m_segments_line_shader_id != 0) {
+        glsafe(glDeleteProgram(m_segments_line_shader_id));
+        m_segments_line_shader_id = 0;
+    }
+#endif // ENABLE_OPENGL_ES
     m_initialized = false;
     OpenGLWrapper::unload_opengl();
 }
@@ -869,7 +900,11 @@ void ViewerImpl::reset()
     m_travels_time = { 0.0f, 0.0f };
     m_vertices.clear();
     m_vertices_colors.clear();
+    reset_colors_cache();
     m_valid_lines_bitset.clear();
+    m_enabled_segments_cache.clear();
+    m_enabled_options_cache.clear();
+    m_enabled_entities_cache_dirty = true;
 #if VGCODE_ENABLE_COG_AND_TOOL_MARKERS
     m_cog_marker.reset();
 #endif // VGCODE_ENABLE_COG_AND_TOOL_MARKERS
@@ -878,7 +913,9 @@ void ViewerImpl::reset()
     m_texture_data.reset();
 #else
     m_enabled_segments_count = 0;
+    m_enabled_segments_base = 0;
     m_enabled_options_count = 0;
+    m_enabled_options_base = 0;
 
     m_settings_used_for_ranges = std::nullopt;
 
@@ -895,6 +932,40 @@ void ViewerImpl::reset()
 #endif // ENABLE_OPENGL_ES
 }
 
+// Runs fn(begin, end) on disjoint subranges of [0, count) from multiple worker threads.
+// Chunk boundaries are aligned to 64 elements, so concurrent BitSet<> updates from
+// different chunks never touch the same block.
+template<typename ChunkFn>
+static void parallel_for_chunks(size_t count, ChunkFn fn)
+{
+    static constexpr const size_t MIN_CHUNK_SIZE = 65536;
+    const size_t num_threads = std::min<size_t>(std::max<size_t>(1, std::thread::hardware_concurrency()),
+                                                (count + MIN_CHUNK_SIZE - 1) / MIN_CHUNK_SIZE);
+    if (num_threads <= 1) {
+        fn(size_t(0), count);
+        return;
+    }
+    const size_t chunk_size = ((count / num_threads + 63) / 64) * 64;
+    std::vector<std::thread> workers;
+    workers.reserve(count / chunk_size + 1);
+    for (size_t begin = 0; begin < count; begin += chunk_size) {
+        const size_t end = std::min(begin + chunk_size, count);
+        workers.emplace_back([fn, begin, end]() { fn(begin, end); });
+    }
+    for (std::thread& w : workers) {
+        w.join();
+    }
+}
+
+// Whether there is a valid path between point i and i+1. Pure function of the vertices,
+// so it can be evaluated from multiple threads in any order.
+static bool path_to_next_valid(const std::vector<PathVertex>& vertices, size_t i) {
+    return i + 1 < vertices.size() &&
+           vertices[i + 1].position != vertices[i].position &&
+           vertices[i + 1].type == vertices[i].type &&
+           vertices[i].type != EMoveType::Seam;
+}
+
 static void extract_pos_and_or_hwa(const std::vector<PathVertex>& vertices, float travels_radius, float wipes_radius, BitSet<>& valid_lines_bitset,
     std::vector<Vec3>* positions = nullptr, std::vector<Vec3>* heights_widths_angles = nullptr, bool update_bitset = false) {
     static constexpr const Vec3 ZERO = { 0.0f, 0.0f, 0.0f };
@@ -905,59 +976,80 @@ static void extract_pos_and_or_hwa(const std::vector<PathVertex>& vertices, floa
     if (travels_radius <= 0.0f || wipes_radius <= 0.0f)
         return;
 
+    // First settle the validity bitset, then fill the buffers reading the settled bitset.
+    // Splitting into two passes removes the serial dependency between consecutive vertices
+    // (vertex i reads the possibly just reset bit of vertex i - 1), so both passes can
+    // run chunked in parallel.
+    if (update_bitset) {
+        parallel_for_chunks(vertices.size(), [&vertices, &valid_lines_bitset](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                if (!path_to_next_valid(vertices, i))
+                    // the connection is invalid, there should be no line rendered, ever
+                    valid_lines_bitset.reset(i);
+            }
+        });
+    }
+
     if (positions != nullptr)
-        positions->reserve(vertices.size());
+        positions->resize(vertices.size());
     if (heights_widths_angles != nullptr)
-        heights_widths_angles->reserve(vertices.size());
-    for (size_t i = 0; i < vertices.size(); ++i) {
-        const PathVertex& v = vertices[i];
-        const EMoveType move_type = v.type;
-        const bool prev_line_valid = i > 0 && valid_lines_bitset[i - 1];
-        const Vec3 prev_line = prev_line_valid ? v.position - vertices[i - 1].position : ZERO;
-        const bool this_line_valid = i + 1 < vertices.size() &&
-                                     vertices[i + 1].position != v.position &&
-                                     vertices[i + 1].type == move_type &&
-                                     move_type != EMoveType::Seam;
-        const Vec3 this_line = this_line_valid ? vertices[i + 1].position - v.position : ZERO;
-
-        if (this_line_valid) {
-            // there is a valid path between point i and i+1.
-        }
-        else {
-            // the connection is invalid, there should be no line rendered, ever
-            if (update_bitset)
-                valid_lines_bitset.reset(i);
-        }
-        
-        if (positions != nullptr) {
-            Vec3 position = v.position;
-            if (move_type == EMoveType::Extrude)
-                // push down extrusion vertices by half height to render them at the right z
-                position[2] -= 0.5f * v.height;
-            positions->emplace_back(position);
-        }
-
-        if (heights_widths_angles != nullptr) {
-            float height = 0.0f;
-            float width = 0.0f;
-            if (v.is_travel()) {
-                height = travels_radius;
-                width  = travels_radius;
-            }
-            else if (v.is_wipe()) {
-                height = wipes_radius;
-                width  = wipes_radius;
-            }
-            else {
-                height = v.height;
-                width = v.width;
+        heights_widths_angles->resize(vertices.size());
+    parallel_for_chunks(vertices.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const PathVertex& v = vertices[i];
+            const EMoveType move_type = v.type;
+
+            if (positions != nullptr) {
+                Vec3 position = v.position;
+                if (move_type == EMoveType::Extrude)
+                    // push down extrusion vertices by half height to render them at the right z
+                    position[2] -= 0.5f * v.height;
+                (*positions)[i] = position;
             }
 
-            heights_widths_angles->push_back({ height, width,
-                std::atan2(prev_line[0] * this_line[1] - prev_line[1] * this_line[0], dot(prev_line, this_line)) });
+            if (heights_widths_angles != nullptr) {
+                const bool prev_line_valid = i > 0 && valid_lines_bitset[i - 1];
+                const Vec3 prev_line = prev_line_valid ? v.position - vertices[i - 1].position : ZERO;
+                const bool this_line_valid = path_to_next_valid(vertices, i);
+                const Vec3 this_line = this_line_valid ? vertices[i + 1].position - v.position : ZERO;
+
+                float height = 0.0f;
+                float width = 0.0f;
+                if (v.is_travel()) {
+                    height = travels_radius;
+                    width  = travels_radius;
+                }
+                else if (v.is_wipe()) {
+                    height = wipes_radius;
+                    width  = wipes_radius;
+                }
+                else {
+                    height = v.height;
+                    width = v.width;
+                }
+
+                (*heights_widths_angles)[i] = { height, width,
+                    std::atan2(prev_line[0] * this_line[1] - prev_line[1] * this_line[0], dot(prev_line, this_line)) };
+            }
         }
+    });
+}
+
+#ifndef ENABLE_OPENGL_ES
+// Orphans the buffer and uploads the data in fixed size chunks. A single huge glBufferData()
+// call forces the driver to stage the whole buffer at once, which may stall for hundreds of
+// milliseconds on multi-hundred-MB toolpath buffers; chunked sub-range uploads let the driver
+// pipeline the transfer.
+static void buffer_data_chunked(GLenum target, size_t size_bytes, const void* data, GLenum usage)
+{
+    static constexpr const size_t UPLOAD_CHUNK_SIZE = 16 * 1024 * 1024;
+    glsafe(glBufferData(target, size_bytes, nullptr, usage));
+    const char* ptr = static_cast<const char*>(data);
+    for (size_t offset = 0; offset < size_bytes; offset += UPLOAD_CHUNK_SIZE) {
+        glsafe(glBufferSubData(target, offset, std::min(UPLOAD_CHUNK_SIZE, size_bytes - offset), ptr + offset));
     }
 }
+#endif // ENABLE_OPENGL_ES
 
 void ViewerImpl::load(GCodeInputData&& gcode_data)
 {
@@ -976,9 +1068,24 @@ void ViewerImpl::load(GCodeInputData&& gcode_data)
 
     m_settings.spiral_vase_mode = gcode_data.spiral_vase_mode;
 
+#ifndef ENABLE_OPENGL_ES
+    Vec3 bbox_min = { FLT_MAX, FLT_MAX, FLT_MAX };
+    Vec3 bbox_max = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+    m_max_cross_section = 0.0f;
+#endif // ENABLE_OPENGL_ES
+
     for (size_t i = 0; i < m_vertices.size(); ++i) {
         const PathVertex& v = m_vertices[i];
 
+#ifndef ENABLE_OPENGL_ES
+        for (size_t j = 0; j < 3; ++j) {
+            bbox_min[j] = std::min(bbox_min[j], v.position[j]);
+            bbox_max[j] = std::max(bbox_max[j], v.position[j]);
+        }
+        if (v.type == EMoveType::Extrude)
+            m_max_cross_section = std::max(m_max_cross_section, std::max(v.height, v.width));
+#endif // ENABLE_OPENGL_ES
+
         m_layers.update(v, static_cast<uint32_t>(i));
 
         for (size_t j = 0; j < TIME_MODES_COUNT; ++j) {
@@ -1018,6 +1125,12 @@ void ViewerImpl::load(GCodeInputData&& gcode_data)
         }
     }
 
+#ifndef ENABLE_OPENGL_ES
+    m_toolpaths_center = { 0.5f * (bbox_min[0] + bbox_max[0]), 0.5f * (bbox_min[1] + bbox_max[1]), 0.5f * (bbox_min[2] + bbox_max[2]) };
+    if (m_max_cross_section == 0.0f)
+        m_max_cross_section = std::max(2.0f * m_travels_radius, 2.0f * m_wipes_radius);
+#endif // ENABLE_OPENGL_ES
+
     if (!m_layers.empty())
         m_layers.set_view_range(0, static_cast<uint32_t>(m_layers.count()) - 1);
 
@@ -1033,22 +1146,29 @@ void ViewerImpl::load(GCodeInputData&& gcode_data)
         m_settings.time_mode = ETimeMode::Normal;
 
     // buffers to send to gpu
+    // The two attribute streams are extracted and uploaded one after the other and each
+    // staging buffer is freed right after its upload: holding both at once would add
+    // 24 transient bytes per vertex on top of the path vertices themselves, which is
+    // what pushes multi-GB previews out of memory. The second extraction pass rereads
+    // the bitset settled by the first one.
     std::vector<Vec3> positions;
-    std::vector<Vec3> heights_widths_angles;
     positions.reserve(m_vertices.size());
-    heights_widths_angles.reserve(m_vertices.size());
-    extract_pos_and_or_hwa(m_vertices, m_travels_radius, m_wipes_radius, m_valid_lines_bitset, &positions, &heights_widths_angles, true);
+    extract_pos_and_or_hwa(m_vertices, m_travels_radius, m_wipes_radius, m_valid_lines_bitset, &positions, nullptr, true);
 
     if (!positions.empty()) {
 #ifdef ENABLE_OPENGL_ES
         m_texture_data.init(positions.size());
         // create and fill position textures
         m_texture_data.set_positions(positions);
+        std::vector<Vec3>().swap(positions);
+
         // create and fill height, width and angle textures
+        std::vector<Vec3> heights_widths_angles;
+        heights_widths_angles.reserve(m_vertices.size());
+        extract_pos_and_or_hwa(m_vertices, m_travels_radius, m_wipes_radius, m_valid_lines_bitset, nullptr, &heights_widths_angles);
         m_texture_data.set_heights_widths_angles(heights_widths_angles);
 #else
         m_positions_tex_size = positions.size() * sizeof(Vec3);
-        m_height_width_angle_tex_size = heights_widths_angles.size() * sizeof(Vec3);
 
         int old_bound_texture = 0;
         glsafe(glGetIntegerv(GL_TEXTURE_BINDING_BUFFER, &old_bound_texture));
@@ -1056,16 +1176,22 @@ void ViewerImpl::load(GCodeInputData&& gcode_data)
         // create and fill positions buffer
         glsafe(glGenBuffers(1, &m_positions_buf_id));
         glsafe(glBindBuffer(GL_TEXTURE_BUFFER, m_positions_buf_id));
-        glsafe(glBufferData(GL_TEXTURE_BUFFER, positions.size() * sizeof(Vec3), positions.data(), GL_STATIC_DRAW));
+        buffer_data_chunked(GL_TEXTURE_BUFFER, positions.size() * sizeof(Vec3), positions.data(), GL_STATIC_DRAW);
         glsafe(glGenTextures(1, &m_positions_tex_id));
         glsafe(glBindTexture(GL_TEXTURE_BUFFER, m_positions_tex_id));
+        std::vector<Vec3>().swap(positions);
 
         // create and fill height, width and angles buffer
+        std::vector<Vec3> heights_widths_angles;
+        heights_widths_angles.reserve(m_vertices.size());
+        extract_pos_and_or_hwa(m_vertices, m_travels_radius, m_wipes_radius, m_valid_lines_bitset, nullptr, &heights_widths_angles);
+        m_height_width_angle_tex_size = heights_widths_angles.size() * sizeof(Vec3);
         glsafe(glGenBuffers(1, &m_heights_widths_angles_buf_id));
         glsafe(glBindBuffer(GL_TEXTURE_BUFFER, m_heights_widths_angles_buf_id));
-        glsafe(glBufferData(GL_TEXTURE_BUFFER, heights_widths_angles.size() * sizeof(Vec3), heights_widths_angles.data(), GL_DYNAMIC_DRAW));
+        buffer_data_chunked(GL_TEXTURE_BUFFER, heights_widths_angles.size() * sizeof(Vec3), heights_widths_angles.data(), GL_DYNAMIC_DRAW);
         glsafe(glGenTextures(1, &m_heights_widths_angles_tex_id));
         glsafe(glBindTexture(GL_TEXTURE_BUFFER, m_heights_widths_angles_tex_id));
+        std::vector<Vec3>().swap(heights_widths_angles);
 
         // create (but do not fill) colors buffer (data is set in update_colors())
         glsafe(glGenBuffers(1, &m_colors_buf_id));
@@ -1101,8 +1227,6 @@ void ViewerImpl::update_enabled_entities()
     if (m_vertices.empty())
         return;
 
-    std::vector<uint32_t> enabled_segments;
-    std::vector<uint32_t> enabled_options;
     Interval range = m_view_range.get_visible();
 
     // when top layer only visualization is enabled, we need to render
@@ -1122,63 +1246,76 @@ void ViewerImpl::update_enabled_entities()
             --range[0];
     }
 
-    for (size_t i = range[0]; i < range[1]; ++i) {
-        const PathVertex& v = m_vertices[i];
+    if (m_enabled_entities_cache_dirty) {
+        // The visibility filters or the vertices changed, refilter the whole vertex list once.
+        // Subsequent range changes (slider moves) only slice this cache.
+        m_enabled_segments_cache.clear();
+        m_enabled_options_cache.clear();
+        for (size_t i = 0; i < m_vertices.size(); ++i) {
+            const PathVertex& v = m_vertices[i];
 
-        if (!m_valid_lines_bitset[i] && !v.is_option())
-            continue;
-        if (v.is_travel()) {
-            if (!m_settings.options_visibility[size_t(EOptionType::Travels)])
-                continue;
-        }
-        else if (v.is_wipe()) {
-            if (!m_settings.options_visibility[size_t(EOptionType::Wipes)])
-                continue;
-        }
-        else if (v.is_option()) {
-            if (!m_settings.options_visibility[size_t(move_type_to_option(v.type))])
+            if (!m_valid_lines_bitset[i] && !v.is_option())
                 continue;
-        }
-        else if (v.is_extrusion()) {
-            if (!m_settings.extrusion_roles_visibility[size_t(v.role)])
+            if (v.is_travel()) {
+                if (!m_settings.options_visibility[size_t(EOptionType::Travels)])
+                    continue;
+            }
+            else if (v.is_wipe()) {
+                if (!m_settings.options_visibility[size_t(EOptionType::Wipes)])
+                    continue;
+            }
+            else if (v.is_option()) {
+                if (!m_settings.options_visibility[size_t(move_type_to_option(v.type))])
+                    continue;
+            }
+            else if (v.is_extrusion()) {
+                if (!m_settings.extrusion_roles_visibility[size_t(v.role)])
+                    continue;
+            }
+            else
                 continue;
+
+            if (v.is_option())
+                m_enabled_options_cache.push_back(static_cast<uint32_t>(i));
+            else
+                m_enabled_segments_cache.push_back(static_cast<uint32_t>(i));
         }
-        else
-            continue;
 
-        if (v.is_option())
-            enabled_options.push_back(static_cast<uint32_t>(i));
-        else
-            enabled_segments.push_back(static_cast<uint32_t>(i));
-    }
+#ifndef ENABLE_OPENGL_ES
+        // upload the whole caches, the visible slice is selected with the base_id shader uniform
+        m_enabled_segments_tex_size = m_enabled_segments_cache.size() * sizeof(uint32_t);
+        m_enabled_options_tex_size = m_enabled_options_cache.size() * sizeof(uint32_t);
 
-#ifdef ENABLE_OPENGL_ES
-    m_texture_data.set_enabled_segments(enabled_segments);
-    m_texture_data.set_enabled_options(enabled_options);
-#else
-    m_enabled_segments_count = enabled_segments.size();
-    m_enabled_options_count = enabled_options.size();
+        assert(m_enabled_segments_buf_id > 0);
+        glsafe(glBindBuffer(GL_TEXTURE_BUFFER, m_enabled_segments_buf_id));
+        glsafe(glBufferData(GL_TEXTURE_BUFFER, m_enabled_segments_cache.size() * sizeof(uint32_t),
+                            m_enabled_segments_cache.empty() ? nullptr : m_enabled_segments_cache.data(), GL_STATIC_DRAW));
 
-    m_enabled_segments_tex_size = enabled_segments.size() * sizeof(uint32_t);
-    m_enabled_options_tex_size = enabled_options.size() * sizeof(uint32_t);
+        assert(m_enabled_options_buf_id > 0);
+        glsafe(glBindBuffer(GL_TEXTURE_BUFFER, m_enabled_options_buf_id));
+        glsafe(glBufferData(GL_TEXTURE_BUFFER, m_enabled_options_cache.size() * sizeof(uint32_t),
+                            m_enabled_options_cache.empty() ? nullptr : m_enabled_options_cache.data(), GL_STATIC_DRAW));
 
-    // update gpu buffer for enabled segments
-    assert(m_enabled_segments_buf_id > 0);
-    glsafe(glBindBuffer(GL_TEXTURE_BUFFER, m_enabled_segments_buf_id));
-    if (!enabled_segments.empty())
-        glsafe(glBufferData(GL_TEXTURE_BUFFER, enabled_segments.size() * sizeof(uint32_t), enabled_segments.data(), GL_STATIC_DRAW));
-    else
-        glsafe(glBufferData(GL_TEXTURE_BUFFER, 0, nullptr, GL_STATIC_DRAW));
+        glsafe(glBindBuffer(GL_TEXTURE_BUFFER, 0));
+#endif // ENABLE_OPENGL_ES
 
-    // update gpu buffer for enabled options
-    assert(m_enabled_options_buf_id > 0);
-    glsafe(glBindBuffer(GL_TEXTURE_BUFFER, m_enabled_options_buf_id));
-    if (!enabled_options.empty())
-        glsafe(glBufferData(GL_TEXTURE_BUFFER, enabled_options.size() * sizeof(uint32_t), enabled_options.data(), GL_STATIC_DRAW));
-    else
-        glsafe(glBufferData(GL_TEXTURE_BUFFER, 0, nullptr, GL_STATIC_DRAW));
+        m_enabled_entities_cache_dirty = false;
+    }
 
-    glsafe(glBindBuffer(GL_TEXTURE_BUFFER, 0));
+    // the caches are sorted by vertex id, the visible range is a contiguous slice of them
+    const auto seg_begin = std::lower_bound(m_enabled_segments_cache.begin(), m_enabled_segments_cache.end(), static_cast<uint32_t>(range[0]));
+    const auto seg_end   = std::lower_bound(seg_begin, m_enabled_segments_cache.end(), static_cast<uint32_t>(range[1]));
+    const auto opt_begin = std::lower_bound(m_enabled_options_cache.begin(), m_enabled_options_cache.end(), static_cast<uint32_t>(range[0]));
+    const auto opt_end   = std::lower_bound(opt_begin, m_enabled_options_cache.end(), static_cast<uint32_t>(range[1]));
+
+#ifdef ENABLE_OPENGL_ES
+    m_texture_data.set_enabled_segments(std::vector<uint32_t>(seg_begin, seg_end));
+    m_texture_data.set_enabled_options(std::vector<uint32_t>(opt_begin, opt_end));
+#else
+    m_enabled_segments_base = std::distance(m_enabled_segments_cache.begin(), seg_begin);
+    m_enabled_segments_count = std::distance(seg_begin, seg_end);
+    m_enabled_options_base = std::distance(m_enabled_options_cache.begin(), opt_begin);
+    m_enabled_options_count = std::distance(opt_begin, opt_end);
 #endif // ENABLE_OPENGL_ES
 
     m_settings.update_enabled_entities = false;
@@ -1207,10 +1344,12 @@ void ViewerImpl::update_colors_texture()
     // vertices as dark grey. Use either that or the normal color (from the cache).
     std::vector<float> colors(m_vertices_colors.size());
     assert(colors.size() == m_vertices.size() && m_vertices_colors.size() == m_vertices.size());
-    for (size_t i=0; i<m_vertices.size(); ++i)
-        colors[i] = (color_top_layer_only && m_vertices[i].layer_id < top_layer_id &&
-                    (!m_settings.spiral_vase_mode || i != m_view_range.get_enabled()[0])) ?
-                    encode_color(DUMMY_COLOR) : m_vertices_colors[i];
+    parallel_for_chunks(m_vertices.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+            colors[i] = (color_top_layer_only && m_vertices[i].layer_id < top_layer_id &&
+                        (!m_settings.spiral_vase_mode || i != m_view_range.get_enabled()[0])) ?
+                        encode_color(DUMMY_COLOR) : m_vertices_colors[i];
+    });
 
     #ifdef ENABLE_OPENGL_ES
         if (!colors.empty())
@@ -1221,7 +1360,7 @@ void ViewerImpl::update_colors_texture()
 
         // update gpu buffer for colors
         glsafe(glBindBuffer(GL_TEXTURE_BUFFER, m_colors_buf_id));
-        glsafe(glBufferData(GL_TEXTURE_BUFFER, colors.size() * sizeof(float), colors.data(), GL_STATIC_DRAW));
+        buffer_data_chunked(GL_TEXTURE_BUFFER, colors.size() * sizeof(float), colors.data(), GL_STATIC_DRAW);
         glsafe(glBindBuffer(GL_TEXTURE_BUFFER, 0));
     #endif // ENABLE_OPENGL_ES
 }
@@ -1248,13 +1387,33 @@ void ViewerImpl::update_colors()
     // If some part of the preview should be rendered in dark grey, it is taken
     // care of in update_colors_texture. That is to avoid the need to recalculate
     // the "normal" color on every slider move.
-    for (size_t i = 0; i < m_vertices.size(); ++i)
-        m_vertices_colors[i] = encode_color(get_vertex_color(m_vertices[i]));
-    
+    // The colors of every view type visited since the last reset_colors_cache() are
+    // kept around, so switching back to such a view type only copies them and
+    // refreshes the texture instead of recalculating them over all the vertices.
+    std::vector<float>& cached_colors = m_vertices_colors_cache[static_cast<size_t>(m_settings.view_type)];
+    if (cached_colors.size() == m_vertices.size())
+        m_vertices_colors = cached_colors;
+    else {
+        parallel_for_chunks(m_vertices.size(), [this](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
+                m_vertices_colors[i] = encode_color(get_vertex_color(m_vertices[i]));
+        });
+        cached_colors = m_vertices_colors;
+    }
+
+
     update_colors_texture();
     m_settings.update_colors = false;
 }
 
+void ViewerImpl::reset_colors_cache()
+{
+    for (std::vector<float>& colors : m_vertices_colors_cache) {
+        colors.clear();
+        colors.shrink_to_fit();
+    }
+}
+
 void ViewerImpl::render(const Mat4x4& view_matrix, const Mat4x4& projection_matrix)
 {
     if (m_settings.update_view_full_range)
@@ -1288,6 +1447,7 @@ void ViewerImpl::set_view_type(EViewType type)
 void ViewerImpl::set_time_mode(ETimeMode mode)
 {
     m_settings.time_mode = mode;
+    reset_colors_cache();
     m_settings.update_colors = true;
 }
 
@@ -1395,7 +1555,9 @@ void ViewerImpl::toggle_option_visibility(EOptionType type)
         else if (m_settings.top_layer_only_view_range && new_enabled_range[0] < visible_range[0])
             m_view_range.set_visible(new_enabled_range[0], visible_range[1]);
     }
+    m_enabled_entities_cache_dirty = true;
     m_settings.update_enabled_entities = true;
+    reset_colors_cache();
     m_settings.update_colors = true;
 }
 
@@ -1408,7 +1570,9 @@ void ViewerImpl::toggle_extrusion_role_visibility(EGCodeExtrusionRole role)
 {
     m_settings.extrusion_roles_visibility[size_t(role)] = ! m_settings.extrusion_roles_visibility[size_t(role)];
     update_view_full_range();
+    m_enabled_entities_cache_dirty = true;
     m_settings.update_enabled_entities = true;
+    reset_colors_cache();
     m_settings.update_colors = true;
 }
 
@@ -1504,12 +1668,14 @@ Color ViewerImpl::get_vertex_color(const PathVertex& v) const
 void ViewerImpl::set_tool_colors(const Palette& colors)
 {
     m_tool_colors = colors;
+    reset_colors_cache();
     m_settings.update_colors = true;
 }
 
 void ViewerImpl::set_color_print_colors(const Palette& colors)
 {
     m_color_print_colors = colors;
+    reset_colors_cache();
     m_settings.update_colors = true;
 }
 
@@ -1521,12 +1687,14 @@ const Color& ViewerImpl::get_extrusion_role_color(EGCodeExtrusionRole role) cons
 void ViewerImpl::set_extrusion_role_color(EGCodeExtrusionRole role, const Color& color)
 {
     m_extrusion_roles_colors[size_t(role)] = color;
+    reset_colors_cache();
     m_settings.update_colors = true;
 }
 
 void ViewerImpl::reset_default_extrusion_roles_colors()
 {
     m_extrusion_roles_colors = DEFAULT_EXTRUSION_ROLES_COLORS;
+    reset_colors_cache();
 }
 
 const Color& ViewerImpl::get_option_color(EOptionType type) const
@@ -1537,12 +1705,14 @@ const Color& ViewerImpl::get_option_color(EOptionType type) const
 void ViewerImpl::set_option_color(EOptionType type, const Color& color)
 {
     m_options_colors[size_t(type)] = color;
+    reset_colors_cache();
     m_settings.update_colors = true;
 }
 
 void ViewerImpl::reset_default_options_colors()
 {
     m_options_colors = DEFAULT_OPTIONS_COLORS;
+    reset_colors_cache();
 }
 
 const ColorRange& ViewerImpl::get_color_range(EViewType type) const
@@ -1579,6 +1749,7 @@ void ViewerImpl::set_color_range_palette(EViewType type, const Palette& palette)
     case EViewType::LayerTimeLogarithmic:     { m_layer_time_range[1].set_palette(palette);   break; }
     default:                                  { break; }
     }
+    reset_colors_cache();
     m_settings.update_colors = true;
 }
 
@@ -1847,15 +2018,57 @@ void ViewerImpl::render_segments(const Mat4x4& view_matrix, const Mat4x4& projec
     const bool curr_cull_face = glIsEnabled(GL_CULL_FACE);
     glcheck();
 
-    glsafe(glUseProgram(m_segments_shader_id));
+#ifndef ENABLE_OPENGL_ES
+    // Level of detail selection, re-evaluated on every camera change: when the largest extrusion
+    // cross section projects to less than ~2 pixels at the center of the toolpaths, the full
+    // half-box geometry covers (sub)pixel sized spans anyway, so the segments are rendered as
+    // line primitives instead, cutting the vertex workload from 24 to 2 vertices per segment.
+    static constexpr const float LOD_PIXEL_THRESHOLD = 2.0f;
+    bool use_line_lod = false;
+    if (m_segments_line_shader_id != 0 && m_max_cross_section > 0.0f) {
+        int viewport[4] = { 0, 0, 0, 0 };
+        glsafe(glGetIntegerv(GL_VIEWPORT, viewport));
+        const Vec3& c = m_toolpaths_center;
+        const bool orthographic = projection_matrix[15] == 1.0f;
+        float scale = 0.5f * static_cast<float>(viewport[3]) * projection_matrix[5];
+        if (!orthographic) {
+            // distance of the toolpaths center along the camera forward axis
+            const float eye_z = -(view_matrix[2] * c[0] + view_matrix[6] * c[1] + view_matrix[10] * c[2] + view_matrix[14]);
+            if (eye_z > 0.0f)
+                scale /= eye_z;
+            else
+                // center behind the camera, keep full detail
+                scale = FLT_MAX;
+        }
+        use_line_lod = m_max_cross_section * scale < LOD_PIXEL_THRESHOLD;
+    }
 
-    glsafe(glUniform1i(m_uni_segments_positions_tex_id, 0));
-    glsafe(glUniform1i(m_uni_segments_height_width_angle_tex_id, 1));
-    glsafe(glUniform1i(m_uni_segments_colors_tex_id, 2));
-    glsafe(glUniform1i(m_uni_segments_segment_index_tex_id, 3));
-    glsafe(glUniformMatrix4fv(m_uni_segments_view_matrix_id, 1, GL_FALSE, view_matrix.data()));
-    glsafe(glUniformMatrix4fv(m_uni_segments_projection_matrix_id, 1, GL_FALSE, projection_matrix.data()));
-    glsafe(glUniform3fv(m_uni_segments_camera_position_id, 1, camera_position.data()));
+    if (use_line_lod) {
+        glsafe(glUseProgram(m_segments_line_shader_id));
+
+        glsafe(glUniform1i(m_uni_segments_line_positions_tex_id, 0));
+        glsafe(glUniform1i(m_uni_segments_line_colors_tex_id, 2));
+        glsafe(glUniform1i(m_uni_segments_line_segment_index_tex_id, 3));
+        glsafe(glUniform1i(m_uni_segments_line_base_id, static_cast<int>(m_enabled_segments_base)));
+        glsafe(glUniformMatrix4fv(m_uni_segments_line_view_matrix_id, 1, GL_FALSE, view_matrix.data()));
+        glsafe(glUniformMatrix4fv(m_uni_segments_line_projection_matrix_id, 1, GL_FALSE, projection_matrix.data()));
+    }
+    else
+#endif // ENABLE_OPENGL_ES
+    {
+        glsafe(glUseProgram(m_segments_shader_id));
+
+        glsafe(glUniform1i(m_uni_segments_positions_tex_id, 0));
+        glsafe(glUniform1i(m_uni_segments_height_width_angle_tex_id, 1));
+        glsafe(glUniform1i(m_uni_segments_colors_tex_id, 2));
+        glsafe(glUniform1i(m_uni_segments_segment_index_tex_id, 3));
+#ifndef ENABLE_OPENGL_ES
+        glsafe(glUniform1i(m_uni_segments_base_id, static_cast<int>(m_enabled_segments_base)));
+#endif // ENABLE_OPENGL_ES
+        glsafe(glUniformMatrix4fv(m_uni_segments_view_matrix_id, 1, GL_FALSE, view_matrix.data()));
+        glsafe(glUniformMatrix4fv(m_uni_segments_projection_matrix_id, 1, GL_FALSE, projection_matrix.data()));
+        glsafe(glUniform3fv(m_uni_segments_camera_position_id, 1, camera_position.data()));
+    }
 
     glsafe(glDisable(GL_CULL_FACE));
 
@@ -1894,7 +2107,10 @@ void ViewerImpl::render_segments(const Mat4x4& view_matrix, const Mat4x4& projec
     glsafe(glBindTexture(GL_TEXTURE_BUFFER, m_enabled_segments_tex_id));
     glsafe(glTexBuffer(GL_TEXTURE_BUFFER, GL_R32UI, m_enabled_segments_buf_id));
 
-    m_segment_template.render(m_enabled_segments_count);
+    if (use_line_lod)
+        m_segment_template.render_lines(m_enabled_segments_count);
+    else
+        m_segment_template.render(m_enabled_segments_count);
 #endif // ENABLE_OPENGL_ES
 
     if (curr_cull_face)
@@ -1934,6 +2150,9 @@ void ViewerImpl::render_options(const Mat4x4& view_matrix, const Mat4x4& project
     glsafe(glUniform1i(m_uni_options_height_width_angle_tex_id, 1));
     glsafe(glUniform1i(m_uni_options_colors_tex_id, 2));
     glsafe(glUniform1i(m_uni_options_segment_index_tex_id, 3));
+#ifndef ENABLE_OPENGL_ES
+    glsafe(glUniform1i(m_uni_options_base_id, static_cast<int>(m_enabled_options_base)));
+#endif // ENABLE_OPENGL_ES
     glsafe(glUniformMatrix4fv(m_uni_options_view_matrix_id, 1, GL_FALSE, view_matrix.data()));
     glsafe(glUniformMatrix4fv(m_uni_options_projection_matrix_id, 1, GL_FALSE, projection_matrix.data()));
 
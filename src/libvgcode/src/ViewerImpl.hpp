@@ -66,6 +66,12 @@ public:
     //
     void update_colors();
     void update_colors_texture();
+    //
+    // Drop the per view type cache of the vertices colors.
+    // To be called whenever anything but the view type itself
+    // changes the color of some vertex.
+    //
+    void reset_colors_cache();
 
     //
     // Render the toolpaths
@@ -271,10 +277,23 @@ private:
     // Cache for the colors to reduce the need to recalculate colors of all the vertices.
     std::vector<float> m_vertices_colors;
 
+    // Per view type cache of the encoded vertices colors, so that switching back to an
+    // already visited view type reuses its colors instead of recalculating them over all
+    // the vertices. Only the entries of the visited view types are populated.
+    std::array<std::vector<float>, VIEW_TYPES_COUNT> m_vertices_colors_cache;
+
     //
     // Variables used for toolpaths visibiliity
     //
     BitSet<> m_valid_lines_bitset;
+
+    // Cache of the vertex ids passing the visibility filters over the whole vertex list,
+    // sorted by id. The visible range of update_enabled_entities() is a contiguous slice
+    // of it, so slider moves only need two binary searches instead of a full rescan.
+    // Rebuilt only when the visibility filters or the vertices change.
+    std::vector<uint32_t> m_enabled_segments_cache;
+    std::vector<uint32_t> m_enabled_options_cache;
+    bool m_enabled_entities_cache_dirty{ true };
     //
     // Variables used for toolpaths coloring
     //
@@ -296,6 +315,9 @@ private:
     // OpenGL shaders ids
     //
     unsigned int m_segments_shader_id{ 0 };
+#ifndef ENABLE_OPENGL_ES
+    unsigned int m_segments_line_shader_id{ 0 };
+#endif // ENABLE_OPENGL_ES
     unsigned int m_options_shader_id{ 0 };
 #if VGCODE_ENABLE_COG_AND_TOOL_MARKERS
     unsigned int m_cog_marker_shader_id{ 0 };
@@ -311,6 +333,24 @@ private:
     int m_uni_segments_height_width_angle_tex_id{ -1 };
     int m_uni_segments_colors_tex_id{ -1 };
     int m_uni_segments_segment_index_tex_id{ -1 };
+    int m_uni_segments_base_id{ -1 };
+#ifndef ENABLE_OPENGL_ES
+    //
+    // Caches for OpenGL uniforms id for the line level of detail segments shader
+    //
+    int m_uni_segments_line_view_matrix_id{ -1 };
+    int m_uni_segments_line_projection_matrix_id{ -1 };
+    int m_uni_segments_line_positions_tex_id{ -1 };
+    int m_uni_segments_line_colors_tex_id{ -1 };
+    int m_uni_segments_line_segment_index_tex_id{ -1 };
+    int m_uni_segments_line_base_id{ -1 };
+    //
+    // Data for the level of detail selection: center of the toolpaths bounding box
+    // and the largest extrusion cross section, set in load().
+    //
+    Vec3 m_toolpaths_center{ 0.0f, 0.0f, 0.0f };
+    float m_max_cross_section{ 0.0f };
+#endif // ENABLE_OPENGL_ES
     //
     // Caches for OpenGL uniforms id for options shader 
     //
@@ -320,6 +360,7 @@ private:
     int m_uni_options_height_width_angle_tex_id{ -1 };
     int m_uni_options_colors_tex_id{ -1 };
     int m_uni_options_segment_index_tex_id{ -1 };
+    int m_uni_options_base_id{ -1 };
 #if VGCODE_ENABLE_COG_AND_TOOL_MARKERS
     //
     // Caches for OpenGL uniforms id for cog marker shader 
@@ -434,12 +475,16 @@ private:
     unsigned int m_enabled_segments_buf_id{ 0 };
     unsigned int m_enabled_segments_tex_id{ 0 };
     size_t m_enabled_segments_count{ 0 };
+    // offset of the first rendered instance into the enabled segments buffer
+    size_t m_enabled_segments_base{ 0 };
     //
     // OpenGL buffers to store enabled options
     //
     unsigned int m_enabled_options_buf_id{ 0 };
     unsigned int m_enabled_options_tex_id{ 0 };
     size_t m_enabled_options_count{ 0 };
+    // offset of the first rendered instance into the enabled options buffer
+    size_t m_enabled_options_base{ 0 };
     //
     // Caches for size of data sent to gpu, in bytes
     //
@@ -21,6 +21,12 @@
 #include "BRepBuilderAPI_Transform.hxx"
 #include "TopExp_Explorer.hxx"
 #include "BRep_Tool.hxx"
+#include "BRepBndLib.hxx"
+#include "Bnd_Box.hxx"
+#include "OSD_Parallel.hxx"
+
+#include <algorithm>
+#include <cmath>
 
 const double STEP_TRANS_CHORD_ERROR = 0.005;
 const double STEP_TRANS_ANGLE_RES = 1;
@@ -126,6 +132,21 @@ try {
     std::string obj_name((last_slash == nullptr) ? path : last_slash + 1);
     res->object_name = obj_name;
 
+    // Tessellate the solids concurrently. Distinct solids own distinct faces
+    // (the shapes were copied by BRepBuilderAPI_Transform above), so their
+    // triangulations are computed independently. For a single solid the face
+    // level parallelism of BRepMesh is used instead. The chordal deflection
+    // is relaxed with the solid size, so one physically large part does not
+    // dominate the tessellation of an assembly with needlessly fine facets.
+    OSD_Parallel::For(0, int(namedSolids.size()), [&namedSolids](int i) {
+        Bnd_Box bbox;
+        BRepBndLib::Add(namedSolids[i].solid, bbox, false);
+        double deflection = STEP_TRANS_CHORD_ERROR;
+        if (!bbox.IsVoid())
+            deflection = std::max(deflection, 1e-4 * std::sqrt(bbox.SquareExtent()));
+        BRepMesh_IncrementalMesh mesh(namedSolids[i].solid, deflection, false, STEP_TRANS_ANGLE_RES, namedSolids.size() == 1);
+    }, namedSolids.size() == 1);
+
     for (size_t i = 0; i < namedSolids.size(); ++i) {
         //BBS:if (proFn) {
         //    proFn(LOAD_STEP_STAGE_GET_MESH, i, namedSolids.size(), cb_cancel);
@@ -141,8 +162,6 @@ try {
         auto& vertices = res->volumes.back().vertices;
         auto& indices  = res->volumes.back().indices;
 
-        BRepMesh_IncrementalMesh mesh(namedSolids[i].solid, STEP_TRANS_CHORD_ERROR, false, STEP_TRANS_ANGLE_RES, true);
-
         for (TopExp_Explorer anExpSF(namedSolids[i].solid, TopAbs_FACE); anExpSF.More(); anExpSF.Next()) {
             const int aNodeOffset = int(vertices.size());
             const TopoDS_Shape& aFace = anExpSF.Current();
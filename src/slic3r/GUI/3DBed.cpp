@@ -380,6 +380,9 @@ void Bed3D::render_texture(bool bottom, GLCanvas3D& canvas, const Transform3d& v
 
         canvas.request_extra_frame();
     }
+    else if (!m_texture.all_compressed_data_sent_to_gpu())
+        // keep polling, so the compressed levels are swapped in as soon as the workers finish
+        canvas.request_extra_frame();
 
     init_triangles();
 
@@ -34,6 +34,12 @@
 #include "libslic3r/ClipperUtils.hpp"
 #include "libslic3r/Tesselate.hpp"
 #include "libslic3r/PrintConfig.hpp"
+#include "libslic3r/QuadricEdgeCollapse.hpp"
+
+#include <limits>
+#include <map>
+#include <mutex>
+#include <thread>
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -77,6 +83,74 @@ void glAssertRecentCallImpl(const char* file_name, unsigned int line, const char
 
 namespace Slic3r {
 
+// Do not bother decimating meshes below this triangle count, they render fast at full resolution.
+static constexpr const size_t LODMinSourceTriangles = 16000;
+// Stop the LOD chain once a level drops below this triangle count.
+static constexpr const size_t LODMinTriangles       = 1000;
+// Each level of detail keeps a quarter of the triangles of the previous one.
+static constexpr const size_t LODDecimationFactor   = 4;
+
+std::shared_ptr<GLVolumeLODs> GLVolumeLODs::get(const std::shared_ptr<const TriangleMesh> &mesh)
+{
+    struct CacheEntry {
+        std::shared_ptr<const TriangleMesh> mesh;
+        std::shared_ptr<GLVolumeLODs>       lods;
+    };
+    static std::mutex                                cache_mutex;
+    static std::map<const TriangleMesh*, CacheEntry> cache;
+
+    assert(mesh != nullptr);
+    if (mesh->facets_count() < LODMinSourceTriangles)
+        return nullptr;
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+
+    // Drop the chains of meshes that are no longer referenced by anything but the cache,
+    // meaning the model replaced or deleted the mesh. A cached chain pins its mesh,
+    // therefore the map key cannot alias a new mesh while its entry exists.
+    for (auto it = cache.begin(); it != cache.end();)
+        if (it->second.mesh.use_count() == 1 && it->second.lods.use_count() == 1)
+            it = cache.erase(it);
+        else
+            ++ it;
+
+    CacheEntry &entry = cache[mesh.get()];
+    if (entry.lods == nullptr) {
+        entry.mesh = mesh;
+        entry.lods = std::make_shared<GLVolumeLODs>();
+        // The builder thread is detached, the captured shared pointers keep both the source
+        // mesh and the chain alive until the build finishes.
+        std::thread([lods = entry.lods, mesh]() { lods->build(mesh); }).detach();
+    }
+    return entry.lods;
+}
+
+void GLVolumeLODs::build(const std::shared_ptr<const TriangleMesh> &mesh)
+{
+    indexed_triangle_set its = mesh->its;
+    m_num_triangles_full = its.indices.size();
+    for (size_t target = m_num_triangles_full / LODDecimationFactor; target >= LODMinTriangles; target /= LODDecimationFactor) {
+        // Decimate progressively, each level starts from the previous one.
+        its_quadric_edge_collapse(its, uint32_t(target));
+        LOD &lod = m_lods.emplace_back();
+        lod.num_triangles = its.indices.size();
+        // Fills the CPU side geometry only, the data are sent to the GPU by the first render()
+        // on the OpenGL thread.
+        lod.model.init_from(its);
+    }
+    m_ready.store(true, std::memory_order_release);
+}
+
+GUI::GLModel* GLVolumeLODs::model_for_budget(size_t max_triangles)
+{
+    if (! m_ready.load(std::memory_order_acquire) || m_lods.empty() || max_triangles >= m_num_triangles_full)
+        return nullptr;
+    for (LOD &lod : m_lods)
+        if (lod.num_triangles <= max_triangles)
+            return &lod.model;
+    return &m_lods.back().model;
+}
+
 const float GLVolume::SinkingContours::HalfWidth = 0.25f;
 
 void GLVolume::SinkingContours::render()
@@ -413,8 +487,12 @@ void GLVolume::render()
         glsafe(::glFrontFace(GL_CW));
     glsafe(::glCullFace(GL_BACK));
 
-    if (tverts_range == std::make_pair<size_t, size_t>(0, -1))
-        model.render();
+    if (tverts_range == std::make_pair<size_t, size_t>(0, -1)) {
+        if (lod_model != nullptr)
+            lod_model->render();
+        else
+            model.render();
+    }
     else
         model.render(this->tverts_range);
 
@@ -478,12 +556,13 @@ int GLVolumeCollection::load_object_volume(
 #if ENABLE_SMOOTH_NORMALS
     v.model.init_from(*mesh, true);
     if (m_use_raycasters)
-      v.mesh_raycaster = std::make_unique<GUI::MeshRaycaster>(mesh);
+      v.mesh_raycaster = GUI::MeshRaycasterCache::get(mesh);
 #else
     v.model.init_from(*mesh);
     if (m_use_raycasters)
-      v.mesh_raycaster = std::make_unique<GUI::MeshRaycaster>(mesh);
+      v.mesh_raycaster = GUI::MeshRaycasterCache::get(mesh);
 #endif // ENABLE_SMOOTH_NORMALS
+    v.lods = GLVolumeLODs::get(mesh);
     v.composite_id = GLVolume::CompositeID(obj_idx, volume_idx, instance_idx);
     if (model_volume->is_model_part()) {
         // GLVolume will reference a convex hull from model_volume!
@@ -600,7 +679,7 @@ int GLVolumeCollection::load_wipe_tower_preview(
 #endif // SLIC3R_OPENGL_ES
     v.model.init_from(mesh);
     v.model.set_color(color);
-    v.mesh_raycaster = std::make_unique<GUI::MeshRaycaster>(std::make_shared<const TriangleMesh>(mesh));
+    v.mesh_raycaster = std::make_shared<const GUI::MeshRaycaster>(std::make_shared<const TriangleMesh>(mesh));
     v.set_convex_hull(mesh.convex_hull_3d());
     v.set_volume_offset(Vec3d(pos_x, pos_y, 0.0));
     v.set_volume_rotation(Vec3d(0., 0., (M_PI / 180.) * rotation_angle));
@@ -639,7 +718,7 @@ void GLVolumeCollection::load_object_auxiliary(
 #else
         v.model.init_from(mesh);
         v.model.set_color(color);
-        v.mesh_raycaster = std::make_unique<GUI::MeshRaycaster>(std::make_shared<const TriangleMesh>(mesh));
+        v.mesh_raycaster = std::make_shared<const GUI::MeshRaycaster>(std::make_shared<const TriangleMesh>(mesh));
 #endif // ENABLE_SMOOTH_NORMALS
         v.composite_id = GLVolume::CompositeID(obj_idx, -int(step), inst_idx);
         v.geometry_id = std::pair<size_t, size_t>(timestamp, model_instance.id().id);
@@ -710,18 +789,75 @@ GLVolume* GLVolumeCollection::new_nontoolpath_volume(const ColorRGBA& rgba)
     return out;
 }
 
-GLVolumeWithIdAndZList volumes_to_render(const GLVolumePtrs& volumes, GLVolumeCollection::ERenderType type, const Transform3d& view_matrix, std::function<bool(const GLVolume&)> filter_func)
+// Extracts the six clipping planes of the view frustum from the combined projection * view matrix
+// (Gribb & Hartmann). The planes are left unnormalized, which is sufficient for half-space sign tests.
+static std::array<Vec4d, 6> extract_frustum_planes(const Transform3d& view_matrix, const Transform3d& projection_matrix)
+{
+    const Eigen::Matrix4d m = (projection_matrix * view_matrix).matrix();
+    return { Vec4d((m.row(3) + m.row(0)).transpose()),   // left
+             Vec4d((m.row(3) - m.row(0)).transpose()),   // right
+             Vec4d((m.row(3) + m.row(1)).transpose()),   // bottom
+             Vec4d((m.row(3) - m.row(1)).transpose()),   // top
+             Vec4d((m.row(3) + m.row(2)).transpose()),   // near
+             Vec4d((m.row(3) - m.row(2)).transpose()) }; // far
+}
+
+// Conservative test whether an axis aligned box intersects the view frustum: for each frustum plane
+// only the box corner furthest in the direction of the plane normal is tested (p-vertex test),
+// thus a box is never culled if any part of it is visible.
+static bool frustum_intersects(const std::array<Vec4d, 6>& planes, const BoundingBoxf3& box)
+{
+    for (const Vec4d& plane : planes) {
+        const Vec3d p(plane.x() >= 0. ? box.max.x() : box.min.x(),
+                      plane.y() >= 0. ? box.max.y() : box.min.y(),
+                      plane.z() >= 0. ? box.max.z() : box.min.z());
+        if (plane.head<3>().dot(p) + plane.w() < 0.)
+            return false;
+    }
+    return true;
+}
+
+// Estimate the number of pixels the volume covers on screen and derive the triangle budget
+// for the LOD selection: roughly one triangle per pixel of the projected bounding box.
+static size_t lod_triangle_budget(const GLVolume& volume, const Transform3d& view_matrix, const Transform3d& projection_matrix, double viewport_height)
+{
+    const BoundingBoxf3 box    = volume.transformed_bounding_box();
+    const double        radius = 0.5 * box.size().norm();
+    const Eigen::Matrix4d& proj = projection_matrix.matrix();
+    double diameter_ndc;
+    if (proj(3, 2) != 0.) {
+        // Perspective projection, the projected size scales with the eye space distance.
+        const double dist = - (view_matrix * box.center()).z();
+        if (dist <= radius)
+            // The camera is inside or close to the volume, render at full resolution.
+            return std::numeric_limits<size_t>::max();
+        // proj(1, 1) scales eye space Y to normalized device coordinates.
+        diameter_ndc = 2. * radius * proj(1, 1) / dist;
+    }
+    else
+        // Orthographic projection.
+        diameter_ndc = 2. * radius * proj(1, 1);
+    const double diameter_px = 0.5 * diameter_ndc * viewport_height;
+    return size_t(std::max(0., diameter_px * diameter_px));
+}
+
+GLVolumeWithIdAndZList volumes_to_render(const GLVolumePtrs& volumes, GLVolumeCollection::ERenderType type, const Transform3d& view_matrix, std::function<bool(const GLVolume&)> filter_func, const Transform3d* projection_matrix)
 {
     GLVolumeWithIdAndZList list;
     list.reserve(volumes.size());
 
+    std::optional<std::array<Vec4d, 6>> frustum_planes;
+    if (projection_matrix != nullptr)
+        frustum_planes = extract_frustum_planes(view_matrix, *projection_matrix);
+
     for (unsigned int i = 0; i < (unsigned int)volumes.size(); ++i) {
         GLVolume* volume = volumes[i];
         bool is_transparent = volume->render_color.is_transparent();
         if (((type == GLVolumeCollection::ERenderType::Opaque && !is_transparent) ||
              (type == GLVolumeCollection::ERenderType::Transparent && is_transparent) ||
              type == GLVolumeCollection::ERenderType::All) &&
-            (! filter_func || filter_func(*volume)))
+            (! filter_func || filter_func(*volume)) &&
+            (! frustum_planes || volume->empty() || frustum_intersects(*frustum_planes, volume->transformed_bounding_box())))
             list.emplace_back(std::make_pair(volume, std::make_pair(i, 0.0)));
     }
 
@@ -746,7 +882,7 @@ GLVolumeWithIdAndZList volumes_to_render(const GLVolumePtrs& volumes, GLVolumeCo
 void GLVolumeCollection::render(GLVolumeCollection::ERenderType type, bool disable_cullface, const Transform3d& view_matrix, const Transform3d& projection_matrix,
     std::function<bool(const GLVolume&)> filter_func) const
 {
-    GLVolumeWithIdAndZList to_render = volumes_to_render(volumes, type, view_matrix, filter_func);
+    GLVolumeWithIdAndZList to_render = volumes_to_render(volumes, type, view_matrix, filter_func, &projection_matrix);
     if (to_render.empty())
         return;
 
@@ -793,13 +929,26 @@ void GLVolumeCollection::render(GLVolumeCollection::ERenderType type, bool disab
 
 
 
+    // The volumes are rendered in state-sorted batches (one batch per shader program), so that the
+    // shader is switched at most twice per render type and the uniforms invariant during the frame
+    // are uploaded once per batch instead of once per volume. Partitioning keeps the relative order
+    // of the volumes inside each batch, thus the back to front order of the transparent volumes is
+    // preserved (volumes are never rendered as MMU painted in the transparent pass anyway).
+    // Viewport height in pixels for the screen space size estimate of the LOD selection.
+    GLint viewport[4] = { 0, 0, 0, 0 };
+    glsafe(::glGetIntegerv(GL_VIEWPORT, viewport));
+
+    std::vector<GLVolume*> batch_regular, batch_mmu_painted;
+    batch_regular.reserve(to_render.size());
     for (GLVolumeWithIdAndZ& volume : to_render) {
         if (!volume.first->is_active)
             continue;
-
-        const Transform3d world_matrix = volume.first->world_matrix();
-        const Matrix3d world_matrix_inv_transp = world_matrix.linear().inverse().transpose();
-        const Matrix3d view_normal_matrix = view_matrix.linear() * world_matrix_inv_transp;
+        // Select the level of detail for this frame. Selected and hovered volumes keep
+        // the full resolution, as the user is likely inspecting or editing them.
+        volume.first->lod_model = nullptr;
+        if (volume.first->lods != nullptr && !volume.first->selected && volume.first->hover == GLVolume::HS_None)
+            volume.first->lod_model = volume.first->lods->model_for_budget(
+                lod_triangle_budget(*volume.first, view_matrix, projection_matrix, double(viewport[3])));
         const int obj_idx = volume.first->object_idx();
         const int vol_idx = volume.first->volume_idx();
         const bool render_as_mmu_painted = is_render_as_mmu_painted_enabled && !volume.first->selected &&
@@ -807,41 +956,91 @@ void GLVolumeCollection::render(GLVolumeCollection::ERenderType type, bool disab
             !model_objects[obj_idx]->volumes[vol_idx]->mm_segmentation_facets.empty() &&
             type != GLVolumeCollection::ERenderType::Transparent; // to filter out shells (not very nice)
         volume.first->set_render_color(true);
+        (render_as_mmu_painted ? batch_mmu_painted : batch_regular).emplace_back(volume.first);
+    }
 
-        // render sinking contours of non-hovered volumes
-        if (sink_shader != nullptr) {
-            sink_shader->start_using();
-            if (m_show_sinking_contours) {
-                if (volume.first->is_sinking() && !volume.first->is_below_printbed() &&
-                    volume.first->hover == GLVolume::HS_None && !volume.first->force_sinking_contours) {
-                    volume.first->render_sinking_contours();
-                }
+    // render sinking contours of non-hovered volumes
+    if (m_show_sinking_contours && sink_shader != nullptr) {
+        sink_shader->start_using();
+        for (GLVolumeWithIdAndZ& volume : to_render) {
+            if (volume.first->is_active && volume.first->is_sinking() && !volume.first->is_below_printbed() &&
+                volume.first->hover == GLVolume::HS_None && !volume.first->force_sinking_contours) {
+                volume.first->render_sinking_contours();
             }
-            sink_shader->stop_using();
         }
+        sink_shader->stop_using();
+    }
 
-        if (render_as_mmu_painted && shader != mmu_painted_shader)
-            shader = mmu_painted_shader;
-        else if (!render_as_mmu_painted && shader != curr_shader)
-            shader = curr_shader;
+    if (!batch_regular.empty()) {
+        shader = curr_shader;
+        shader->start_using();
+        shader->set_uniform("z_range", m_z_range);
+        shader->set_uniform("clipping_plane", m_clipping_plane);
+        shader->set_uniform("use_color_clip_plane", m_use_color_clip_plane);
+        shader->set_uniform("color_clip_plane", m_color_clip_plane);
+        shader->set_uniform("uniform_color_clip_plane_1", m_color_clip_plane_colors[0]);
+        shader->set_uniform("uniform_color_clip_plane_2", m_color_clip_plane_colors[1]);
+        shader->set_uniform("print_volume.type", static_cast<int>(m_print_volume.type));
+        shader->set_uniform("print_volume.xy_data", m_print_volume.data);
+        shader->set_uniform("print_volume.z_data", m_print_volume.zs);
+        shader->set_uniform("slope.normal_z", m_slope.normal_z);
+        shader->set_uniform("projection_matrix", projection_matrix);
 
-        if (render_as_mmu_painted) {
-            shader->start_using();
-            const std::array<float, 4> clp_data = { 0.0f, 0.0f, 1.0f, FLT_MAX };
-            const std::array<float, 2> z_range = { -FLT_MAX, FLT_MAX };
-            const bool is_left_handed = volume.first->is_left_handed();
+#if ENABLE_ENVIRONMENT_MAP
+        unsigned int environment_texture_id = GUI::wxGetApp().plater()->get_environment_texture_id();
+        bool use_environment_texture = environment_texture_id > 0 && GUI::wxGetApp().app_config->get_bool("use_environment_map");
+        shader->set_uniform("use_environment_tex", use_environment_texture);
+        if (use_environment_texture)
+            glsafe(::glBindTexture(GL_TEXTURE_2D, environment_texture_id));
+#endif // ENABLE_ENVIRONMENT_MAP
+        glcheck();
+
+        for (GLVolume* volume : batch_regular) {
+            const Transform3d world_matrix = volume->world_matrix();
+            const Matrix3d world_matrix_inv_transp = world_matrix.linear().inverse().transpose();
+            const Matrix3d view_normal_matrix = view_matrix.linear() * world_matrix_inv_transp;
+            shader->set_uniform("volume_world_matrix", world_matrix);
+            shader->set_uniform("slope.actived", m_slope.active && !volume->is_modifier && !volume->is_wipe_tower);
+            shader->set_uniform("slope.volume_world_normal_matrix", static_cast<Matrix3f>(world_matrix_inv_transp.cast<float>()));
+
+            volume->model.set_color(volume->render_color);
+            shader->set_uniform("view_model_matrix", view_matrix * world_matrix);
+            shader->set_uniform("view_normal_matrix", view_normal_matrix);
+            volume->render();
+        }
+
+#if ENABLE_ENVIRONMENT_MAP
+        if (use_environment_texture)
+            glsafe(::glBindTexture(GL_TEXTURE_2D, 0));
+#endif // ENABLE_ENVIRONMENT_MAP
+
+        glsafe(::glBindBuffer(GL_ARRAY_BUFFER, 0));
+        glsafe(::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
+        shader->stop_using();
+    }
+
+    if (!batch_mmu_painted.empty()) {
+        shader = mmu_painted_shader;
+        shader->start_using();
+        const std::array<float, 4> clp_data = { 0.0f, 0.0f, 1.0f, FLT_MAX };
+        const std::array<float, 2> z_range = { -FLT_MAX, FLT_MAX };
+        shader->set_uniform("clipping_plane", clp_data);
+        shader->set_uniform("z_range", z_range);
+        shader->set_uniform("projection_matrix", projection_matrix);
+
+        for (GLVolume* volume : batch_mmu_painted) {
+            const Transform3d world_matrix = volume->world_matrix();
+            const Matrix3d view_normal_matrix = view_matrix.linear() * world_matrix.linear().inverse().transpose();
+            const bool is_left_handed = volume->is_left_handed();
             shader->set_uniform("volume_world_matrix", world_matrix);
             shader->set_uniform("volume_mirrored", is_left_handed);
-            shader->set_uniform("clipping_plane", clp_data);
-            shader->set_uniform("z_range", z_range);
             shader->set_uniform("view_model_matrix", view_matrix * world_matrix);
-            shader->set_uniform("projection_matrix", projection_matrix);
             shader->set_uniform("view_normal_matrix", view_normal_matrix);
 
             if (is_left_handed)
                 glsafe(::glFrontFace(GL_CW));
 
-            const ModelVolume& model_volume = *model_objects[obj_idx]->volumes[vol_idx];
+            const ModelVolume& model_volume = *model_objects[volume->object_idx()]->volumes[volume->volume_idx()];
             const size_t extruder_idx = ModelVolume::get_extruder_color_idx(model_volume, GUI::wxGetApp().extruders_edited_cnt());
 
 
@@ -862,54 +1061,13 @@ void GLVolumeCollection::render(GLVolumeCollection::ERenderType type, bool disab
                 it->second.time_used = time_now;
             }
 
-            
+
             ts->render(nullptr, world_matrix);
 
             if (is_left_handed)
                 glsafe(::glFrontFace(GL_CCW));
-
-            shader->stop_using();
-        }
-        else {
-            shader->start_using();
-            shader->set_uniform("z_range", m_z_range);
-            shader->set_uniform("clipping_plane", m_clipping_plane);
-            shader->set_uniform("use_color_clip_plane", m_use_color_clip_plane);
-            shader->set_uniform("color_clip_plane", m_color_clip_plane);
-            shader->set_uniform("uniform_color_clip_plane_1", m_color_clip_plane_colors[0]);
-            shader->set_uniform("uniform_color_clip_plane_2", m_color_clip_plane_colors[1]);
-            shader->set_uniform("print_volume.type", static_cast<int>(m_print_volume.type));
-            shader->set_uniform("print_volume.xy_data", m_print_volume.data);
-            shader->set_uniform("print_volume.z_data", m_print_volume.zs);
-            shader->set_uniform("volume_world_matrix", world_matrix);
-            shader->set_uniform("slope.actived", m_slope.active && !volume.first->is_modifier && !volume.first->is_wipe_tower);
-            shader->set_uniform("slope.volume_world_normal_matrix", static_cast<Matrix3f>(world_matrix_inv_transp.cast<float>()));
-            shader->set_uniform("slope.normal_z", m_slope.normal_z);
-
-#if ENABLE_ENVIRONMENT_MAP
-            unsigned int environment_texture_id = GUI::wxGetApp().plater()->get_environment_texture_id();
-            bool use_environment_texture = environment_texture_id > 0 && GUI::wxGetApp().app_config->get_bool("use_environment_map");
-            shader->set_uniform("use_environment_tex", use_environment_texture);
-            if (use_environment_texture)
-                glsafe(::glBindTexture(GL_TEXTURE_2D, environment_texture_id));
-#endif // ENABLE_ENVIRONMENT_MAP
-            glcheck();
-
-            volume.first->model.set_color(volume.first->render_color);
-            shader->set_uniform("view_model_matrix", view_matrix * world_matrix);
-            shader->set_uniform("projection_matrix", projection_matrix);
-            shader->set_uniform("view_normal_matrix", view_normal_matrix);
-            volume.first->render();
-
-#if ENABLE_ENVIRONMENT_MAP
-            if (use_environment_texture)
-                glsafe(::glBindTexture(GL_TEXTURE_2D, 0));
-#endif // ENABLE_ENVIRONMENT_MAP
-
-            glsafe(::glBindBuffer(GL_ARRAY_BUFFER, 0));
-            glsafe(::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
-            shader->stop_using();
         }
+        shader->stop_using();
     }
 
 
@@ -26,7 +26,9 @@
 #include "GLModel.hpp"
 #include "MeshUtils.hpp"
 
+#include <atomic>
 #include <functional>
+#include <memory>
 #include <optional>
 
 #ifndef NDEBUG
@@ -61,6 +63,39 @@ enum ModelInstanceEPrintVolumeState : unsigned char;
 // Return appropriate color based on the ModelVolume.
 extern ColorRGBA color_from_model_volume(const ModelVolume& model_volume);
 
+// Chain of decimated versions of a volume mesh for level of detail rendering.
+// The chain is built asynchronously by a background thread at import and shared
+// between the GLVolumes referencing the same mesh.
+class GLVolumeLODs
+{
+public:
+    struct LOD {
+        GUI::GLModel model;
+        // Triangle count of the decimated mesh, used to match a LOD to a triangle budget.
+        size_t       num_triangles { 0 };
+    };
+
+    // Return the LOD chain of the given mesh, scheduling a background build on the first call.
+    // Returns nullptr for meshes too small to be worth decimating.
+    // Chains of meshes no longer referenced by anything but the cache are dropped.
+    static std::shared_ptr<GLVolumeLODs> get(const std::shared_ptr<const TriangleMesh> &mesh);
+
+    // Finest LOD not exceeding the given triangle budget, the coarsest one if even that
+    // is above the budget. Returns nullptr if the budget allows the full resolution mesh
+    // or the background build did not finish yet.
+    GUI::GLModel* model_for_budget(size_t max_triangles);
+
+private:
+    void build(const std::shared_ptr<const TriangleMesh> &mesh);
+
+    // Decimated models ordered from the finest to the coarsest. Filled by the builder
+    // thread, published by m_ready, not to be touched by the render thread before.
+    std::vector<LOD>  m_lods;
+    // Triangle count of the source mesh.
+    size_t            m_num_triangles_full { 0 };
+    std::atomic<bool> m_ready { false };
+};
+
 class GLVolume {
 public:
     static const ColorRGBA SELECTED_COLOR;
@@ -206,7 +241,13 @@ public:
 
     GUI::GLModel            model;
     // raycaster used for picking
-    std::unique_ptr<GUI::MeshRaycaster> mesh_raycaster;
+    // Shared with the other consumers of the same mesh through GUI::MeshRaycasterCache.
+    std::shared_ptr<const GUI::MeshRaycaster> mesh_raycaster;
+    // Level of detail chain of the volume mesh, shared between the GLVolumes of the same mesh.
+    std::shared_ptr<GLVolumeLODs> lods;
+    // Decimated model selected for the current frame by GLVolumeCollection::render() from the
+    // projected screen size of the volume, nullptr to render at full resolution.
+    GUI::GLModel*               lod_model { nullptr };
     // Ranges of triangle and quad indices to be rendered.
     std::pair<size_t, size_t>   tverts_range;
 
@@ -500,7 +541,9 @@ private:
     GLVolumeCollection& operator=(const GLVolumeCollection &);
 };
 
-GLVolumeWithIdAndZList volumes_to_render(const GLVolumePtrs& volumes, GLVolumeCollection::ERenderType type, const Transform3d& view_matrix, std::function<bool(const GLVolume&)> filter_func = nullptr);
+// If projection_matrix is provided, the volumes whose world bounding box lies completely outside
+// of the view frustum are culled from the returned list.
+GLVolumeWithIdAndZList volumes_to_render(const GLVolumePtrs& volumes, GLVolumeCollection::ERenderType type, const Transform3d& view_matrix, std::function<bool(const GLVolume&)> filter_func = nullptr, const Transform3d* projection_matrix = nullptr);
 
 struct _3DScene
 {
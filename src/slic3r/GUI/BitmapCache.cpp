@@ -23,6 +23,9 @@
 #include <nanosvg/nanosvg.h>
 #include <nanosvg/nanosvgrast.h>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 namespace Slic3r { namespace GUI {
 
 BitmapCache::BitmapCache()
@@ -450,21 +453,24 @@ wxBitmapBundle* BitmapCache::from_png(const std::string& bitmap_name, unsigned w
     return this->insert_bndl(bitmap_key, wxImage_to_wxBitmap_with_alpha(std::move(image)));
 }
 
-wxBitmap* BitmapCache::load_svg(const std::string &bitmap_name, unsigned target_width, unsigned target_height, 
-    const bool grayscale/* = false*/, const bool dark_mode/* = false*/, const std::string& new_color /*= ""*/)
+static std::string svg_bitmap_key(const std::string &bitmap_name, unsigned target_width, unsigned target_height,
+    const bool grayscale, const bool dark_mode, const std::string &new_color, const double scale)
 {
-    std::string bitmap_key = bitmap_name + ( target_height !=0 ? 
-                                           "-h" + std::to_string(target_height) : 
-                                           "-w" + std::to_string(target_width))
-                                         + (m_scale != 1.0f ? "-s" + float_to_string_decimal_point(m_scale) : "")
-                                         + (dark_mode ? "-dm" : "")
-                                         + (grayscale ? "-gs" : "")
-                                         + new_color;
-
-    auto it = m_map.find(bitmap_key);
-    if (it != m_map.end())
-        return it->second;
+    return bitmap_name + ( target_height !=0 ?
+                         "-h" + std::to_string(target_height) :
+                         "-w" + std::to_string(target_width))
+                       + (scale != 1.0f ? "-s" + float_to_string_decimal_point(scale) : "")
+                       + (dark_mode ? "-dm" : "")
+                       + (grayscale ? "-gs" : "")
+                       + new_color;
+}
 
+// Rasterize an SVG icon into a raw RGBA buffer with nanosvg.
+// Pure CPU work without any wxWidgets calls, thus safe to run off the GUI thread.
+static bool rasterize_svg(const std::string &bitmap_name, unsigned target_width, unsigned target_height,
+    const double scale, const bool dark_mode, const std::string &new_color,
+    int &width, int &height, std::vector<unsigned char> &data)
+{
     // map of color replaces
     std::map<std::string, std::string> replaces;
     if (dark_mode)
@@ -472,38 +478,88 @@ wxBitmap* BitmapCache::load_svg(const std::string &bitmap_name, unsigned target_
     if (!new_color.empty())
         replaces["#ED6B21"] = new_color;
 
-    NSVGimage *image =  nsvgParseFromFileWithReplace(Slic3r::var(bitmap_name + ".svg").c_str(), "px", 96.0f, replaces);
+    NSVGimage *image =  BitmapCache::nsvgParseFromFileWithReplace(Slic3r::var(bitmap_name + ".svg").c_str(), "px", 96.0f, replaces);
     if (image == nullptr)
-        return nullptr;
+        return false;
 
-    target_height != 0 ? target_height *= m_scale : target_width *= m_scale;
+    target_height != 0 ? target_height *= scale : target_width *= scale;
 
-    float svg_scale = target_height != 0 ? 
+    float svg_scale = target_height != 0 ?
                   (float)target_height / image->height  : target_width != 0 ?
                   (float)target_width / image->width    : 1;
 
-    int   width    = (int)(svg_scale * image->width + 0.5f);
-    int   height   = (int)(svg_scale * image->height + 0.5f);
-    int   n_pixels = width * height;
+    width    = (int)(svg_scale * image->width + 0.5f);
+    height   = (int)(svg_scale * image->height + 0.5f);
+    int n_pixels = width * height;
     if (n_pixels <= 0) {
         ::nsvgDelete(image);
-        return nullptr;
+        return false;
     }
 
     NSVGrasterizer *rast = ::nsvgCreateRasterizer();
     if (rast == nullptr) {
         ::nsvgDelete(image);
-        return nullptr;
+        return false;
     }
 
-    std::vector<unsigned char> data(n_pixels * 4, 0);
+    data.assign(n_pixels * 4, 0);
     ::nsvgRasterize(rast, image, 0, 0, svg_scale, data.data(), width, height, width * 4);
     ::nsvgDeleteRasterizer(rast);
     ::nsvgDelete(image);
+    return true;
+}
+
+wxBitmap* BitmapCache::load_svg(const std::string &bitmap_name, unsigned target_width, unsigned target_height,
+    const bool grayscale/* = false*/, const bool dark_mode/* = false*/, const std::string& new_color /*= ""*/)
+{
+    std::string bitmap_key = svg_bitmap_key(bitmap_name, target_width, target_height, grayscale, dark_mode, new_color, m_scale);
+
+    auto it = m_map.find(bitmap_key);
+    if (it != m_map.end())
+        return it->second;
+
+    int                        width  = 0;
+    int                        height = 0;
+    std::vector<unsigned char> data;
+    if (! rasterize_svg(bitmap_name, target_width, target_height, m_scale, dark_mode, new_color, width, height, data))
+        return nullptr;
 
     return this->insert_raw_rgba(bitmap_key, width, height, data.data(), grayscale);
 }
 
+void BitmapCache::preload_svgs(const std::vector<SVGRequest> &requests)
+{
+    struct Raster {
+        std::string                bitmap_key;
+        int                        width  = 0;
+        int                        height = 0;
+        std::vector<unsigned char> data;
+    };
+    std::vector<Raster> rasters(requests.size());
+    // Leave the bitmap_key of the icons already cached empty, they are skipped below.
+    for (size_t i = 0; i < requests.size(); ++ i)
+        if (std::string bitmap_key = svg_bitmap_key(requests[i].name, requests[i].width, requests[i].height,
+                requests[i].grayscale, requests[i].dark_mode, requests[i].new_color, m_scale);
+            m_map.find(bitmap_key) == m_map.end())
+            rasters[i].bitmap_key = std::move(bitmap_key);
+
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, requests.size()),
+        [this, &requests, &rasters](const tbb::blocked_range<size_t> &range) {
+        for (size_t i = range.begin(); i < range.end(); ++ i) {
+            Raster &raster = rasters[i];
+            if (! raster.bitmap_key.empty() &&
+                ! rasterize_svg(requests[i].name, requests[i].width, requests[i].height, m_scale,
+                                requests[i].dark_mode, requests[i].new_color, raster.width, raster.height, raster.data))
+                raster.bitmap_key.clear();
+        }
+    });
+
+    // The wxBitmap construction is not thread safe on all platforms, insert on the calling thread.
+    for (size_t i = 0; i < requests.size(); ++ i)
+        if (! rasters[i].bitmap_key.empty())
+            this->insert_raw_rgba(rasters[i].bitmap_key, rasters[i].width, rasters[i].height, rasters[i].data.data(), requests[i].grayscale);
+}
+
 //we make scaled solid bitmaps only for the cases, when its will be used with scaled SVG icon in one output bitmap
 //wxBitmap BitmapCache::mksolid(size_t width, size_t height, unsigned char r, unsigned char g, unsigned char b, unsigned char transparency, bool suppress_scaling/* = false* /, size_t border_width /*= 0* /, bool dark_mode/* = false* /)
 //{
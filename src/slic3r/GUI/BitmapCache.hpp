@@ -59,6 +59,21 @@ public:
 	// Load svg from resources/icons. bitmap_key is given without the .svg suffix. SVG will be rasterized to provided height/width.
     wxBitmap* 		load_svg(const std::string &bitmap_key, unsigned width = 0, unsigned height = 0, const bool grayscale = false, const bool dark_mode = false, const std::string& new_color = "");
 
+	// One icon of a batch to be rasterized by preload_svgs().
+	struct SVGRequest {
+		std::string name;
+		unsigned    width     = 0;
+		unsigned    height    = 0;
+		bool        grayscale = false;
+		bool        dark_mode = false;
+		std::string new_color;
+	};
+	// Rasterize a batch of SVG icons in parallel and insert them into the cache, so that
+	// a dialog may warm up its icon set before it is shown. The nanosvg parsing and
+	// rasterization runs on worker threads, while the wxBitmap construction is kept on
+	// the calling (GUI) thread. Icons already present in the cache are skipped.
+	void 			preload_svgs(const std::vector<SVGRequest> &requests);
+
 	wxBitmapBundle	mksolid(size_t width, size_t height, unsigned char r, unsigned char g, unsigned char b, unsigned char transparency, size_t border_width = 0, bool dark_mode = false);
 	wxBitmapBundle*	mksolid_bndl(size_t width, size_t height, const std::string& color = std::string(), size_t border_width = 0, bool dark_mode = false);
 	wxBitmapBundle* mkclear_bndl(size_t width, size_t height) { return 	mksolid_bndl(width, height); }
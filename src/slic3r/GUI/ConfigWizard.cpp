@@ -17,6 +17,7 @@
 #include <utility>
 #include <unordered_map>
 #include <stdexcept>
+#include <tbb/parallel_for.h>
 #include <boost/format.hpp>
 #include <boost/log/trivial.hpp>
 #include <boost/algorithm/string/predicate.hpp>
@@ -178,6 +179,9 @@ BundleMap BundleMap::load()
     // Should we concider case where archive has older profiles than resources (shouldnt happen)? -> YES, it happens during re-configuration when running older PS after newer version
     typedef std::pair<const fs::path&, BundleLocation> DirData;
     std::vector<DirData> dir_list { {vendor_dir, BundleLocation::IN_VENDOR},  {archive_dir, BundleLocation::IN_ARCHIVE},  {rsrc_vendor_dir, BundleLocation::IN_RESOURCES} };
+    // Bundles that passed the cheap screening below, to be fully parsed in parallel afterwards.
+    struct PendingBundle { std::string id; fs::path path; BundleLocation location; };
+    std::vector<PendingBundle> pending;
     for ( auto dir : dir_list) {
         if (!fs::exists(dir.first))
             continue;
@@ -185,8 +189,9 @@ BundleMap BundleMap::load()
             if (Slic3r::is_ini_file(dir_entry)) {
                 std::string id = dir_entry.path().stem().string();  // stem() = filename() without the trailing ".ini" part
 
-                // Don't load this bundle if we've already loaded it.
+                // Don't load this bundle if we've already loaded it or queued it for loading.
                 if (res.find(id) != res.end()) { continue; }
+                if (std::any_of(pending.begin(), pending.end(), [&id](const PendingBundle &pb) { return pb.id == id; })) { continue; }
 
                 // Fresh index should be in archive_dir, otherwise look for it in cache 
                 // Then if not in archive or cache - it could be 3rd party profile that user just copied to vendor folder (both ini and cache)
@@ -234,20 +239,35 @@ BundleMap BundleMap::load()
                 // Don't load
                 if (vp.config_version > recommended)
                     continue;
+                pending.push_back({std::move(id), dir_entry.path(), dir.second});
+            }
+        }
+    }
+
+    // The screening above is cheap filesystem work; the full profile parse of each
+    // bundle is independent and dominates the wizard startup with many vendors
+    // installed, so parse the accepted bundles in parallel and insert them in the
+    // original scan order to keep the map contents deterministic.
+    std::vector<Bundle> loaded(pending.size());
+    std::vector<char>   load_success(pending.size(), false);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, pending.size()),
+        [&pending, &loaded, &load_success](const tbb::blocked_range<size_t> &range) {
+            for (size_t i = range.begin(); i != range.end(); ++i) {
                 // Load full VP.
                 try {
-                    vp = VendorProfile::from_ini(dir_entry, true);
+                    VendorProfile::from_ini(pending[i].path, true);
                 }
                 catch (const std::exception& e) {
-                    BOOST_LOG_TRIVIAL(error) << format("Could not load bundle %1% due to corrupted profile file %2%. Message: %3%", id, dir_entry.path().string(), e.what());
+                    BOOST_LOG_TRIVIAL(error) << format("Could not load bundle %1% due to corrupted profile file %2%. Message: %3%", pending[i].id, pending[i].path.string(), e.what());
                     continue;
                 }
-                Bundle bundle;
-                if (bundle.load(dir_entry.path(), dir.second))
-                    res.emplace(std::move(id), std::move(bundle));
+                load_success[i] = loaded[i].load(pending[i].path, pending[i].location);
             }
-        }
-    }
+        });
+
+    for (size_t i = 0; i < pending.size(); ++i)
+        if (load_success[i])
+            res.emplace(std::move(pending[i].id), std::move(loaded[i]));
 
     return res;
 }
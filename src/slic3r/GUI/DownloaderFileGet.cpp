@@ -4,7 +4,10 @@
 ///|/
 #include "DownloaderFileGet.hpp"
 
+#include <atomic>
+#include <mutex>
 #include <thread>
+#include <vector>
 #include <curl/curl.h>
 #include <boost/nowide/fstream.hpp>
 #include <boost/format.hpp>
@@ -21,6 +24,11 @@ namespace GUI {
 
 const size_t DOWNLOAD_MAX_CHUNK_SIZE	= 10 * 1024 * 1024;
 const size_t DOWNLOAD_SIZE_LIMIT		= 1024 * 1024 * 1024;
+// Downloads at least twice this size whose server accepts byte ranges are split
+// into up to DOWNLOAD_MAX_SEGMENTS ranges downloaded in parallel.
+const size_t DOWNLOAD_SEGMENT_MIN_SIZE	= 32 * 1024 * 1024;
+const size_t DOWNLOAD_MAX_SEGMENTS		= 4;
+const int    DOWNLOAD_SEGMENT_RETRIES	= 3;
 
 std::string FileGet::escape_url(const std::string& unescaped)
 {
@@ -82,6 +90,16 @@ unsigned get_current_pid()
 	return ::getpid();
 #endif
 }
+
+// fseek with a 64 bit offset, so that segments beyond 2GB are addressable on Windows.
+int file_seek(FILE *file, size_t offset)
+{
+#ifdef WIN32
+	return _fseeki64(file, __int64(offset), SEEK_SET);
+#else
+	return fseeko(file, off_t(offset), SEEK_SET);
+#endif
+}
 }
 
 // int = DOWNLOAD ID; string = file path
@@ -111,9 +129,21 @@ struct FileGet::priv
 	std::atomic_bool m_stopped { false }; // either canceled or paused - download is not running
 	size_t m_written { 0 };
 	size_t m_absolute_size { 0 };
+	struct Segment {
+		size_t begin;
+		size_t end;     // one past the last byte of the segment
+		size_t written; // bytes of the segment already stored in the target file
+	};
+	// Non-empty while a segmented download is in progress. Survives pause / resume,
+	// so that resumed segments continue where they left off.
+	std::vector<Segment> m_segments;
 	priv(int ID, std::string&& url, const std::string& filename, wxEvtHandler* evt_handler, const boost::filesystem::path& dest_folder);
 
 	void get_perform();
+	// Queries the total size of the file behind m_url and whether the server accepts byte ranges.
+	// Returns false when the size could not be determined.
+	bool probe_size(size_t& size, bool& accept_ranges) const;
+	void get_perform_segmented(const boost::filesystem::path& dest_path, size_t total_size);
 };
 
 FileGet::priv::priv(int ID, std::string&& url, const std::string& filename, wxEvtHandler* evt_handler, const boost::filesystem::path& dest_folder)
@@ -135,7 +165,7 @@ void FileGet::priv::get_perform()
 	m_stopped = false;
 
 	// open dest file
-	if (m_written == 0)
+	if (m_written == 0 && m_segments.empty())
 	{
 		boost::filesystem::path dest_path = m_dest_folder / m_filename;
 		std::string extension = dest_path.extension().string();
@@ -184,6 +214,20 @@ void FileGet::priv::get_perform()
 	
 	BOOST_LOG_TRIVIAL(info) << GUI::format("Starting download from %1% to %2%. Temp path is %3%",m_url, dest_path, m_tmp_path);
 
+	if (! m_segments.empty()) {
+		// Resuming a paused segmented download.
+		get_perform_segmented(dest_path, m_absolute_size);
+		return;
+	}
+	if (size_t total_size = 0; m_written == 0) {
+		bool accept_ranges = false;
+		if (probe_size(total_size, accept_ranges) && accept_ranges
+			&& total_size >= 2 * DOWNLOAD_SEGMENT_MIN_SIZE && total_size <= DOWNLOAD_SIZE_LIMIT) {
+			get_perform_segmented(dest_path, total_size);
+			return;
+		}
+	}
+
 	FILE* file;
 	// open file for writting
 	if (m_written == 0)
@@ -323,6 +367,194 @@ void FileGet::priv::get_perform()
 
 }
 
+bool FileGet::priv::probe_size(size_t& size, bool& accept_ranges) const
+{
+	CURL* curl = curl_easy_init();
+	if (!curl) {
+		BOOST_LOG_TRIVIAL(error) << "Failed to init Curl library in function probe_size.";
+		return false;
+	}
+	bool ranges = false;
+	curl_easy_setopt(curl, CURLOPT_URL, m_url.c_str());
+	curl_easy_setopt(curl, CURLOPT_NOBODY, 1L);
+	curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+	curl_easy_setopt(curl, CURLOPT_USERAGENT, SLIC3R_APP_NAME "/" SLIC3R_VERSION);
+	curl_easy_setopt(curl, CURLOPT_TIMEOUT, 10L);
+	curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, +[](char* buffer, size_t sz, size_t nitems, void* userp) -> size_t {
+		std::string line(buffer, sz * nitems);
+		if (boost::istarts_with(line, "Accept-Ranges:") && line.find("bytes") != std::string::npos)
+			*static_cast<bool*>(userp) = true;
+		return sz * nitems;
+	});
+	curl_easy_setopt(curl, CURLOPT_HEADERDATA, &ranges);
+	CURLcode res = curl_easy_perform(curl);
+	curl_off_t length = -1;
+	if (res == CURLE_OK)
+		curl_easy_getinfo(curl, CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &length);
+	curl_easy_cleanup(curl);
+	if (res != CURLE_OK || length <= 0)
+		return false;
+	size = size_t(length);
+	accept_ranges = ranges;
+	return true;
+}
+
+void FileGet::priv::get_perform_segmented(const boost::filesystem::path& dest_path, size_t total_size)
+{
+	wxString temp_path_wstring(m_tmp_path.wstring());
+
+	if (m_segments.empty()) {
+		// Fresh download: preallocate the target file (sparse where the filesystem supports it)
+		// and lay out the segments.
+		FILE* file = fopen(temp_path_wstring.c_str(), "wb");
+		if (file == NULL) {
+			wxCommandEvent* evt = new wxCommandEvent(EVT_DWNLDR_FILE_ERROR);
+			// TRN %1% = file path
+			evt->SetString(GUI::format_wxstr(_L("Can't create file at %1%"), temp_path_wstring));
+			evt->SetInt(m_id);
+			m_evt_handler->QueueEvent(evt);
+			return;
+		}
+		fclose(file);
+		boost::system::error_code ec;
+		boost::filesystem::resize_file(m_tmp_path, total_size, ec);
+		if (ec) {
+			std::remove(m_tmp_path.string().c_str());
+			wxCommandEvent* evt = new wxCommandEvent(EVT_DWNLDR_FILE_ERROR);
+			evt->SetString(GUI::format_wxstr(_L("Can't create file at %1%"), temp_path_wstring));
+			evt->SetInt(m_id);
+			m_evt_handler->QueueEvent(evt);
+			return;
+		}
+		size_t count = std::min(DOWNLOAD_MAX_SEGMENTS, total_size / DOWNLOAD_SEGMENT_MIN_SIZE);
+		size_t segment_size = total_size / count;
+		for (size_t i = 0; i < count; ++ i)
+			m_segments.push_back({ i * segment_size, i + 1 == count ? total_size : (i + 1) * segment_size, 0 });
+	}
+
+	m_absolute_size = total_size;
+
+	std::atomic<size_t> written_total { 0 };
+	for (const Segment& segment : m_segments)
+		written_total += segment.written;
+	std::atomic<int> last_percent { int(written_total * 100 / total_size) };
+	std::atomic_bool failed { false };
+	std::string error_message;
+	std::mutex error_mutex;
+
+	std::vector<std::thread> workers;
+	for (Segment& segment : m_segments) {
+		if (segment.written >= segment.end - segment.begin)
+			continue;
+		workers.emplace_back([this, &segment, &written_total, &last_percent, &failed, &error_message, &error_mutex, &temp_path_wstring, total_size]() {
+			for (int attempt = 0; attempt < DOWNLOAD_SEGMENT_RETRIES; ++ attempt) {
+				if (m_cancel || m_pause || failed)
+					return;
+				FILE* file = fopen(temp_path_wstring.c_str(), "r+b");
+				if (file == NULL || file_seek(file, segment.begin + segment.written) != 0) {
+					if (file != NULL)
+						fclose(file);
+					std::lock_guard<std::mutex> lock(error_mutex);
+					if (error_message.empty())
+						// TRN %1% = file path
+						error_message = into_u8(GUI::format_wxstr(_L("Can't create file at %1%"), temp_path_wstring));
+					failed = true;
+					return;
+				}
+				size_t segment_written_before = segment.written;
+				size_t flushed_this_attempt = 0;
+				bool transport_ok = true;
+				std::string range_string = std::to_string(segment.begin + segment.written) + "-" + std::to_string(segment.end - 1);
+				Http::get(m_url)
+					.size_limit(DOWNLOAD_SIZE_LIMIT)
+					.set_range(range_string)
+					.on_progress([&](Http::Progress progress, bool& cancel) {
+						if (m_cancel || m_pause || failed) {
+							cancel = true;
+							return;
+						}
+						if (progress.dlnow != 0 && (progress.dlnow - flushed_this_attempt > DOWNLOAD_MAX_CHUNK_SIZE || progress.dlnow == progress.dltotal)) {
+							fwrite(progress.buffer.data() + flushed_this_attempt, 1, progress.dlnow - flushed_this_attempt, file);
+							written_total += progress.dlnow - flushed_this_attempt;
+							flushed_this_attempt = progress.dlnow;
+							segment.written = segment_written_before + flushed_this_attempt;
+							int percent = int(written_total * 100 / total_size);
+							if (last_percent.exchange(percent) != percent) {
+								wxCommandEvent* evt = new wxCommandEvent(EVT_DWNLDR_FILE_PROGRESS);
+								evt->SetString(std::to_string(percent));
+								evt->SetInt(m_id);
+								m_evt_handler->QueueEvent(evt);
+							}
+						}
+					})
+					.on_error([&](std::string /* body */, std::string error, unsigned http_status) {
+						transport_ok = false;
+						if (attempt + 1 == DOWNLOAD_SEGMENT_RETRIES && !m_cancel && !m_pause) {
+							std::lock_guard<std::mutex> lock(error_mutex);
+							if (error_message.empty())
+								error_message = error.empty() ? GUI::format("HTTP %1%", http_status) : error;
+							failed = true;
+						}
+					})
+					.perform_sync();
+				fclose(file);
+				if (transport_ok || segment.written >= segment.end - segment.begin)
+					return;
+				BOOST_LOG_TRIVIAL(error) << GUI::format("Download of segment %1%-%2% failed on attempt %3%.", segment.begin, segment.end, attempt + 1);
+			}
+		});
+	}
+	for (std::thread& worker : workers)
+		worker.join();
+
+	if (m_cancel) {
+		m_stopped = true;
+		std::remove(m_tmp_path.string().c_str());
+		m_segments.clear();
+		m_written = 0;
+		wxCommandEvent* evt = new wxCommandEvent(EVT_DWNLDR_FILE_CANCELED);
+		evt->SetInt(m_id);
+		m_evt_handler->QueueEvent(evt);
+		return;
+	}
+	if (m_pause) {
+		m_stopped = true;
+		// Keep m_segments, a resume continues each segment where it left off.
+		m_written = written_total;
+		wxCommandEvent* evt = new wxCommandEvent(EVT_DWNLDR_FILE_PAUSED);
+		evt->SetInt(m_id);
+		m_evt_handler->QueueEvent(evt);
+		return;
+	}
+	if (failed) {
+		wxCommandEvent* evt = new wxCommandEvent(EVT_DWNLDR_FILE_ERROR);
+		evt->SetString(GUI::from_u8(error_message));
+		evt->SetInt(m_id);
+		m_evt_handler->QueueEvent(evt);
+		return;
+	}
+
+	m_segments.clear();
+	m_written = total_size;
+	try
+	{
+		boost::filesystem::rename(m_tmp_path, dest_path);
+	}
+	catch (const std::exception& /*e*/)
+	{
+		wxCommandEvent* evt = new wxCommandEvent(EVT_DWNLDR_FILE_ERROR);
+		evt->SetString("Failed to write and move.");
+		evt->SetInt(m_id);
+		m_evt_handler->QueueEvent(evt);
+		return;
+	}
+
+	wxCommandEvent* evt = new wxCommandEvent(EVT_DWNLDR_FILE_COMPLETE);
+	evt->SetString(dest_path.wstring());
+	evt->SetInt(m_id);
+	m_evt_handler->QueueEvent(evt);
+}
+
 FileGet::FileGet(int ID, std::string url, const std::string& filename, wxEvtHandler* evt_handler, const boost::filesystem::path& dest_folder)
 	: p(new priv(ID, std::move(url), filename, evt_handler, dest_folder))
 {}
@@ -1077,6 +1077,7 @@ void GCodeViewer::load_as_gcode(const GCodeProcessorResult& gcode_result, const
     }
 
     m_print_statistics = gcode_result.print_statistics;
+    m_legend_columns_cache.reset();
 
     PrintEstimatedStatistics::ETimeMode time_mode = convert(m_viewer.get_time_mode());
     if (m_viewer.get_time_mode() != libvgcode::ETimeMode::Normal) {
@@ -1131,6 +1132,7 @@ void GCodeViewer::reset()
     m_sequential_view.gcode_window.reset();
     m_contained_in_bed = true;
     m_legend_resizer.reset();
+    m_legend_columns_cache.reset();
 }
 
 void GCodeViewer::render()
@@ -2125,14 +2127,14 @@ void GCodeViewer::render_legend(float& legend_height)
         std::vector<std::pair<ColorRGBA, std::pair<double, double>>> ret;
         ret.reserve(custom_gcode_per_print_z.size());
 
+        // get_layers_zs() returns the layers by value, get the copy once instead of per item
+        const std::vector<float> zs = m_viewer.get_layers_zs();
         for (const auto& item : custom_gcode_per_print_z) {
             if (extruder_id + 1 != static_cast<unsigned char>(item.extruder))
                 continue;
 
             if (item.type != CustomGCode::ColorChange)
                 continue;
-
-            const std::vector<float> zs = m_viewer.get_layers_zs();
             auto lower_b = std::lower_bound(zs.begin(), zs.end(),
                 static_cast<float>(item.print_z - Slic3r::CustomGCode::epsilon()));
             if (lower_b == zs.end())
@@ -2209,7 +2211,46 @@ void GCodeViewer::render_legend(float& legend_height)
     std::vector<double> used_filaments_g;
     float max_time_percent = 0.0f;
 
-    if (curr_view_type == libvgcode::EViewType::FeatureType) {
+    // The labels, the formatted times and the measured column offsets below only depend on
+    // slow changing state (view type, time mode, units, font, loaded print), not on the frame,
+    // thus they are reused from the cache until the hash of that state changes.
+    bool columns_cache_valid = false;
+    if (curr_view_type == libvgcode::EViewType::FeatureType || curr_view_type == libvgcode::EViewType::Tool) {
+        size_t state_hash = 0;
+        auto hash_combine = [&state_hash](size_t v) { state_hash ^= v + 0x9e3779b97f4a7c15ULL + (state_hash << 6) + (state_hash >> 2); };
+        hash_combine(std::hash<int>{}(curr_view_type_i));
+        hash_combine(std::hash<int>{}(static_cast<int>(m_viewer.get_time_mode())));
+        hash_combine(std::hash<bool>{}(imperial_units));
+        hash_combine(std::hash<float>{}(ImGui::GetFontSize()));
+        hash_combine(std::hash<float>{}(time_mode.time));
+        if (state_hash == 0)
+            // zero is reserved as the invalid state
+            state_hash = 1;
+        columns_cache_valid = m_legend_columns_cache.state_hash == state_hash;
+        m_legend_columns_cache.state_hash = state_hash;
+    }
+    auto load_columns_from_cache = [this, &offsets, &labels, &times, &percents, &used_filaments_m, &used_filaments_g, &max_time_percent]() {
+        offsets = m_legend_columns_cache.offsets;
+        labels = m_legend_columns_cache.labels;
+        times = m_legend_columns_cache.times;
+        percents = m_legend_columns_cache.percents;
+        used_filaments_m = m_legend_columns_cache.used_filaments_m;
+        used_filaments_g = m_legend_columns_cache.used_filaments_g;
+        max_time_percent = m_legend_columns_cache.max_time_percent;
+    };
+    auto store_columns_to_cache = [this, &offsets, &labels, &times, &percents, &used_filaments_m, &used_filaments_g, &max_time_percent]() {
+        m_legend_columns_cache.offsets = offsets;
+        m_legend_columns_cache.labels = labels;
+        m_legend_columns_cache.times = times;
+        m_legend_columns_cache.percents = percents;
+        m_legend_columns_cache.used_filaments_m = used_filaments_m;
+        m_legend_columns_cache.used_filaments_g = used_filaments_g;
+        m_legend_columns_cache.max_time_percent = max_time_percent;
+    };
+
+    if (curr_view_type == libvgcode::EViewType::FeatureType && columns_cache_valid)
+        load_columns_from_cache();
+    else if (curr_view_type == libvgcode::EViewType::FeatureType) {
         // calculate offsets to align time/percentage data
         const std::vector<libvgcode::EGCodeExtrusionRole>& roles = m_viewer.get_extrusion_roles();
         for (libvgcode::EGCodeExtrusionRole role : roles) {
@@ -2246,6 +2287,7 @@ void GCodeViewer::render_legend(float& legend_height)
         }
 
         offsets = calculate_offsets(labels, times, { _u8L("Feature type"), _u8L("Time"), longest_percentage_string, longest_used_filament_string }, icon_size);
+        store_columns_to_cache();
     }
 
     // get used filament (meters and grams) from used volume in respect to the active extruder
@@ -2256,7 +2298,9 @@ void GCodeViewer::render_legend(float& legend_height)
         return ret;
     };
 
-    if (curr_view_type == libvgcode::EViewType::Tool) {
+    if (curr_view_type == libvgcode::EViewType::Tool && columns_cache_valid)
+        load_columns_from_cache();
+    else if (curr_view_type == libvgcode::EViewType::Tool) {
         // calculate used filaments data
         const size_t extruders_count = get_extruders_count();
         used_filaments_m = std::vector<double>(extruders_count, 0.0);
@@ -2281,6 +2325,7 @@ void GCodeViewer::render_legend(float& legend_height)
         }
 
         offsets = calculate_offsets(labels, times, { "Extruder NNN", longest_used_filament_string }, icon_size);
+        store_columns_to_cache();
     }
 
     // selection section
@@ -1,9 +1,9 @@
-///|/ Copyright (c) Prusa Research 2020 - 2023 Enrico Turri @enricoturri1966, Vojtěch Bubník @bubnikv, Lukáš Matěna @lukasmatena, Filip Sykala @Jony01, Oleksandra Iushchenko @YuSanka
-///|/ Copyright (c) BambuStudio 2023 manch1n @manch1n
-///|/ Copyright (c) SuperSlicer 2023 Remi Durand @supermerill
-///|/
-///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
-///|/
+///|/ Copyright (c) Prusa Research 2020 - 2023 Enrico Turri @enricoturri1966, Vojtěch Bubník @bubnikv, Lukáš Matěna @lukasmatena, Filip Sykala @Jony01, Oleksandra Iushchenko @YuSanka
+///|/ Copyright (c) BambuStudio 2023 manch1n @manch1n
+///|/ Copyright (c) SuperSlicer 2023 Remi Durand @supermerill
+///|/
+///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
+///|/
 #ifndef slic3r_GCodeViewer_hpp_
 #define slic3r_GCodeViewer_hpp_
 
@@ -252,6 +252,25 @@ private:
         void reset() { dirty = true; }
     };
     LegendResizer m_legend_resizer;
+
+    // Columns data of the legend (labels, formatted times, measured column offsets) derived
+    // from the print statistics. Rebuilding the strings and measuring the texts on every
+    // repaint of an unchanged legend is wasteful, thus the data are kept here and only
+    // recalculated when the hash of the state they were derived from changes.
+    struct LegendColumnsCache
+    {
+        // Hash of the state the cached data were calculated from, zero if invalid.
+        size_t state_hash{ 0 };
+        std::array<float, 4> offsets{ 0.0f, 0.0f, 0.0f, 0.0f };
+        std::vector<std::string> labels;
+        std::vector<std::string> times;
+        std::vector<float> percents;
+        std::vector<double> used_filaments_m;
+        std::vector<double> used_filaments_g;
+        float max_time_percent{ 0.0f };
+        void reset() { state_hash = 0; }
+    };
+    LegendColumnsCache m_legend_columns_cache;
     PrintEstimatedStatistics m_print_statistics;
     GCodeProcessorResult::SettingsIds m_settings_ids;
 
@@ -315,7 +334,7 @@ public:
         std::transform(zs.begin(), zs.end(), std::back_inserter(ret), [](float z) { return static_cast<double>(z); });
         return ret;
     }
-    std::vector<float> get_layers_times() const { return m_viewer.get_layers_estimated_times(); }
+    std::vector<float> get_layers_times() const { return m_viewer.get_layers_estimated_times(); }
 
     const SequentialView& get_sequential_view() const { return m_sequential_view; }
     void update_sequential_view_current(unsigned int first, unsigned int last);
@@ -353,15 +372,15 @@ public:
 
     size_t get_extruders_count() { return m_extruders_count; }
 
-    void invalidate_legend() { m_legend_resizer.reset(); }
+    void invalidate_legend() { m_legend_resizer.reset(); m_legend_columns_cache.reset(); }
 
     const ConflictResultOpt& get_conflict_result() const { return m_conflict_result; }
 
     void load_shells(const Print& print);
 
 #if VGCODE_ENABLE_COG_AND_TOOL_MARKERS
-    float get_cog_marker_scale_factor() const { return m_viewer.get_cog_marker_scale_factor(); }
-    void set_cog_marker_scale_factor(float factor) { return m_viewer.set_cog_marker_scale_factor(factor); }
+    float get_cog_marker_scale_factor() const { return m_viewer.get_cog_marker_scale_factor(); }
+    void set_cog_marker_scale_factor(float factor) { return m_viewer.set_cog_marker_scale_factor(factor); }
 #endif // VGCODE_ENABLE_COG_AND_TOOL_MARKERS
 
 private:
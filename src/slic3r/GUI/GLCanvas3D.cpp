@@ -1963,7 +1963,25 @@ void GLCanvas3D::render()
 
 void GLCanvas3D::render_thumbnail(ThumbnailData& thumbnail_data, unsigned int w, unsigned int h, const ThumbnailsParams& thumbnail_params, Camera::EType camera_type)
 {
+    // Reuse a previously captured thumbnail whenever the scene did not change since,
+    // the cache is invalidated in reload_scene().
+    for (const CachedThumbnail& cached : m_thumbnails_cache) {
+        if (cached.width == w && cached.height == h &&
+            cached.printable_only == thumbnail_params.printable_only &&
+            cached.parts_only == thumbnail_params.parts_only &&
+            cached.show_bed == thumbnail_params.show_bed &&
+            cached.transparent_background == thumbnail_params.transparent_background &&
+            cached.camera_type == camera_type) {
+            thumbnail_data = cached.data;
+            return;
+        }
+    }
+
     render_thumbnail(thumbnail_data, w, h, thumbnail_params, m_volumes, camera_type);
+
+    if (thumbnail_data.is_valid())
+        m_thumbnails_cache.push_back({ w, h, thumbnail_params.printable_only, thumbnail_params.parts_only,
+            thumbnail_params.show_bed, thumbnail_params.transparent_background, camera_type, thumbnail_data });
 }
 
 void GLCanvas3D::render_thumbnail(ThumbnailData& thumbnail_data, unsigned int w, unsigned int h, const ThumbnailsParams& thumbnail_params, const GLVolumeCollection& volumes, Camera::EType camera_type)
@@ -2091,6 +2109,9 @@ void GLCanvas3D::reload_scene(bool refresh_immediately, bool force_full_scene_re
     
     _set_current();
 
+    // The scene is about to change, drop the cached thumbnail captures.
+    m_thumbnails_cache.clear();
+
     m_hover_volume_idxs.clear();
 
     struct ModelVolumeState {
@@ -6095,7 +6116,8 @@ void GLCanvas3D::_render_volumes_for_picking(const Camera& camera) const
 
     const Transform3d& view_matrix = camera.get_view_matrix();
     for (size_t type = 0; type < 2; ++ type) {
-        GLVolumeWithIdAndZList to_render = volumes_to_render(m_volumes.volumes, (type == 0) ? GLVolumeCollection::ERenderType::Opaque : GLVolumeCollection::ERenderType::Transparent, view_matrix);
+        GLVolumeWithIdAndZList to_render = volumes_to_render(m_volumes.volumes, (type == 0) ? GLVolumeCollection::ERenderType::Opaque : GLVolumeCollection::ERenderType::Transparent, view_matrix,
+                                                             nullptr, &camera.get_projection_matrix());
         for (const GLVolumeWithIdAndZ& volume : to_render)
 	        if (!volume.first->disabled && (volume.first->composite_id.volume_id >= 0 || m_render_sla_auxiliaries)) {
 		        // Object picking mode. Render the object with a color encoding the object index.
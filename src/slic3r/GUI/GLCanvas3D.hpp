@@ -28,6 +28,7 @@
 #include "ArrangeSettingsDialogImgui.hpp"
 
 #include "libslic3r/Slicing.hpp"
+#include "libslic3r/GCode/ThumbnailData.hpp"
 
 #include <float.h>
 
@@ -50,8 +51,6 @@ namespace Slic3r {
 
 class BackgroundSlicingProcess;
 class BuildVolume;
-struct ThumbnailData;
-struct ThumbnailsParams;
 class ModelObject;
 class ModelInstance;
 class PrintObject;
@@ -514,6 +513,24 @@ private:
 #endif // SLIC3R_OPENGL_ES
     GCodeViewer m_gcode_viewer;
 
+    // Rendering a thumbnail redraws the whole scene into an offscreen framebuffer on the UI thread
+    // and the G-code export path requests the same captures repeatedly (once for each output format)
+    // through BackgroundSlicingProcess::execute_ui_task(), stalling the interaction each time.
+    // Therefore the captured pixels are cached and reused until the scene changes,
+    // see render_thumbnail() and reload_scene().
+    struct CachedThumbnail
+    {
+        unsigned int  width{ 0 };
+        unsigned int  height{ 0 };
+        bool          printable_only{ false };
+        bool          parts_only{ false };
+        bool          show_bed{ false };
+        bool          transparent_background{ false };
+        Camera::EType camera_type{ Camera::EType::Ortho };
+        ThumbnailData data;
+    };
+    std::vector<CachedThumbnail> m_thumbnails_cache;
+
     RenderTimer m_render_timer;
 
     Selection m_selection;
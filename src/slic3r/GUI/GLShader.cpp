@@ -9,10 +9,14 @@
 #include "GLShader.hpp"
 
 #include "3DScene.hpp"
+#if !SLIC3R_OPENGL_ES
+#include "OpenGLManager.hpp"
+#endif // !SLIC3R_OPENGL_ES
 #include "libslic3r/Utils.hpp"
 #include "libslic3r/format.hpp"
 #include "libslic3r/Color.hpp"
 
+#include <boost/filesystem/operations.hpp>
 #include <boost/nowide/fstream.hpp>
 #include <GL/glew.h>
 #include <cassert>
@@ -21,6 +25,120 @@
 
 namespace Slic3r {
 
+#if !SLIC3R_OPENGL_ES
+
+// Persistent cache of the linked program binaries (GL 4.1 / ARB_get_program_binary),
+// so that a warm start does not recompile the GLSL of every shader program again.
+// Each cache file is keyed by a hash of the shader sources and of the driver identity:
+// a mismatch (changed sources, updated driver, different GPU) simply recompiles and
+// rewrites the file, thus the cache never grows beyond one file per shader program.
+
+static bool program_binary_supported()
+{
+    if (! GLEW_ARB_get_program_binary)
+        return false;
+    GLint num_formats = 0;
+    glsafe(::glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &num_formats));
+    return num_formats > 0;
+}
+
+static uint64_t program_binary_hash(const GLShaderProgram::ShaderSources& sources)
+{
+    // FNV-1a
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    auto feed = [&hash](const std::string& data) {
+        for (const char c : data)
+            hash = (hash ^ uint64_t(uint8_t(c))) * 0x100000001b3ULL;
+        // separator, so that moving a character between two fields changes the hash
+        hash = (hash ^ 0xffULL) * 0x100000001b3ULL;
+    };
+    // The binary is only valid for the exact driver that produced it.
+    feed(GUI::OpenGLManager::get_gl_info().get_vendor());
+    feed(GUI::OpenGLManager::get_gl_info().get_renderer());
+    feed(GUI::OpenGLManager::get_gl_info().get_version_string());
+    for (const std::string& source : sources)
+        feed(source);
+    return hash;
+}
+
+static std::string program_binary_path(const std::string& name)
+{
+    return data_dir() + "/cache/shaders/" + name + ".bin";
+}
+
+struct ProgramBinaryHeader
+{
+    uint64_t hash{ 0 };
+    uint32_t format{ 0 };
+    uint32_t size{ 0 };
+};
+
+// Returns the id of a program linked from the cached binary, or 0 if the cache
+// does not hold a binary for the given hash or the driver rejects it.
+static GLuint load_program_binary(const std::string& name, uint64_t hash)
+{
+    if (! program_binary_supported() || data_dir().empty())
+        return 0;
+
+    boost::nowide::ifstream file(program_binary_path(name), boost::nowide::ifstream::binary);
+    if (! file.good())
+        return 0;
+    ProgramBinaryHeader header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (! file.good() || header.hash != hash || header.size == 0)
+        return 0;
+    std::vector<char> binary(header.size);
+    file.read(binary.data(), header.size);
+    if (! file.good())
+        return 0;
+
+    GLuint id = ::glCreateProgram();
+    glcheck();
+    if (id == 0)
+        return 0;
+    // No glsafe() here: a stale binary (e.g. a driver update not reflected in the version
+    // string) may be legitimately rejected and is recompiled from the sources instead.
+    ::glProgramBinary(id, static_cast<GLenum>(header.format), binary.data(), static_cast<GLsizei>(header.size));
+    GLint linked = GL_FALSE;
+    if (::glGetError() == GL_NO_ERROR)
+        glsafe(::glGetProgramiv(id, GL_LINK_STATUS, &linked));
+    if (linked == GL_FALSE) {
+        glsafe(::glDeleteProgram(id));
+        return 0;
+    }
+    return id;
+}
+
+static void save_program_binary(const std::string& name, uint64_t hash, GLuint program_id)
+{
+    if (! program_binary_supported() || data_dir().empty())
+        return;
+
+    GLint size = 0;
+    glsafe(::glGetProgramiv(program_id, GL_PROGRAM_BINARY_LENGTH, &size));
+    if (size <= 0)
+        return;
+    std::vector<char> binary(size);
+    GLsizei written = 0;
+    GLenum format = 0;
+    glsafe(::glGetProgramBinary(program_id, size, &written, &format, binary.data()));
+    if (written <= 0)
+        return;
+
+    boost::system::error_code ec;
+    boost::filesystem::create_directories(boost::filesystem::path(data_dir()) / "cache" / "shaders", ec);
+    if (ec)
+        return;
+    boost::nowide::ofstream file(program_binary_path(name), boost::nowide::ofstream::binary);
+    if (! file.good())
+        return;
+    const ProgramBinaryHeader header = { hash, static_cast<uint32_t>(format), static_cast<uint32_t>(written) };
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(binary.data(), written);
+}
+
+#endif // !SLIC3R_OPENGL_ES
+
 GLShaderProgram::~GLShaderProgram()
 {
     if (m_id > 0)
@@ -125,6 +243,14 @@ bool GLShaderProgram::init_from_texts(const std::string& name, const ShaderSourc
 
     m_name = name;
 
+#if !SLIC3R_OPENGL_ES
+    const uint64_t binary_hash = program_binary_hash(sources);
+    if (GLuint id = load_program_binary(name, binary_hash); id != 0) {
+        m_id = id;
+        return true;
+    }
+#endif // !SLIC3R_OPENGL_ES
+
     std::array<GLuint, static_cast<size_t>(EShaderType::Count)> shader_ids = { 0 };
 
     for (size_t i = 0; i < static_cast<size_t>(EShaderType::Count); ++i) {
@@ -176,6 +302,11 @@ bool GLShaderProgram::init_from_texts(const std::string& name, const ShaderSourc
             glsafe(::glAttachShader(m_id, shader_ids[i]));
     }
 
+#if !SLIC3R_OPENGL_ES
+    if (program_binary_supported())
+        glsafe(::glProgramParameteri(m_id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE));
+#endif // !SLIC3R_OPENGL_ES
+
     glsafe(::glLinkProgram(m_id));
     GLint params;
     glsafe(::glGetProgramiv(m_id, GL_LINK_STATUS, &params));
@@ -199,6 +330,10 @@ bool GLShaderProgram::init_from_texts(const std::string& name, const ShaderSourc
     // release shaders, they are no more needed
     release_shaders(shader_ids);
 
+#if !SLIC3R_OPENGL_ES
+    save_program_binary(name, binary_hash, m_id);
+#endif // !SLIC3R_OPENGL_ES
+
     return true;
 }
 
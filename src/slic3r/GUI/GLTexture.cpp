@@ -35,10 +35,15 @@ namespace GUI {
 
 void GLTexture::Compressor::reset()
 {
-	if (m_thread.joinable()) {
+	if (! m_threads.empty()) {
         m_abort_compressing = true;
-		m_thread.join();
+        for (std::thread& thrd : m_threads)
+		    thrd.join();
+        m_threads.clear();
 	    m_levels.clear();
+        m_tasks.clear();
+        m_remaining_tasks_per_level.reset();
+        m_next_task = 0;
 	    m_num_levels_compressed = 0;
 	    m_abort_compressing = false;
 	}
@@ -49,78 +54,108 @@ void GLTexture::Compressor::reset()
 
 void GLTexture::Compressor::start_compressing()
 {
-	// The worker thread should be stopped already.
-	assert(! m_thread.joinable());
+	// The worker threads should be stopped already.
+	assert(m_threads.empty());
 	assert(! m_levels.empty());
 	assert(m_abort_compressing == false);
 	assert(m_num_levels_compressed == 0);
-	if (! m_levels.empty()) {
-		std::thread thrd(&GLTexture::Compressor::compress, this);
-    	m_thread = std::move(thrd);
+	if (m_levels.empty())
+        return;
+
+    // Cut the levels into tasks for the worker pool. Large levels are split into stripes of rows,
+    // so the most detailed level of a 4k texture does not serialize the whole pipeline.
+    static constexpr const unsigned int StripeRows = 256;
+    m_remaining_tasks_per_level = std::make_unique<std::atomic<unsigned int>[]>(m_levels.size());
+    for (unsigned int level_idx = 0; level_idx < (unsigned int)m_levels.size(); ++ level_idx) {
+        Level& level = m_levels[level_idx];
+        if (level.w % 4 == 0 && level.h % 4 == 0 && level.h > StripeRows) {
+            // DXT5 output is fixed 16 bytes per 4x4 block, thus the destination buffer size is known
+            // and the output of each stripe lands at a known offset.
+            level.compressed_data = std::vector<unsigned char>(size_t(level.w / 4) * size_t(level.h / 4) * 16, 0);
+            unsigned int num_tasks = 0;
+            for (unsigned int row = 0; row < level.h; row += StripeRows) {
+                m_tasks.push_back({ level_idx, row, std::min(row + StripeRows, level.h), size_t(level.w / 4) * size_t(row / 4) * 16, false });
+                ++ num_tasks;
+            }
+            m_remaining_tasks_per_level[level_idx] = num_tasks;
+        }
+        else {
+            // Small or oddly sized level, compressed as a whole by a single worker.
+            m_tasks.push_back({ level_idx, 0, level.h, 0, true });
+            m_remaining_tasks_per_level[level_idx] = 1;
+        }
     }
+
+    unsigned int num_threads = std::min((unsigned int)m_tasks.size(), std::max(1u, std::thread::hardware_concurrency() / 2));
+    m_threads.reserve(num_threads);
+    for (unsigned int i = 0; i < num_threads; ++ i)
+        m_threads.emplace_back(&GLTexture::Compressor::compress, this);
 }
 
 bool GLTexture::Compressor::unsent_compressed_data_available() const
 {
-	if (m_levels.empty())
-		return false;
-	// Querying the atomic m_num_levels_compressed value synchronizes processor caches, so that the data of m_levels modified by the worker thread are accessible to the calling thread.
-	unsigned int num_compressed = m_num_levels_compressed;
-	for (unsigned int i = 0; i < num_compressed; ++ i)
-        if (! m_levels[i].sent_to_gpu && ! m_levels[i].compressed_data.empty())
-            return true;
-    return false;
+	// Querying the atomic m_num_levels_compressed value synchronizes processor caches, so that the data of m_levels modified by the worker threads are accessible to the calling thread.
+	// All levels are swapped in at once when the complete compression is finished, so the texture never
+	// mixes compressed and uncompressed mip levels (that would make it mipmap incomplete).
+	return ! m_levels.empty() && m_num_levels_compressed == (unsigned int)m_levels.size();
 }
 
 void GLTexture::Compressor::send_compressed_data_to_gpu()
 {
     // this method should be called inside the main thread of Slicer or a new OpenGL context (sharing resources) would be needed
-	if (m_levels.empty())
+	if (! this->unsent_compressed_data_available())
 		return;
 
     glsafe(::glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
     glsafe(::glBindTexture(GL_TEXTURE_2D, m_texture.m_id));
-	// Querying the atomic m_num_levels_compressed value synchronizes processor caches, so that the dat of m_levels modified by the worker thread are accessible to the calling thread.
-	int num_compressed = (int)m_num_levels_compressed;
-    for (int i = 0; i < num_compressed; ++ i) {
+    for (int i = 0; i < (int)m_levels.size(); ++ i) {
         Level& level = m_levels[i];
-        if (! level.sent_to_gpu && ! level.compressed_data.empty()) {
-            glsafe(::glCompressedTexSubImage2D(GL_TEXTURE_2D, (GLint)i, 0, 0, (GLsizei)level.w, (GLsizei)level.h, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, (GLsizei)level.compressed_data.size(), (const GLvoid*)level.compressed_data.data()));
-            glsafe(::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, i));
-            glsafe(::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, (i > 0) ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR));
-            level.sent_to_gpu = true;
-            // we are done with the compressed data, we can discard it
-            level.compressed_data.clear();
-        }
+        // Replace the uncompressed level shown so far with the compressed one.
+        glsafe(::glCompressedTexImage2D(GL_TEXTURE_2D, (GLint)i, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, (GLsizei)level.w, (GLsizei)level.h, 0, (GLsizei)level.compressed_data.size(), (const GLvoid*)level.compressed_data.data()));
+        level.sent_to_gpu = true;
+        // we are done with the compressed data, we can discard it
+        level.compressed_data.clear();
     }
+    glsafe(::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, (GLint)m_levels.size() - 1));
+    glsafe(::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, (m_levels.size() > 1) ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR));
     glsafe(::glBindTexture(GL_TEXTURE_2D, 0));
 
-    if (num_compressed == (int)m_levels.size())
-        // Finalize the worker thread, close it.
-    	this->reset();
+    // Finalize the worker threads, close them.
+    this->reset();
 }
 
 void GLTexture::Compressor::compress()
 {
     // reference: https://github.com/Cyan4973/RygsDXTc
 
-    assert(m_num_levels_compressed == 0);
     assert(m_abort_compressing == false);
 
-    for (Level& level : m_levels) {
-        if (m_abort_compressing)
+    for (;;) {
+        unsigned int task_idx = m_next_task ++;
+        if (task_idx >= (unsigned int)m_tasks.size() || m_abort_compressing)
             break;
 
-        // stb_dxt library, despite claiming that the needed size of the destination buffer is equal to (source buffer size)/4,
-        // crashes if doing so, requiring a minimum of 64 bytes and up to a third of the source buffer size, so we set the destination buffer initial size to be half the source buffer size
-        level.compressed_data = std::vector<unsigned char>(std::max((unsigned int)64, (unsigned int)level.src_data.size() / 2), 0);
+        const Task& task  = m_tasks[task_idx];
+        Level&      level = m_levels[task.level];
         int compressed_size = 0;
-        rygCompress(level.compressed_data.data(), level.src_data.data(), level.w, level.h, 1, compressed_size);
-        level.compressed_data.resize(compressed_size);
-
-        // we are done with the source data, we can discard it
-        level.src_data.clear();
-        ++ m_num_levels_compressed;
+        if (task.whole_level) {
+            // stb_dxt library, despite claiming that the needed size of the destination buffer is equal to (source buffer size)/4,
+            // crashes if doing so, requiring a minimum of 64 bytes and up to a third of the source buffer size, so we set the destination buffer initial size to be half the source buffer size
+            level.compressed_data = std::vector<unsigned char>(std::max((unsigned int)64, (unsigned int)level.src_data.size() / 2), 0);
+            rygCompress(level.compressed_data.data(), level.src_data.data(), level.w, level.h, 1, compressed_size);
+            level.compressed_data.resize(compressed_size);
+        }
+        else
+            // The destination buffer was already sized by start_compressing(), the stripes of the level
+            // write into disjoint ranges of it.
+            rygCompress(level.compressed_data.data() + task.dst_offset, level.src_data.data() + size_t(task.row_begin) * size_t(level.w) * 4, level.w, task.row_end - task.row_begin, 1, compressed_size);
+
+        if (-- m_remaining_tasks_per_level[task.level] == 0) {
+            // This was the last task of the level, publish it.
+            // we are done with the source data, we can discard it
+            level.src_data.clear();
+            ++ m_num_levels_compressed;
+        }
     }
 }
 
@@ -469,8 +504,9 @@ bool GLTexture::load_from_png(const std::string& filename, bool use_mipmaps, ECo
         if (compression_type == SingleThreaded)
             glsafe(::glTexImage2D(GL_TEXTURE_2D, 0, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, (GLsizei)m_width, (GLsizei)m_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, (const void*)data.data()));
         else {
-            // initializes the texture on GPU 
-            glsafe(::glTexImage2D(GL_TEXTURE_2D, 0, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, (GLsizei)m_width, (GLsizei)m_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0));
+            // upload the uncompressed data, so the texture shows immediately, the compressed levels
+            // produced by the background workers are swapped in later in one go
+            glsafe(::glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, (GLsizei)m_width, (GLsizei)m_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, (const void*)data.data()));
             // and send the uncompressed data to the compressor
             m_compressor.add_level((unsigned int)m_width, (unsigned int)m_height, data);
         }
@@ -510,8 +546,9 @@ bool GLTexture::load_from_png(const std::string& filename, bool use_mipmaps, ECo
                 if (compression_type == SingleThreaded)
                     glsafe(::glTexImage2D(GL_TEXTURE_2D, level, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, (GLsizei)m_width, (GLsizei)m_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, (const void*)data.data()));
                 else {
-                    // initializes the texture on GPU 
-                    glsafe(::glTexImage2D(GL_TEXTURE_2D, level, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, (GLsizei)lod_w, (GLsizei)lod_h, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0));
+                    // upload the uncompressed data, so the texture shows immediately, the compressed levels
+                    // produced by the background workers are swapped in later in one go
+                    glsafe(::glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA, (GLsizei)lod_w, (GLsizei)lod_h, 0, GL_RGBA, GL_UNSIGNED_BYTE, (const void*)data.data()));
                     // and send the uncompressed data to the compressor
                     m_compressor.add_level((unsigned int)lod_w, (unsigned int)lod_h, data);
                 }
@@ -520,7 +557,7 @@ bool GLTexture::load_from_png(const std::string& filename, bool use_mipmaps, ECo
                 glsafe(::glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA, (GLsizei)lod_w, (GLsizei)lod_h, 0, GL_RGBA, GL_UNSIGNED_BYTE, (const void*)data.data()));
         }
 
-        if (!compression_enabled) {
+        if (!compression_enabled || compression_type == MultiThreaded) {
             glsafe(::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, level));
             glsafe(::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR));
         }
@@ -607,8 +644,9 @@ bool GLTexture::load_from_svg(const std::string& filename, bool use_mipmaps, boo
     }
 
     if (compression_enabled) {
-        // initializes the texture on GPU 
-        glsafe(::glTexImage2D(GL_TEXTURE_2D, 0, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, (GLsizei)m_width, (GLsizei)m_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0));
+        // upload the uncompressed data, so the texture shows immediately, the compressed levels
+        // produced by the background workers are swapped in later in one go
+        glsafe(::glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, (GLsizei)m_width, (GLsizei)m_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, (const void*)data.data()));
         // and send the uncompressed data to the compressor
         m_compressor.add_level((unsigned int)m_width, (unsigned int)m_height, data);
     }
@@ -632,8 +670,9 @@ bool GLTexture::load_from_svg(const std::string& filename, bool use_mipmaps, boo
 
             nsvgRasterizeXY(rast, image, 0, 0, scale_w, scale_h, data.data(), lod_w, lod_h, lod_w * 4);
             if (compression_enabled) {
-                // initializes the texture on GPU 
-                glsafe(::glTexImage2D(GL_TEXTURE_2D, level, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, (GLsizei)lod_w, (GLsizei)lod_h, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0));
+                // upload the uncompressed data, so the texture shows immediately, the compressed levels
+                // produced by the background workers are swapped in later in one go
+                glsafe(::glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA, (GLsizei)lod_w, (GLsizei)lod_h, 0, GL_RGBA, GL_UNSIGNED_BYTE, (const void*)data.data()));
                 // and send the uncompressed data to the compressor
                 m_compressor.add_level((unsigned int)lod_w, (unsigned int)lod_h, data);
             }
@@ -641,10 +680,8 @@ bool GLTexture::load_from_svg(const std::string& filename, bool use_mipmaps, boo
                 glsafe(::glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA, (GLsizei)lod_w, (GLsizei)lod_h, 0, GL_RGBA, GL_UNSIGNED_BYTE, (const void*)data.data()));
         }
 
-        if (!compression_enabled) {
-            glsafe(::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, level));
-            glsafe(::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR));
-        }
+        glsafe(::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, level));
+        glsafe(::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR));
     }
     else {
         glsafe(::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
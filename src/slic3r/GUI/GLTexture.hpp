@@ -6,6 +6,7 @@
 #define slic3r_GLTexture_hpp_
 
 #include <atomic>
+#include <memory>
 #include <string>
 #include <vector>
 #include <thread>
@@ -30,18 +31,35 @@ namespace GUI {
                 Level(unsigned int w, unsigned int h, const std::vector<unsigned char>& data) : w(w), h(h), src_data(data), sent_to_gpu(false) {}
             };
 
+            // A unit of work for the worker pool: either a whole level or a horizontal stripe of it.
+            // Stripes of a level compress independently, as DXT5 processes 4x4 blocks with a fixed
+            // 16 bytes output per block, thus each stripe lands at a known offset of the level buffer.
+            struct Task
+            {
+                unsigned int level;
+                unsigned int row_begin;
+                unsigned int row_end;
+                size_t       dst_offset;
+                bool         whole_level;
+            };
+
             GLTexture& m_texture;
             std::vector<Level> m_levels;
-            std::thread m_thread;
-            // Does the caller want the background thread to stop?
-            // This atomic also works as a memory barrier for synchronizing the cancel event with the worker thread.
+            std::vector<std::thread> m_threads;
+            std::vector<Task> m_tasks;
+            // Number of tasks left to complete for each level, the last finishing worker publishes the level.
+            std::unique_ptr<std::atomic<unsigned int>[]> m_remaining_tasks_per_level;
+            // Next task to be picked up by a worker thread.
+            std::atomic<unsigned int> m_next_task;
+            // Does the caller want the background threads to stop?
+            // This atomic also works as a memory barrier for synchronizing the cancel event with the worker threads.
             std::atomic<bool> m_abort_compressing;
-            // How many levels were compressed since the start of the background processing thread?
-            // This atomic also works as a memory barrier for synchronizing results of the worker thread with the calling thread.
+            // How many levels were compressed since the start of the background processing threads?
+            // This atomic also works as a memory barrier for synchronizing results of the worker threads with the calling thread.
             std::atomic<unsigned int> m_num_levels_compressed;
 
         public:
-            explicit Compressor(GLTexture& texture) : m_texture(texture), m_abort_compressing(false), m_num_levels_compressed(0) {}
+            explicit Compressor(GLTexture& texture) : m_texture(texture), m_next_task(0), m_abort_compressing(false), m_num_levels_compressed(0) {}
             ~Compressor() { reset(); }
 
             void reset();
@@ -1559,8 +1559,8 @@ bool GUI_App::on_init_inner()
             this->post_init();
         }
 
-        if (m_post_initialized && app_config->dirty())
-            app_config->save();
+        if (m_post_initialized)
+            app_config->save_if_dirty_debounced();
     });
 
     m_initialized = true;
@@ -31,6 +31,9 @@
 #include "NotificationManager.hpp"
 #include "MsgDialog.hpp"
 
+#include <algorithm>
+#include <optional>
+
 #include <boost/algorithm/string.hpp>
 #include <wx/progdlg.h>
 #include <wx/listbook.h>
@@ -899,11 +902,14 @@ void ObjectList::paste_objects_into_list(const std::vector<size_t>& object_idxs)
         return;
 
     wxDataViewItemArray items;
+    // batch the insertions into a single freeze/thaw cycle
+    this->Freeze();
     for (const size_t object : object_idxs)
     {
         add_object_to_list(object, false);
         items.Add(m_objects_model->GetItemById(object));
     }
+    this->Thaw();
 
     wxGetApp().plater()->changed_objects(object_idxs);
 
@@ -3111,6 +3117,14 @@ bool ObjectList::delete_from_model_and_list(const std::vector<ItemForDelete>& it
     m_prevent_list_events = true;
     ScopeGuard sg_prevent_list_events = ScopeGuard([this]() { m_prevent_list_events = false; });
 
+    // When deleting whole objects only, coalesce the full scene reload triggered by each
+    // deletion into a single one. The volume / instance paths rely on the scene being
+    // reloaded between the steps (ensure_on_bed()), thus they are left eager.
+    std::optional<Plater::CoalesceUpdates> coalesce;
+    if (std::all_of(items_for_delete.begin(), items_for_delete.end(),
+                    [](const ItemForDelete &item) { return (item.type & itObject) != 0; }))
+        coalesce.emplace(wxGetApp().plater());
+
     std::set<size_t> modified_objects_ids;
     for (std::vector<ItemForDelete>::const_reverse_iterator item = items_for_delete.rbegin(); item != items_for_delete.rend(); ++item) {
         if (!(item->type&(itObject | itVolume | itInstance)))
@@ -3147,6 +3161,9 @@ bool ObjectList::delete_from_model_and_list(const std::vector<ItemForDelete>& it
         modified_objects_ids.insert(static_cast<size_t>(item->obj_idx));
     }
 
+    // Run the postponed scene reload now, update_info_items() below relies on a fresh scene.
+    coalesce.reset();
+
     for (size_t id : modified_objects_ids) {
         update_info_items(id);
     }
@@ -4858,6 +4875,9 @@ void ObjectList::update_after_undo_redo()
      * */
     m_prevent_list_events = true;
     this->UnselectAll();
+    // Batch the rebuild into a single freeze/thaw cycle, so the control does not
+    // relayout and repaint per inserted item on plates with hundreds of objects.
+    this->Freeze();
     m_objects_model->DeleteAll();
     m_prevent_list_events = false;
 
@@ -4869,6 +4889,7 @@ void ObjectList::update_after_undo_redo()
         obj_idxs.push_back(obj_idx);
         ++obj_idx;
     }
+    this->Thaw();
 
     update_selections();
 
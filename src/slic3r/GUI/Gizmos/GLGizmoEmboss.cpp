@@ -51,7 +51,9 @@
 #include <cereal/archives/binary.hpp>
 
 #include <GL/glew.h>
+#include <atomic> // shared state of font validation job
 #include <chrono> // measure enumeration of fonts
+#include <mutex>  // shared state of font validation job
 
 // uncomment for easier debug
 //#define ALLOW_DEBUG_MODE
@@ -205,6 +207,20 @@ struct FaceName
     std::shared_ptr<bool> is_created = nullptr;
 };
 
+// Shared state between the main thread and the background job validating enumerated face names.
+// The job appends checked names under the mutex, the main thread moves them into Facenames.
+struct FacenameValidation
+{
+    // Face names which passed the load check, in sorted order.
+    std::vector<wxString> good;
+    // Face names which can't be loaded, in sorted order.
+    std::vector<wxString> bad;
+    // Guards access to the vectors above.
+    std::mutex mutex;
+    // Set by the worker after the last name is checked.
+    std::atomic<bool> finished{false};
+};
+
 // Implementation of forwarded struct
 // Keep sorted list of loadable face names
 struct Facenames
@@ -246,11 +262,17 @@ struct Facenames
     // filtration pattern
     std::string       search = "";
     std::vector<bool> hide; // result of filtration
+
+    // Validation of the enumerated face names running in the background worker.
+    // Drained into this->faces by update_face_names(), reset when validation is finished.
+    std::shared_ptr<FacenameValidation> validation = nullptr;
 };
 
 bool store(const Facenames &facenames);
 bool load(Facenames &facenames);
 void init_face_names(Facenames &facenames);
+// Move face names validated by the background job into the list shown by the combo box.
+void update_face_names(Facenames &face_names);
 void init_truncated_names(Facenames &face_names, float max_width);
 
 // This configs holds GUI layout size given by translated texts.
@@ -1815,6 +1837,9 @@ void GLGizmoEmboss::draw_font_list()
             set_selection_focus = true;
         }
 
+        // populate the list with face names validated by the background job
+        update_face_names(*m_face_names);
+
         if (!m_face_names->has_truncated_names)
             init_truncated_names(*m_face_names, m_gui_cfg->input_width);
         
@@ -3705,6 +3730,76 @@ void init_truncated_names(Facenames &face_names, float max_width)
     face_names.has_truncated_names = true;
 }
 
+// Check the enumerated face names for loadability in the background worker,
+// so opening the combo box does not block the UI on systems with many fonts
+// (every check constructs a wxFont, which may open the font file).
+class ValidateFacenamesJob : public Job
+{
+    // Enumerated face names, sorted.
+    wxArrayString m_facenames;
+    // Previously detected bad names, sorted.
+    std::vector<wxString> m_bad;
+    wxFontEncoding m_encoding;
+    // Incrementally filled result, shared with Facenames::validation.
+    std::shared_ptr<FacenameValidation> m_result;
+public:
+    ValidateFacenamesJob(wxArrayString &&facenames, std::vector<wxString> &&bad, wxFontEncoding encoding, std::shared_ptr<FacenameValidation> result)
+        : m_facenames(std::move(facenames)), m_bad(std::move(bad)), m_encoding(encoding), m_result(std::move(result)) {}
+
+    void process(Ctl &ctl) override {
+        using namespace std::chrono;
+        steady_clock::time_point enumerate_start = steady_clock::now();
+        size_t count_good = 0;
+        // validation lambda
+        auto is_valid_font = [&encoding = m_encoding, &bad = m_bad](const wxString &name) {
+            if (name.empty()) return false;
+
+            // vertical font start with @, we will filter it out
+            // Not sure if it is only in Windows so filtering is on all platforms
+            if (name[0] == '@') return false;
+
+            // previously detected bad font
+            auto it = std::lower_bound(bad.begin(), bad.end(), name);
+            if (it != bad.end() && *it == name) return false;
+
+            wxFont wx_font(wxFontInfo().FaceName(name).Encoding(encoding));
+            //*
+            // Faster chech if wx_font is loadable but not 100%
+            // names could contain not loadable font
+            if (!WxFontUtils::can_load(wx_font)) return false;
+
+            /*/
+            // Slow copy of font files to try load font
+            // After this all files are loadable
+            auto font_file = WxFontUtils::create_font_file(wx_font);
+            if (font_file == nullptr)
+                return false; // can't create font file
+            // */
+            return true;
+        };
+        for (const wxString &name : m_facenames) {
+            if (ctl.was_canceled())
+                return;
+            bool valid = is_valid_font(name);
+            if (valid)
+                ++count_good;
+            std::lock_guard<std::mutex> lock(m_result->mutex);
+            (valid ? m_result->good : m_result->bad).push_back(name);
+        }
+        steady_clock::time_point enumerate_end = steady_clock::now();
+        long long enumerate_duration = duration_cast<milliseconds>(enumerate_end - enumerate_start).count();
+        BOOST_LOG_TRIVIAL(info) << "Validate " << count_good << " fonts "
+                                << "(+ " << m_facenames.size() - count_good << " can't load "
+                                << "= " << m_facenames.size() << " fonts) "
+                                << "in " << enumerate_duration << " ms";
+    }
+
+    void finalize(bool canceled, std::exception_ptr &) override {
+        if (!canceled)
+            m_result->finished.store(true);
+    }
+};
+
 void init_face_names(Facenames &face_names)
 {
     Timer t("enumerate_fonts");
@@ -3721,24 +3816,18 @@ void init_face_names(Facenames &face_names)
         face_names.has_truncated_names = false;
     }
 
-    using namespace std::chrono;
-    steady_clock::time_point enumerate_start = steady_clock::now();
-    ScopeGuard sg([&enumerate_start, &face_names = face_names]() {
-        steady_clock::time_point enumerate_end = steady_clock::now();
-        long long enumerate_duration = duration_cast<milliseconds>(enumerate_end - enumerate_start).count();
-        BOOST_LOG_TRIVIAL(info) << "OS enumerate " << face_names.faces.size() << " fonts "
-                                << "(+ " << face_names.bad.size() << " can't load "
-                                << "= " << face_names.faces.size() + face_names.bad.size() << " fonts) "
-                                << "in " << enumerate_duration << " ms\n" << concat(face_names.bad);
-    });
+    // Already validating the current enumeration in the background.
+    if (face_names.validation != nullptr)
+        return;
+
     wxArrayString facenames = wxFontEnumerator::GetFacenames(face_names.encoding);
     size_t hash = boost::hash_range(facenames.begin(), facenames.end());
     // Zero value is used as uninitialized hash
     if (hash == 0) hash = 1;
     // check if it is same as last time
-    if (face_names.hash == hash) { 
+    if (face_names.hash == hash) {
         // no new installed font
-        BOOST_LOG_TRIVIAL(info) << "Same FontNames hash, cache is used. " 
+        BOOST_LOG_TRIVIAL(info) << "Same FontNames hash, cache is used. "
             << "For clear cache delete file: " << get_fontlist_cache_path().string();
         return;
     }
@@ -3747,49 +3836,60 @@ void init_face_names(Facenames &face_names)
         "FontName list is generate from scratch." :
         "Hash are different. Only previous bad fonts are used and set again as bad");
     face_names.hash = hash;
-    
-    // validation lambda
-    auto is_valid_font = [encoding = face_names.encoding, bad = face_names.bad /*copy*/](const wxString &name) {
-        if (name.empty()) return false;
-
-        // vertical font start with @, we will filter it out
-        // Not sure if it is only in Windows so filtering is on all platforms
-        if (name[0] == '@') return false;        
-
-        // previously detected bad font
-        auto it = std::lower_bound(bad.begin(), bad.end(), name);
-        if (it != bad.end() && *it == name) return false;
-
-        wxFont wx_font(wxFontInfo().FaceName(name).Encoding(encoding));
-        //*
-        // Faster chech if wx_font is loadable but not 100%
-        // names could contain not loadable font
-        if (!WxFontUtils::can_load(wx_font)) return false;
-
-        /*/
-        // Slow copy of font files to try load font
-        // After this all files are loadable
-        auto font_file = WxFontUtils::create_font_file(wx_font);
-        if (font_file == nullptr) 
-            return false; // can't create font file
-        // */
-        return true;
-    };
 
+    // The loadability check of every enumerated name is the expensive part,
+    // run it in the background worker. The checked names are moved into
+    // face_names.faces incrementally by update_face_names().
+    std::vector<wxString> bad = std::move(face_names.bad);
     face_names.faces.clear();
     face_names.bad.clear();
-    face_names.faces.reserve(facenames.size());
+    face_names.has_truncated_names = false;
     std::sort(facenames.begin(), facenames.end());
-    for (const wxString &name : facenames) {
-        if (is_valid_font(name)) {
-            face_names.faces.push_back({name});
-        }else{
-            face_names.bad.push_back(name);
+    face_names.validation = std::make_shared<FacenameValidation>();
+    auto &worker = wxGetApp().plater()->get_ui_job_worker();
+    queue_job(worker, std::make_unique<ValidateFacenamesJob>(std::move(facenames), std::move(bad), face_names.encoding, face_names.validation));
+}
+
+void update_face_names(Facenames &face_names)
+{
+    if (face_names.validation == nullptr)
+        return;
+    FacenameValidation &validation = *face_names.validation;
+    // Read the flag before draining, the worker appends before setting it.
+    bool finished = validation.finished.load();
+    std::vector<wxString> good, bad;
+    {
+        std::lock_guard<std::mutex> lock(validation.mutex);
+        good = std::move(validation.good);
+        bad  = std::move(validation.bad);
+        validation.good.clear();
+        validation.bad.clear();
+    }
+    if (!good.empty() || !bad.empty()) {
+        // The worker checks the names in sorted order, appending keeps the lists sorted.
+        // filtration pattern to uppercase
+        std::string search = face_names.search; // copy
+        std::transform(search.begin(), search.end(), search.begin(), ::toupper);
+        for (wxString &wx_name : good) {
+            // Apply the active filtration pattern to the newly added name.
+            std::string name(wx_name.ToUTF8().data());
+            std::transform(name.begin(), name.end(), name.begin(), ::toupper);
+            face_names.hide.push_back(!boost::starts_with(name, search));
+            face_names.faces.push_back({std::move(wx_name)});
         }
+        std::move(bad.begin(), bad.end(), std::back_inserter(face_names.bad));
+        // re-initialize truncated names of the newly added faces
+        face_names.has_truncated_names = false;
+    }
+    if (finished) {
+        face_names.validation = nullptr;
+        assert(std::is_sorted(face_names.bad.begin(), face_names.bad.end()));
+        store(face_names);
+        BOOST_LOG_TRIVIAL(info) << "OS enumerate " << face_names.faces.size() << " fonts "
+                                << "(+ " << face_names.bad.size() << " can't load "
+                                << "= " << face_names.faces.size() + face_names.bad.size() << " fonts)\n"
+                                << concat(face_names.bad);
     }
-    assert(std::is_sorted(face_names.bad.begin(), face_names.bad.end()));
-    face_names.has_truncated_names = false;
-    store(face_names);
 }
 
 void draw_font_preview(FaceName &face, const std::string& text, Facenames &faces, const GuiCfg &cfg, bool is_visible){
@@ -148,7 +148,7 @@ void GLGizmoHollow::render_points(const Selection& selection)
     shader->set_uniform("projection_matrix", camera.get_projection_matrix());
 
     ColorRGBA render_color;
-    const sla::DrainHoles& drain_holes = m_c->selection_info()->model_object()->sla_drain_holes;
+    const sla::DrainHoles& drain_holes = m_c->selection_info()->model_object()->sla_drain_holes.get();
     const size_t cache_size = drain_holes.size();
 
     for (size_t i = 0; i < cache_size; ++i) {
@@ -244,7 +244,7 @@ bool GLGizmoHollow::gizmo_event(SLAGizmoEventType action, const Vec2d& mouse_pos
             if (unproject_on_mesh(mouse_position, pos_and_normal)) { // we got an intersection
                 Plater::TakeSnapshot snapshot(wxGetApp().plater(), _L("Add drainage hole"));
 
-                mo->sla_drain_holes.emplace_back(pos_and_normal.first,
+                mo->sla_drain_holes.modify().emplace_back(pos_and_normal.first,
                                                 -pos_and_normal.second, m_new_hole_radius, m_new_hole_height);
                 m_selected.push_back(false);
                 assert(m_selected.size() == mo->sla_drain_holes.size());
@@ -272,7 +272,7 @@ bool GLGizmoHollow::gizmo_event(SLAGizmoEventType action, const Vec2d& mouse_pos
         trafo.set_offset(trafo.get_offset() + Vec3d(0., 0., m_c->selection_info()->get_sla_shift()));
         std::vector<Vec3d> points;
         for (unsigned int i=0; i<mo->sla_drain_holes.size(); ++i)
-            points.push_back(trafo.get_matrix() * mo->sla_drain_holes[i].pos.cast<double>());
+            points.push_back(trafo.get_matrix() * mo->sla_drain_holes.get()[i].pos.cast<double>());
 
         // Now ask the rectangle which of the points are inside.
         std::vector<Vec3f> points_inside;
@@ -362,7 +362,7 @@ bool GLGizmoHollow::gizmo_event(SLAGizmoEventType action, const Vec2d& mouse_pos
 void GLGizmoHollow::delete_selected_points()
 {
     Plater::TakeSnapshot snapshot(wxGetApp().plater(), _(L("Delete drainage hole")));
-    sla::DrainHoles& drain_holes = m_c->selection_info()->model_object()->sla_drain_holes;
+    sla::DrainHoles& drain_holes = m_c->selection_info()->model_object()->sla_drain_holes.modify();
 
     for (unsigned int idx=0; idx<drain_holes.size(); ++idx) {
         if (m_selected[idx]) {
@@ -449,7 +449,7 @@ void GLGizmoHollow::register_hole_raycasters_for_picking()
 
     const CommonGizmosDataObjects::SelectionInfo* info = m_c->selection_info();
     if (info != nullptr && !info->model_object()->sla_drain_holes.empty()) {
-        const sla::DrainHoles& drain_holes = info->model_object()->sla_drain_holes;
+        const sla::DrainHoles& drain_holes = info->model_object()->sla_drain_holes.get();
         for (int i = 0; i < (int)drain_holes.size(); ++i) {
             m_hole_raycasters.emplace_back(m_parent.add_raycaster_for_picking(SceneRaycaster::EType::Gizmo, i, *m_cylinder.mesh_raycaster, Transform3d::Identity()));
         }
@@ -469,7 +469,7 @@ void GLGizmoHollow::update_hole_raycasters_for_picking_transform()
 {
     const CommonGizmosDataObjects::SelectionInfo* info = m_c->selection_info();
     if (info != nullptr) {
-        const sla::DrainHoles& drain_holes = info->model_object()->sla_drain_holes;
+        const sla::DrainHoles& drain_holes = info->model_object()->sla_drain_holes.get();
         if (!drain_holes.empty()) {
             assert(!m_hole_raycasters.empty());
 
@@ -717,19 +717,20 @@ RENDER_AGAIN:
     //  - take correct undo/redo snapshot after the user is done with moving the slider
     if (! m_selection_empty) {
         if (clicked) {
-            m_holes_stash = mo->sla_drain_holes;
+            m_holes_stash = mo->sla_drain_holes.get();
         }
         if (edited) {
+            sla::DrainHoles &drain_holes = mo->sla_drain_holes.modify();
             for (size_t idx=0; idx<m_selected.size(); ++idx)
                 if (m_selected[idx]) {
-                    mo->sla_drain_holes[idx].radius = m_new_hole_radius;
-                    mo->sla_drain_holes[idx].height = m_new_hole_height;
+                    drain_holes[idx].radius = m_new_hole_radius;
+                    drain_holes[idx].height = m_new_hole_height;
                 }
         }
         if (deactivated) {
             // momentarily restore the old value to take snapshot
-            sla::DrainHoles new_holes = mo->sla_drain_holes;
-            mo->sla_drain_holes = m_holes_stash;
+            sla::DrainHoles new_holes = mo->sla_drain_holes.get();
+            mo->sla_drain_holes.set(m_holes_stash);
             float backup_rad = m_new_hole_radius;
             float backup_hei = m_new_hole_height;
             for (size_t i=0; i<m_holes_stash.size(); ++i) {
@@ -742,7 +743,7 @@ RENDER_AGAIN:
             Plater::TakeSnapshot snapshot(wxGetApp().plater(), _L("Change drainage hole diameter"));
             m_new_hole_radius = backup_rad;
             m_new_hole_height = backup_hei;
-            mo->sla_drain_holes = new_holes;
+            mo->sla_drain_holes.set(std::move(new_holes));
         }
     }
 
@@ -866,7 +867,7 @@ void GLGizmoHollow::on_start_dragging()
     if (m_hover_id != -1) {
         select_point(NoPoints);
         select_point(m_hover_id);
-        m_hole_before_drag = m_c->selection_info()->model_object()->sla_drain_holes[m_hover_id].pos;
+        m_hole_before_drag = m_c->selection_info()->model_object()->sla_drain_holes.get()[m_hover_id].pos;
     }
     else
         m_hole_before_drag = Vec3f::Zero();
@@ -875,7 +876,7 @@ void GLGizmoHollow::on_start_dragging()
 
 void GLGizmoHollow::on_stop_dragging()
 {
-    sla::DrainHoles& drain_holes = m_c->selection_info()->model_object()->sla_drain_holes;
+    sla::DrainHoles& drain_holes = m_c->selection_info()->model_object()->sla_drain_holes.modify();
     if (m_hover_id != -1) {
         Vec3f backup = drain_holes[m_hover_id].pos;
 
@@ -897,7 +898,7 @@ void GLGizmoHollow::on_dragging(const UpdateData &data)
     std::pair<Vec3f, Vec3f> pos_and_normal;
     if (!unproject_on_mesh(data.mouse_pos.cast<double>(), pos_and_normal))
         return;
-    sla::DrainHoles &drain_holes =  m_c->selection_info()->model_object()->sla_drain_holes;
+    sla::DrainHoles &drain_holes =  m_c->selection_info()->model_object()->sla_drain_holes.modify();
     drain_holes[m_hover_id].pos    = pos_and_normal.first;
     drain_holes[m_hover_id].normal = -pos_and_normal.second;
 }
@@ -927,7 +928,7 @@ void GLGizmoHollow::on_save(cereal::BinaryOutputArchive& ar) const
 
 void GLGizmoHollow::select_point(int i)
 {
-    const sla::DrainHoles& drain_holes = m_c->selection_info()->model_object()->sla_drain_holes;
+    const sla::DrainHoles& drain_holes = m_c->selection_info()->model_object()->sla_drain_holes.get();
 
     if (i == AllPoints || i == NoPoints) {
         m_selected.assign(m_selected.size(), i == AllPoints);
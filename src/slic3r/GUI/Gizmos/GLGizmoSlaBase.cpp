@@ -83,7 +83,7 @@ void GLGizmoSlaBase::update_volumes()
             volume->set_instance_transformation(inst_trafo);
             volume->set_sla_shift_z(current_elevation);
             if (add_mesh_raycaster)
-                volume->mesh_raycaster = std::make_unique<GUI::MeshRaycaster>(mesh);
+                volume->mesh_raycaster = std::make_shared<const GUI::MeshRaycaster>(mesh);
             if (m_input_enabled)
                 volume->selected = true; // to set the proper color
             else
@@ -121,13 +121,13 @@ void GLGizmoSlaBase::update_volumes()
             if (!v->is_modifier) {
                 m_volumes.volumes.emplace_back(new GLVolume());
                 GLVolume* new_volume = m_volumes.volumes.back();
-                const TriangleMesh& mesh = mo->volumes[v->volume_idx()]->mesh();
-                new_volume->model.init_from(mesh);
+                const ModelVolume* model_volume = mo->volumes[v->volume_idx()];
+                new_volume->model.init_from(model_volume->mesh());
                 new_volume->set_instance_transformation(v->get_instance_transformation());
                 new_volume->set_volume_transformation(v->get_volume_transformation());
                 new_volume->set_sla_shift_z(v->get_sla_shift_z());
                 new_volume->set_color(DISABLED_COLOR);
-                new_volume->mesh_raycaster = std::make_unique<GUI::MeshRaycaster>(mesh);
+                new_volume->mesh_raycaster = GUI::MeshRaycasterCache::get(model_volume->get_mesh_shared_ptr());
             }
         }
     }
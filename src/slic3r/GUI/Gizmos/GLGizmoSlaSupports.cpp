@@ -1004,8 +1004,7 @@ void GLGizmoSlaSupports::editing_mode_apply_changes()
 
         ModelObject* mo = m_c->selection_info()->model_object();
         mo->sla_points_status = sla::PointsStatus::UserModified;
-        mo->sla_support_points.clear();
-        mo->sla_support_points = m_normal_cache;
+        mo->sla_support_points.set(m_normal_cache);
 
         reslice_until_step(slaposPad);
     }
@@ -1020,7 +1019,7 @@ void GLGizmoSlaSupports::reload_cache()
     if (mo->sla_points_status == sla::PointsStatus::AutoGenerated || mo->sla_points_status == sla::PointsStatus::Generating)
         get_data_from_backend();
     else
-        for (const sla::SupportPoint& point : mo->sla_support_points)
+        for (const sla::SupportPoint& point : mo->sla_support_points.get())
             m_normal_cache.emplace_back(point);
 }
 
@@ -271,18 +271,25 @@ void Raycaster::on_update()
         }
     }
 
+    std::vector<std::shared_ptr<const TriangleMesh>> shared_meshes;
     if (meshes.empty()) {
         const std::vector<ModelVolume*>& mvs = mo->volumes;
         for (const ModelVolume* mv : mvs) {
-            if (mv->is_model_part())
+            if (mv->is_model_part()) {
                 meshes.push_back(&mv->mesh());
+                shared_meshes.push_back(mv->get_mesh_shared_ptr());
+            }
         }
     }
 
     if (force_raycaster_regeneration || meshes != m_old_meshes) {
         m_raycasters.clear();
-        for (const TriangleMesh* mesh : meshes)
-            m_raycasters.emplace_back(new MeshRaycaster(std::make_shared<const TriangleMesh>(*mesh)));
+        for (size_t mesh_idx = 0; mesh_idx < meshes.size(); ++ mesh_idx)
+            m_raycasters.emplace_back(mesh_idx < shared_meshes.size() ?
+                // Model meshes: share the AABB tree already built for the scene picking.
+                MeshRaycasterCache::get(shared_meshes[mesh_idx]) :
+                // Mesh generated by the SLA backend, not shareable.
+                std::make_shared<const MeshRaycaster>(std::make_shared<const TriangleMesh>(*meshes[mesh_idx])));
         m_old_meshes = meshes;
     }
 }
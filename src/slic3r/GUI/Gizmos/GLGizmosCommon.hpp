@@ -226,7 +226,9 @@ protected:
     void on_release() override;
 
 private:
-    std::vector<std::unique_ptr<MeshRaycaster>> m_raycasters;
+    // The raycasters over the model meshes are shared with the scene picking
+    // through MeshRaycasterCache.
+    std::vector<std::shared_ptr<const MeshRaycaster>> m_raycasters;
     std::vector<const TriangleMesh*> m_old_meshes;
     // Used to store the sla mesh coming from the backend
     TriangleMesh m_sla_mesh_cache;
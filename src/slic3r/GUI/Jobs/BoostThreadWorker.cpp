@@ -177,12 +177,16 @@ bool BoostThreadWorker::wait_for_idle(unsigned timeout_ms)
     return !timeout_reached;
 }
 
-bool BoostThreadWorker::push(std::unique_ptr<Job> job)
+bool BoostThreadWorker::push(std::unique_ptr<Job> job, JobPriority priority)
 {
     if (!job)
         return false;
 
-    m_input_queue.push(JobEntry{std::move(job)});
+    if (priority == JobPriority::High)
+        m_input_queue.push_front(JobEntry{std::move(job)});
+    else
+        m_input_queue.push(JobEntry{std::move(job)});
+
     return true;
 }
 
@@ -163,7 +163,8 @@ public:
     BoostThreadWorker &operator=(const BoostThreadWorker &) = delete;
     BoostThreadWorker &operator=(BoostThreadWorker &&) = delete;
 
-    bool push(std::unique_ptr<Job> job) override;
+    bool push(std::unique_ptr<Job> job,
+              JobPriority priority = JobPriority::Normal) override;
 
     bool is_idle() const override
     {
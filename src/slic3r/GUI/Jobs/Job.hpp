@@ -7,6 +7,7 @@
 
 #include <atomic>
 #include <exception>
+#include <functional>
 #include <future>
 
 #include "libslic3r/libslic3r.h"
@@ -56,6 +57,17 @@ public:
     virtual void finalize(bool /*canceled*/, std::exception_ptr &) {}
 };
 
+// Adapt a job's cancellation state into a polling functor of the form used
+// throughout libslic3r (e.g. the stop condition of the arrangement or the
+// was_canceled hooks of the Emboss functions), so that canceling the job
+// stops the algorithms deep inside libslic3r instead of only being checked
+// between the steps of process(). The control object must outlive the
+// returned functor.
+inline std::function<bool()> make_cancel_check(const Job::Ctl &ctl)
+{
+    return [&ctl]() { return ctl.was_canceled(); };
+}
+
 }} // namespace Slic3r::GUI
 
 #endif // JOB_HPP
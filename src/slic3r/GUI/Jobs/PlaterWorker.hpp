@@ -126,9 +126,11 @@ public:
     }
 
     // Always package the job argument into a PlaterJob
-    bool push(std::unique_ptr<Job> job) override
+    bool push(std::unique_ptr<Job> job,
+              JobPriority priority = JobPriority::Normal) override
     {
-        return m_w.push(std::make_unique<PlaterJob>(m_plater, std::move(job)));
+        return m_w.push(std::make_unique<PlaterJob>(m_plater, std::move(job)),
+                        priority);
     }
 
     bool is_idle() const override { return m_w.is_idle(); }
@@ -108,6 +108,21 @@ public:
         m_cond_var.notify_one();
     }
 
+    // Push element to the front of the queue, to be consumed before the
+    // elements queued with push(). std::queue does not expose front
+    // insertion, so the protected container member is reached through a
+    // derived type.
+    template<class...TArgs>
+    void push_front(TArgs&&...el)
+    {
+        using Q = std::queue<T, Container<T, ContainerArgs...>>;
+        struct Access: Q { using Q::c; };
+
+        std::lock_guard lk{m_mutex};
+        (m_queue.*(&Access::c)).emplace_front(std::forward<TArgs>(el)...);
+        m_cond_var.notify_one();
+    }
+
     bool empty() const
     {
         std::lock_guard lk{m_mutex};
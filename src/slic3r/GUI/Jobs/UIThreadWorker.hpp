@@ -15,7 +15,7 @@ namespace Slic3r { namespace GUI {
 
 // Implementation of a worker which does not create any additional threads.
 class UIThreadWorker : public Worker, private Job::Ctl {
-    std::queue<std::unique_ptr<Job>, std::deque<std::unique_ptr<Job>>> m_jobqueue;
+    std::deque<std::unique_ptr<Job>> m_jobqueue;
     std::shared_ptr<ProgressIndicator> m_progress;
     bool m_running = false;
     bool m_canceled = false;
@@ -26,7 +26,7 @@ class UIThreadWorker : public Worker, private Job::Ctl {
 
         if (!m_jobqueue.empty()) {
             job = std::move(m_jobqueue.front());
-            m_jobqueue.pop();
+            m_jobqueue.pop_front();
         }
 
         if (job) {
@@ -88,12 +88,17 @@ public:
 
     UIThreadWorker() = default;
 
-    bool push(std::unique_ptr<Job> job) override
+    bool push(std::unique_ptr<Job> job,
+              JobPriority priority = JobPriority::Normal) override
     {
         m_canceled = false;
 
-        if (job)
-            m_jobqueue.push(std::move(job));
+        if (job) {
+            if (priority == JobPriority::High)
+                m_jobqueue.push_front(std::move(job));
+            else
+                m_jobqueue.push_back(std::move(job));
+        }
 
         return bool(job);
     }
@@ -107,8 +112,7 @@ public:
         m_canceled = true;
         process_front();
 
-        while (!m_jobqueue.empty())
-            m_jobqueue.pop();
+        m_jobqueue.clear();
     }
 
     void process_events() override {
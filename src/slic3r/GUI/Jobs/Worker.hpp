@@ -6,11 +6,18 @@
 #define PRUSALSICER_WORKER_HPP
 
 #include <memory>
+#include <vector>
 
 #include "Job.hpp"
 
 namespace Slic3r { namespace GUI {
 
+// Priority lane of a queued job. High priority jobs are consumed before the
+// normal priority jobs already waiting in the queue, so that a quick
+// interactive job is not held up behind long batch jobs. A job that is
+// already running is not preempted.
+enum class JobPriority { Normal, High };
+
 // An interface of a worker that runs jobs on a dedicated worker thread, one
 // after the other. It is assumed that every method of this class is called
 // from the same main thread.
@@ -18,7 +25,8 @@ class Worker {
 public:
     // Queue up a new job after the current one. This call does not block.
     // Returns false if the job gets discarded.
-    virtual bool push(std::unique_ptr<Job> job) = 0;
+    virtual bool push(std::unique_ptr<Job> job,
+                      JobPriority priority = JobPriority::Normal) = 0;
 
     // Returns true if no job is running, the job queue is empty and no job
     // message is left to be processed. This means that nothing is left to
@@ -92,6 +100,56 @@ inline bool queue_job(Worker &w, std::unique_ptr<Job> j)
     return w.push(std::move(j));
 }
 
+// Queue up a chain of dependent jobs: each job is only started if the
+// previous one finished without being canceled and without throwing. Note
+// that the links of the chain are queued one by one as their predecessors
+// finalize, so jobs pushed while the chain is in progress may run in between
+// the links.
+inline bool queue_job_chain(Worker                            &w,
+                            std::vector<std::unique_ptr<Job>>  chain,
+                            JobPriority priority = JobPriority::Normal)
+{
+    struct ChainLink: Job {
+        Worker                           *w;
+        std::unique_ptr<Job>              job;
+        std::vector<std::unique_ptr<Job>> rest;
+        JobPriority                       prio;
+
+        ChainLink(Worker                           &worker,
+                  std::unique_ptr<Job>              j,
+                  std::vector<std::unique_ptr<Job>> r,
+                  JobPriority                       p)
+            : w{&worker}, job{std::move(j)}, rest{std::move(r)}, prio{p}
+        {}
+
+        void process(Ctl &ctl) override { job->process(ctl); }
+        void finalize(bool canceled, std::exception_ptr &eptr) override
+        {
+            // The chain is broken by a throwing link even if its finalize()
+            // handles the exception.
+            bool failed = eptr != nullptr;
+            job->finalize(canceled, eptr);
+            if (!canceled && !failed && !rest.empty()) {
+                auto next = std::move(rest.front());
+                rest.erase(rest.begin());
+                w->push(std::make_unique<ChainLink>(*w, std::move(next),
+                                                    std::move(rest), prio),
+                        prio);
+            }
+        }
+    };
+
+    if (chain.empty())
+        return false;
+
+    auto first = std::move(chain.front());
+    chain.erase(chain.begin());
+
+    return w.push(std::make_unique<ChainLink>(w, std::move(first),
+                                              std::move(chain), priority),
+                  priority);
+}
+
 // Replace the current job queue with a new job. The signature is the same
 // as for queue_job(). This cancels all jobs and
 // will not wait. The new job will begin after the queue cancels properly.
@@ -171,11 +171,25 @@ GCodeInputData convert(const Slic3r::GCodeProcessorResult& result, const std::ve
         ret.color_print_colors.emplace_back(convert(color));
     }
 
-    const std::vector<Slic3r::GCodeProcessorResult::MoveVertex>& moves = result.moves;
-    ret.vertices.reserve(2 * moves.size());
+    const Slic3r::GCodeProcessorResult::Moves& moves = result.moves;
+    // Count the vertices first so that the buffer can be reserved exactly. Reserving
+    // 2 * moves.size() would transiently hold twice the needed memory during the
+    // conversion of multi-GB prints, while only the path starts emit a second,
+    // 'phantom' vertex.
+    size_t vertices_count = 0;
     for (size_t i = 1; i < moves.size(); ++i) {
         const Slic3r::GCodeProcessorResult::MoveVertex& curr = moves[i];
         const Slic3r::GCodeProcessorResult::MoveVertex& prev = moves[i - 1];
+        const EOptionType option_type = move_type_to_option(convert(curr.type));
+        if ((option_type == EOptionType::COUNT || option_type == EOptionType::Travels || option_type == EOptionType::Wipes) &&
+            (vertices_count == 0 || prev.type != curr.type || prev.extrusion_role != curr.extrusion_role))
+            ++vertices_count;
+        ++vertices_count;
+    }
+    ret.vertices.reserve(vertices_count);
+    for (size_t i = 1; i < moves.size(); ++i) {
+        const Slic3r::GCodeProcessorResult::MoveVertex curr = moves[i];
+        const Slic3r::GCodeProcessorResult::MoveVertex prev = moves[i - 1];
         const EMoveType curr_type = convert(curr.type);
         const EOptionType option_type = move_type_to_option(curr_type);
         if (option_type == EOptionType::COUNT || option_type == EOptionType::Travels || option_type == EOptionType::Wipes) {
@@ -212,6 +226,7 @@ GCodeInputData convert(const Slic3r::GCodeProcessorResult& result, const std::ve
 #endif // VGCODE_ENABLE_COG_AND_TOOL_MARKERS
         ret.vertices.emplace_back(vertex);
     }
+    assert(ret.vertices.size() == vertices_count);
     ret.vertices.shrink_to_fit();
 
     ret.spiral_vase_mode = result.spiral_vase_mode;
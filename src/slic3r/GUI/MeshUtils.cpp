@@ -22,6 +22,8 @@
 #include <igl/unproject.h>
 
 #include <cstdint>
+#include <map>
+#include <mutex>
 
 
 namespace Slic3r {
@@ -585,5 +587,28 @@ int MeshRaycaster::get_closest_facet(const Vec3f &point) const
     return facet_idx;
 }
 
+std::shared_ptr<const MeshRaycaster> MeshRaycasterCache::get(const std::shared_ptr<const TriangleMesh> &mesh)
+{
+    static std::mutex                                                  cache_mutex;
+    static std::map<const TriangleMesh*, std::shared_ptr<const MeshRaycaster>> cache;
+
+    assert(mesh != nullptr);
+    std::lock_guard<std::mutex> lock(cache_mutex);
+
+    // Drop the raycasters of meshes that are no longer referenced by anything but the cache,
+    // meaning the model replaced or deleted the mesh. A cached raycaster pins its mesh,
+    // therefore the map key cannot alias a new mesh while its entry exists.
+    for (auto it = cache.begin(); it != cache.end();)
+        if (it->second->mesh_ptr().use_count() == 1 && it->second.use_count() == 1)
+            it = cache.erase(it);
+        else
+            ++ it;
+
+    std::shared_ptr<const MeshRaycaster> &raycaster = cache[mesh.get()];
+    if (raycaster == nullptr)
+        raycaster = std::make_shared<const MeshRaycaster>(mesh);
+    return raycaster;
+}
+
 } // namespace GUI
 } // namespace Slic3r
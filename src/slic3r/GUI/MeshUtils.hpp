@@ -228,12 +228,26 @@ public:
 
     Vec3f get_triangle_normal(size_t facet_idx) const;
 
+    const std::shared_ptr<const TriangleMesh>& mesh_ptr() const { return m_mesh; }
+
 private:
     std::shared_ptr<const TriangleMesh> m_mesh;
     AABBMesh m_emesh;
     std::vector<stl_normal> m_normals;
 };
 
+// Cache of MeshRaycasters shared between the scene picking and the gizmos.
+// Building the AABB tree over a large mesh takes seconds and all the consumers raycast
+// the very same ModelVolume meshes, so each tree is built just once per mesh and shared,
+// which also makes switching between the tools instant.
+class MeshRaycasterCache
+{
+public:
+    // Return a shared raycaster over the given mesh, building and caching it if not cached yet.
+    // Raycasters of meshes released by the model meanwhile are dropped from the cache.
+    static std::shared_ptr<const MeshRaycaster> get(const std::shared_ptr<const TriangleMesh> &mesh);
+};
+
 struct PickingModel
 {
     GLModel model;
@@ -451,6 +451,9 @@ struct Plater::priv
     void suppress_snapshots()   { m_prevent_snapshots++; }
     void allow_snapshots()      { m_prevent_snapshots--; }
 
+    void postpone_updates()     { m_postpone_updates++; }
+    void process_postponed_updates();
+
     void process_validation_warning(const std::vector<std::string>& warning) const;
 
     bool background_processing_enabled() const { return this->get_config_bool("background_processing"); }
@@ -586,6 +589,10 @@ private:
                                                               * we should call tack_snapshot just ones
                                                               * instead of calls for each action separately
                                                               * */
+    // Nesting counter of the Plater::CoalesceUpdates wrappers, see Plater::priv::update().
+    int                         m_postpone_updates = 0;
+    bool                        m_update_postponed = false;
+    unsigned int                m_postponed_update_flags = 0;
     std::string 				m_last_fff_printer_profile_name;
     std::string 				m_last_sla_printer_profile_name;
 
@@ -1018,6 +1025,14 @@ Plater::priv::~priv()
 
 void Plater::priv::update(unsigned int flags)
 {
+    if (m_postpone_updates > 0) {
+        // Inside a Plater::CoalesceUpdates scope. Merge this update into a single one
+        // executed when the outermost scope is left.
+        m_update_postponed = true;
+        m_postponed_update_flags |= flags;
+        return;
+    }
+
     // the following line, when enabled, causes flickering on NVIDIA graphics cards
 //    wxWindowUpdateLocker freeze_guard(q);
     if (get_config_bool("autocenter"))
@@ -1040,6 +1055,17 @@ void Plater::priv::update(unsigned int flags)
         this->sidebar->obj_manipul()->UpdateAndShow(true);
 }
 
+void Plater::priv::process_postponed_updates()
+{
+    assert(m_postpone_updates > 0);
+    if (-- m_postpone_updates == 0 && m_update_postponed) {
+        m_update_postponed = false;
+        unsigned int flags = m_postponed_update_flags;
+        m_postponed_update_flags = 0;
+        this->update(flags);
+    }
+}
+
 void Plater::priv::select_view(const std::string& direction)
 {
     if (current_panel == view3D)
@@ -5131,9 +5157,12 @@ void Plater::decrease_instances(size_t num, int obj_idx/* = -1*/)
         obj_idx = p->get_selected_object_idx();
 
     if (obj_idx < 0) {
-        if (const auto obj_ids = get_selection().get_object_idxs(); !obj_ids.empty())
+        if (const auto obj_ids = get_selection().get_object_idxs(); !obj_ids.empty()) {
+            // Coalesce the full scene reloads of the per object calls into a single one.
+            CoalesceUpdates coalesce(this);
             for (const size_t obj_id : obj_ids)
                 decrease_instances(1, int(obj_id));
+        }
         return;
     }
 
@@ -5282,10 +5311,14 @@ void Plater::convert_unit(ConversionType conv_type)
     wxBusyCursor wait;
 
     ModelObjectPtrs objects;
-    for (int obj_idx : obj_idxs) {
-        ModelObject *object = p->model.objects[obj_idx];
-        object->convert_units(objects, conv_type, volume_idxs);
-        remove(obj_idx);
+    {
+        // Coalesce the full scene reloads of the per object remove() calls into a single one.
+        CoalesceUpdates coalesce(this);
+        for (int obj_idx : obj_idxs) {
+            ModelObject *object = p->model.objects[obj_idx];
+            object->convert_units(objects, conv_type, volume_idxs);
+            remove(obj_idx);
+        }
     }
     p->load_model_objects(objects);
     
@@ -6189,6 +6222,8 @@ void Plater::take_snapshot(const std::string &snapshot_name, UndoRedo::SnapshotT
 void Plater::take_snapshot(const wxString &snapshot_name, UndoRedo::SnapshotType snapshot_type) { p->take_snapshot(snapshot_name, snapshot_type); }
 void Plater::suppress_snapshots() { p->suppress_snapshots(); }
 void Plater::allow_snapshots() { p->allow_snapshots(); }
+void Plater::postpone_updates() { p->postpone_updates(); }
+void Plater::process_postponed_updates() { p->process_postponed_updates(); }
 void Plater::undo() { p->undo(); }
 void Plater::redo() { p->redo(); }
 void Plater::undo_to(int selection)
@@ -389,6 +389,25 @@ public:
 		Plater *m_plater;
 	};
 
+	// RAII wrapper, which postpones and coalesces the Plater updates (full scene reloads)
+	// triggered inside its scope into a single update executed when the outermost wrapper
+	// is destroyed. Bulk operations (multi object delete, unit conversion) wrap themselves
+	// into it, so that they trigger one scene reload instead of one per object.
+	class CoalesceUpdates
+	{
+	public:
+		CoalesceUpdates(Plater *plater) : m_plater(plater)
+		{
+			m_plater->postpone_updates();
+		}
+		~CoalesceUpdates()
+		{
+			m_plater->process_postponed_updates();
+		}
+	private:
+		Plater *m_plater;
+	};
+
     // RAII wrapper for taking an Undo / Redo snapshot while disabling the snapshot taking by the methods called from inside this snapshot.
 	class TakeSnapshot
 	{
@@ -453,6 +472,9 @@ private:
     void suppress_snapshots();
     void allow_snapshots();
 
+    void postpone_updates();
+    void process_postponed_updates();
+
     friend class SuppressBackgroundProcessingUpdate;
 };
 
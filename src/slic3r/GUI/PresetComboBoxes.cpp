@@ -1536,8 +1536,20 @@ void TabPresetComboBox::update_dirty()
 {
     // 1) Update the dirty flag of the current preset.
     m_collection->update_dirty();
+    // 2) Update the labels.
+    update_dirty_labels();
+}
 
+void TabPresetComboBox::update_dirty(const std::string& opt_key)
+{
+    // 1) Update the dirty flag of the current preset, recomparing just the changed option.
+    m_collection->update_dirty(opt_key);
     // 2) Update the labels.
+    update_dirty_labels();
+}
+
+void TabPresetComboBox::update_dirty_labels()
+{
     wxWindowUpdateLocker noUpdates(this);
     for (unsigned int ui_id = 0; ui_id < GetCount(); ++ui_id) {
         auto marker = reinterpret_cast<Marker>(this->GetClientData(ui_id));
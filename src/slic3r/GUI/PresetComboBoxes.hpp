@@ -200,6 +200,8 @@ class TabPresetComboBox : public PresetComboBox
     bool show_incompatible {false};
     bool m_enable_all {false};
 
+    void update_dirty_labels();
+
 public:
     TabPresetComboBox(wxWindow *parent, Preset::Type preset_type);
     ~TabPresetComboBox() {}
@@ -210,6 +212,8 @@ public:
     wxString get_preset_name(const Preset& preset) override;
     void update() override;
     void update_dirty();
+    // Variant to be used from an edit field change, when only opt_key changed.
+    void update_dirty(const std::string& opt_key);
     void msw_rescale() override;
     void OnSelect(wxCommandEvent& evt) override;
 
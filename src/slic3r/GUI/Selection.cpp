@@ -1746,9 +1746,9 @@ void Selection::copy_to_clipboard()
         dst_object->name                 = src_object->name;
         dst_object->input_file           = src_object->input_file;
 		dst_object->config.assign_config(src_object->config);
-        dst_object->sla_support_points   = src_object->sla_support_points;
+        dst_object->sla_support_points.assign(src_object->sla_support_points);
         dst_object->sla_points_status    = src_object->sla_points_status;
-        dst_object->sla_drain_holes      = src_object->sla_drain_holes;
+        dst_object->sla_drain_holes.assign(src_object->sla_drain_holes);
         dst_object->layer_config_ranges  = src_object->layer_config_ranges;     // #ys_FIXME_experiment
         dst_object->layer_height_profile.assign(src_object->layer_height_profile);
         dst_object->origin_translation   = src_object->origin_translation;
@@ -625,9 +625,10 @@ void Tab::update_changed_ui()
     if (m_postpone_update_ui)
         return;
 
-    const bool deep_compare = m_type != Preset::TYPE_FILAMENT;
-    auto dirty_options = m_presets->current_dirty_options(deep_compare);
-    auto nonsys_options = m_presets->current_different_from_parent_options(deep_compare);
+    // The diffs are maintained incrementally by update_dirty(opt_key) while editing
+    // and only recalculated in full after a bulk change.
+    std::vector<std::string> dirty_options = m_presets->cached_dirty_options();
+    std::vector<std::string> nonsys_options = m_presets->cached_different_from_parent_options();
     if (m_type == Preset::TYPE_PRINTER) {
         {
             auto check_bed_custom_options = [](std::vector<std::string>& keys) {
@@ -873,6 +874,15 @@ void Tab::update_dirty()
     update_changed_ui();
 }
 
+// Variant of update_dirty() to be used from an edit field change, when it is known
+// that only opt_key changed: just that option is recompared with the selected preset.
+void Tab::update_dirty(const std::string& opt_key)
+{
+    m_presets_choice->update_dirty(opt_key);
+    on_presets_changed();
+    update_changed_ui();
+}
+
 void Tab::update_tab_ui()
 {
     m_presets_choice->update();
@@ -2155,7 +2165,7 @@ void TabFilament::build()
 
         optgroup->on_change = [this](t_config_option_key opt_key, boost::any value)
         {
-            update_dirty();
+            update_dirty(opt_key);
             if (opt_key == "filament_spool_weight") {
                 // Change of this option influences for an update of "Sliced Info"
                 wxGetApp().sidebar().update_sliced_info_sizer();
@@ -5248,7 +5258,7 @@ ConfigOptionsGroupShp Page::new_optgroup(const wxString& title, int noncommon_la
     optgroup->set_config_category_and_type(m_title, static_cast<Tab*>(tab)->type());
     optgroup->on_change = [tab](t_config_option_key opt_key, boost::any value) {
         // This function will be called from OptionGroup.
-        tab->update_dirty();
+        tab->update_dirty(opt_key);
         tab->on_value_change(opt_key, value);
     };
 
@@ -371,6 +371,8 @@ public:
 	void			emplace_option(const std::string &opt_key, bool respect_vec_values = false);
 	void			load_initial_data();
 	void			update_dirty();
+	// Variant to be used from an edit field change, when only opt_key changed.
+	void			update_dirty(const std::string& opt_key);
 	void			update_tab_ui();
 	void			load_config(const DynamicPrintConfig& config);
 	virtual void	reload_config();
@@ -7,16 +7,22 @@
 #include <cstdint>
 #include <algorithm>
 #include <array>
+#include <mutex>
 #include <vector>
 #include <string>
 #include <map>
 #include <thread>
+#include <boost/algorithm/string.hpp>
 #include <boost/endian/conversion.hpp>
 #include <boost/date_time/posix_time/posix_time_duration.hpp>
+#include <boost/filesystem.hpp>
 #include <boost/format.hpp>
 #include <boost/log/trivial.hpp>
+#include <boost/nowide/fstream.hpp>
 #include <boost/bind/bind.hpp>
 
+#include "libslic3r/Utils.hpp"
+
 using boost::optional;
 using boost::system::error_code;
 namespace endian = boost::endian;
@@ -833,6 +839,117 @@ void ResolveSession::handle_receive(const error_code& error, size_t bytes)
 
 // API - private part
 
+// Persistent cache of printers seen by previous lookups, so that a new lookup can
+// replay the known devices through ReplyFn immediately while the network discovery
+// refreshes them in the background.
+// Replayed cache entries may be duplicated by live replies, which is nothing new to
+// the callers: the same happens with retries > 1 (see Bonjour::set_retries()).
+class BonjourReplyCache
+{
+public:
+	static BonjourReplyCache& get()
+	{
+		static BonjourReplyCache instance;
+		return instance;
+	}
+
+	std::vector<BonjourReply> retrieve(const std::string &service)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		load();
+		auto it = m_replies.find(service);
+		return it != m_replies.end() ? it->second : std::vector<BonjourReply>();
+	}
+
+	void store(const std::string &service, const BonjourReply &reply)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		load();
+		auto &replies = m_replies[service];
+		for (BonjourReply &existing : replies)
+			if (existing.service_name == reply.service_name && existing.hostname == reply.hostname) {
+				if (! (existing == reply)) {
+					// The device answers from a different address than the last time, refresh it.
+					existing = reply;
+					m_dirty = true;
+				}
+				return;
+			}
+		replies.push_back(reply);
+		m_dirty = true;
+	}
+
+	void save()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (! m_dirty)
+			return;
+		boost::filesystem::path path = cache_path();
+		if (path.empty())
+			return;
+		boost::system::error_code ec;
+		boost::filesystem::create_directories(path.parent_path(), ec);
+		if (ec) {
+			BOOST_LOG_TRIVIAL(error) << "Failed to create directory for bonjour cache: " << ec.message();
+			return;
+		}
+		boost::nowide::ofstream file(path.string(), std::ios::trunc);
+		for (const auto &service : m_replies)
+			for (const BonjourReply &reply : service.second) {
+				file << service.first << '\t' << reply.ip.to_string() << '\t' << reply.port
+					 << '\t' << reply.service_name << '\t' << reply.hostname;
+				for (const auto &kv : reply.txt_data)
+					file << '\t' << kv.first << '=' << kv.second;
+				file << '\n';
+			}
+		m_dirty = false;
+	}
+
+private:
+	BonjourReplyCache() = default;
+
+	// Lazy load under m_mutex, the data directory is not known at static init time.
+	void load()
+	{
+		if (m_loaded)
+			return;
+		m_loaded = true;
+		boost::filesystem::path path = cache_path();
+		boost::system::error_code ec;
+		if (path.empty() || ! boost::filesystem::exists(path, ec))
+			return;
+		boost::nowide::ifstream file(path.string());
+		std::string line;
+		while (std::getline(file, line)) {
+			std::vector<std::string> fields;
+			boost::split(fields, line, boost::is_any_of("\t"));
+			if (fields.size() < 5)
+				continue;
+			auto ip = asio::ip::address::from_string(fields[1], ec);
+			int port = std::atoi(fields[2].c_str());
+			if (ec || port <= 0 || port > 65535)
+				continue;
+			BonjourReply::TxtData txt_data;
+			for (size_t i = 5; i < fields.size(); ++ i)
+				if (size_t eq = fields[i].find('='); eq != std::string::npos)
+					txt_data[fields[i].substr(0, eq)] = fields[i].substr(eq + 1);
+			m_replies[fields[0]].emplace_back(ip, uint16_t(port), fields[3], fields[4], std::move(txt_data));
+		}
+	}
+
+	boost::filesystem::path cache_path() const
+	{
+		const std::string &dir = data_dir();
+		// data_dir is empty when running outside of the GUI (e.g. the CLI), no caching then.
+		return dir.empty() ? boost::filesystem::path() : boost::filesystem::path(dir) / "cache" / "bonjour.txt";
+	}
+
+	std::mutex m_mutex;
+	std::map<std::string, std::vector<BonjourReply>> m_replies;
+	bool m_loaded = false;
+	bool m_dirty = false;
+};
+
 struct Bonjour::priv
 {
 	const std::string service;
@@ -871,6 +988,19 @@ void Bonjour::priv::lookup_perform()
 {
 	service_dn = (boost::format("_%1%._%2%.local") % service % protocol).str();
 
+	// Replay printers seen by previous lookups, so that the caller can present
+	// known devices immediately while the discovery below refreshes them.
+	if (replyfn)
+		for (BonjourReply &reply : BonjourReplyCache::get().retrieve(service))
+			replyfn(std::move(reply));
+
+	// Live replies are recorded into the cache on top of being passed to the caller.
+	Bonjour::ReplyFn cache_replyfn = [this](BonjourReply &&reply) {
+		BonjourReplyCache::get().store(service, reply);
+		if (replyfn)
+			replyfn(std::move(reply));
+	};
+
 	std::shared_ptr< boost::asio::io_service > io_service(new boost::asio::io_service);
 
 	std::vector<LookupSocket*> sockets;
@@ -890,12 +1020,12 @@ void Bonjour::priv::lookup_perform()
 		// create ipv4 socket for each interface
 		// each will send to querry to for both ipv4 and ipv6
 		for (const auto& intrfc : interfaces) 		
-			sockets.emplace_back(new LookupSocket(txt_keys, service, service_dn, protocol, replyfn, BonjourRequest::MCAST_IP4, intrfc, io_service));
+			sockets.emplace_back(new LookupSocket(txt_keys, service, service_dn, protocol, cache_replyfn, BonjourRequest::MCAST_IP4, intrfc, io_service));
 	} else {
 		BOOST_LOG_TRIVIAL(info) << "Failed to resolve ipv4 interfaces: " << ec.message();
 	}
 	if (sockets.empty())
-		sockets.emplace_back(new LookupSocket(txt_keys, service, service_dn, protocol, replyfn, BonjourRequest::MCAST_IP4, io_service));
+		sockets.emplace_back(new LookupSocket(txt_keys, service, service_dn, protocol, cache_replyfn, BonjourRequest::MCAST_IP4, io_service));
 	// ipv6 interfaces
 	interfaces.clear();
 	//udp::resolver::query query(host, PORT, boost::asio::ip::resolver_query_base::numeric_service);
@@ -910,9 +1040,9 @@ void Bonjour::priv::lookup_perform()
 		// create ipv6 socket for each interface
 		// each will send to querry to for both ipv4 and ipv6
 		for (const auto& intrfc : interfaces)
-			sockets.emplace_back(new LookupSocket(txt_keys, service, service_dn, protocol, replyfn, BonjourRequest::MCAST_IP6, intrfc, io_service));
+			sockets.emplace_back(new LookupSocket(txt_keys, service, service_dn, protocol, cache_replyfn, BonjourRequest::MCAST_IP6, intrfc, io_service));
 		if (interfaces.empty())
-			sockets.emplace_back(new LookupSocket(txt_keys, service, service_dn, protocol, replyfn, BonjourRequest::MCAST_IP6, io_service));
+			sockets.emplace_back(new LookupSocket(txt_keys, service, service_dn, protocol, cache_replyfn, BonjourRequest::MCAST_IP6, io_service));
 	} else {
 		BOOST_LOG_TRIVIAL(info)<< "Failed to resolve ipv6 interfaces: " << ec.message();
 	}
@@ -930,6 +1060,7 @@ void Bonjour::priv::lookup_perform()
 			if (retries == 0 || error) {
 				// is this correct ending?
 				io_service->stop();
+				BonjourReplyCache::get().save();
 				if (completefn) {
 					completefn();
 				}
@@ -8,6 +8,7 @@
 
 #include <cstdlib>
 #include <functional>
+#include <mutex>
 #include <thread>
 #include <deque>
 #include <sstream>
@@ -106,6 +107,56 @@ struct CurlGlobalInit
 
 std::unique_ptr<CurlGlobalInit> CurlGlobalInit::instance;
 
+// A process wide curl share handle attached to every easy handle created by Http.
+// It lets consecutive requests reuse DNS entries, TLS sessions and (on new enough
+// libcurl) established connections, so that periodic status polling of a print host
+// does not pay a fresh TCP + TLS handshake on every request.
+// The share handle is protected by the locking callbacks below, as the requests
+// run on their own threads.
+class CurlConnectionShare
+{
+public:
+	static ::CURLSH* get()
+	{
+		// Intentionally leaked: detached request threads may still hold easy handles
+		// attached to the share during process teardown.
+		static CurlConnectionShare *instance = new CurlConnectionShare();
+		return instance->m_share;
+	}
+
+private:
+	CurlConnectionShare()
+	{
+		m_share = ::curl_share_init();
+		if (m_share == nullptr) {
+			BOOST_LOG_TRIVIAL(error) << "Could not construct Curl share object, connection reuse is disabled";
+			return;
+		}
+		::curl_share_setopt(m_share, CURLSHOPT_LOCKFUNC, lockcb);
+		::curl_share_setopt(m_share, CURLSHOPT_UNLOCKFUNC, unlockcb);
+		::curl_share_setopt(m_share, CURLSHOPT_USERDATA, this);
+		::curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+		::curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+#if LIBCURL_VERSION_MAJOR > 7 || (LIBCURL_VERSION_MAJOR == 7 && LIBCURL_VERSION_MINOR >= 57)
+		// Sharing the connection cache between easy handles is only available since curl 7.57.
+		::curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+#endif
+	}
+
+	static void lockcb(::CURL * /* handle */, ::curl_lock_data data, ::curl_lock_access /* access */, void *userp)
+	{
+		static_cast<CurlConnectionShare*>(userp)->m_mutexes[size_t(data) % size_t(CURL_LOCK_DATA_LAST)].lock();
+	}
+
+	static void unlockcb(::CURL * /* handle */, ::curl_lock_data data, void *userp)
+	{
+		static_cast<CurlConnectionShare*>(userp)->m_mutexes[size_t(data) % size_t(CURL_LOCK_DATA_LAST)].unlock();
+	}
+
+	::CURLSH   *m_share = nullptr;
+	std::mutex  m_mutexes[size_t(CURL_LOCK_DATA_LAST)];
+};
+
 struct Http::priv
 {
 	enum {
@@ -149,7 +200,7 @@ struct Http::priv
 	void form_add_file(const char *name, const fs::path &path, const char* filename);
 	void set_post_body(const fs::path &path);
 	void set_post_body(const std::string &body);
-	void set_put_body(const fs::path &path);
+	void set_put_body(const fs::path &path, size_t offset = 0);
 	void set_range(const std::string& range);
 
 	std::string curl_error(CURLcode curlcode);
@@ -177,7 +228,16 @@ Http::priv::priv(const std::string &url)
 	::curl_easy_setopt(curl, CURLOPT_URL, url.c_str());   // curl makes a copy internally
 	::curl_easy_setopt(curl, CURLOPT_USERAGENT, SLIC3R_APP_NAME "/" SLIC3R_VERSION);
 	::curl_easy_setopt(curl, CURLOPT_ERRORBUFFER, &error_buffer.front());
+#if LIBCURL_VERSION_MAJOR > 7 || (LIBCURL_VERSION_MAJOR == 7 && LIBCURL_VERSION_MINOR >= 47)
+	// Negotiate HTTP/2 over TLS connections (plain HTTP print hosts keep talking HTTP/1.1),
+	// which allows multiplexing concurrent requests over a single reused connection.
+	::curl_easy_setopt(curl, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+#else
 	::curl_easy_setopt(curl, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_1_1);
+#endif
+	if (::CURLSH *share = CurlConnectionShare::get(); share != nullptr)
+		::curl_easy_setopt(curl, CURLOPT_SHARE, share);
+	::curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
 }
 
 Http::priv::~priv()
@@ -310,14 +370,16 @@ void Http::priv::set_post_body(const std::string &body)
 	postfields = body;
 }
 
-void Http::priv::set_put_body(const fs::path &path)
+void Http::priv::set_put_body(const fs::path &path, size_t offset)
 {
 	boost::system::error_code ec;
 	boost::uintmax_t filesize = file_size(path, ec);
-	if (!ec) {
+	if (!ec && offset <= filesize) {
         putFile = std::make_unique<fs::ifstream>(path, std::ios::binary);
+        if (offset > 0)
+            putFile->seekg(offset, std::ios::beg);
         ::curl_easy_setopt(curl, CURLOPT_READDATA, (void *) (putFile.get()));
-		::curl_easy_setopt(curl, CURLOPT_INFILESIZE, filesize);
+		::curl_easy_setopt(curl, CURLOPT_INFILESIZE, filesize - offset);
 	}
 }
 
@@ -569,6 +631,12 @@ Http& Http::set_put_body(const fs::path &path)
 	return *this;
 }
 
+Http& Http::set_put_body(const fs::path &path, size_t offset)
+{
+	if (p) { p->set_put_body(path, offset);}
+	return *this;
+}
+
 Http& Http::on_complete(CompleteFn fn)
 {
 	if (p) { p->completefn = std::move(fn); }
@@ -113,6 +113,9 @@ public:
 	// The data is used verbatim, it is not additionally encoded in any way.
 	// This can be used for hosts which do not support multipart requests.
 	Http& set_put_body(const boost::filesystem::path &path);
+	// Same as above, starting at the given byte offset of the file.
+	// Used to resume an interrupted upload of the file tail.
+	Http& set_put_body(const boost::filesystem::path &path, size_t offset);
 
 	// Callback called on HTTP request complete
 	Http& on_complete(CompleteFn fn);
@@ -184,28 +184,59 @@ bool PrusaConnectNew::upload(PrintHostUpload upload_data, ProgressFn progress_fn
         % upload_data.upload_path.filename().string()
         % upload_data.upload_path.parent_path().string()
         % (upload_data.post_action == PrintHostPostUploadAction::StartPrint ? "true" : "false");
-     
-    Http http = Http::put(std::move(url));
-    http.set_put_body(upload_data.source_path)
-        .header("Content-Type", "text/x.gcode")
-        .header("Authorization", "Bearer " + access_token)
-        .on_complete([&](std::string body, unsigned status) {
-            BOOST_LOG_TRIVIAL(info) << boost::format("%1%: File uploaded: HTTP %2%: %3%") % name % status % body;
-        })
-        .on_error([&](std::string body, std::string error, unsigned status) {
-            BOOST_LOG_TRIVIAL(error) << boost::format("%1%: Error uploading file: %2%, HTTP %3%, body: `%4%`") % name % error % status % body;
-            error_fn(format_error(body, error, status));
-            res = false;
-        })
-        .on_progress([&](Http::Progress progress, bool& cancel) {
-            progress_fn(std::move(progress), cancel);
-            if (cancel) {
-                // Upload was canceled
-                BOOST_LOG_TRIVIAL(info) << name << ": Upload canceled";
+
+    // Upload the file via a PUT request. When the transfer dies mid flight (transport error,
+    // typically a dropped connection), resume the registered upload from the last byte pushed
+    // out instead of restarting a multi hundred MB upload from zero. The resumed request
+    // carries a Content-Range header; a server refusing it fails the upload the same way the
+    // dropped connection used to.
+    static constexpr int max_attempts = 3;
+    boost::system::error_code ec;
+    const boost::uintmax_t total_size = boost::filesystem::file_size(upload_data.source_path, ec);
+    size_t resume_offset = 0;
+    for (int attempt = 0; attempt < max_attempts; ++ attempt) {
+        bool transport_error = false;
+        bool canceled        = false;
+        size_t uploaded      = resume_offset;
+        res = true;
+        Http http = Http::put(std::string(url));
+        http.set_put_body(upload_data.source_path, resume_offset)
+            .header("Content-Type", "text/x.gcode")
+            .header("Authorization", "Bearer " + access_token);
+        if (resume_offset > 0)
+            http.header("Content-Range", GUI::format("bytes %1%-%2%/%3%", resume_offset, total_size - 1, total_size));
+        http.on_complete([&](std::string body, unsigned status) {
+                BOOST_LOG_TRIVIAL(info) << boost::format("%1%: File uploaded: HTTP %2%: %3%") % name % status % body;
+            })
+            .on_error([&](std::string body, std::string error, unsigned status) {
+                BOOST_LOG_TRIVIAL(error) << boost::format("%1%: Error uploading file: %2%, HTTP %3%, body: `%4%`") % name % error % status % body;
+                // status == 0 means the request died without an HTTP reply (libcurl transport failure).
+                transport_error = status == 0;
+                if (! transport_error || ec || attempt + 1 == max_attempts)
+                    error_fn(format_error(body, error, status));
                 res = false;
-            }
-        })
-        .perform_sync();
+            })
+            .on_progress([&](Http::Progress progress, bool& cancel) {
+                // Report the overall progress including the part pushed out by the previous attempts.
+                uploaded        = resume_offset + progress.ulnow;
+                progress.ulnow  = uploaded;
+                if (! ec)
+                    progress.ultotal = total_size;
+                progress_fn(std::move(progress), cancel);
+                if (cancel) {
+                    // Upload was canceled
+                    BOOST_LOG_TRIVIAL(info) << name << ": Upload canceled";
+                    canceled = true;
+                    res      = false;
+                }
+            })
+            .perform_sync();
+
+        if (res || canceled || ! transport_error || ec)
+            break;
+        resume_offset = uploaded;
+        BOOST_LOG_TRIVIAL(info) << boost::format("%1%: Upload interrupted, resuming from byte %2%") % name % resume_offset;
+    }
 
     return res;
 }
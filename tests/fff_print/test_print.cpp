@@ -127,6 +127,39 @@ SCENARIO("Print: Brim generation", "[Print]") {
     }
 }
 
+SCENARIO("Print: Moving a parked modifier mesh does not invalidate slicing", "[Print]") {
+    GIVEN("sliced 20mm cube with a modifier mesh parked aside") {
+        auto config = Slic3r::DynamicPrintConfig::full_print_config();
+        Print print;
+        Model model;
+        Slic3r::Test::init_print({ TestMesh::cube_20x20x20 }, print, model, config);
+        ModelVolume *modifier = model.objects.front()->add_volume(make_cube(5., 5., 5.), ModelVolumeType::PARAMETER_MODIFIER);
+        modifier->config.set_deserialize_strict("fill_density", "100%");
+        modifier->set_offset(Vec3d(100., 0., 0.));
+        print.apply(model, config);
+        print.process();
+        REQUIRE(print.objects().front()->is_step_done(posSlice));
+        WHEN("the modifier is moved where it still overlaps nothing") {
+            Model model2(model);
+            model2.objects.front()->volumes.back()->set_offset(Vec3d(100., 50., 0.));
+            PrintBase::ApplyStatus status = print.apply(model2, config);
+            THEN("all milestones stay valid") {
+                REQUIRE(status == PrintBase::APPLY_STATUS_UNCHANGED);
+                REQUIRE(print.objects().front()->is_step_done(posSlice));
+            }
+        }
+        WHEN("the modifier is moved over the object") {
+            Model model2(model);
+            model2.objects.front()->volumes.back()->set_offset(Vec3d(0., 0., 0.));
+            PrintBase::ApplyStatus status = print.apply(model2, config);
+            THEN("the slicing milestones are invalidated") {
+                REQUIRE(status == PrintBase::APPLY_STATUS_INVALIDATED);
+                REQUIRE(! print.objects().front()->is_step_done(posSlice));
+            }
+        }
+    }
+}
+
 SCENARIO("Ported from Perl", "[Print]") {
     GIVEN("20mm cube") {
         WHEN("Print center is set to 100x100 (test framework default)")  {
@@ -0,0 +1,43 @@
+#include <catch2/catch.hpp>
+
+#include "test_data.hpp"
+#include "bench_utils.hpp"
+
+#include "libslic3r/PrintConfig.hpp"
+#include "libslic3r/libslic3r.h"
+
+using namespace Slic3r;
+
+// End-to-end slicing benchmarks: a small matrix of representative meshes and
+// print profiles, each sliced to G-code through the full pipeline. Run with
+//     slic3r_bench "[Benchmarks]"
+// and set SLIC3R_BENCH_JSON=<file> to collect machine readable results.
+TEST_CASE("End-to-end FFF slicing", "[.Benchmarks]") {
+    const std::vector<std::pair<std::string, Test::TestMesh>> meshes = {
+        { "cube20",           Test::TestMesh::cube_20x20x20 },
+        { "ipadstand",        Test::TestMesh::ipadstand },
+        { "bridge_with_hole", Test::TestMesh::bridge_with_hole },
+    };
+
+    std::vector<std::pair<std::string, DynamicPrintConfig>> profiles;
+    profiles.emplace_back("default", DynamicPrintConfig::full_print_config());
+    profiles.emplace_back("detail", DynamicPrintConfig::full_print_config_with({
+        { "layer_height",       "0.1" },
+        { "first_layer_height", "0.2" },
+        { "perimeters",         "3" },
+        { "fill_density",       "20%" },
+    }));
+    profiles.emplace_back("supports", DynamicPrintConfig::full_print_config_with({
+        { "support_material",   "1" },
+    }));
+    profiles.emplace_back("arachne", DynamicPrintConfig::full_print_config_with({
+        { "perimeter_generator", "arachne" },
+    }));
+
+    for (const auto &mesh : meshes)
+        for (const auto &profile : profiles)
+            Bench::measure("slice " + mesh.first + " / " + profile.first, 3, [&mesh, &profile]() {
+                const std::string gcode = Test::slice({ mesh.second }, profile.second);
+                REQUIRE(! gcode.empty());
+            });
+}
@@ -0,0 +1,106 @@
+#include <catch2/catch.hpp>
+
+#include "test_data.hpp"
+#include "bench_utils.hpp"
+
+#include "libslic3r/Arachne/WallToolPaths.hpp"
+#include "libslic3r/ClipperUtils.hpp"
+#include "libslic3r/GCode.hpp"
+#include "libslic3r/GCode/CoolingBuffer.hpp"
+#include "libslic3r/PrintConfig.hpp"
+#include "libslic3r/TriangleMesh.hpp"
+#include "libslic3r/TriangleMeshSlicer.hpp"
+#include "libslic3r/libslic3r.h"
+
+using namespace Slic3r;
+
+// Per-subsystem microbenchmarks over the hot paths of the slicing pipeline.
+// See bench_fff_slicing.cpp for the end-to-end matrix and usage notes.
+
+namespace {
+
+// Slices the mesh into per-layer polygons, the common input of the benchmarks below.
+std::vector<Polygons> sliced_layers(const TriangleMesh &mesh, float layer_height)
+{
+    std::vector<float> zs;
+    for (float z = layer_height; z < float(mesh.bounding_box().max.z()); z += layer_height)
+        zs.emplace_back(z);
+    return slice_mesh(mesh.its, zs, MeshSlicingParams{}, [](){});
+}
+
+} // namespace
+
+TEST_CASE("slice_mesh microbenchmark", "[.Benchmarks]") {
+    const TriangleMesh mesh = Test::mesh(Test::TestMesh::ipadstand);
+    std::vector<float> zs;
+    for (float z = 0.15f; z < float(mesh.bounding_box().max.z()); z += 0.15f)
+        zs.emplace_back(z);
+    const MeshSlicingParams params;
+    Bench::measure("slice_mesh ipadstand / 0.15mm", 10, [&]() {
+        const std::vector<Polygons> layers = slice_mesh(mesh.its, zs, params, [](){});
+        REQUIRE(! layers.empty());
+    });
+}
+
+TEST_CASE("ClipperUtils microbenchmarks", "[.Benchmarks]") {
+    const std::vector<Polygons> layers = sliced_layers(Test::mesh(Test::TestMesh::ipadstand), 0.15f);
+
+    Bench::measure("offset all layers by 0.5mm", 10, [&]() {
+        size_t num_polygons = 0;
+        for (const Polygons &layer : layers)
+            num_polygons += offset(layer, scaled<float>(0.5)).size();
+        REQUIRE(num_polygons > 0);
+    });
+
+    Bench::measure("union_ex all layers", 10, [&]() {
+        size_t num_expolygons = 0;
+        for (const Polygons &layer : layers)
+            num_expolygons += union_ex(layer).size();
+        REQUIRE(num_expolygons > 0);
+    });
+}
+
+TEST_CASE("Arachne WallToolPaths microbenchmark", "[.Benchmarks]") {
+    // A sphere provides a different outline on every layer, so the benchmark is
+    // not skewed by the toolpath cache of consecutive identical outlines.
+    const std::vector<Polygons> layers = sliced_layers(Test::mesh(Test::TestMesh::sphere_50mm), 0.3f);
+    const PrintObjectConfig object_config;
+    const PrintConfig       print_config;
+    const coord_t           bead_width = scaled<coord_t>(0.45);
+
+    size_t layer_idx = 0;
+    Bench::measure("Arachne generate, one layer per run", 10, [&]() {
+        Arachne::WallToolPaths wall_tool_paths(layers[layer_idx ++ % layers.size()],
+            bead_width, bead_width, 3, 0, 0.3, object_config, print_config);
+        REQUIRE(! wall_tool_paths.getToolPaths().empty());
+    });
+}
+
+TEST_CASE("CoolingBuffer microbenchmark", "[.Benchmarks]") {
+    GCodeGenerator gcodegen;
+    PrintConfig print_config;
+    print_config.apply(DynamicPrintConfig::full_print_config_with({
+        { "cooling",                   "1" },
+        { "fan_below_layer_time",      "60" },
+        { "slowdown_below_layer_time", "5" },
+    }), true);
+    gcodegen.apply_print_config(print_config);
+    gcodegen.set_layer_count(1000);
+    gcodegen.writer().set_extruders({ 0 });
+    gcodegen.writer().set_extruder(0);
+    CoolingBuffer buffer(gcodegen);
+
+    // A synthetic layer of many short extrusions with speed markers, the shape
+    // of G-code the cooling buffer has to rescale on slowdown.
+    std::string layer_gcode;
+    for (int i = 0; i < 2000; ++ i) {
+        layer_gcode += "G1 F3000;_EXTRUDE_SET_SPEED\n";
+        layer_gcode += "G1 X" + std::to_string(i % 100) + " Y" + std::to_string(i / 100) + " E0.05\n";
+    }
+
+    size_t layer_id = 0;
+    Bench::measure("CoolingBuffer::process_layer, 2000 segments", 20, [&]() {
+        const std::string gcode = buffer.process_layer(layer_gcode, layer_id ++, true);
+        REQUIRE(! gcode.empty());
+    });
+}
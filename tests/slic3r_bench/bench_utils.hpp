@@ -0,0 +1,115 @@
+#ifndef SLIC3R_BENCH_UTILS_HPP
+#define SLIC3R_BENCH_UTILS_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+    #include <psapi.h>
+#else
+    #include <sys/resource.h>
+    #include <sys/time.h>
+#endif
+
+namespace Slic3r { namespace Bench {
+
+// Peak resident set size of this process in bytes (high water mark, monotonic).
+inline size_t peak_rss_bytes()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS pmc;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+        return size_t(pmc.PeakWorkingSetSize);
+    return 0;
+#else
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+    size_t peak = size_t(usage.ru_maxrss);
+    #ifdef __linux__
+        peak *= 1024; // getrusage reports kB on Linux.
+    #endif
+    return peak;
+#endif
+}
+
+// CPU time (user + system, all threads) consumed by this process in seconds.
+inline double cpu_seconds()
+{
+#ifdef _WIN32
+    FILETIME creation, exit, kernel, user;
+    if (! GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user))
+        return 0.;
+    auto to_seconds = [](const FILETIME &ft) {
+        return double((uint64_t(ft.dwHighDateTime) << 32) | ft.dwLowDateTime) * 1e-7;
+    };
+    return to_seconds(kernel) + to_seconds(user);
+#else
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0.;
+    auto to_seconds = [](const timeval &tv) { return double(tv.tv_sec) + double(tv.tv_usec) * 1e-6; };
+    return to_seconds(usage.ru_utime) + to_seconds(usage.ru_stime);
+#endif
+}
+
+struct Result
+{
+    std::string name;
+    size_t      runs;
+    double      wall_ms_median;
+    double      wall_ms_min;
+    // CPU time per run averaged over all runs. With parallel code this exceeds
+    // the wall time; the ratio is the effective parallelism of the benchmark.
+    double      cpu_ms;
+    size_t      peak_rss_bytes;
+};
+
+// Prints a human readable report line and, if the SLIC3R_BENCH_JSON environment
+// variable names a file, appends the result as one JSON object per line
+// (JSON Lines), which is trivial to ingest for trend tracking.
+inline void report(const Result &r)
+{
+    std::printf("[bench] %-52s median %10.2f ms  min %10.2f ms  cpu %10.2f ms  peak RSS %6zu MB  (%zu runs)\n",
+        r.name.c_str(), r.wall_ms_median, r.wall_ms_min, r.cpu_ms, r.peak_rss_bytes >> 20, r.runs);
+    if (const char *path = std::getenv("SLIC3R_BENCH_JSON"); path != nullptr && *path != 0) {
+        std::ofstream out(path, std::ios::app);
+        out << "{\"name\":\"" << r.name << "\",\"runs\":" << r.runs
+            << ",\"wall_ms_median\":" << r.wall_ms_median
+            << ",\"wall_ms_min\":" << r.wall_ms_min
+            << ",\"cpu_ms\":" << r.cpu_ms
+            << ",\"peak_rss_bytes\":" << r.peak_rss_bytes << "}\n";
+    }
+}
+
+// Runs fn() the given number of times and reports median / minimum wall time,
+// per-run CPU time and the process peak RSS. The median is robust against a
+// one-off scheduling hiccup; the minimum approximates the noise-free cost.
+template<class Fn>
+void measure(const std::string &name, size_t runs, Fn &&fn)
+{
+    std::vector<double> wall_ms;
+    wall_ms.reserve(runs);
+    const double cpu_start = cpu_seconds();
+    for (size_t i = 0; i < runs; ++ i) {
+        const auto t0 = std::chrono::steady_clock::now();
+        fn();
+        wall_ms.emplace_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count());
+    }
+    const double cpu_ms = (cpu_seconds() - cpu_start) * 1000. / double(runs);
+    std::sort(wall_ms.begin(), wall_ms.end());
+    report({ name, runs, wall_ms[wall_ms.size() / 2], wall_ms.front(), cpu_ms, peak_rss_bytes() });
+}
+
+} } // namespace Slic3r::Bench
+
+#endif // SLIC3R_BENCH_UTILS_HPP
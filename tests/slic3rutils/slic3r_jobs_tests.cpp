@@ -1,7 +1,9 @@
 #include "catch2/catch.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <thread>
+#include <vector>
 
 #include "slic3r/GUI/Jobs/BoostThreadWorker.hpp"
 #include "slic3r/GUI/Jobs/UIThreadWorker.hpp"
@@ -152,6 +154,84 @@ TEMPLATE_LIST_TEST_CASE("cancel_all should remove all pending jobs", "[Jobs]", T
     REQUIRE(jobres[3] == false);
 }
 
+TEMPLATE_LIST_TEST_CASE("High priority jobs should overtake the queued normal jobs", "[Jobs]", TestClasses) {
+    using namespace Slic3r;
+    using namespace Slic3r::GUI;
+
+    auto pri = std::make_shared<Progress>();
+    TestType worker{pri};
+
+    std::vector<int> order;
+
+    queue_job(worker, [&order](Job::Ctl &) {
+        order.emplace_back(0);
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    });
+    queue_job(worker, [&order](Job::Ctl &) { order.emplace_back(1); });
+    queue_job(worker, [&order](Job::Ctl &) { order.emplace_back(2); });
+
+    struct PriorityJob: Job {
+        std::vector<int> &order;
+        explicit PriorityJob(std::vector<int> &o): order{o} {}
+        void process(Ctl &) override { order.emplace_back(3); }
+    };
+
+    worker.push(std::make_unique<PriorityJob>(order), JobPriority::High);
+
+    worker.wait_for_idle();
+
+    REQUIRE(order.size() == 4);
+    auto pos_of = [&order](int id) {
+        return std::find(order.begin(), order.end(), id) - order.begin();
+    };
+    REQUIRE(pos_of(3) < pos_of(1));
+    REQUIRE(pos_of(3) < pos_of(2));
+}
+
+TEMPLATE_LIST_TEST_CASE("Chained jobs should run in order and stop on error", "[Jobs]", TestClasses) {
+    using namespace Slic3r;
+    using namespace Slic3r::GUI;
+
+    struct RecJob: Job {
+        std::vector<int> &order;
+        int  id;
+        bool do_throw;
+        RecJob(std::vector<int> &o, int i, bool t = false)
+            : order{o}, id{i}, do_throw{t}
+        {}
+        void process(Ctl &) override
+        {
+            order.emplace_back(id);
+            if (do_throw)
+                throw std::runtime_error("chain");
+        }
+        void finalize(bool /*canceled*/, std::exception_ptr &eptr) override
+        {
+            if (do_throw) {
+                REQUIRE(eptr != nullptr);
+                eptr = nullptr;
+            }
+        }
+    };
+
+    auto pri = std::make_shared<Progress>();
+    TestType worker{pri};
+
+    std::vector<int> order;
+
+    std::vector<std::unique_ptr<Job>> chain;
+    chain.emplace_back(std::make_unique<RecJob>(order, 1));
+    chain.emplace_back(std::make_unique<RecJob>(order, 2, /*do_throw=*/true));
+    chain.emplace_back(std::make_unique<RecJob>(order, 3));
+
+    queue_job_chain(worker, std::move(chain));
+
+    worker.wait_for_idle();
+
+    // The third link is not reached, its predecessor has thrown.
+    REQUIRE(order == std::vector<int>{1, 2});
+}
+
 TEMPLATE_LIST_TEST_CASE("Exception should be properly forwarded to finalize()", "[Jobs]", TestClasses) {
     using namespace Slic3r;
     using namespace Slic3r::GUI;